@@ -0,0 +1,110 @@
+# Builds the host-native motion simulator.
+#
+# The firmware's motion core (planner, stepper, endstops and the G-code parser) is compiled unmodified with the host
+# compiler against the fake AVR headers in ./include. LTO is required, just as it is for the firmware itself, as many
+# of the __forceinline functions are defined in other translation units.
+#
+#   ruby build.rb            # builds ./build/simulator
+#   CXX=clang++ ruby build.rb
+#   ruby build.rb -DPLANNER_FIXED_POINT -o simulator-fixed
+#
+# Extra -D options are passed to every compile, so configuration options can be toggled without editing the firmware's
+# configuration. Each output name gets its own object directory.
+
+require 'fileutils'
+
+$ROOT = File.expand_path(File.dirname(__FILE__))
+$TUNA = File.expand_path($ROOT + "/../Tuna")
+$BUILD = $ROOT + "/build"
+
+$DEFINES = []
+$OUTPUT = "simulator"
+
+args = ARGV.dup
+while (arg = args.shift)
+	if (arg.start_with?("-D"))
+		$DEFINES << arg
+	elsif (arg == "-o" && args.length != 0)
+		$OUTPUT = args.shift
+	else
+		raise ArgumentError.new("usage: build.rb [-DNAME[=VALUE]...] [-o output]")
+	end
+end
+
+$OBJECTS = ($OUTPUT == "simulator") ? $BUILD : ($BUILD + "/" + $OUTPUT + ".obj")
+
+def gpp_path
+	return ENV["CXX"] || "g++"
+end
+
+$FIRMWARE_SOURCES = [
+	"planner.cpp",
+	"stepper.cpp",
+	"endstops.cpp",
+	"gcode.cpp",
+	"planner_arc.cpp",
+	"planner_bezier.cpp",
+	"isr_profile.cpp",
+	"step_record.cpp",
+	"binary_protocol.cpp",
+	"command_queue.cpp",
+	"line_assembler.cpp",
+	"serial_tx.cpp",
+	"baud_switch.cpp",
+	"arduino/Print.cpp"
+].map { |source| $TUNA + "/" + source }
+
+$SIMULATOR_SOURCES = Dir.glob($ROOT + "/*.cpp")
+
+def buildline()
+	buildopts = [
+		"-O2",
+		"-w",
+		"-std=gnu++17",
+		"-fpermissive",
+		"-fno-exceptions",
+		"-fno-threadsafe-statics",
+		"-funsigned-char",
+		"-funsigned-bitfields",
+		"-flto",
+		"-fno-fat-lto-objects",
+		"-D__AVR_ATmega2560__",
+		"-DF_CPU=16000000L",
+		"-DARDUINO=10804",
+		"-DARDUINO_AVR_MEGA2560",
+		"-DARDUINO_ARCH_AVR",
+		"-include sim/avr_builtins.h",
+		"-I\"#{$ROOT}/include\"",
+		"-I\"#{$TUNA}/arduino\"",
+		"-I\"#{$TUNA}\""
+	] + $DEFINES
+
+	return_opts = ""
+	buildopts.each { |opt|
+		if (opt.length)
+			return_opts += opt + " "
+		end
+	}
+	return return_opts.chomp
+end
+
+def run(command)
+	puts command
+	STDOUT.flush
+
+	system(command)
+	if ($? != 0)
+		raise RuntimeError.new("Command failed - return code #{$?.to_s}")
+	end
+end
+
+def compile(source)
+	object = $OBJECTS + "/" + File.basename(source) + ".o"
+	run(gpp_path() + " " + buildline() + " -c \"#{source}\" -o \"#{object}\"")
+	return object
+end
+
+FileUtils.mkdir_p $OBJECTS
+
+objects = ($FIRMWARE_SOURCES + $SIMULATOR_SOURCES).map { |source| compile(source) }
+run(gpp_path() + " -O2 -flto " + objects.map { |object| "\"#{object}\"" }.join(" ") + " -o \"#{$BUILD}/#{$OUTPUT}\"")
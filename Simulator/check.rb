@@ -0,0 +1,145 @@
+# Builds the simulator in each configuration the firmware's motion and serial options are checked in, and runs the G-code
+# corpus (./corpus, written by corpus.rb) through every build, as it is and with stepper ISRs preempting the planner.
+# Then runs the tests: one feature each, in one of those builds or comparing two, from a file in ./tests or the corpus.
+#
+#   ruby check.rb                  # every configuration and test
+#   ruby check.rb default arcs     # only these configurations, and their tests
+#   ruby check.rb baud             # only this test
+#   ruby check.rb -k               # reuse builds that are already there
+#
+# A configuration passes when validate.rb reports no failing file. A test passes when the simulator exits with 0 and its
+# summary has the line the test expects, or, for a test that compares runs, when its lambda is satisfied with their
+# summaries and output. The exit status is the number of configurations and tests that failed.
+
+require "tmpdir"
+
+$ROOT = File.expand_path(File.dirname(__FILE__))
+
+$CONFIGURATIONS = {
+	"default" => [],
+	"fixed" => ["-DPLANNER_FIXED_POINT", "-DS_CURVE_ACCELERATION"],
+	"tables" => ["-DSTEPPER_RAMP_TABLES", "-DBATCHED_STEP_PULSES"],
+	"cache" => ["-DSTEPPER_RAMP_CACHE"],
+	"multirate" => ["-DMULTI_RATE_STEPPING", "-DISR_PROFILING"],
+	"shaping" => ["-DINPUT_SHAPING"],
+	"arcs" => ["-DNATIVE_ARCS"],
+	"merging" => ["-DSEGMENT_MERGING", "-DJUNCTION_DEVIATION"],
+	"endstops" => ["-DENDSTOP_INTERRUPTS_FEATURE", "-DX_STOP_PIN=10", "-DY_STOP_PIN=11", "-DZ_STOP_PIN=12"],
+	"serial" => ["-DBINARY_PROTOCOL", "-DPREPARSED_COMMANDS", "-DRX_LINE_ASSEMBLER", "-DSERIAL_TX_LANES", "-DBAUD_SWITCHING"]
+}
+
+# name => [configuration, simulator arguments (.gcode files are in ./tests, unless named from here, as corpus/...),
+#          summary line expected], or
+#         [configuration or configurations, lambda given for each a lambda that runs its simulator with arguments and
+#          returns its summary (nil if it failed), returning the line to report or nil if the test failed]
+$TESTS = {
+	"baud" => ["serial", ["-L", "115200:250000", "baud.gcode"],
+		/^baud switching: 3 switches, 2 confirmed, 1 fell back, 1 lines sent again, 0 unsupported$/],
+	# Five arcs planned, the sixth too short to: in segments, and whole.
+	"arc-segments" => ["default", ["arcs.gcode"], /^arcs: 0 native, 5 segmented$/],
+	"arc-native" => ["arcs", ["arcs.gcode"], /^arcs: 5 native, 0 segmented$/],
+	"assembler" => ["serial", ["-A"], /^line assembler: 10 streams, 0 failed$/],
+	# Shaped at 40 Hz without damping, the moves keep less than 4% of their 40 Hz content (3.0% of X and 1.2% of Y; with
+	# the steps of a shaping entry echoed as one burst, 4.7% and 2.0%).
+	"spectrum" => ["shaping", lambda { |simulate|
+		shaped, unshaped = ["spectrum.gcode", "spectrum-off.gcode"].map { |file|
+			summary = simulate.call("-F", "40", file)
+			summary && summary[/^ +40\.00 Hz: X (\S+) Y (\S+)$/] && [$1.to_f, $2.to_f]
+		}
+		next nil if (!shaped || !unshaped)
+		ratios = [0, 1].map { |axis| shaped[axis] / unshaped[axis] }
+		line = format("40 Hz shaped/unshaped: X %.4f Y %.4f", *ratios)
+		next line if (ratios.all? { |ratio| ratio < 0.04 })
+		puts "  " + line
+		nil
+	}]
+}
+
+$PREEMPT_SEED = "1"
+
+def run(*command)
+	puts command.join(" ")
+	STDOUT.flush
+	system(*command)
+	return $?.exitstatus
+end
+
+keep = false
+names = []
+tests = []
+ARGV.each { |arg|
+	if (arg == "-k")
+		keep = true
+	elsif ($CONFIGURATIONS.key?(arg))
+		names << arg
+	elsif ($TESTS.key?(arg))
+		tests << arg
+	else
+		raise ArgumentError.new("usage: check.rb [-k] [#{($CONFIGURATIONS.keys + $TESTS.keys).join("|")}...]")
+	end
+}
+if (names.empty? && tests.empty?)
+	names = $CONFIGURATIONS.keys
+	tests = $TESTS.keys
+else
+	tests |= $TESTS.keys.select { |test| !(names & [*$TESTS[test][0]]).empty? }
+end
+
+built = {}
+build = lambda { |name|
+	output = "check-" + name
+	if (!built.key?(name))
+		built[name] = (keep && File.executable?($ROOT + "/build/" + output)) ||
+			run("ruby", $ROOT + "/build.rb", *$CONFIGURATIONS[name], "-o", output, :out => File::NULL) == 0
+	end
+	built[name] ? output : nil
+}
+
+failed = []
+names.each { |name|
+	output = build.call(name)
+	if (!output)
+		failed << name + " (build)"
+		next
+	end
+	status = run("ruby", $ROOT + "/validate.rb", "-s", output, $ROOT + "/corpus")
+	status = run("ruby", $ROOT + "/validate.rb", "-s", output, "-S", $PREEMPT_SEED, $ROOT + "/corpus") if (status == 0)
+	failed << name if (status != 0)
+}
+
+tests.each { |test|
+	configurations, args, expected = $TESTS[test]
+	outputs = [*configurations].map { |configuration| build.call(configuration) }
+	if (outputs.include?(nil))
+		failed << test + " (build)"
+		next
+	end
+	simulators = outputs.map { |output|
+		lambda { |*arguments|
+			files = arguments.map { |arg| arg.end_with?(".gcode") ? $ROOT + (arg.include?("/") ? "/" : "/tests/") + arg : arg }
+			command = [$ROOT + "/build/" + output, "-n", *files]
+			puts command.join(" ")
+			STDOUT.flush
+			summary = IO.popen([*command, :err => [:child, :out]]) { |io| io.read }
+			next summary if ($?.exitstatus == 0)
+			puts "  exit status #{$?.exitstatus.inspect}"
+			summary.lines.grep(/^validation: /).first(8).each { |line| puts "  " + line }
+			nil
+		}
+	}
+	simulate = simulators.first
+	if (args.is_a?(Proc))
+		line = args.call(*simulators)
+		puts "#{test}: #{line ? "passed, " + line : "FAILED"}"
+		failed << test if (!line)
+		next
+	end
+	summary = simulate.call(*args)
+	passed = summary && summary.lines.any? { |line| line =~ expected }
+	puts "#{test}: #{passed ? "passed" : "FAILED"}"
+	summary.lines.grep(/#{expected.source.split(":").first.delete("^")}/).first(8).each { |line| puts "  " + line } if (summary && !passed)
+	failed << test if (!passed)
+}
+
+puts "#{names.length} configurations, #{tests.length} tests, #{failed.length} failed#{failed.empty? ? "" : ": " + failed.join(", ")}"
+exit [failed.length, 255].min
@@ -0,0 +1,240 @@
+# Writes the G-code corpus the simulator is validated against (./corpus), from fixed seeds, so every build can be run
+# over the same moves:
+#
+#   ruby corpus.rb
+#
+# lines       a small print: homing, perimeters, infill, travel and retractions
+# curves      polygonal circles, spirals and random travel at 2-degree segments, as a slicer writes curved walls
+# micro       0.05-0.1 mm squares and circles, far shorter than a block takes to plan
+# home        full and single-axis G28s, with moves in between
+# overrides   M220, M221, G92 and M410 in the middle of a print, with moves queued behind the quick stop
+# drain       moves separated by dwells and M400, so the buffer keeps running dry
+# arcs        G2/G3 circles from r=2 to 40 mm, 3/4 arcs, R-form S-bends and a helix
+# bezier      random G5 curves
+# shaping     random X/Y moves at 3000 mm/s^2, with M593 left at its default
+#
+# The files are committed; rerun this only to change them.
+
+require 'fileutils'
+
+$ROOT = File.expand_path(File.dirname(__FILE__))
+$CORPUS = $ROOT + "/corpus"
+
+def mm(value)
+	return format("%.3f", value)
+end
+
+def write_corpus(name)
+	lines = []
+	yield lines
+	File.write($CORPUS + "/" + name + ".gcode", lines.join("\n") + "\n")
+end
+
+# A print head laying down filament: tracks E and writes G1s with it.
+class Extruder
+	attr_reader :x, :y
+
+	def initialize(lines, x, y)
+		@lines = lines
+		@x = x
+		@y = y
+		@e = 0.0
+	end
+
+	def travel(x, y, f = 6000)
+		@lines << "G0 X#{mm(x)} Y#{mm(y)} F#{f}"
+		@x = x
+		@y = y
+	end
+
+	def extrude(x, y, f = 1800, per_mm = 0.033)
+		@e += Math.hypot(x - @x, y - @y) * per_mm
+		@lines << "G1 X#{mm(x)} Y#{mm(y)} E#{format("%.5f", @e)} F#{f}"
+		@x = x
+		@y = y
+	end
+
+	def retract(length = 1.5)
+		@e -= length
+		@lines << "G1 E#{format("%.5f", @e)} F2400"
+		@e += length
+		yield
+		@lines << "G1 E#{format("%.5f", @e)} F2400"
+	end
+end
+
+FileUtils.mkdir_p($CORPUS)
+
+write_corpus("lines") { |lines|
+	lines << "G28" << "G90" << "M82" << "G92 E0" << "G1 Z0.3 F600"
+	head = Extruder.new(lines, 0.0, 0.0)
+	4.times { |layer|
+		lines << "G1 Z#{mm(0.3 + layer * 0.2)} F600"
+		[40.0, 38.0, 36.0].each { |half|
+			head.retract { head.travel(100.0 - half, 97.0 - half) }
+			head.extrude(100.0 + half, 97.0 - half)
+			head.extrude(100.0 + half, 97.0 + half)
+			head.extrude(100.0 - half, 97.0 + half)
+			head.extrude(100.0 - half, 97.0 - half)
+		}
+		y = 62.0
+		while (y < 132.0)
+			head.extrude(65.0, y + 0.4, 3000)
+			head.extrude(135.0, y + 0.4, 3000)
+			y += 0.8
+			head.extrude(135.0, y + 0.4, 3000)
+			head.extrude(65.0, y + 0.4, 3000)
+			y += 0.8
+		end
+	}
+	lines << "M400"
+}
+
+write_corpus("curves") { |lines|
+	random = Random.new(1)
+	lines << "G28" << "G92 E0" << "G90" << "M82" << "G1 Z0.3 F600"
+	head = Extruder.new(lines, 0.0, 0.0)
+	4.times { |layer|
+		radius = 40.0 - layer * 2.5
+		head.travel(100.0 + radius, 100.0, 6000)
+		(1..180).each { |i|
+			angle = i * Math::PI / 90.0
+			head.extrude(100.0 + radius * Math.cos(angle), 100.0 + radius * Math.sin(angle), 3000)
+		}
+		# An outward spiral at the same 2 degrees a segment.
+		(1..360).each { |i|
+			angle = i * Math::PI / 90.0
+			r = 5.0 + i * 0.06
+			head.extrude(100.0 + r * Math.cos(angle), 100.0 + r * Math.sin(angle), 2400)
+		}
+		12.times { head.extrude(40.0 + random.rand * 120.0, 40.0 + random.rand * 110.0, 2400) }
+	}
+	lines << "M400"
+}
+
+write_corpus("micro") { |lines|
+	lines << "G28" << "G92 E0" << "G90" << "M82" << "G1 Z0.3 F600"
+	head = Extruder.new(lines, 0.0, 0.0)
+	head.travel(60.0, 60.0)
+	x = 60.0
+	10.times { |square|
+		side = 2.0 + square * 0.1
+		step = 0.05 + (square % 6) * 0.01
+		[[1, 0], [0, 1], [-1, 0], [0, -1]].each { |dx, dy|
+			(side / step).round.times {
+				x += dx * step
+				head.extrude(x, head.y + dy * step, 1800)
+			}
+		}
+	}
+	head.travel(120.0, 100.0)
+	2.times { |circle|
+		radius = 3.0 + circle
+		segments = (2.0 * Math::PI * radius / 0.08).round
+		(1..segments).each { |i|
+			angle = 2.0 * Math::PI * i / segments
+			head.extrude(117.0 - circle + radius * Math.cos(angle), 100.0 + radius * Math.sin(angle), 2400)
+		}
+	}
+	lines << "M400"
+}
+
+write_corpus("home") { |lines|
+	lines << "G28" << "G90" << "G1 X50 Y60 Z10 F6000" << "G28"
+	lines << "G1 X120 Y80 Z5 F6000" << "G28 X" << "G1 X30 F6000" << "G28 Y"
+	lines << "G1 Y90 Z20 F6000" << "G28 Z" << "G1 X80 Y40 Z2 F3000" << "G28" << "G1 X10 Y10 Z1 F3000" << "M400"
+}
+
+write_corpus("overrides") { |lines|
+	lines << "G28" << "G90" << "M82" << "G92 E0" << "G1 Z0.3 F600"
+	head = Extruder.new(lines, 0.0, 0.0)
+	head.travel(50.0, 50.0)
+	square = lambda { |size|
+		head.extrude(50.0 + size, 50.0)
+		head.extrude(50.0 + size, 50.0 + size)
+		head.extrude(50.0, 50.0 + size)
+		head.extrude(50.0, 50.0)
+	}
+	square.call(40.0)
+	lines << "M220 S150"
+	square.call(38.0)
+	lines << "M221 S90"
+	square.call(36.0)
+	lines << "M220 S50" << "M221 S110"
+	square.call(34.0)
+	lines << "M220 S100" << "M221 S100"
+	lines << "G92 E0"
+	head = Extruder.new(lines, 50.0, 50.0)
+	square.call(32.0)
+	lines << "G92 X60 Y60"
+	head = Extruder.new(lines, 60.0, 60.0)
+	head.travel(90.0, 90.0)
+	# A quick stop in the middle of the next moves, and moves queued behind it.
+	lines << "G1 X150 Y90 F1200" << "G1 X150 Y150 F1200" << "M410"
+	lines << "G1 X100 Y100 F3000" << "G1 X110 Y120 F3000" << "G4 P6000"
+	lines << "G1 X60 Y60 F6000" << "G1 X70 Y80 Z1 F6000" << "M410" << "G1 X20 Y30 F6000"
+	lines << "G4 P6000" << "G1 X40 Y40 F6000" << "G28" << "G1 X10 Y10 F6000" << "M400"
+}
+
+write_corpus("drain") { |lines|
+	random = Random.new(2)
+	lines << "G28" << "G90" << "M82" << "G92 E0" << "G1 Z0.3 F600"
+	head = Extruder.new(lines, 0.0, 0.0)
+	40.times { |i|
+		(1 + random.rand(4)).times { head.extrude(20.0 + random.rand * 160.0, 20.0 + random.rand * 150.0, 1200 + random.rand(4800)) }
+		lines << ((i % 3 == 0) ? "M400" : "G4 P#{random.rand(50)}")
+	}
+	lines << "M400"
+}
+
+write_corpus("arcs") { |lines|
+	lines << "G28" << "G90" << "M82" << "G92 E0" << "G1 Z0.3 F600"
+	e = 0.0
+	[2.0, 5.0, 10.0, 20.0, 40.0].each_with_index { |radius, i|
+		f = [1800, 3000, 1800, 2400, 1800][i]
+		lines << "G0 X#{mm(100.0 + radius)} Y100 F6000"
+		e += 2.0 * Math::PI * radius * 0.033
+		lines << "G2 X#{mm(100.0 + radius)} Y100 I#{mm(-radius)} J0 E#{format("%.5f", e)} F#{f}"
+		e += 1.5 * Math::PI * radius * 0.033
+		lines << "G3 X100 Y#{mm(100.0 + radius)} I#{mm(-radius)} J0 E#{format("%.5f", e)} F#{f}"
+	}
+	lines << "G0 X40 Y40 F6000"
+	4.times { |i|
+		e += Math::PI * 10.0 * 0.5 * 0.033
+		lines << "G#{2 + i % 2} X#{40 + (i + 1) * 10} Y40 R5 E#{format("%.5f", e)} F2400"
+		lines << "G#{3 - i % 2} X#{40 + (i + 1) * 10} Y50 R-7.5 F2400"
+		lines << "G1 Y40 F2400"
+	}
+	lines << "G0 X130 Y150 Z1 F6000"
+	4.times { |turn|
+		lines << "G2 X130 Y150 Z#{mm(1.0 + (turn + 1) * 0.5)} I0 J-15 F1800"
+	}
+	lines << "M400"
+}
+
+write_corpus("bezier") { |lines|
+	random = Random.new(3)
+	lines << "G28" << "G90" << "M82" << "G92 E0" << "G1 Z0.3 F600" << "G0 X100 Y100 F6000"
+	x = 100.0
+	y = 100.0
+	e = 0.0
+	200.times {
+		nx = 40.0 + random.rand * 120.0
+		ny = 40.0 + random.rand * 110.0
+		e += Math.hypot(nx - x, ny - y) * 0.04
+		control = Array.new(4) { (random.rand - 0.5) * 40.0 }
+		lines << "G5 I#{mm(control[0])} J#{mm(control[1])} P#{mm(control[2])} Q#{mm(control[3])} X#{mm(nx)} Y#{mm(ny)} E#{format("%.4f", e)} F#{1800 + random.rand(3000)}"
+		x = nx
+		y = ny
+	}
+	lines << "M400"
+}
+
+write_corpus("shaping") { |lines|
+	random = Random.new(4)
+	lines << "G28" << "G90" << "M204 S3000" << "M201 X3000 Y3000" << "G1 X100 Y100 F6000"
+	300.times {
+		lines << "G1 X#{mm(60.0 + random.rand * 80.0)} Y#{mm(60.0 + random.rand * 70.0)} F#{3000 + random.rand(6000)}"
+	}
+	lines << "M400"
+}
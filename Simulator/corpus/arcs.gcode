@@ -0,0 +1,39 @@
+G28
+G90
+M82
+G92 E0
+G1 Z0.3 F600
+G0 X102.000 Y100 F6000
+G2 X102.000 Y100 I-2.000 J0 E0.41469 F1800
+G3 X100 Y102.000 I-2.000 J0 E0.72571 F1800
+G0 X105.000 Y100 F6000
+G2 X105.000 Y100 I-5.000 J0 E1.76243 F3000
+G3 X100 Y105.000 I-5.000 J0 E2.53998 F3000
+G0 X110.000 Y100 F6000
+G2 X110.000 Y100 I-10.000 J0 E4.61343 F1800
+G3 X100 Y110.000 I-10.000 J0 E6.16852 F1800
+G0 X120.000 Y100 F6000
+G2 X120.000 Y100 I-20.000 J0 E10.31542 F2400
+G3 X100 Y120.000 I-20.000 J0 E13.42560 F2400
+G0 X140.000 Y100 F6000
+G2 X140.000 Y100 I-40.000 J0 E21.71940 F1800
+G3 X100 Y140.000 I-40.000 J0 E27.93975 F1800
+G0 X40 Y40 F6000
+G2 X50 Y40 R5 E28.45812 F2400
+G3 X50 Y50 R-7.5 F2400
+G1 Y40 F2400
+G3 X60 Y40 R5 E28.97648 F2400
+G2 X60 Y50 R-7.5 F2400
+G1 Y40 F2400
+G2 X70 Y40 R5 E29.49484 F2400
+G3 X70 Y50 R-7.5 F2400
+G1 Y40 F2400
+G3 X80 Y40 R5 E30.01321 F2400
+G2 X80 Y50 R-7.5 F2400
+G1 Y40 F2400
+G0 X130 Y150 Z1 F6000
+G2 X130 Y150 Z1.500 I0 J-15 F1800
+G2 X130 Y150 Z2.000 I0 J-15 F1800
+G2 X130 Y150 Z2.500 I0 J-15 F1800
+G2 X130 Y150 Z3.000 I0 J-15 F1800
+M400
@@ -0,0 +1,207 @@
+G28
+G90
+M82
+G92 E0
+G1 Z0.3 F600
+G0 X100 Y100 F6000
+G5 I-8.364 J0.433 P15.718 Q15.852 X106.096 Y117.896 E0.7562 F3505
+G5 I-2.368 J-18.805 P-1.727 Q5.966 X64.869 Y45.661 E4.0831 F2137
+G5 I16.532 J10.633 P18.946 Q-3.906 X82.469 Y94.190 E6.1480 F3433
+G5 I-2.382 J-13.725 P1.786 Q11.213 X74.023 Y116.245 E7.0926 F3629
+G5 I8.737 J-19.175 P-14.291 Q-6.988 X70.910 Y138.237 E7.9811 F2074
+G5 I-3.451 J11.486 P8.543 Q-19.075 X87.879 Y86.717 E10.1508 F1917
+G5 I4.385 J-11.866 P6.145 Q6.507 X107.532 Y122.297 E11.7767 F2810
+G5 I-1.815 J-11.784 P-11.945 Q0.561 X74.019 Y70.578 E14.2418 F4345
+G5 I-5.506 J0.644 P-1.707 Q12.334 X123.116 Y89.049 E16.3401 F3320
+G5 I-6.406 J2.912 P-6.968 Q-2.194 X84.832 Y113.495 E18.1570 F3319
+G5 I-10.777 J7.659 P6.019 Q8.958 X69.121 Y146.876 E19.6328 F3892
+G5 I17.029 J-8.907 P-12.958 Q19.612 X150.164 Y62.766 E24.3048 F3610
+G5 I-16.560 J6.625 P-6.817 Q-5.534 X130.257 Y52.784 E25.1956 F3305
+G5 I13.568 J9.053 P-0.790 Q13.684 X71.666 Y141.940 E29.4630 F3488
+G5 I11.429 J-8.664 P15.276 Q1.815 X132.729 Y138.615 E31.9091 F2289
+G5 I11.397 J18.884 P14.039 Q1.744 X63.049 Y119.824 E34.7959 F4048
+G5 I-8.064 J-9.248 P15.476 Q0.130 X100.304 Y58.960 E37.6503 F4399
+G5 I15.696 J5.607 P-14.267 Q-3.435 X61.266 Y48.099 E39.2711 F3603
+G5 I-9.930 J15.909 P13.410 Q-14.147 X70.865 Y70.431 E40.2434 F1813
+G5 I-0.327 J-14.814 P14.402 Q-11.264 X82.687 Y100.184 E41.5241 F2276
+G5 I-9.586 J7.679 P15.823 Q-6.372 X140.495 Y58.704 E44.3701 F3091
+G5 I9.643 J-13.679 P7.799 Q13.657 X143.694 Y71.996 E44.9170 F2665
+G5 I-3.764 J1.539 P5.983 Q-7.602 X150.383 Y50.437 E45.8199 F3326
+G5 I11.959 J18.865 P-5.292 Q-11.802 X58.449 Y136.814 E50.8658 F2858
+G5 I-15.763 J-8.548 P8.544 Q-10.463 X138.345 Y73.275 E54.9490 F3732
+G5 I-11.362 J13.270 P13.932 Q-7.414 X144.662 Y50.134 E55.9085 F4322
+G5 I5.723 J11.295 P11.750 Q-4.763 X67.775 Y88.795 E59.3508 F3317
+G5 I14.169 J18.777 P8.806 Q-3.596 X52.679 Y88.290 E59.9550 F2421
+G5 I9.709 J-7.813 P0.671 Q-13.750 X45.460 Y46.121 E61.6663 F3558
+G5 I-9.503 J12.113 P16.031 Q-5.557 X101.954 Y80.533 E64.3124 F2472
+G5 I-14.967 J19.717 P-2.659 Q4.668 X65.547 Y86.229 E65.7864 F4692
+G5 I-4.075 J11.544 P4.698 Q3.661 X75.203 Y89.974 E66.2006 F3341
+G5 I-0.820 J-19.970 P-18.788 Q-1.538 X66.799 Y66.728 E67.1894 F3015
+G5 I19.441 J-3.095 P9.206 Q4.608 X49.095 Y70.179 E67.9109 F4539
+G5 I-14.631 J-10.891 P12.591 Q-9.427 X84.638 Y105.670 E69.9200 F4650
+G5 I-14.188 J8.081 P2.683 Q4.464 X152.317 Y70.311 E72.9744 F4031
+G5 I-15.977 J0.077 P12.040 Q-17.185 X79.152 Y104.232 E76.2002 F3086
+G5 I1.344 J13.778 P4.694 Q19.781 X122.833 Y53.657 E78.8733 F2798
+G5 I-18.317 J14.678 P7.040 Q-2.163 X60.702 Y131.128 E82.8456 F3623
+G5 I-6.387 J-12.349 P2.655 Q-18.919 X139.584 Y109.825 E86.1139 F3172
+G5 I16.160 J-6.179 P-17.725 Q8.595 X66.440 Y67.712 E89.4900 F4549
+G5 I-16.457 J-2.739 P16.575 Q10.566 X125.910 Y126.795 E92.8431 F4662
+G5 I15.830 J-9.992 P16.793 Q14.504 X120.255 Y126.772 E93.0694 F3453
+G5 I10.485 J-13.071 P1.353 Q-14.943 X108.148 Y52.643 E96.0738 F2251
+G5 I-18.260 J-9.099 P5.154 Q3.876 X115.955 Y127.031 E99.0657 F3828
+G5 I6.026 J1.727 P2.295 Q14.742 X115.745 Y103.467 E100.0083 F4004
+G5 I-2.006 J-3.503 P18.669 Q-17.840 X61.480 Y116.918 E102.2446 F4073
+G5 I-11.335 J0.650 P2.808 Q12.958 X40.255 Y63.068 E104.5599 F4528
+G5 I5.020 J6.819 P15.886 Q7.271 X154.723 Y137.068 E110.0120 F2232
+G5 I-14.176 J1.497 P19.831 Q-18.038 X152.511 Y124.662 E110.5161 F4301
+G5 I-17.011 J-4.150 P-4.549 Q-6.454 X116.636 Y103.240 E112.1875 F3881
+G5 I-3.617 J4.032 P-18.574 Q-3.455 X104.633 Y118.983 E112.9794 F3868
+G5 I-15.173 J-12.290 P9.047 Q1.759 X56.594 Y44.578 E116.5220 F2280
+G5 I-4.301 J19.958 P12.812 Q2.914 X95.744 Y40.736 E118.0955 F3238
+G5 I15.363 J-0.753 P-10.912 Q10.710 X66.481 Y133.622 E121.9910 F3197
+G5 I-18.515 J19.934 P5.426 Q-2.986 X60.292 Y73.315 E124.4160 F2195
+G5 I10.221 J-4.471 P-13.901 Q16.211 X75.032 Y72.124 E125.0075 F3113
+G5 I-1.564 J-4.906 P4.724 Q15.553 X43.317 Y51.328 E126.5245 F4220
+G5 I8.780 J-0.772 P-16.631 Q-5.455 X89.486 Y140.489 E130.5407 F3476
+G5 I-1.157 J-18.235 P0.497 Q6.647 X151.675 Y123.976 E133.1144 F4420
+G5 I-3.035 J-1.762 P14.940 Q-5.488 X129.444 Y120.297 E134.0158 F3891
+G5 I-17.053 J1.157 P-14.670 Q-16.416 X131.265 Y74.835 E135.8357 F2324
+G5 I-1.783 J-16.728 P-8.349 Q-14.204 X103.235 Y77.562 E136.9622 F4651
+G5 I16.955 J-18.408 P15.549 Q-13.804 X93.597 Y50.704 E138.1036 F3671
+G5 I7.820 J4.208 P14.136 Q18.517 X47.326 Y59.554 E139.9880 F4675
+G5 I4.690 J1.837 P0.054 Q18.166 X83.129 Y55.860 E141.4278 F2334
+G5 I15.794 J2.320 P-19.411 Q12.222 X123.727 Y146.233 E145.3907 F3566
+G5 I-13.456 J-8.136 P5.430 Q-11.130 X143.919 Y93.128 E147.6633 F2718
+G5 I12.922 J-4.332 P-15.729 Q-13.048 X99.857 Y47.713 E150.1943 F3519
+G5 I6.589 J-18.691 P17.530 Q-8.096 X47.243 Y134.494 E154.2537 F2120
+G5 I-1.929 J10.552 P13.948 Q-9.230 X46.869 Y106.207 E155.3853 F2450
+G5 I-6.097 J3.787 P-14.864 Q0.419 X107.900 Y75.540 E158.1174 F4378
+G5 I13.381 J-12.980 P-10.542 Q-13.421 X80.989 Y75.402 E159.1938 F3050
+G5 I17.674 J-8.704 P13.793 Q-0.300 X96.995 Y135.371 E161.6765 F4260
+G5 I5.972 J-16.815 P13.540 Q-15.770 X103.419 Y100.353 E163.1006 F4232
+G5 I11.013 J-8.941 P-13.896 Q13.558 X105.015 Y137.846 E164.6016 F2077
+G5 I-19.281 J7.130 P16.002 Q-13.702 X46.706 Y136.669 E166.9345 F2937
+G5 I-12.710 J8.384 P6.801 Q-2.479 X127.671 Y56.708 E171.4862 F2133
+G5 I7.747 J10.504 P6.387 Q11.769 X74.877 Y122.563 E174.8623 F1853
+G5 I-8.750 J-10.931 P19.039 Q5.995 X130.217 Y57.242 E178.2868 F1902
+G5 I16.553 J18.972 P9.935 Q19.500 X72.959 Y83.290 E180.8030 F4122
+G5 I8.926 J8.374 P7.125 Q-0.484 X74.109 Y87.859 E180.9915 F4375
+G5 I19.175 J-14.903 P19.213 Q-4.955 X155.157 Y64.214 E184.3685 F4543
+G5 I-7.247 J-14.504 P6.825 Q14.153 X96.000 Y54.521 E186.7664 F3121
+G5 I-16.270 J2.507 P7.038 Q5.329 X124.796 Y147.609 E190.6640 F3729
+G5 I-10.525 J16.934 P-8.373 Q18.978 X137.161 Y86.479 E193.1587 F3718
+G5 I4.000 J15.066 P12.128 Q-3.921 X49.382 Y127.449 E197.0334 F2812
+G5 I1.720 J-3.339 P-11.372 Q-1.691 X116.650 Y140.419 E199.7737 F3900
+G5 I-2.221 J0.151 P-16.272 Q-6.473 X88.732 Y115.548 E201.2693 F4559
+G5 I13.387 J17.474 P2.571 Q-11.635 X103.199 Y89.541 E202.4597 F3696
+G5 I-9.289 J-9.472 P18.909 Q11.646 X70.131 Y66.161 E204.0797 F4311
+G5 I16.293 J-1.665 P-0.397 Q-7.288 X69.849 Y93.901 E205.1894 F4240
+G5 I9.619 J-8.392 P-1.614 Q8.604 X71.117 Y130.506 E206.6544 F2747
+G5 I-7.024 J7.792 P-1.721 Q8.714 X103.189 Y63.556 E209.6239 F4399
+G5 I0.091 J4.888 P17.986 Q4.876 X147.177 Y56.820 E211.4039 F4254
+G5 I6.775 J-15.301 P10.978 Q14.055 X57.523 Y86.622 E215.1830 F2647
+G5 I-10.988 J-10.881 P19.150 Q-18.914 X124.601 Y127.082 E218.3165 F4231
+G5 I-1.881 J-13.524 P5.691 Q-2.459 X73.732 Y134.143 E220.3707 F2934
+G5 I10.075 J-8.258 P17.098 Q-12.633 X101.966 Y149.018 E221.6473 F3400
+G5 I-19.819 J5.971 P0.346 Q-13.763 X84.711 Y148.427 E222.3379 F2991
+G5 I11.875 J12.922 P-5.940 Q4.886 X140.768 Y44.570 E227.0586 F4420
+G5 I-19.275 J1.515 P18.437 Q3.737 X70.932 Y126.128 E231.3535 F1854
+G5 I-19.629 J-12.974 P-4.839 Q-2.019 X155.746 Y102.905 E234.8709 F3030
+G5 I-4.611 J-8.331 P-8.202 Q2.452 X137.695 Y76.170 E236.1613 F3856
+G5 I13.775 J2.386 P6.377 Q14.436 X80.471 Y142.285 E239.6589 F2482
+G5 I17.296 J-19.243 P12.996 Q-19.258 X118.514 Y86.553 E242.3580 F2868
+G5 I-5.467 J-0.388 P7.867 Q-14.118 X98.708 Y99.642 E243.3076 F3016
+G5 I9.490 J-8.040 P-1.353 Q-9.560 X96.704 Y111.245 E243.7786 F2325
+G5 I12.765 J5.019 P-9.120 Q11.426 X67.470 Y146.332 E245.6054 F2136
+G5 I-14.115 J-13.353 P4.832 Q19.131 X134.058 Y103.464 E248.7732 F4040
+G5 I2.210 J0.146 P-6.431 Q-19.109 X156.621 Y143.157 E250.5995 F4249
+G5 I16.477 J8.435 P-7.847 Q5.806 X101.968 Y95.826 E253.4915 F2586
+G5 I-6.056 J19.404 P11.549 Q-11.637 X112.609 Y56.240 E255.1311 F3670
+G5 I19.774 J2.362 P2.984 Q16.308 X43.923 Y78.126 E258.0147 F3066
+G5 I14.356 J-15.668 P2.387 Q5.309 X73.290 Y108.435 E259.7028 F4753
+G5 I8.636 J-2.504 P9.354 Q-10.162 X99.672 Y133.138 E261.1485 F1839
+G5 I-13.412 J14.187 P0.634 Q-19.146 X115.796 Y107.089 E262.3739 F3551
+G5 I9.648 J3.415 P-6.412 Q0.800 X61.959 Y107.798 E264.5275 F2527
+G5 I-19.266 J-7.057 P7.975 Q-3.209 X80.252 Y51.342 E266.9014 F1852
+G5 I-5.694 J-12.585 P9.474 Q15.463 X57.002 Y104.581 E269.2251 F4583
+G5 I14.920 J-3.263 P-5.679 Q-14.006 X86.998 Y62.628 E271.2880 F4719
+G5 I0.117 J-10.048 P18.785 Q19.942 X48.052 Y81.676 E273.0223 F3978
+G5 I-5.925 J13.835 P1.149 Q4.771 X145.934 Y104.208 E277.0400 F1835
+G5 I15.440 J11.397 P3.768 Q-1.534 X95.270 Y68.573 E279.5176 F3408
+G5 I-13.065 J8.573 P14.199 Q14.850 X81.679 Y145.647 E282.6482 F3656
+G5 I14.265 J10.491 P0.535 Q0.119 X105.923 Y72.363 E285.7358 F2821
+G5 I-10.622 J-12.361 P13.595 Q3.989 X86.797 Y45.581 E287.0522 F3038
+G5 I-16.240 J-18.943 P10.588 Q9.578 X76.767 Y76.873 E288.3666 F2261
+G5 I17.013 J16.468 P-15.360 Q-6.898 X41.321 Y118.423 E290.5512 F3806
+G5 I13.152 J6.345 P-7.738 Q-1.734 X81.004 Y94.487 E292.4049 F2546
+G5 I-12.731 J-1.779 P-12.016 Q2.017 X86.502 Y118.085 E293.3741 F3667
+G5 I19.658 J-0.807 P-11.280 Q-2.264 X74.470 Y148.795 E294.6935 F1875
+G5 I5.655 J-2.590 P-18.912 Q7.704 X122.120 Y77.046 E298.1387 F2360
+G5 I19.695 J6.492 P-10.114 Q17.125 X60.257 Y125.743 E301.2879 F1851
+G5 I17.533 J-10.689 P3.000 Q19.736 X150.891 Y112.928 E304.9493 F3835
+G5 I-11.739 J-16.981 P-19.106 Q13.202 X63.032 Y135.610 E308.5788 F3592
+G5 I-6.908 J-13.102 P-12.598 Q6.706 X110.210 Y79.472 E311.5120 F4637
+G5 I-8.230 J10.173 P11.021 Q15.327 X146.607 Y102.332 E313.2312 F3645
+G5 I-17.888 J6.188 P-2.138 Q-7.582 X138.870 Y115.077 E313.8276 F2947
+G5 I4.761 J-9.574 P5.036 Q-2.482 X44.986 Y57.460 E318.2338 F4752
+G5 I6.278 J3.988 P9.906 Q-7.234 X156.967 Y50.791 E322.7210 F2152
+G5 I-2.440 J17.912 P6.951 Q-15.309 X40.047 Y63.705 E327.4262 F3072
+G5 I8.018 J14.362 P4.287 Q-1.082 X130.001 Y105.997 E331.4021 F2448
+G5 I9.406 J-11.967 P5.928 Q16.344 X71.503 Y102.393 E333.7465 F2806
+G5 I1.022 J-14.488 P3.293 Q-9.919 X72.278 Y55.216 E335.6338 F4441
+G5 I2.202 J17.516 P-10.913 Q7.425 X98.312 Y102.718 E337.8005 F4544
+G5 I-13.953 J-11.422 P1.518 Q-13.291 X61.082 Y76.105 E339.6311 F2644
+G5 I7.155 J18.091 P12.800 Q16.181 X53.948 Y69.107 E340.0308 F4495
+G5 I11.909 J-18.592 P3.057 Q-9.893 X125.084 Y61.764 E342.8913 F2587
+G5 I-8.753 J-6.583 P-7.298 Q2.620 X44.220 Y53.716 E346.1419 F3378
+G5 I10.882 J1.445 P19.671 Q-5.451 X47.818 Y62.188 E346.5101 F3218
+G5 I-3.106 J-6.294 P-16.702 Q-9.848 X131.759 Y121.157 E350.6134 F3824
+G5 I12.821 J9.490 P-5.168 Q4.464 X70.063 Y96.240 E353.2750 F2376
+G5 I19.735 J5.692 P13.848 Q-4.974 X81.347 Y145.504 E355.2966 F4552
+G5 I6.615 J0.044 P-14.047 Q-8.406 X136.642 Y132.623 E357.5676 F4156
+G5 I17.164 J1.235 P-17.816 Q17.811 X42.860 Y69.803 E362.0828 F3353
+G5 I-19.677 J19.484 P-14.171 Q-5.558 X156.647 Y106.806 E366.8688 F4342
+G5 I12.411 J8.478 P-14.601 Q-17.730 X59.411 Y112.643 E370.7653 F3719
+G5 I9.919 J5.525 P-9.998 Q-16.313 X108.684 Y48.172 E374.0110 F2235
+G5 I3.579 J-0.944 P-4.941 Q-2.361 X136.460 Y115.555 E376.9264 F3619
+G5 I7.984 J8.354 P2.890 Q-9.540 X47.082 Y65.466 E381.0246 F2185
+G5 I16.923 J-16.930 P13.704 Q-19.038 X82.065 Y133.205 E384.0742 F1918
+G5 I-8.718 J-10.489 P-15.996 Q4.710 X147.204 Y100.788 E386.9846 F3924
+G5 I-8.037 J6.742 P11.381 Q-8.303 X115.276 Y121.353 E388.5037 F3871
+G5 I-19.254 J-6.074 P12.360 Q5.151 X49.252 Y105.844 E391.2165 F4447
+G5 I-7.984 J17.697 P-15.931 Q-16.256 X109.581 Y119.094 E393.6872 F2799
+G5 I-15.031 J-11.672 P19.497 Q6.871 X46.216 Y55.368 E397.2819 F3928
+G5 I19.326 J18.468 P17.138 Q19.043 X71.889 Y107.980 E399.6235 F3445
+G5 I7.453 J14.057 P-5.539 Q13.433 X135.865 Y105.527 E402.1845 F4539
+G5 I4.592 J19.186 P0.440 Q-11.407 X149.757 Y118.935 E402.9567 F3985
+G5 I12.298 J-0.696 P3.504 Q-17.832 X144.207 Y106.934 E403.4856 F3331
+G5 I-2.219 J4.460 P9.965 Q1.309 X56.435 Y119.947 E407.0349 F3436
+G5 I15.650 J-16.844 P-0.848 Q9.391 X84.141 Y115.487 E408.1574 F3831
+G5 I-4.349 J1.400 P-0.064 Q-15.360 X83.673 Y136.867 E409.0128 F3366
+G5 I-19.077 J-18.717 P2.223 Q-16.990 X47.908 Y145.452 E410.4841 F4516
+G5 I2.935 J15.169 P11.384 Q11.257 X61.872 Y119.975 E411.6462 F4017
+G5 I-19.362 J14.846 P-4.230 Q-4.079 X116.991 Y115.653 E413.8577 F2421
+G5 I14.803 J11.795 P17.101 Q-19.572 X133.503 Y69.831 E415.8059 F3636
+G5 I-0.167 J-12.060 P-0.687 Q18.101 X159.135 Y73.539 E416.8419 F2521
+G5 I-3.813 J17.815 P-2.122 Q16.219 X110.885 Y78.295 E418.7813 F4658
+G5 I-19.194 J7.944 P-9.375 Q1.969 X134.571 Y91.648 E419.8689 F4489
+G5 I-7.316 J-6.436 P-5.243 Q18.762 X141.039 Y142.010 E421.9000 F4113
+G5 I-9.964 J18.128 P18.937 Q-15.297 X139.476 Y120.134 E422.7772 F2556
+G5 I11.653 J19.362 P1.253 Q-3.136 X55.930 Y72.344 E426.6271 F2385
+G5 I6.248 J13.782 P-10.485 Q-18.747 X65.603 Y132.643 E429.0699 F3321
+G5 I0.815 J7.548 P-1.826 Q11.222 X53.889 Y142.798 E429.6900 F4284
+G5 I-15.428 J-9.824 P-15.049 Q-6.819 X159.330 Y116.837 E434.0336 F4145
+G5 I-6.699 J-18.097 P0.200 Q2.550 X94.919 Y132.369 E436.6840 F2839
+G5 I13.131 J13.391 P-10.206 Q-2.792 X132.920 Y45.808 E440.4654 F3992
+G5 I18.678 J17.170 P8.749 Q9.049 X90.107 Y96.279 E443.1128 F2410
+G5 I14.767 J-14.926 P19.247 Q-9.925 X116.153 Y106.758 E444.2357 F3096
+G5 I1.851 J14.853 P-19.770 Q-13.919 X114.854 Y101.261 E444.4617 F4119
+G5 I-18.037 J-6.604 P-19.610 Q-2.324 X43.265 Y60.450 E447.7579 F3834
+G5 I-8.781 J14.722 P5.026 Q-16.042 X100.377 Y83.161 E450.2164 F2590
+G5 I12.458 J-9.767 P8.611 Q-12.243 X95.128 Y76.577 E450.5532 F2697
+G5 I17.902 J16.243 P-4.707 Q7.468 X96.088 Y139.649 E453.0764 F2700
+G5 I7.825 J2.353 P-16.649 Q16.999 X40.235 Y124.075 E455.3958 F4490
+G5 I-12.513 J2.561 P10.822 Q-4.653 X113.263 Y75.933 E458.8945 F3373
+G5 I16.225 J-18.016 P19.418 Q-14.469 X97.923 Y114.554 E460.5567 F1980
+G5 I-18.196 J19.215 P-5.978 Q12.179 X103.537 Y148.050 E461.9153 F3275
+M400
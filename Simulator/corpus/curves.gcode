@@ -0,0 +1,2218 @@
+G28
+G92 E0
+G90
+M82
+G1 Z0.3 F600
+G0 X140.000 Y100.000 F6000
+G1 X139.976 Y101.396 E0.04607 F3000
+G1 X139.903 Y102.790 E0.09215 F3000
+G1 X139.781 Y104.181 E0.13822 F3000
+G1 X139.611 Y105.567 E0.18430 F3000
+G1 X139.392 Y106.946 E0.23037 F3000
+G1 X139.126 Y108.316 E0.27645 F3000
+G1 X138.812 Y109.677 E0.32252 F3000
+G1 X138.450 Y111.025 E0.36859 F3000
+G1 X138.042 Y112.361 E0.41467 F3000
+G1 X137.588 Y113.681 E0.46074 F3000
+G1 X137.087 Y114.984 E0.50682 F3000
+G1 X136.542 Y116.269 E0.55289 F3000
+G1 X135.952 Y117.535 E0.59897 F3000
+G1 X135.318 Y118.779 E0.64504 F3000
+G1 X134.641 Y120.000 E0.69112 F3000
+G1 X133.922 Y121.197 E0.73719 F3000
+G1 X133.162 Y122.368 E0.78326 F3000
+G1 X132.361 Y123.511 E0.82934 F3000
+G1 X131.520 Y124.626 E0.87541 F3000
+G1 X130.642 Y125.712 E0.92149 F3000
+G1 X129.726 Y126.765 E0.96756 F3000
+G1 X128.774 Y127.786 E1.01364 F3000
+G1 X127.786 Y128.774 E1.05971 F3000
+G1 X126.765 Y129.726 E1.10578 F3000
+G1 X125.712 Y130.642 E1.15186 F3000
+G1 X124.626 Y131.520 E1.19793 F3000
+G1 X123.511 Y132.361 E1.24401 F3000
+G1 X122.368 Y133.162 E1.29008 F3000
+G1 X121.197 Y133.922 E1.33616 F3000
+G1 X120.000 Y134.641 E1.38223 F3000
+G1 X118.779 Y135.318 E1.42830 F3000
+G1 X117.535 Y135.952 E1.47438 F3000
+G1 X116.269 Y136.542 E1.52045 F3000
+G1 X114.984 Y137.087 E1.56653 F3000
+G1 X113.681 Y137.588 E1.61260 F3000
+G1 X112.361 Y138.042 E1.65868 F3000
+G1 X111.025 Y138.450 E1.70475 F3000
+G1 X109.677 Y138.812 E1.75083 F3000
+G1 X108.316 Y139.126 E1.79690 F3000
+G1 X106.946 Y139.392 E1.84297 F3000
+G1 X105.567 Y139.611 E1.88905 F3000
+G1 X104.181 Y139.781 E1.93512 F3000
+G1 X102.790 Y139.903 E1.98120 F3000
+G1 X101.396 Y139.976 E2.02727 F3000
+G1 X100.000 Y140.000 E2.07335 F3000
+G1 X98.604 Y139.976 E2.11942 F3000
+G1 X97.210 Y139.903 E2.16549 F3000
+G1 X95.819 Y139.781 E2.21157 F3000
+G1 X94.433 Y139.611 E2.25764 F3000
+G1 X93.054 Y139.392 E2.30372 F3000
+G1 X91.684 Y139.126 E2.34979 F3000
+G1 X90.323 Y138.812 E2.39587 F3000
+G1 X88.975 Y138.450 E2.44194 F3000
+G1 X87.639 Y138.042 E2.48802 F3000
+G1 X86.319 Y137.588 E2.53409 F3000
+G1 X85.016 Y137.087 E2.58016 F3000
+G1 X83.731 Y136.542 E2.62624 F3000
+G1 X82.465 Y135.952 E2.67231 F3000
+G1 X81.221 Y135.318 E2.71839 F3000
+G1 X80.000 Y134.641 E2.76446 F3000
+G1 X78.803 Y133.922 E2.81054 F3000
+G1 X77.632 Y133.162 E2.85661 F3000
+G1 X76.489 Y132.361 E2.90268 F3000
+G1 X75.374 Y131.520 E2.94876 F3000
+G1 X74.288 Y130.642 E2.99483 F3000
+G1 X73.235 Y129.726 E3.04091 F3000
+G1 X72.214 Y128.774 E3.08698 F3000
+G1 X71.226 Y127.786 E3.13306 F3000
+G1 X70.274 Y126.765 E3.17913 F3000
+G1 X69.358 Y125.712 E3.22520 F3000
+G1 X68.480 Y124.626 E3.27128 F3000
+G1 X67.639 Y123.511 E3.31735 F3000
+G1 X66.838 Y122.368 E3.36343 F3000
+G1 X66.078 Y121.197 E3.40950 F3000
+G1 X65.359 Y120.000 E3.45558 F3000
+G1 X64.682 Y118.779 E3.50165 F3000
+G1 X64.048 Y117.535 E3.54773 F3000
+G1 X63.458 Y116.269 E3.59380 F3000
+G1 X62.913 Y114.984 E3.63987 F3000
+G1 X62.412 Y113.681 E3.68595 F3000
+G1 X61.958 Y112.361 E3.73202 F3000
+G1 X61.550 Y111.025 E3.77810 F3000
+G1 X61.188 Y109.677 E3.82417 F3000
+G1 X60.874 Y108.316 E3.87025 F3000
+G1 X60.608 Y106.946 E3.91632 F3000
+G1 X60.389 Y105.567 E3.96239 F3000
+G1 X60.219 Y104.181 E4.00847 F3000
+G1 X60.097 Y102.790 E4.05454 F3000
+G1 X60.024 Y101.396 E4.10062 F3000
+G1 X60.000 Y100.000 E4.14669 F3000
+G1 X60.024 Y98.604 E4.19277 F3000
+G1 X60.097 Y97.210 E4.23884 F3000
+G1 X60.219 Y95.819 E4.28491 F3000
+G1 X60.389 Y94.433 E4.33099 F3000
+G1 X60.608 Y93.054 E4.37706 F3000
+G1 X60.874 Y91.684 E4.42314 F3000
+G1 X61.188 Y90.323 E4.46921 F3000
+G1 X61.550 Y88.975 E4.51529 F3000
+G1 X61.958 Y87.639 E4.56136 F3000
+G1 X62.412 Y86.319 E4.60744 F3000
+G1 X62.913 Y85.016 E4.65351 F3000
+G1 X63.458 Y83.731 E4.69958 F3000
+G1 X64.048 Y82.465 E4.74566 F3000
+G1 X64.682 Y81.221 E4.79173 F3000
+G1 X65.359 Y80.000 E4.83781 F3000
+G1 X66.078 Y78.803 E4.88388 F3000
+G1 X66.838 Y77.632 E4.92996 F3000
+G1 X67.639 Y76.489 E4.97603 F3000
+G1 X68.480 Y75.374 E5.02210 F3000
+G1 X69.358 Y74.288 E5.06818 F3000
+G1 X70.274 Y73.235 E5.11425 F3000
+G1 X71.226 Y72.214 E5.16033 F3000
+G1 X72.214 Y71.226 E5.20640 F3000
+G1 X73.235 Y70.274 E5.25248 F3000
+G1 X74.288 Y69.358 E5.29855 F3000
+G1 X75.374 Y68.480 E5.34462 F3000
+G1 X76.489 Y67.639 E5.39070 F3000
+G1 X77.632 Y66.838 E5.43677 F3000
+G1 X78.803 Y66.078 E5.48285 F3000
+G1 X80.000 Y65.359 E5.52892 F3000
+G1 X81.221 Y64.682 E5.57500 F3000
+G1 X82.465 Y64.048 E5.62107 F3000
+G1 X83.731 Y63.458 E5.66715 F3000
+G1 X85.016 Y62.913 E5.71322 F3000
+G1 X86.319 Y62.412 E5.75929 F3000
+G1 X87.639 Y61.958 E5.80537 F3000
+G1 X88.975 Y61.550 E5.85144 F3000
+G1 X90.323 Y61.188 E5.89752 F3000
+G1 X91.684 Y60.874 E5.94359 F3000
+G1 X93.054 Y60.608 E5.98967 F3000
+G1 X94.433 Y60.389 E6.03574 F3000
+G1 X95.819 Y60.219 E6.08181 F3000
+G1 X97.210 Y60.097 E6.12789 F3000
+G1 X98.604 Y60.024 E6.17396 F3000
+G1 X100.000 Y60.000 E6.22004 F3000
+G1 X101.396 Y60.024 E6.26611 F3000
+G1 X102.790 Y60.097 E6.31219 F3000
+G1 X104.181 Y60.219 E6.35826 F3000
+G1 X105.567 Y60.389 E6.40434 F3000
+G1 X106.946 Y60.608 E6.45041 F3000
+G1 X108.316 Y60.874 E6.49648 F3000
+G1 X109.677 Y61.188 E6.54256 F3000
+G1 X111.025 Y61.550 E6.58863 F3000
+G1 X112.361 Y61.958 E6.63471 F3000
+G1 X113.681 Y62.412 E6.68078 F3000
+G1 X114.984 Y62.913 E6.72686 F3000
+G1 X116.269 Y63.458 E6.77293 F3000
+G1 X117.535 Y64.048 E6.81900 F3000
+G1 X118.779 Y64.682 E6.86508 F3000
+G1 X120.000 Y65.359 E6.91115 F3000
+G1 X121.197 Y66.078 E6.95723 F3000
+G1 X122.368 Y66.838 E7.00330 F3000
+G1 X123.511 Y67.639 E7.04938 F3000
+G1 X124.626 Y68.480 E7.09545 F3000
+G1 X125.712 Y69.358 E7.14152 F3000
+G1 X126.765 Y70.274 E7.18760 F3000
+G1 X127.786 Y71.226 E7.23367 F3000
+G1 X128.774 Y72.214 E7.27975 F3000
+G1 X129.726 Y73.235 E7.32582 F3000
+G1 X130.642 Y74.288 E7.37190 F3000
+G1 X131.520 Y75.374 E7.41797 F3000
+G1 X132.361 Y76.489 E7.46405 F3000
+G1 X133.162 Y77.632 E7.51012 F3000
+G1 X133.922 Y78.803 E7.55619 F3000
+G1 X134.641 Y80.000 E7.60227 F3000
+G1 X135.318 Y81.221 E7.64834 F3000
+G1 X135.952 Y82.465 E7.69442 F3000
+G1 X136.542 Y83.731 E7.74049 F3000
+G1 X137.087 Y85.016 E7.78657 F3000
+G1 X137.588 Y86.319 E7.83264 F3000
+G1 X138.042 Y87.639 E7.87871 F3000
+G1 X138.450 Y88.975 E7.92479 F3000
+G1 X138.812 Y90.323 E7.97086 F3000
+G1 X139.126 Y91.684 E8.01694 F3000
+G1 X139.392 Y93.054 E8.06301 F3000
+G1 X139.611 Y94.433 E8.10909 F3000
+G1 X139.781 Y95.819 E8.15516 F3000
+G1 X139.903 Y97.210 E8.20123 F3000
+G1 X139.976 Y98.604 E8.24731 F3000
+G1 X140.000 Y100.000 E8.29338 F3000
+G1 X105.057 Y100.177 E9.44652 F2400
+G1 X105.108 Y100.357 E9.45271 F2400
+G1 X105.152 Y100.541 E9.45896 F2400
+G1 X105.189 Y100.729 E9.46528 F2400
+G1 X105.219 Y100.920 E9.47167 F2400
+G1 X105.243 Y101.114 E9.47812 F2400
+G1 X105.259 Y101.311 E9.48463 F2400
+G1 X105.268 Y101.510 E9.49122 F2400
+G1 X105.269 Y101.712 E9.49786 F2400
+G1 X105.262 Y101.915 E9.50458 F2400
+G1 X105.248 Y102.120 E9.51136 F2400
+G1 X105.225 Y102.327 E9.51821 F2400
+G1 X105.195 Y102.534 E9.52512 F2400
+G1 X105.156 Y102.742 E9.53210 F2400
+G1 X105.110 Y102.950 E9.53914 F2400
+G1 X105.054 Y103.158 E9.54625 F2400
+G1 X104.991 Y103.366 E9.55343 F2400
+G1 X104.919 Y103.574 E9.56068 F2400
+G1 X104.838 Y103.780 E9.56799 F2400
+G1 X104.749 Y103.985 E9.57537 F2400
+G1 X104.652 Y104.189 E9.58281 F2400
+G1 X104.546 Y104.390 E9.59032 F2400
+G1 X104.432 Y104.589 E9.59790 F2400
+G1 X104.309 Y104.786 E9.60554 F2400
+G1 X104.178 Y104.979 E9.61325 F2400
+G1 X104.039 Y105.169 E9.62103 F2400
+G1 X103.891 Y105.356 E9.62888 F2400
+G1 X103.735 Y105.538 E9.63679 F2400
+G1 X103.572 Y105.716 E9.64477 F2400
+G1 X103.400 Y105.889 E9.65281 F2400
+G1 X103.221 Y106.057 E9.66092 F2400
+G1 X103.034 Y106.220 E9.66910 F2400
+G1 X102.839 Y106.377 E9.67735 F2400
+G1 X102.637 Y106.527 E9.68566 F2400
+G1 X102.428 Y106.672 E9.69404 F2400
+G1 X102.213 Y106.810 E9.70249 F2400
+G1 X101.990 Y106.940 E9.71101 F2400
+G1 X101.761 Y107.064 E9.71959 F2400
+G1 X101.526 Y107.180 E9.72824 F2400
+G1 X101.285 Y107.288 E9.73696 F2400
+G1 X101.038 Y107.387 E9.74574 F2400
+G1 X100.786 Y107.479 E9.75459 F2400
+G1 X100.529 Y107.562 E9.76351 F2400
+G1 X100.267 Y107.635 E9.77250 F2400
+G1 X100.000 Y107.700 E9.78155 F2400
+G1 X99.729 Y107.755 E9.79067 F2400
+G1 X99.455 Y107.801 E9.79986 F2400
+G1 X99.176 Y107.837 E9.80912 F2400
+G1 X98.895 Y107.863 E9.81844 F2400
+G1 X98.611 Y107.878 E9.82783 F2400
+G1 X98.324 Y107.884 E9.83729 F2400
+G1 X98.036 Y107.879 E9.84682 F2400
+G1 X97.745 Y107.863 E9.85641 F2400
+G1 X97.454 Y107.837 E9.86607 F2400
+G1 X97.161 Y107.799 E9.87580 F2400
+G1 X96.868 Y107.751 E9.88560 F2400
+G1 X96.575 Y107.692 E9.89547 F2400
+G1 X96.283 Y107.622 E9.90540 F2400
+G1 X95.991 Y107.540 E9.91540 F2400
+G1 X95.700 Y107.448 E9.92547 F2400
+G1 X95.411 Y107.344 E9.93560 F2400
+G1 X95.124 Y107.229 E9.94581 F2400
+G1 X94.839 Y107.103 E9.95608 F2400
+G1 X94.558 Y106.966 E9.96642 F2400
+G1 X94.279 Y106.818 E9.97682 F2400
+G1 X94.005 Y106.659 E9.98730 F2400
+G1 X93.734 Y106.488 E9.99784 F2400
+G1 X93.468 Y106.307 E10.00845 F2400
+G1 X93.208 Y106.116 E10.01913 F2400
+G1 X92.952 Y105.914 E10.02988 F2400
+G1 X92.703 Y105.701 E10.04069 F2400
+G1 X92.460 Y105.478 E10.05157 F2400
+G1 X92.224 Y105.245 E10.06252 F2400
+G1 X91.994 Y105.002 E10.07354 F2400
+G1 X91.773 Y104.750 E10.08463 F2400
+G1 X91.559 Y104.488 E10.09578 F2400
+G1 X91.354 Y104.217 E10.10700 F2400
+G1 X91.157 Y103.937 E10.11829 F2400
+G1 X90.969 Y103.649 E10.12965 F2400
+G1 X90.791 Y103.352 E10.14108 F2400
+G1 X90.623 Y103.047 E10.15257 F2400
+G1 X90.464 Y102.734 E10.16414 F2400
+G1 X90.316 Y102.414 E10.17577 F2400
+G1 X90.179 Y102.087 E10.18747 F2400
+G1 X90.053 Y101.754 E10.19923 F2400
+G1 X89.939 Y101.414 E10.21107 F2400
+G1 X89.836 Y101.068 E10.22297 F2400
+G1 X89.745 Y100.717 E10.23494 F2400
+G1 X89.666 Y100.361 E10.24698 F2400
+G1 X89.600 Y100.000 E10.25909 F2400
+G1 X89.546 Y99.635 E10.27127 F2400
+G1 X89.506 Y99.266 E10.28351 F2400
+G1 X89.478 Y98.894 E10.29582 F2400
+G1 X89.464 Y98.519 E10.30820 F2400
+G1 X89.463 Y98.142 E10.32065 F2400
+G1 X89.475 Y97.763 E10.33317 F2400
+G1 X89.501 Y97.382 E10.34575 F2400
+G1 X89.541 Y97.001 E10.35841 F2400
+G1 X89.595 Y96.619 E10.37113 F2400
+G1 X89.663 Y96.238 E10.38392 F2400
+G1 X89.745 Y95.857 E10.39678 F2400
+G1 X89.841 Y95.477 E10.40970 F2400
+G1 X89.951 Y95.099 E10.42270 F2400
+G1 X90.076 Y94.723 E10.43576 F2400
+G1 X90.214 Y94.350 E10.44889 F2400
+G1 X90.366 Y93.980 E10.46209 F2400
+G1 X90.532 Y93.614 E10.47536 F2400
+G1 X90.712 Y93.252 E10.48870 F2400
+G1 X90.906 Y92.895 E10.50210 F2400
+G1 X91.114 Y92.544 E10.51558 F2400
+G1 X91.335 Y92.198 E10.52912 F2400
+G1 X91.569 Y91.859 E10.54273 F2400
+G1 X91.817 Y91.526 E10.55641 F2400
+G1 X92.077 Y91.201 E10.57015 F2400
+G1 X92.351 Y90.884 E10.58397 F2400
+G1 X92.637 Y90.575 E10.59785 F2400
+G1 X92.935 Y90.276 E10.61180 F2400
+G1 X93.245 Y89.985 E10.62582 F2400
+G1 X93.567 Y89.705 E10.63991 F2400
+G1 X93.900 Y89.434 E10.65407 F2400
+G1 X94.244 Y89.175 E10.66830 F2400
+G1 X94.599 Y88.927 E10.68259 F2400
+G1 X94.965 Y88.690 E10.69695 F2400
+G1 X95.340 Y88.466 E10.71138 F2400
+G1 X95.725 Y88.254 E10.72588 F2400
+G1 X96.119 Y88.055 E10.74045 F2400
+G1 X96.521 Y87.869 E10.75509 F2400
+G1 X96.932 Y87.697 E10.76979 F2400
+G1 X97.351 Y87.538 E10.78457 F2400
+G1 X97.777 Y87.394 E10.79941 F2400
+G1 X98.210 Y87.265 E10.81432 F2400
+G1 X98.649 Y87.151 E10.82930 F2400
+G1 X99.095 Y87.052 E10.84434 F2400
+G1 X99.545 Y86.968 E10.85946 F2400
+G1 X100.000 Y86.900 E10.87464 F2400
+G1 X100.459 Y86.848 E10.88990 F2400
+G1 X100.922 Y86.812 E10.90522 F2400
+G1 X101.388 Y86.793 E10.92061 F2400
+G1 X101.857 Y86.790 E10.93607 F2400
+G1 X102.327 Y86.804 E10.95159 F2400
+G1 X102.798 Y86.834 E10.96719 F2400
+G1 X103.271 Y86.882 E10.98285 F2400
+G1 X103.743 Y86.946 E10.99859 F2400
+G1 X104.215 Y87.028 E11.01439 F2400
+G1 X104.686 Y87.126 E11.03026 F2400
+G1 X105.155 Y87.242 E11.04620 F2400
+G1 X105.621 Y87.375 E11.06220 F2400
+G1 X106.085 Y87.525 E11.07828 F2400
+G1 X106.544 Y87.692 E11.09442 F2400
+G1 X107.000 Y87.876 E11.11064 F2400
+G1 X107.451 Y88.076 E11.12692 F2400
+G1 X107.896 Y88.294 E11.14327 F2400
+G1 X108.335 Y88.528 E11.15969 F2400
+G1 X108.767 Y88.779 E11.17617 F2400
+G1 X109.192 Y89.046 E11.19273 F2400
+G1 X109.609 Y89.328 E11.20935 F2400
+G1 X110.017 Y89.627 E11.22605 F2400
+G1 X110.416 Y89.941 E11.24281 F2400
+G1 X110.805 Y90.271 E11.25964 F2400
+G1 X111.184 Y90.615 E11.27654 F2400
+G1 X111.552 Y90.974 E11.29351 F2400
+G1 X111.909 Y91.348 E11.31054 F2400
+G1 X112.253 Y91.735 E11.32765 F2400
+G1 X112.585 Y92.136 E11.34482 F2400
+G1 X112.904 Y92.550 E11.36206 F2400
+G1 X113.209 Y92.977 E11.37937 F2400
+G1 X113.500 Y93.416 E11.39675 F2400
+G1 X113.776 Y93.866 E11.41420 F2400
+G1 X114.038 Y94.328 E11.43172 F2400
+G1 X114.283 Y94.801 E11.44930 F2400
+G1 X114.513 Y95.284 E11.46696 F2400
+G1 X114.727 Y95.777 E11.48468 F2400
+G1 X114.923 Y96.279 E11.50247 F2400
+G1 X115.103 Y96.790 E11.52033 F2400
+G1 X115.265 Y97.308 E11.53826 F2400
+G1 X115.409 Y97.834 E11.55626 F2400
+G1 X115.534 Y98.367 E11.57432 F2400
+G1 X115.642 Y98.906 E11.59246 F2400
+G1 X115.730 Y99.451 E11.61066 F2400
+G1 X115.800 Y100.000 E11.62894 F2400
+G1 X115.850 Y100.554 E11.64728 F2400
+G1 X115.881 Y101.111 E11.66569 F2400
+G1 X115.892 Y101.670 E11.68416 F2400
+G1 X115.884 Y102.232 E11.70271 F2400
+G1 X115.855 Y102.796 E11.72133 F2400
+G1 X115.807 Y103.360 E11.74001 F2400
+G1 X115.738 Y103.924 E11.75877 F2400
+G1 X115.649 Y104.487 E11.77759 F2400
+G1 X115.540 Y105.049 E11.79648 F2400
+G1 X115.411 Y105.609 E11.81544 F2400
+G1 X115.261 Y106.166 E11.83447 F2400
+G1 X115.092 Y106.719 E11.85356 F2400
+G1 X114.902 Y107.268 E11.87273 F2400
+G1 X114.692 Y107.812 E11.89196 F2400
+G1 X114.463 Y108.350 E11.91127 F2400
+G1 X114.213 Y108.881 E11.93064 F2400
+G1 X113.944 Y109.406 E11.95008 F2400
+G1 X113.656 Y109.922 E11.96959 F2400
+G1 X113.349 Y110.429 E11.98917 F2400
+G1 X113.023 Y110.927 E12.00881 F2400
+G1 X112.678 Y111.415 E12.02853 F2400
+G1 X112.315 Y111.893 E12.04832 F2400
+G1 X111.934 Y112.358 E12.06817 F2400
+G1 X111.536 Y112.812 E12.08809 F2400
+G1 X111.120 Y113.253 E12.10808 F2400
+G1 X110.688 Y113.680 E12.12814 F2400
+G1 X110.239 Y114.093 E12.14827 F2400
+G1 X109.775 Y114.492 E12.16847 F2400
+G1 X109.295 Y114.875 E12.18873 F2400
+G1 X108.800 Y115.242 E12.20907 F2400
+G1 X108.291 Y115.593 E12.22947 F2400
+G1 X107.768 Y115.927 E12.24994 F2400
+G1 X107.232 Y116.243 E12.27048 F2400
+G1 X106.683 Y116.541 E12.29109 F2400
+G1 X106.122 Y116.820 E12.31177 F2400
+G1 X105.550 Y117.081 E12.33252 F2400
+G1 X104.967 Y117.322 E12.35334 F2400
+G1 X104.374 Y117.543 E12.37422 F2400
+G1 X103.772 Y117.744 E12.39518 F2400
+G1 X103.160 Y117.924 E12.41620 F2400
+G1 X102.541 Y118.082 E12.43729 F2400
+G1 X101.915 Y118.220 E12.45845 F2400
+G1 X101.282 Y118.335 E12.47968 F2400
+G1 X100.644 Y118.429 E12.50098 F2400
+G1 X100.000 Y118.500 E12.52234 F2400
+G1 X99.352 Y118.549 E12.54378 F2400
+G1 X98.701 Y118.575 E12.56528 F2400
+G1 X98.047 Y118.578 E12.58686 F2400
+G1 X97.392 Y118.558 E12.60850 F2400
+G1 X96.735 Y118.514 E12.63021 F2400
+G1 X96.079 Y118.448 E12.65199 F2400
+G1 X95.423 Y118.358 E12.67384 F2400
+G1 X94.768 Y118.245 E12.69576 F2400
+G1 X94.116 Y118.108 E12.71774 F2400
+G1 X93.467 Y117.948 E12.73980 F2400
+G1 X92.823 Y117.765 E12.76192 F2400
+G1 X92.183 Y117.558 E12.78411 F2400
+G1 X91.548 Y117.329 E12.80637 F2400
+G1 X90.920 Y117.076 E12.82870 F2400
+G1 X90.300 Y116.801 E12.85110 F2400
+G1 X89.688 Y116.503 E12.87357 F2400
+G1 X89.085 Y116.183 E12.89611 F2400
+G1 X88.491 Y115.841 E12.91871 F2400
+G1 X87.908 Y115.477 E12.94139 F2400
+G1 X87.337 Y115.091 E12.96413 F2400
+G1 X86.778 Y114.685 E12.98694 F2400
+G1 X86.232 Y114.257 E13.00983 F2400
+G1 X85.700 Y113.810 E13.03278 F2400
+G1 X85.182 Y113.342 E13.05579 F2400
+G1 X84.679 Y112.856 E13.07888 F2400
+G1 X84.193 Y112.350 E13.10204 F2400
+G1 X83.723 Y111.826 E13.12526 F2400
+G1 X83.270 Y111.285 E13.14856 F2400
+G1 X82.836 Y110.726 E13.17192 F2400
+G1 X82.420 Y110.150 E13.19535 F2400
+G1 X82.023 Y109.558 E13.21885 F2400
+G1 X81.647 Y108.952 E13.24242 F2400
+G1 X81.291 Y108.330 E13.26606 F2400
+G1 X80.956 Y107.694 E13.28977 F2400
+G1 X80.642 Y107.046 E13.31355 F2400
+G1 X80.351 Y106.384 E13.33739 F2400
+G1 X80.083 Y105.711 E13.36131 F2400
+G1 X79.837 Y105.027 E13.38529 F2400
+G1 X79.615 Y104.333 E13.40934 F2400
+G1 X79.418 Y103.629 E13.43346 F2400
+G1 X79.244 Y102.917 E13.45765 F2400
+G1 X79.095 Y102.197 E13.48191 F2400
+G1 X78.971 Y101.470 E13.50624 F2400
+G1 X78.873 Y100.738 E13.53063 F2400
+G1 X78.800 Y100.000 E13.55510 F2400
+G1 X78.753 Y99.258 E13.57963 F2400
+G1 X78.732 Y98.513 E13.60423 F2400
+G1 X78.737 Y97.765 E13.62891 F2400
+G1 X78.769 Y97.016 E13.65365 F2400
+G1 X78.827 Y96.267 E13.67846 F2400
+G1 X78.911 Y95.517 E13.70333 F2400
+G1 X79.022 Y94.770 E13.72828 F2400
+G1 X79.160 Y94.024 E13.75330 F2400
+G1 X79.324 Y93.282 E13.77838 F2400
+G1 X79.515 Y92.544 E13.80354 F2400
+G1 X79.732 Y91.811 E13.82876 F2400
+G1 X79.975 Y91.084 E13.85405 F2400
+G1 X80.245 Y90.365 E13.87941 F2400
+G1 X80.540 Y89.653 E13.90484 F2400
+G1 X80.861 Y88.950 E13.93034 F2400
+G1 X81.207 Y88.257 E13.95591 F2400
+G1 X81.579 Y87.575 E13.98154 F2400
+G1 X81.975 Y86.904 E14.00725 F2400
+G1 X82.396 Y86.246 E14.03302 F2400
+G1 X82.841 Y85.602 E14.05887 F2400
+G1 X83.309 Y84.971 E14.08478 F2400
+G1 X83.800 Y84.356 E14.11076 F2400
+G1 X84.315 Y83.757 E14.13681 F2400
+G1 X84.851 Y83.175 E14.16293 F2400
+G1 X85.409 Y82.611 E14.18912 F2400
+G1 X85.988 Y82.065 E14.21537 F2400
+G1 X86.587 Y81.538 E14.24170 F2400
+G1 X87.206 Y81.032 E14.26809 F2400
+G1 X87.844 Y80.546 E14.29455 F2400
+G1 X88.500 Y80.081 E14.32109 F2400
+G1 X89.174 Y79.639 E14.34769 F2400
+G1 X89.865 Y79.220 E14.37436 F2400
+G1 X90.572 Y78.824 E14.40110 F2400
+G1 X91.294 Y78.452 E14.42790 F2400
+G1 X92.031 Y78.105 E14.45478 F2400
+G1 X92.781 Y77.783 E14.48173 F2400
+G1 X93.545 Y77.487 E14.50874 F2400
+G1 X94.320 Y77.217 E14.53583 F2400
+G1 X95.106 Y76.974 E14.56298 F2400
+G1 X95.902 Y76.759 E14.59020 F2400
+G1 X96.707 Y76.570 E14.61749 F2400
+G1 X97.521 Y76.410 E14.64485 F2400
+G1 X98.341 Y76.278 E14.67228 F2400
+G1 X99.168 Y76.175 E14.69977 F2400
+G1 X100.000 Y76.100 E14.72734 F2400
+G1 X100.836 Y76.055 E14.75498 F2400
+G1 X101.676 Y76.039 E14.78268 F2400
+G1 X102.517 Y76.052 E14.81045 F2400
+G1 X103.360 Y76.095 E14.83829 F2400
+G1 X104.202 Y76.168 E14.86620 F2400
+G1 X105.044 Y76.270 E14.89418 F2400
+G1 X105.884 Y76.402 E14.92223 F2400
+G1 X106.720 Y76.564 E14.95035 F2400
+G1 X107.552 Y76.756 E14.97854 F2400
+G1 X108.379 Y76.978 E15.00679 F2400
+G1 X109.200 Y77.228 E15.03512 F2400
+G1 X110.014 Y77.509 E15.06351 F2400
+G1 X110.819 Y77.818 E15.09197 F2400
+G1 X111.615 Y78.156 E15.12050 F2400
+G1 X112.400 Y78.523 E15.14910 F2400
+G1 X113.174 Y78.918 E15.17777 F2400
+G1 X113.935 Y79.340 E15.20651 F2400
+G1 X114.683 Y79.791 E15.23532 F2400
+G1 X115.416 Y80.268 E15.26419 F2400
+G1 X116.134 Y80.772 E15.29314 F2400
+G1 X116.835 Y81.302 E15.32215 F2400
+G1 X117.519 Y81.858 E15.35124 F2400
+G1 X118.185 Y82.439 E15.38039 F2400
+G1 X118.831 Y83.044 E15.40961 F2400
+G1 X119.458 Y83.673 E15.43890 F2400
+G1 X120.063 Y84.325 E15.46826 F2400
+G1 X120.646 Y85.000 E15.49768 F2400
+G1 X121.207 Y85.696 E15.52718 F2400
+G1 X121.744 Y86.413 E15.55675 F2400
+G1 X122.257 Y87.150 E15.58638 F2400
+G1 X122.745 Y87.906 E15.61608 F2400
+G1 X123.207 Y88.681 E15.64586 F2400
+G1 X123.643 Y89.474 E15.67570 F2400
+G1 X124.051 Y90.283 E15.70561 F2400
+G1 X124.432 Y91.107 E15.73559 F2400
+G1 X124.785 Y91.947 E15.76563 F2400
+G1 X125.108 Y92.800 E15.79575 F2400
+G1 X125.402 Y93.666 E15.82594 F2400
+G1 X125.667 Y94.544 E15.85619 F2400
+G1 X125.900 Y95.433 E15.88652 F2400
+G1 X126.103 Y96.331 E15.91691 F2400
+G1 X126.275 Y97.238 E15.94737 F2400
+G1 X126.415 Y98.153 E15.97790 F2400
+G1 X126.524 Y99.074 E16.00850 F2400
+G1 X126.600 Y100.000 E16.03917 F2400
+G1 X90.043 Y119.236 E17.40238 F2400
+G1 X40.014 Y73.257 E19.64467 F2400
+G1 X57.611 Y50.157 E20.60294 F2400
+G1 X62.351 Y78.012 E21.53535 F2400
+G1 X87.612 Y99.270 E22.62486 F2400
+G1 X90.303 Y115.374 E23.16367 F2400
+G1 X64.534 Y136.593 E24.26524 F2400
+G1 X43.287 Y113.751 E25.29472 F2400
+G1 X90.077 Y101.456 E26.89121 F2400
+G1 X56.846 Y61.791 E28.59879 F2400
+G1 X136.089 Y146.509 E32.42686 F2400
+G1 X77.611 Y116.155 E34.60112 F2400
+G0 X137.500 Y100.000 F6000
+G1 X137.477 Y101.309 E34.64432 F3000
+G1 X137.409 Y102.616 E34.68751 F3000
+G1 X137.295 Y103.920 E34.73071 F3000
+G1 X137.135 Y105.219 E34.77390 F3000
+G1 X136.930 Y106.512 E34.81710 F3000
+G1 X136.681 Y107.797 E34.86029 F3000
+G1 X136.386 Y109.072 E34.90349 F3000
+G1 X136.047 Y110.336 E34.94668 F3000
+G1 X135.665 Y111.588 E34.98988 F3000
+G1 X135.238 Y112.826 E35.03307 F3000
+G1 X134.769 Y114.048 E35.07627 F3000
+G1 X134.258 Y115.253 E35.11946 F3000
+G1 X133.705 Y116.439 E35.16266 F3000
+G1 X133.111 Y117.605 E35.20585 F3000
+G1 X132.476 Y118.750 E35.24904 F3000
+G1 X131.802 Y119.872 E35.29224 F3000
+G1 X131.089 Y120.970 E35.33543 F3000
+G1 X130.338 Y122.042 E35.37863 F3000
+G1 X129.550 Y123.087 E35.42182 F3000
+G1 X128.727 Y124.105 E35.46502 F3000
+G1 X127.868 Y125.092 E35.50821 F3000
+G1 X126.975 Y126.050 E35.55141 F3000
+G1 X126.050 Y126.975 E35.59460 F3000
+G1 X125.092 Y127.868 E35.63780 F3000
+G1 X124.105 Y128.727 E35.68099 F3000
+G1 X123.087 Y129.550 E35.72419 F3000
+G1 X122.042 Y130.338 E35.76738 F3000
+G1 X120.970 Y131.089 E35.81058 F3000
+G1 X119.872 Y131.802 E35.85377 F3000
+G1 X118.750 Y132.476 E35.89697 F3000
+G1 X117.605 Y133.111 E35.94016 F3000
+G1 X116.439 Y133.705 E35.98335 F3000
+G1 X115.253 Y134.258 E36.02655 F3000
+G1 X114.048 Y134.769 E36.06974 F3000
+G1 X112.826 Y135.238 E36.11294 F3000
+G1 X111.588 Y135.665 E36.15613 F3000
+G1 X110.336 Y136.047 E36.19933 F3000
+G1 X109.072 Y136.386 E36.24252 F3000
+G1 X107.797 Y136.681 E36.28572 F3000
+G1 X106.512 Y136.930 E36.32891 F3000
+G1 X105.219 Y137.135 E36.37211 F3000
+G1 X103.920 Y137.295 E36.41530 F3000
+G1 X102.616 Y137.409 E36.45850 F3000
+G1 X101.309 Y137.477 E36.50169 F3000
+G1 X100.000 Y137.500 E36.54489 F3000
+G1 X98.691 Y137.477 E36.58808 F3000
+G1 X97.384 Y137.409 E36.63128 F3000
+G1 X96.080 Y137.295 E36.67447 F3000
+G1 X94.781 Y137.135 E36.71766 F3000
+G1 X93.488 Y136.930 E36.76086 F3000
+G1 X92.203 Y136.681 E36.80405 F3000
+G1 X90.928 Y136.386 E36.84725 F3000
+G1 X89.664 Y136.047 E36.89044 F3000
+G1 X88.412 Y135.665 E36.93364 F3000
+G1 X87.174 Y135.238 E36.97683 F3000
+G1 X85.952 Y134.769 E37.02003 F3000
+G1 X84.747 Y134.258 E37.06322 F3000
+G1 X83.561 Y133.705 E37.10642 F3000
+G1 X82.395 Y133.111 E37.14961 F3000
+G1 X81.250 Y132.476 E37.19281 F3000
+G1 X80.128 Y131.802 E37.23600 F3000
+G1 X79.030 Y131.089 E37.27920 F3000
+G1 X77.958 Y130.338 E37.32239 F3000
+G1 X76.913 Y129.550 E37.36559 F3000
+G1 X75.895 Y128.727 E37.40878 F3000
+G1 X74.908 Y127.868 E37.45197 F3000
+G1 X73.950 Y126.975 E37.49517 F3000
+G1 X73.025 Y126.050 E37.53836 F3000
+G1 X72.132 Y125.092 E37.58156 F3000
+G1 X71.273 Y124.105 E37.62475 F3000
+G1 X70.450 Y123.087 E37.66795 F3000
+G1 X69.662 Y122.042 E37.71114 F3000
+G1 X68.911 Y120.970 E37.75434 F3000
+G1 X68.198 Y119.872 E37.79753 F3000
+G1 X67.524 Y118.750 E37.84073 F3000
+G1 X66.889 Y117.605 E37.88392 F3000
+G1 X66.295 Y116.439 E37.92712 F3000
+G1 X65.742 Y115.253 E37.97031 F3000
+G1 X65.231 Y114.048 E38.01351 F3000
+G1 X64.762 Y112.826 E38.05670 F3000
+G1 X64.335 Y111.588 E38.09990 F3000
+G1 X63.953 Y110.336 E38.14309 F3000
+G1 X63.614 Y109.072 E38.18628 F3000
+G1 X63.319 Y107.797 E38.22948 F3000
+G1 X63.070 Y106.512 E38.27267 F3000
+G1 X62.865 Y105.219 E38.31587 F3000
+G1 X62.705 Y103.920 E38.35906 F3000
+G1 X62.591 Y102.616 E38.40226 F3000
+G1 X62.523 Y101.309 E38.44545 F3000
+G1 X62.500 Y100.000 E38.48865 F3000
+G1 X62.523 Y98.691 E38.53184 F3000
+G1 X62.591 Y97.384 E38.57504 F3000
+G1 X62.705 Y96.080 E38.61823 F3000
+G1 X62.865 Y94.781 E38.66143 F3000
+G1 X63.070 Y93.488 E38.70462 F3000
+G1 X63.319 Y92.203 E38.74782 F3000
+G1 X63.614 Y90.928 E38.79101 F3000
+G1 X63.953 Y89.664 E38.83421 F3000
+G1 X64.335 Y88.412 E38.87740 F3000
+G1 X64.762 Y87.174 E38.92059 F3000
+G1 X65.231 Y85.952 E38.96379 F3000
+G1 X65.742 Y84.747 E39.00698 F3000
+G1 X66.295 Y83.561 E39.05018 F3000
+G1 X66.889 Y82.395 E39.09337 F3000
+G1 X67.524 Y81.250 E39.13657 F3000
+G1 X68.198 Y80.128 E39.17976 F3000
+G1 X68.911 Y79.030 E39.22296 F3000
+G1 X69.662 Y77.958 E39.26615 F3000
+G1 X70.450 Y76.913 E39.30935 F3000
+G1 X71.273 Y75.895 E39.35254 F3000
+G1 X72.132 Y74.908 E39.39574 F3000
+G1 X73.025 Y73.950 E39.43893 F3000
+G1 X73.950 Y73.025 E39.48213 F3000
+G1 X74.908 Y72.132 E39.52532 F3000
+G1 X75.895 Y71.273 E39.56852 F3000
+G1 X76.913 Y70.450 E39.61171 F3000
+G1 X77.958 Y69.662 E39.65490 F3000
+G1 X79.030 Y68.911 E39.69810 F3000
+G1 X80.128 Y68.198 E39.74129 F3000
+G1 X81.250 Y67.524 E39.78449 F3000
+G1 X82.395 Y66.889 E39.82768 F3000
+G1 X83.561 Y66.295 E39.87088 F3000
+G1 X84.747 Y65.742 E39.91407 F3000
+G1 X85.952 Y65.231 E39.95727 F3000
+G1 X87.174 Y64.762 E40.00046 F3000
+G1 X88.412 Y64.335 E40.04366 F3000
+G1 X89.664 Y63.953 E40.08685 F3000
+G1 X90.928 Y63.614 E40.13005 F3000
+G1 X92.203 Y63.319 E40.17324 F3000
+G1 X93.488 Y63.070 E40.21644 F3000
+G1 X94.781 Y62.865 E40.25963 F3000
+G1 X96.080 Y62.705 E40.30283 F3000
+G1 X97.384 Y62.591 E40.34602 F3000
+G1 X98.691 Y62.523 E40.38921 F3000
+G1 X100.000 Y62.500 E40.43241 F3000
+G1 X101.309 Y62.523 E40.47560 F3000
+G1 X102.616 Y62.591 E40.51880 F3000
+G1 X103.920 Y62.705 E40.56199 F3000
+G1 X105.219 Y62.865 E40.60519 F3000
+G1 X106.512 Y63.070 E40.64838 F3000
+G1 X107.797 Y63.319 E40.69158 F3000
+G1 X109.072 Y63.614 E40.73477 F3000
+G1 X110.336 Y63.953 E40.77797 F3000
+G1 X111.588 Y64.335 E40.82116 F3000
+G1 X112.826 Y64.762 E40.86436 F3000
+G1 X114.048 Y65.231 E40.90755 F3000
+G1 X115.253 Y65.742 E40.95075 F3000
+G1 X116.439 Y66.295 E40.99394 F3000
+G1 X117.605 Y66.889 E41.03714 F3000
+G1 X118.750 Y67.524 E41.08033 F3000
+G1 X119.872 Y68.198 E41.12352 F3000
+G1 X120.970 Y68.911 E41.16672 F3000
+G1 X122.042 Y69.662 E41.20991 F3000
+G1 X123.087 Y70.450 E41.25311 F3000
+G1 X124.105 Y71.273 E41.29630 F3000
+G1 X125.092 Y72.132 E41.33950 F3000
+G1 X126.050 Y73.025 E41.38269 F3000
+G1 X126.975 Y73.950 E41.42589 F3000
+G1 X127.868 Y74.908 E41.46908 F3000
+G1 X128.727 Y75.895 E41.51228 F3000
+G1 X129.550 Y76.913 E41.55547 F3000
+G1 X130.338 Y77.958 E41.59867 F3000
+G1 X131.089 Y79.030 E41.64186 F3000
+G1 X131.802 Y80.128 E41.68506 F3000
+G1 X132.476 Y81.250 E41.72825 F3000
+G1 X133.111 Y82.395 E41.77145 F3000
+G1 X133.705 Y83.561 E41.81464 F3000
+G1 X134.258 Y84.747 E41.85783 F3000
+G1 X134.769 Y85.952 E41.90103 F3000
+G1 X135.238 Y87.174 E41.94422 F3000
+G1 X135.665 Y88.412 E41.98742 F3000
+G1 X136.047 Y89.664 E42.03061 F3000
+G1 X136.386 Y90.928 E42.07381 F3000
+G1 X136.681 Y92.203 E42.11700 F3000
+G1 X136.930 Y93.488 E42.16020 F3000
+G1 X137.135 Y94.781 E42.20339 F3000
+G1 X137.295 Y96.080 E42.24659 F3000
+G1 X137.409 Y97.384 E42.28978 F3000
+G1 X137.477 Y98.691 E42.33298 F3000
+G1 X137.500 Y100.000 E42.37617 F3000
+G1 X105.057 Y100.177 E43.44681 F2400
+G1 X105.108 Y100.357 E43.45300 F2400
+G1 X105.152 Y100.541 E43.45925 F2400
+G1 X105.189 Y100.729 E43.46557 F2400
+G1 X105.219 Y100.920 E43.47195 F2400
+G1 X105.243 Y101.114 E43.47841 F2400
+G1 X105.259 Y101.311 E43.48492 F2400
+G1 X105.268 Y101.510 E43.49150 F2400
+G1 X105.269 Y101.712 E43.49815 F2400
+G1 X105.262 Y101.915 E43.50487 F2400
+G1 X105.248 Y102.120 E43.51165 F2400
+G1 X105.225 Y102.327 E43.51849 F2400
+G1 X105.195 Y102.534 E43.52541 F2400
+G1 X105.156 Y102.742 E43.53239 F2400
+G1 X105.110 Y102.950 E43.53943 F2400
+G1 X105.054 Y103.158 E43.54654 F2400
+G1 X104.991 Y103.366 E43.55372 F2400
+G1 X104.919 Y103.574 E43.56097 F2400
+G1 X104.838 Y103.780 E43.56828 F2400
+G1 X104.749 Y103.985 E43.57565 F2400
+G1 X104.652 Y104.189 E43.58310 F2400
+G1 X104.546 Y104.390 E43.59061 F2400
+G1 X104.432 Y104.589 E43.59819 F2400
+G1 X104.309 Y104.786 E43.60583 F2400
+G1 X104.178 Y104.979 E43.61354 F2400
+G1 X104.039 Y105.169 E43.62132 F2400
+G1 X103.891 Y105.356 E43.62916 F2400
+G1 X103.735 Y105.538 E43.63708 F2400
+G1 X103.572 Y105.716 E43.64505 F2400
+G1 X103.400 Y105.889 E43.65310 F2400
+G1 X103.221 Y106.057 E43.66121 F2400
+G1 X103.034 Y106.220 E43.66939 F2400
+G1 X102.839 Y106.377 E43.67764 F2400
+G1 X102.637 Y106.527 E43.68595 F2400
+G1 X102.428 Y106.672 E43.69433 F2400
+G1 X102.213 Y106.810 E43.70278 F2400
+G1 X101.990 Y106.940 E43.71130 F2400
+G1 X101.761 Y107.064 E43.71988 F2400
+G1 X101.526 Y107.180 E43.72853 F2400
+G1 X101.285 Y107.288 E43.73724 F2400
+G1 X101.038 Y107.387 E43.74603 F2400
+G1 X100.786 Y107.479 E43.75488 F2400
+G1 X100.529 Y107.562 E43.76380 F2400
+G1 X100.267 Y107.635 E43.77279 F2400
+G1 X100.000 Y107.700 E43.78184 F2400
+G1 X99.729 Y107.755 E43.79096 F2400
+G1 X99.455 Y107.801 E43.80015 F2400
+G1 X99.176 Y107.837 E43.80941 F2400
+G1 X98.895 Y107.863 E43.81873 F2400
+G1 X98.611 Y107.878 E43.82812 F2400
+G1 X98.324 Y107.884 E43.83758 F2400
+G1 X98.036 Y107.879 E43.84711 F2400
+G1 X97.745 Y107.863 E43.85670 F2400
+G1 X97.454 Y107.837 E43.86636 F2400
+G1 X97.161 Y107.799 E43.87609 F2400
+G1 X96.868 Y107.751 E43.88589 F2400
+G1 X96.575 Y107.692 E43.89575 F2400
+G1 X96.283 Y107.622 E43.90569 F2400
+G1 X95.991 Y107.540 E43.91569 F2400
+G1 X95.700 Y107.448 E43.92575 F2400
+G1 X95.411 Y107.344 E43.93589 F2400
+G1 X95.124 Y107.229 E43.94609 F2400
+G1 X94.839 Y107.103 E43.95637 F2400
+G1 X94.558 Y106.966 E43.96670 F2400
+G1 X94.279 Y106.818 E43.97711 F2400
+G1 X94.005 Y106.659 E43.98759 F2400
+G1 X93.734 Y106.488 E43.99813 F2400
+G1 X93.468 Y106.307 E44.00874 F2400
+G1 X93.208 Y106.116 E44.01942 F2400
+G1 X92.952 Y105.914 E44.03016 F2400
+G1 X92.703 Y105.701 E44.04098 F2400
+G1 X92.460 Y105.478 E44.05186 F2400
+G1 X92.224 Y105.245 E44.06281 F2400
+G1 X91.994 Y105.002 E44.07383 F2400
+G1 X91.773 Y104.750 E44.08492 F2400
+G1 X91.559 Y104.488 E44.09607 F2400
+G1 X91.354 Y104.217 E44.10729 F2400
+G1 X91.157 Y103.937 E44.11858 F2400
+G1 X90.969 Y103.649 E44.12994 F2400
+G1 X90.791 Y103.352 E44.14137 F2400
+G1 X90.623 Y103.047 E44.15286 F2400
+G1 X90.464 Y102.734 E44.16443 F2400
+G1 X90.316 Y102.414 E44.17606 F2400
+G1 X90.179 Y102.087 E44.18776 F2400
+G1 X90.053 Y101.754 E44.19952 F2400
+G1 X89.939 Y101.414 E44.21136 F2400
+G1 X89.836 Y101.068 E44.22326 F2400
+G1 X89.745 Y100.717 E44.23523 F2400
+G1 X89.666 Y100.361 E44.24727 F2400
+G1 X89.600 Y100.000 E44.25938 F2400
+G1 X89.546 Y99.635 E44.27155 F2400
+G1 X89.506 Y99.266 E44.28380 F2400
+G1 X89.478 Y98.894 E44.29611 F2400
+G1 X89.464 Y98.519 E44.30849 F2400
+G1 X89.463 Y98.142 E44.32094 F2400
+G1 X89.475 Y97.763 E44.33346 F2400
+G1 X89.501 Y97.382 E44.34604 F2400
+G1 X89.541 Y97.001 E44.35870 F2400
+G1 X89.595 Y96.619 E44.37142 F2400
+G1 X89.663 Y96.238 E44.38421 F2400
+G1 X89.745 Y95.857 E44.39707 F2400
+G1 X89.841 Y95.477 E44.40999 F2400
+G1 X89.951 Y95.099 E44.42299 F2400
+G1 X90.076 Y94.723 E44.43605 F2400
+G1 X90.214 Y94.350 E44.44918 F2400
+G1 X90.366 Y93.980 E44.46238 F2400
+G1 X90.532 Y93.614 E44.47565 F2400
+G1 X90.712 Y93.252 E44.48899 F2400
+G1 X90.906 Y92.895 E44.50239 F2400
+G1 X91.114 Y92.544 E44.51587 F2400
+G1 X91.335 Y92.198 E44.52941 F2400
+G1 X91.569 Y91.859 E44.54302 F2400
+G1 X91.817 Y91.526 E44.55670 F2400
+G1 X92.077 Y91.201 E44.57044 F2400
+G1 X92.351 Y90.884 E44.58426 F2400
+G1 X92.637 Y90.575 E44.59814 F2400
+G1 X92.935 Y90.276 E44.61209 F2400
+G1 X93.245 Y89.985 E44.62611 F2400
+G1 X93.567 Y89.705 E44.64020 F2400
+G1 X93.900 Y89.434 E44.65436 F2400
+G1 X94.244 Y89.175 E44.66858 F2400
+G1 X94.599 Y88.927 E44.68288 F2400
+G1 X94.965 Y88.690 E44.69724 F2400
+G1 X95.340 Y88.466 E44.71167 F2400
+G1 X95.725 Y88.254 E44.72617 F2400
+G1 X96.119 Y88.055 E44.74074 F2400
+G1 X96.521 Y87.869 E44.75538 F2400
+G1 X96.932 Y87.697 E44.77008 F2400
+G1 X97.351 Y87.538 E44.78485 F2400
+G1 X97.777 Y87.394 E44.79970 F2400
+G1 X98.210 Y87.265 E44.81461 F2400
+G1 X98.649 Y87.151 E44.82959 F2400
+G1 X99.095 Y87.052 E44.84463 F2400
+G1 X99.545 Y86.968 E44.85975 F2400
+G1 X100.000 Y86.900 E44.87493 F2400
+G1 X100.459 Y86.848 E44.89019 F2400
+G1 X100.922 Y86.812 E44.90551 F2400
+G1 X101.388 Y86.793 E44.92090 F2400
+G1 X101.857 Y86.790 E44.93636 F2400
+G1 X102.327 Y86.804 E44.95188 F2400
+G1 X102.798 Y86.834 E44.96748 F2400
+G1 X103.271 Y86.882 E44.98314 F2400
+G1 X103.743 Y86.946 E44.99888 F2400
+G1 X104.215 Y87.028 E45.01468 F2400
+G1 X104.686 Y87.126 E45.03055 F2400
+G1 X105.155 Y87.242 E45.04649 F2400
+G1 X105.621 Y87.375 E45.06249 F2400
+G1 X106.085 Y87.525 E45.07857 F2400
+G1 X106.544 Y87.692 E45.09471 F2400
+G1 X107.000 Y87.876 E45.11093 F2400
+G1 X107.451 Y88.076 E45.12721 F2400
+G1 X107.896 Y88.294 E45.14356 F2400
+G1 X108.335 Y88.528 E45.15998 F2400
+G1 X108.767 Y88.779 E45.17646 F2400
+G1 X109.192 Y89.046 E45.19302 F2400
+G1 X109.609 Y89.328 E45.20964 F2400
+G1 X110.017 Y89.627 E45.22634 F2400
+G1 X110.416 Y89.941 E45.24310 F2400
+G1 X110.805 Y90.271 E45.25993 F2400
+G1 X111.184 Y90.615 E45.27683 F2400
+G1 X111.552 Y90.974 E45.29379 F2400
+G1 X111.909 Y91.348 E45.31083 F2400
+G1 X112.253 Y91.735 E45.32794 F2400
+G1 X112.585 Y92.136 E45.34511 F2400
+G1 X112.904 Y92.550 E45.36235 F2400
+G1 X113.209 Y92.977 E45.37966 F2400
+G1 X113.500 Y93.416 E45.39704 F2400
+G1 X113.776 Y93.866 E45.41449 F2400
+G1 X114.038 Y94.328 E45.43201 F2400
+G1 X114.283 Y94.801 E45.44959 F2400
+G1 X114.513 Y95.284 E45.46725 F2400
+G1 X114.727 Y95.777 E45.48497 F2400
+G1 X114.923 Y96.279 E45.50276 F2400
+G1 X115.103 Y96.790 E45.52062 F2400
+G1 X115.265 Y97.308 E45.53855 F2400
+G1 X115.409 Y97.834 E45.55655 F2400
+G1 X115.534 Y98.367 E45.57461 F2400
+G1 X115.642 Y98.906 E45.59275 F2400
+G1 X115.730 Y99.451 E45.61095 F2400
+G1 X115.800 Y100.000 E45.62922 F2400
+G1 X115.850 Y100.554 E45.64757 F2400
+G1 X115.881 Y101.111 E45.66597 F2400
+G1 X115.892 Y101.670 E45.68445 F2400
+G1 X115.884 Y102.232 E45.70300 F2400
+G1 X115.855 Y102.796 E45.72162 F2400
+G1 X115.807 Y103.360 E45.74030 F2400
+G1 X115.738 Y103.924 E45.75905 F2400
+G1 X115.649 Y104.487 E45.77788 F2400
+G1 X115.540 Y105.049 E45.79677 F2400
+G1 X115.411 Y105.609 E45.81573 F2400
+G1 X115.261 Y106.166 E45.83476 F2400
+G1 X115.092 Y106.719 E45.85385 F2400
+G1 X114.902 Y107.268 E45.87302 F2400
+G1 X114.692 Y107.812 E45.89225 F2400
+G1 X114.463 Y108.350 E45.91156 F2400
+G1 X114.213 Y108.881 E45.93093 F2400
+G1 X113.944 Y109.406 E45.95037 F2400
+G1 X113.656 Y109.922 E45.96988 F2400
+G1 X113.349 Y110.429 E45.98946 F2400
+G1 X113.023 Y110.927 E46.00910 F2400
+G1 X112.678 Y111.415 E46.02882 F2400
+G1 X112.315 Y111.893 E46.04860 F2400
+G1 X111.934 Y112.358 E46.06846 F2400
+G1 X111.536 Y112.812 E46.08838 F2400
+G1 X111.120 Y113.253 E46.10837 F2400
+G1 X110.688 Y113.680 E46.12843 F2400
+G1 X110.239 Y114.093 E46.14856 F2400
+G1 X109.775 Y114.492 E46.16876 F2400
+G1 X109.295 Y114.875 E46.18902 F2400
+G1 X108.800 Y115.242 E46.20936 F2400
+G1 X108.291 Y115.593 E46.22976 F2400
+G1 X107.768 Y115.927 E46.25023 F2400
+G1 X107.232 Y116.243 E46.27077 F2400
+G1 X106.683 Y116.541 E46.29138 F2400
+G1 X106.122 Y116.820 E46.31206 F2400
+G1 X105.550 Y117.081 E46.33281 F2400
+G1 X104.967 Y117.322 E46.35363 F2400
+G1 X104.374 Y117.543 E46.37451 F2400
+G1 X103.772 Y117.744 E46.39546 F2400
+G1 X103.160 Y117.924 E46.41649 F2400
+G1 X102.541 Y118.082 E46.43758 F2400
+G1 X101.915 Y118.220 E46.45874 F2400
+G1 X101.282 Y118.335 E46.47997 F2400
+G1 X100.644 Y118.429 E46.50127 F2400
+G1 X100.000 Y118.500 E46.52263 F2400
+G1 X99.352 Y118.549 E46.54407 F2400
+G1 X98.701 Y118.575 E46.56557 F2400
+G1 X98.047 Y118.578 E46.58715 F2400
+G1 X97.392 Y118.558 E46.60879 F2400
+G1 X96.735 Y118.514 E46.63050 F2400
+G1 X96.079 Y118.448 E46.65228 F2400
+G1 X95.423 Y118.358 E46.67413 F2400
+G1 X94.768 Y118.245 E46.69604 F2400
+G1 X94.116 Y118.108 E46.71803 F2400
+G1 X93.467 Y117.948 E46.74009 F2400
+G1 X92.823 Y117.765 E46.76221 F2400
+G1 X92.183 Y117.558 E46.78440 F2400
+G1 X91.548 Y117.329 E46.80666 F2400
+G1 X90.920 Y117.076 E46.82899 F2400
+G1 X90.300 Y116.801 E46.85139 F2400
+G1 X89.688 Y116.503 E46.87386 F2400
+G1 X89.085 Y116.183 E46.89640 F2400
+G1 X88.491 Y115.841 E46.91900 F2400
+G1 X87.908 Y115.477 E46.94168 F2400
+G1 X87.337 Y115.091 E46.96442 F2400
+G1 X86.778 Y114.685 E46.98723 F2400
+G1 X86.232 Y114.257 E47.01011 F2400
+G1 X85.700 Y113.810 E47.03306 F2400
+G1 X85.182 Y113.342 E47.05608 F2400
+G1 X84.679 Y112.856 E47.07917 F2400
+G1 X84.193 Y112.350 E47.10233 F2400
+G1 X83.723 Y111.826 E47.12555 F2400
+G1 X83.270 Y111.285 E47.14885 F2400
+G1 X82.836 Y110.726 E47.17221 F2400
+G1 X82.420 Y110.150 E47.19564 F2400
+G1 X82.023 Y109.558 E47.21914 F2400
+G1 X81.647 Y108.952 E47.24271 F2400
+G1 X81.291 Y108.330 E47.26635 F2400
+G1 X80.956 Y107.694 E47.29006 F2400
+G1 X80.642 Y107.046 E47.31384 F2400
+G1 X80.351 Y106.384 E47.33768 F2400
+G1 X80.083 Y105.711 E47.36159 F2400
+G1 X79.837 Y105.027 E47.38558 F2400
+G1 X79.615 Y104.333 E47.40963 F2400
+G1 X79.418 Y103.629 E47.43375 F2400
+G1 X79.244 Y102.917 E47.45794 F2400
+G1 X79.095 Y102.197 E47.48220 F2400
+G1 X78.971 Y101.470 E47.50653 F2400
+G1 X78.873 Y100.738 E47.53092 F2400
+G1 X78.800 Y100.000 E47.55539 F2400
+G1 X78.753 Y99.258 E47.57992 F2400
+G1 X78.732 Y98.513 E47.60452 F2400
+G1 X78.737 Y97.765 E47.62919 F2400
+G1 X78.769 Y97.016 E47.65394 F2400
+G1 X78.827 Y96.267 E47.67875 F2400
+G1 X78.911 Y95.517 E47.70362 F2400
+G1 X79.022 Y94.770 E47.72857 F2400
+G1 X79.160 Y94.024 E47.75359 F2400
+G1 X79.324 Y93.282 E47.77867 F2400
+G1 X79.515 Y92.544 E47.80383 F2400
+G1 X79.732 Y91.811 E47.82905 F2400
+G1 X79.975 Y91.084 E47.85434 F2400
+G1 X80.245 Y90.365 E47.87970 F2400
+G1 X80.540 Y89.653 E47.90513 F2400
+G1 X80.861 Y88.950 E47.93063 F2400
+G1 X81.207 Y88.257 E47.95620 F2400
+G1 X81.579 Y87.575 E47.98183 F2400
+G1 X81.975 Y86.904 E48.00754 F2400
+G1 X82.396 Y86.246 E48.03331 F2400
+G1 X82.841 Y85.602 E48.05916 F2400
+G1 X83.309 Y84.971 E48.08507 F2400
+G1 X83.800 Y84.356 E48.11105 F2400
+G1 X84.315 Y83.757 E48.13710 F2400
+G1 X84.851 Y83.175 E48.16322 F2400
+G1 X85.409 Y82.611 E48.18940 F2400
+G1 X85.988 Y82.065 E48.21566 F2400
+G1 X86.587 Y81.538 E48.24199 F2400
+G1 X87.206 Y81.032 E48.26838 F2400
+G1 X87.844 Y80.546 E48.29484 F2400
+G1 X88.500 Y80.081 E48.32138 F2400
+G1 X89.174 Y79.639 E48.34798 F2400
+G1 X89.865 Y79.220 E48.37465 F2400
+G1 X90.572 Y78.824 E48.40139 F2400
+G1 X91.294 Y78.452 E48.42819 F2400
+G1 X92.031 Y78.105 E48.45507 F2400
+G1 X92.781 Y77.783 E48.48202 F2400
+G1 X93.545 Y77.487 E48.50903 F2400
+G1 X94.320 Y77.217 E48.53611 F2400
+G1 X95.106 Y76.974 E48.56327 F2400
+G1 X95.902 Y76.759 E48.59049 F2400
+G1 X96.707 Y76.570 E48.61778 F2400
+G1 X97.521 Y76.410 E48.64514 F2400
+G1 X98.341 Y76.278 E48.67257 F2400
+G1 X99.168 Y76.175 E48.70006 F2400
+G1 X100.000 Y76.100 E48.72763 F2400
+G1 X100.836 Y76.055 E48.75526 F2400
+G1 X101.676 Y76.039 E48.78297 F2400
+G1 X102.517 Y76.052 E48.81074 F2400
+G1 X103.360 Y76.095 E48.83858 F2400
+G1 X104.202 Y76.168 E48.86649 F2400
+G1 X105.044 Y76.270 E48.89447 F2400
+G1 X105.884 Y76.402 E48.92252 F2400
+G1 X106.720 Y76.564 E48.95064 F2400
+G1 X107.552 Y76.756 E48.97883 F2400
+G1 X108.379 Y76.978 E49.00708 F2400
+G1 X109.200 Y77.228 E49.03541 F2400
+G1 X110.014 Y77.509 E49.06380 F2400
+G1 X110.819 Y77.818 E49.09226 F2400
+G1 X111.615 Y78.156 E49.12079 F2400
+G1 X112.400 Y78.523 E49.14939 F2400
+G1 X113.174 Y78.918 E49.17806 F2400
+G1 X113.935 Y79.340 E49.20680 F2400
+G1 X114.683 Y79.791 E49.23561 F2400
+G1 X115.416 Y80.268 E49.26448 F2400
+G1 X116.134 Y80.772 E49.29343 F2400
+G1 X116.835 Y81.302 E49.32244 F2400
+G1 X117.519 Y81.858 E49.35152 F2400
+G1 X118.185 Y82.439 E49.38068 F2400
+G1 X118.831 Y83.044 E49.40990 F2400
+G1 X119.458 Y83.673 E49.43919 F2400
+G1 X120.063 Y84.325 E49.46854 F2400
+G1 X120.646 Y85.000 E49.49797 F2400
+G1 X121.207 Y85.696 E49.52747 F2400
+G1 X121.744 Y86.413 E49.55703 F2400
+G1 X122.257 Y87.150 E49.58667 F2400
+G1 X122.745 Y87.906 E49.61637 F2400
+G1 X123.207 Y88.681 E49.64614 F2400
+G1 X123.643 Y89.474 E49.67599 F2400
+G1 X124.051 Y90.283 E49.70590 F2400
+G1 X124.432 Y91.107 E49.73587 F2400
+G1 X124.785 Y91.947 E49.76592 F2400
+G1 X125.108 Y92.800 E49.79604 F2400
+G1 X125.402 Y93.666 E49.82623 F2400
+G1 X125.667 Y94.544 E49.85648 F2400
+G1 X125.900 Y95.433 E49.88681 F2400
+G1 X126.103 Y96.331 E49.91720 F2400
+G1 X126.275 Y97.238 E49.94766 F2400
+G1 X126.415 Y98.153 E49.97819 F2400
+G1 X126.524 Y99.074 E50.00879 F2400
+G1 X126.600 Y100.000 E50.03946 F2400
+G1 X145.167 Y138.407 E51.44721 F2400
+G1 X50.205 Y44.296 E55.85916 F2400
+G1 X60.380 Y136.596 E58.92350 F2400
+G1 X51.802 Y86.322 E60.60651 F2400
+G1 X154.947 Y98.648 E64.03452 F2400
+G1 X123.025 Y74.707 E65.35129 F2400
+G1 X122.380 Y131.809 E67.23578 F2400
+G1 X42.195 Y122.516 E69.89961 F2400
+G1 X158.663 Y122.298 E73.74309 F2400
+G1 X73.653 Y126.821 E76.55239 F2400
+G1 X52.387 Y89.268 E77.97653 F2400
+G1 X149.031 Y72.298 E81.21459 F2400
+G0 X135.000 Y100.000 F6000
+G1 X134.979 Y101.221 E81.25491 F3000
+G1 X134.915 Y102.441 E81.29522 F3000
+G1 X134.808 Y103.658 E81.33554 F3000
+G1 X134.659 Y104.871 E81.37585 F3000
+G1 X134.468 Y106.078 E81.41617 F3000
+G1 X134.235 Y107.277 E81.45648 F3000
+G1 X133.960 Y108.467 E81.49680 F3000
+G1 X133.644 Y109.647 E81.53711 F3000
+G1 X133.287 Y110.816 E81.57743 F3000
+G1 X132.889 Y111.971 E81.61774 F3000
+G1 X132.451 Y113.111 E81.65806 F3000
+G1 X131.974 Y114.236 E81.69837 F3000
+G1 X131.458 Y115.343 E81.73869 F3000
+G1 X130.903 Y116.432 E81.77900 F3000
+G1 X130.311 Y117.500 E81.81932 F3000
+G1 X129.682 Y118.547 E81.85963 F3000
+G1 X129.016 Y119.572 E81.89995 F3000
+G1 X128.316 Y120.572 E81.94027 F3000
+G1 X127.580 Y121.548 E81.98058 F3000
+G1 X126.812 Y122.498 E82.02090 F3000
+G1 X126.010 Y123.420 E82.06121 F3000
+G1 X125.177 Y124.313 E82.10153 F3000
+G1 X124.313 Y125.177 E82.14184 F3000
+G1 X123.420 Y126.010 E82.18216 F3000
+G1 X122.498 Y126.812 E82.22247 F3000
+G1 X121.548 Y127.580 E82.26279 F3000
+G1 X120.572 Y128.316 E82.30310 F3000
+G1 X119.572 Y129.016 E82.34342 F3000
+G1 X118.547 Y129.682 E82.38373 F3000
+G1 X117.500 Y130.311 E82.42405 F3000
+G1 X116.432 Y130.903 E82.46436 F3000
+G1 X115.343 Y131.458 E82.50468 F3000
+G1 X114.236 Y131.974 E82.54499 F3000
+G1 X113.111 Y132.451 E82.58531 F3000
+G1 X111.971 Y132.889 E82.62562 F3000
+G1 X110.816 Y133.287 E82.66594 F3000
+G1 X109.647 Y133.644 E82.70625 F3000
+G1 X108.467 Y133.960 E82.74657 F3000
+G1 X107.277 Y134.235 E82.78688 F3000
+G1 X106.078 Y134.468 E82.82720 F3000
+G1 X104.871 Y134.659 E82.86751 F3000
+G1 X103.658 Y134.808 E82.90783 F3000
+G1 X102.441 Y134.915 E82.94814 F3000
+G1 X101.221 Y134.979 E82.98846 F3000
+G1 X100.000 Y135.000 E83.02877 F3000
+G1 X98.779 Y134.979 E83.06909 F3000
+G1 X97.559 Y134.915 E83.10940 F3000
+G1 X96.342 Y134.808 E83.14972 F3000
+G1 X95.129 Y134.659 E83.19003 F3000
+G1 X93.922 Y134.468 E83.23035 F3000
+G1 X92.723 Y134.235 E83.27066 F3000
+G1 X91.533 Y133.960 E83.31098 F3000
+G1 X90.353 Y133.644 E83.35129 F3000
+G1 X89.184 Y133.287 E83.39161 F3000
+G1 X88.029 Y132.889 E83.43192 F3000
+G1 X86.889 Y132.451 E83.47224 F3000
+G1 X85.764 Y131.974 E83.51255 F3000
+G1 X84.657 Y131.458 E83.55287 F3000
+G1 X83.568 Y130.903 E83.59318 F3000
+G1 X82.500 Y130.311 E83.63350 F3000
+G1 X81.453 Y129.682 E83.67381 F3000
+G1 X80.428 Y129.016 E83.71413 F3000
+G1 X79.428 Y128.316 E83.75444 F3000
+G1 X78.452 Y127.580 E83.79476 F3000
+G1 X77.502 Y126.812 E83.83507 F3000
+G1 X76.580 Y126.010 E83.87539 F3000
+G1 X75.687 Y125.177 E83.91570 F3000
+G1 X74.823 Y124.313 E83.95602 F3000
+G1 X73.990 Y123.420 E83.99633 F3000
+G1 X73.188 Y122.498 E84.03665 F3000
+G1 X72.420 Y121.548 E84.07696 F3000
+G1 X71.684 Y120.572 E84.11728 F3000
+G1 X70.984 Y119.572 E84.15759 F3000
+G1 X70.318 Y118.547 E84.19791 F3000
+G1 X69.689 Y117.500 E84.23822 F3000
+G1 X69.097 Y116.432 E84.27854 F3000
+G1 X68.542 Y115.343 E84.31885 F3000
+G1 X68.026 Y114.236 E84.35917 F3000
+G1 X67.549 Y113.111 E84.39948 F3000
+G1 X67.111 Y111.971 E84.43980 F3000
+G1 X66.713 Y110.816 E84.48011 F3000
+G1 X66.356 Y109.647 E84.52043 F3000
+G1 X66.040 Y108.467 E84.56074 F3000
+G1 X65.765 Y107.277 E84.60106 F3000
+G1 X65.532 Y106.078 E84.64137 F3000
+G1 X65.341 Y104.871 E84.68169 F3000
+G1 X65.192 Y103.658 E84.72200 F3000
+G1 X65.085 Y102.441 E84.76232 F3000
+G1 X65.021 Y101.221 E84.80263 F3000
+G1 X65.000 Y100.000 E84.84295 F3000
+G1 X65.021 Y98.779 E84.88326 F3000
+G1 X65.085 Y97.559 E84.92358 F3000
+G1 X65.192 Y96.342 E84.96389 F3000
+G1 X65.341 Y95.129 E85.00421 F3000
+G1 X65.532 Y93.922 E85.04452 F3000
+G1 X65.765 Y92.723 E85.08484 F3000
+G1 X66.040 Y91.533 E85.12515 F3000
+G1 X66.356 Y90.353 E85.16547 F3000
+G1 X66.713 Y89.184 E85.20578 F3000
+G1 X67.111 Y88.029 E85.24610 F3000
+G1 X67.549 Y86.889 E85.28641 F3000
+G1 X68.026 Y85.764 E85.32673 F3000
+G1 X68.542 Y84.657 E85.36705 F3000
+G1 X69.097 Y83.568 E85.40736 F3000
+G1 X69.689 Y82.500 E85.44768 F3000
+G1 X70.318 Y81.453 E85.48799 F3000
+G1 X70.984 Y80.428 E85.52831 F3000
+G1 X71.684 Y79.428 E85.56862 F3000
+G1 X72.420 Y78.452 E85.60894 F3000
+G1 X73.188 Y77.502 E85.64925 F3000
+G1 X73.990 Y76.580 E85.68957 F3000
+G1 X74.823 Y75.687 E85.72988 F3000
+G1 X75.687 Y74.823 E85.77020 F3000
+G1 X76.580 Y73.990 E85.81051 F3000
+G1 X77.502 Y73.188 E85.85083 F3000
+G1 X78.452 Y72.420 E85.89114 F3000
+G1 X79.428 Y71.684 E85.93146 F3000
+G1 X80.428 Y70.984 E85.97177 F3000
+G1 X81.453 Y70.318 E86.01209 F3000
+G1 X82.500 Y69.689 E86.05240 F3000
+G1 X83.568 Y69.097 E86.09272 F3000
+G1 X84.657 Y68.542 E86.13303 F3000
+G1 X85.764 Y68.026 E86.17335 F3000
+G1 X86.889 Y67.549 E86.21366 F3000
+G1 X88.029 Y67.111 E86.25398 F3000
+G1 X89.184 Y66.713 E86.29429 F3000
+G1 X90.353 Y66.356 E86.33461 F3000
+G1 X91.533 Y66.040 E86.37492 F3000
+G1 X92.723 Y65.765 E86.41524 F3000
+G1 X93.922 Y65.532 E86.45555 F3000
+G1 X95.129 Y65.341 E86.49587 F3000
+G1 X96.342 Y65.192 E86.53618 F3000
+G1 X97.559 Y65.085 E86.57650 F3000
+G1 X98.779 Y65.021 E86.61681 F3000
+G1 X100.000 Y65.000 E86.65713 F3000
+G1 X101.221 Y65.021 E86.69744 F3000
+G1 X102.441 Y65.085 E86.73776 F3000
+G1 X103.658 Y65.192 E86.77807 F3000
+G1 X104.871 Y65.341 E86.81839 F3000
+G1 X106.078 Y65.532 E86.85870 F3000
+G1 X107.277 Y65.765 E86.89902 F3000
+G1 X108.467 Y66.040 E86.93933 F3000
+G1 X109.647 Y66.356 E86.97965 F3000
+G1 X110.816 Y66.713 E87.01996 F3000
+G1 X111.971 Y67.111 E87.06028 F3000
+G1 X113.111 Y67.549 E87.10059 F3000
+G1 X114.236 Y68.026 E87.14091 F3000
+G1 X115.343 Y68.542 E87.18122 F3000
+G1 X116.432 Y69.097 E87.22154 F3000
+G1 X117.500 Y69.689 E87.26185 F3000
+G1 X118.547 Y70.318 E87.30217 F3000
+G1 X119.572 Y70.984 E87.34248 F3000
+G1 X120.572 Y71.684 E87.38280 F3000
+G1 X121.548 Y72.420 E87.42311 F3000
+G1 X122.498 Y73.188 E87.46343 F3000
+G1 X123.420 Y73.990 E87.50374 F3000
+G1 X124.313 Y74.823 E87.54406 F3000
+G1 X125.177 Y75.687 E87.58437 F3000
+G1 X126.010 Y76.580 E87.62469 F3000
+G1 X126.812 Y77.502 E87.66500 F3000
+G1 X127.580 Y78.452 E87.70532 F3000
+G1 X128.316 Y79.428 E87.74563 F3000
+G1 X129.016 Y80.428 E87.78595 F3000
+G1 X129.682 Y81.453 E87.82626 F3000
+G1 X130.311 Y82.500 E87.86658 F3000
+G1 X130.903 Y83.568 E87.90689 F3000
+G1 X131.458 Y84.657 E87.94721 F3000
+G1 X131.974 Y85.764 E87.98752 F3000
+G1 X132.451 Y86.889 E88.02784 F3000
+G1 X132.889 Y88.029 E88.06815 F3000
+G1 X133.287 Y89.184 E88.10847 F3000
+G1 X133.644 Y90.353 E88.14878 F3000
+G1 X133.960 Y91.533 E88.18910 F3000
+G1 X134.235 Y92.723 E88.22941 F3000
+G1 X134.468 Y93.922 E88.26973 F3000
+G1 X134.659 Y95.129 E88.31004 F3000
+G1 X134.808 Y96.342 E88.35036 F3000
+G1 X134.915 Y97.559 E88.39067 F3000
+G1 X134.979 Y98.779 E88.43099 F3000
+G1 X135.000 Y100.000 E88.47130 F3000
+G1 X105.057 Y100.177 E89.45944 F2400
+G1 X105.108 Y100.357 E89.46563 F2400
+G1 X105.152 Y100.541 E89.47189 F2400
+G1 X105.189 Y100.729 E89.47820 F2400
+G1 X105.219 Y100.920 E89.48459 F2400
+G1 X105.243 Y101.114 E89.49104 F2400
+G1 X105.259 Y101.311 E89.49756 F2400
+G1 X105.268 Y101.510 E89.50414 F2400
+G1 X105.269 Y101.712 E89.51079 F2400
+G1 X105.262 Y101.915 E89.51750 F2400
+G1 X105.248 Y102.120 E89.52428 F2400
+G1 X105.225 Y102.327 E89.53113 F2400
+G1 X105.195 Y102.534 E89.53804 F2400
+G1 X105.156 Y102.742 E89.54502 F2400
+G1 X105.110 Y102.950 E89.55207 F2400
+G1 X105.054 Y103.158 E89.55918 F2400
+G1 X104.991 Y103.366 E89.56636 F2400
+G1 X104.919 Y103.574 E89.57360 F2400
+G1 X104.838 Y103.780 E89.58091 F2400
+G1 X104.749 Y103.985 E89.58829 F2400
+G1 X104.652 Y104.189 E89.59573 F2400
+G1 X104.546 Y104.390 E89.60324 F2400
+G1 X104.432 Y104.589 E89.61082 F2400
+G1 X104.309 Y104.786 E89.61847 F2400
+G1 X104.178 Y104.979 E89.62618 F2400
+G1 X104.039 Y105.169 E89.63395 F2400
+G1 X103.891 Y105.356 E89.64180 F2400
+G1 X103.735 Y105.538 E89.64971 F2400
+G1 X103.572 Y105.716 E89.65769 F2400
+G1 X103.400 Y105.889 E89.66573 F2400
+G1 X103.221 Y106.057 E89.67385 F2400
+G1 X103.034 Y106.220 E89.68203 F2400
+G1 X102.839 Y106.377 E89.69027 F2400
+G1 X102.637 Y106.527 E89.69859 F2400
+G1 X102.428 Y106.672 E89.70697 F2400
+G1 X102.213 Y106.810 E89.71542 F2400
+G1 X101.990 Y106.940 E89.72393 F2400
+G1 X101.761 Y107.064 E89.73251 F2400
+G1 X101.526 Y107.180 E89.74116 F2400
+G1 X101.285 Y107.288 E89.74988 F2400
+G1 X101.038 Y107.387 E89.75866 F2400
+G1 X100.786 Y107.479 E89.76752 F2400
+G1 X100.529 Y107.562 E89.77643 F2400
+G1 X100.267 Y107.635 E89.78542 F2400
+G1 X100.000 Y107.700 E89.79447 F2400
+G1 X99.729 Y107.755 E89.80360 F2400
+G1 X99.455 Y107.801 E89.81278 F2400
+G1 X99.176 Y107.837 E89.82204 F2400
+G1 X98.895 Y107.863 E89.83136 F2400
+G1 X98.611 Y107.878 E89.84076 F2400
+G1 X98.324 Y107.884 E89.85022 F2400
+G1 X98.036 Y107.879 E89.85974 F2400
+G1 X97.745 Y107.863 E89.86934 F2400
+G1 X97.454 Y107.837 E89.87900 F2400
+G1 X97.161 Y107.799 E89.88873 F2400
+G1 X96.868 Y107.751 E89.89852 F2400
+G1 X96.575 Y107.692 E89.90839 F2400
+G1 X96.283 Y107.622 E89.91832 F2400
+G1 X95.991 Y107.540 E89.92832 F2400
+G1 X95.700 Y107.448 E89.93839 F2400
+G1 X95.411 Y107.344 E89.94853 F2400
+G1 X95.124 Y107.229 E89.95873 F2400
+G1 X94.839 Y107.103 E89.96900 F2400
+G1 X94.558 Y106.966 E89.97934 F2400
+G1 X94.279 Y106.818 E89.98975 F2400
+G1 X94.005 Y106.659 E90.00022 F2400
+G1 X93.734 Y106.488 E90.01076 F2400
+G1 X93.468 Y106.307 E90.02137 F2400
+G1 X93.208 Y106.116 E90.03205 F2400
+G1 X92.952 Y105.914 E90.04280 F2400
+G1 X92.703 Y105.701 E90.05361 F2400
+G1 X92.460 Y105.478 E90.06450 F2400
+G1 X92.224 Y105.245 E90.07545 F2400
+G1 X91.994 Y105.002 E90.08646 F2400
+G1 X91.773 Y104.750 E90.09755 F2400
+G1 X91.559 Y104.488 E90.10871 F2400
+G1 X91.354 Y104.217 E90.11993 F2400
+G1 X91.157 Y103.937 E90.13122 F2400
+G1 X90.969 Y103.649 E90.14258 F2400
+G1 X90.791 Y103.352 E90.15400 F2400
+G1 X90.623 Y103.047 E90.16550 F2400
+G1 X90.464 Y102.734 E90.17706 F2400
+G1 X90.316 Y102.414 E90.18869 F2400
+G1 X90.179 Y102.087 E90.20039 F2400
+G1 X90.053 Y101.754 E90.21216 F2400
+G1 X89.939 Y101.414 E90.22399 F2400
+G1 X89.836 Y101.068 E90.23590 F2400
+G1 X89.745 Y100.717 E90.24787 F2400
+G1 X89.666 Y100.361 E90.25991 F2400
+G1 X89.600 Y100.000 E90.27201 F2400
+G1 X89.546 Y99.635 E90.28419 F2400
+G1 X89.506 Y99.266 E90.29643 F2400
+G1 X89.478 Y98.894 E90.30875 F2400
+G1 X89.464 Y98.519 E90.32113 F2400
+G1 X89.463 Y98.142 E90.33358 F2400
+G1 X89.475 Y97.763 E90.34609 F2400
+G1 X89.501 Y97.382 E90.35868 F2400
+G1 X89.541 Y97.001 E90.37133 F2400
+G1 X89.595 Y96.619 E90.38405 F2400
+G1 X89.663 Y96.238 E90.39684 F2400
+G1 X89.745 Y95.857 E90.40970 F2400
+G1 X89.841 Y95.477 E90.42263 F2400
+G1 X89.951 Y95.099 E90.43562 F2400
+G1 X90.076 Y94.723 E90.44869 F2400
+G1 X90.214 Y94.350 E90.46182 F2400
+G1 X90.366 Y93.980 E90.47502 F2400
+G1 X90.532 Y93.614 E90.48829 F2400
+G1 X90.712 Y93.252 E90.50162 F2400
+G1 X90.906 Y92.895 E90.51503 F2400
+G1 X91.114 Y92.544 E90.52850 F2400
+G1 X91.335 Y92.198 E90.54204 F2400
+G1 X91.569 Y91.859 E90.55565 F2400
+G1 X91.817 Y91.526 E90.56933 F2400
+G1 X92.077 Y91.201 E90.58308 F2400
+G1 X92.351 Y90.884 E90.59689 F2400
+G1 X92.637 Y90.575 E90.61078 F2400
+G1 X92.935 Y90.276 E90.62473 F2400
+G1 X93.245 Y89.985 E90.63875 F2400
+G1 X93.567 Y89.705 E90.65284 F2400
+G1 X93.900 Y89.434 E90.66699 F2400
+G1 X94.244 Y89.175 E90.68122 F2400
+G1 X94.599 Y88.927 E90.69551 F2400
+G1 X94.965 Y88.690 E90.70988 F2400
+G1 X95.340 Y88.466 E90.72431 F2400
+G1 X95.725 Y88.254 E90.73881 F2400
+G1 X96.119 Y88.055 E90.75337 F2400
+G1 X96.521 Y87.869 E90.76801 F2400
+G1 X96.932 Y87.697 E90.78272 F2400
+G1 X97.351 Y87.538 E90.79749 F2400
+G1 X97.777 Y87.394 E90.81233 F2400
+G1 X98.210 Y87.265 E90.82724 F2400
+G1 X98.649 Y87.151 E90.84222 F2400
+G1 X99.095 Y87.052 E90.85727 F2400
+G1 X99.545 Y86.968 E90.87238 F2400
+G1 X100.000 Y86.900 E90.88757 F2400
+G1 X100.459 Y86.848 E90.90282 F2400
+G1 X100.922 Y86.812 E90.91814 F2400
+G1 X101.388 Y86.793 E90.93353 F2400
+G1 X101.857 Y86.790 E90.94899 F2400
+G1 X102.327 Y86.804 E90.96452 F2400
+G1 X102.798 Y86.834 E90.98011 F2400
+G1 X103.271 Y86.882 E90.99578 F2400
+G1 X103.743 Y86.946 E91.01151 F2400
+G1 X104.215 Y87.028 E91.02731 F2400
+G1 X104.686 Y87.126 E91.04318 F2400
+G1 X105.155 Y87.242 E91.05912 F2400
+G1 X105.621 Y87.375 E91.07513 F2400
+G1 X106.085 Y87.525 E91.09120 F2400
+G1 X106.544 Y87.692 E91.10735 F2400
+G1 X107.000 Y87.876 E91.12356 F2400
+G1 X107.451 Y88.076 E91.13984 F2400
+G1 X107.896 Y88.294 E91.15619 F2400
+G1 X108.335 Y88.528 E91.17261 F2400
+G1 X108.767 Y88.779 E91.18910 F2400
+G1 X109.192 Y89.046 E91.20565 F2400
+G1 X109.609 Y89.328 E91.22228 F2400
+G1 X110.017 Y89.627 E91.23897 F2400
+G1 X110.416 Y89.941 E91.25573 F2400
+G1 X110.805 Y90.271 E91.27256 F2400
+G1 X111.184 Y90.615 E91.28946 F2400
+G1 X111.552 Y90.974 E91.30643 F2400
+G1 X111.909 Y91.348 E91.32346 F2400
+G1 X112.253 Y91.735 E91.34057 F2400
+G1 X112.585 Y92.136 E91.35774 F2400
+G1 X112.904 Y92.550 E91.37499 F2400
+G1 X113.209 Y92.977 E91.39230 F2400
+G1 X113.500 Y93.416 E91.40968 F2400
+G1 X113.776 Y93.866 E91.42712 F2400
+G1 X114.038 Y94.328 E91.44464 F2400
+G1 X114.283 Y94.801 E91.46223 F2400
+G1 X114.513 Y95.284 E91.47988 F2400
+G1 X114.727 Y95.777 E91.49760 F2400
+G1 X114.923 Y96.279 E91.51539 F2400
+G1 X115.103 Y96.790 E91.53325 F2400
+G1 X115.265 Y97.308 E91.55118 F2400
+G1 X115.409 Y97.834 E91.56918 F2400
+G1 X115.534 Y98.367 E91.58725 F2400
+G1 X115.642 Y98.906 E91.60538 F2400
+G1 X115.730 Y99.451 E91.62359 F2400
+G1 X115.800 Y100.000 E91.64186 F2400
+G1 X115.850 Y100.554 E91.66020 F2400
+G1 X115.881 Y101.111 E91.67861 F2400
+G1 X115.892 Y101.670 E91.69709 F2400
+G1 X115.884 Y102.232 E91.71564 F2400
+G1 X115.855 Y102.796 E91.73425 F2400
+G1 X115.807 Y103.360 E91.75294 F2400
+G1 X115.738 Y103.924 E91.77169 F2400
+G1 X115.649 Y104.487 E91.79051 F2400
+G1 X115.540 Y105.049 E91.80940 F2400
+G1 X115.411 Y105.609 E91.82836 F2400
+G1 X115.261 Y106.166 E91.84739 F2400
+G1 X115.092 Y106.719 E91.86649 F2400
+G1 X114.902 Y107.268 E91.88565 F2400
+G1 X114.692 Y107.812 E91.90489 F2400
+G1 X114.463 Y108.350 E91.92419 F2400
+G1 X114.213 Y108.881 E91.94356 F2400
+G1 X113.944 Y109.406 E91.96300 F2400
+G1 X113.656 Y109.922 E91.98251 F2400
+G1 X113.349 Y110.429 E92.00209 F2400
+G1 X113.023 Y110.927 E92.02174 F2400
+G1 X112.678 Y111.415 E92.04145 F2400
+G1 X112.315 Y111.893 E92.06124 F2400
+G1 X111.934 Y112.358 E92.08109 F2400
+G1 X111.536 Y112.812 E92.10101 F2400
+G1 X111.120 Y113.253 E92.12101 F2400
+G1 X110.688 Y113.680 E92.14106 F2400
+G1 X110.239 Y114.093 E92.16119 F2400
+G1 X109.775 Y114.492 E92.18139 F2400
+G1 X109.295 Y114.875 E92.20166 F2400
+G1 X108.800 Y115.242 E92.22199 F2400
+G1 X108.291 Y115.593 E92.24239 F2400
+G1 X107.768 Y115.927 E92.26287 F2400
+G1 X107.232 Y116.243 E92.28341 F2400
+G1 X106.683 Y116.541 E92.30402 F2400
+G1 X106.122 Y116.820 E92.32470 F2400
+G1 X105.550 Y117.081 E92.34544 F2400
+G1 X104.967 Y117.322 E92.36626 F2400
+G1 X104.374 Y117.543 E92.38715 F2400
+G1 X103.772 Y117.744 E92.40810 F2400
+G1 X103.160 Y117.924 E92.42912 F2400
+G1 X102.541 Y118.082 E92.45021 F2400
+G1 X101.915 Y118.220 E92.47137 F2400
+G1 X101.282 Y118.335 E92.49260 F2400
+G1 X100.644 Y118.429 E92.51390 F2400
+G1 X100.000 Y118.500 E92.53527 F2400
+G1 X99.352 Y118.549 E92.55670 F2400
+G1 X98.701 Y118.575 E92.57821 F2400
+G1 X98.047 Y118.578 E92.59978 F2400
+G1 X97.392 Y118.558 E92.62142 F2400
+G1 X96.735 Y118.514 E92.64313 F2400
+G1 X96.079 Y118.448 E92.66491 F2400
+G1 X95.423 Y118.358 E92.68676 F2400
+G1 X94.768 Y118.245 E92.70868 F2400
+G1 X94.116 Y118.108 E92.73067 F2400
+G1 X93.467 Y117.948 E92.75272 F2400
+G1 X92.823 Y117.765 E92.77484 F2400
+G1 X92.183 Y117.558 E92.79704 F2400
+G1 X91.548 Y117.329 E92.81930 F2400
+G1 X90.920 Y117.076 E92.84163 F2400
+G1 X90.300 Y116.801 E92.86403 F2400
+G1 X89.688 Y116.503 E92.88650 F2400
+G1 X89.085 Y116.183 E92.90903 F2400
+G1 X88.491 Y115.841 E92.93164 F2400
+G1 X87.908 Y115.477 E92.95431 F2400
+G1 X87.337 Y115.091 E92.97706 F2400
+G1 X86.778 Y114.685 E92.99987 F2400
+G1 X86.232 Y114.257 E93.02275 F2400
+G1 X85.700 Y113.810 E93.04570 F2400
+G1 X85.182 Y113.342 E93.06872 F2400
+G1 X84.679 Y112.856 E93.09181 F2400
+G1 X84.193 Y112.350 E93.11496 F2400
+G1 X83.723 Y111.826 E93.13819 F2400
+G1 X83.270 Y111.285 E93.16148 F2400
+G1 X82.836 Y110.726 E93.18485 F2400
+G1 X82.420 Y110.150 E93.20828 F2400
+G1 X82.023 Y109.558 E93.23178 F2400
+G1 X81.647 Y108.952 E93.25535 F2400
+G1 X81.291 Y108.330 E93.27899 F2400
+G1 X80.956 Y107.694 E93.30269 F2400
+G1 X80.642 Y107.046 E93.32647 F2400
+G1 X80.351 Y106.384 E93.35031 F2400
+G1 X80.083 Y105.711 E93.37423 F2400
+G1 X79.837 Y105.027 E93.39821 F2400
+G1 X79.615 Y104.333 E93.42226 F2400
+G1 X79.418 Y103.629 E93.44638 F2400
+G1 X79.244 Y102.917 E93.47057 F2400
+G1 X79.095 Y102.197 E93.49483 F2400
+G1 X78.971 Y101.470 E93.51916 F2400
+G1 X78.873 Y100.738 E93.54356 F2400
+G1 X78.800 Y100.000 E93.56802 F2400
+G1 X78.753 Y99.258 E93.59255 F2400
+G1 X78.732 Y98.513 E93.61716 F2400
+G1 X78.737 Y97.765 E93.64183 F2400
+G1 X78.769 Y97.016 E93.66657 F2400
+G1 X78.827 Y96.267 E93.69138 F2400
+G1 X78.911 Y95.517 E93.71626 F2400
+G1 X79.022 Y94.770 E93.74121 F2400
+G1 X79.160 Y94.024 E93.76622 F2400
+G1 X79.324 Y93.282 E93.79131 F2400
+G1 X79.515 Y92.544 E93.81646 F2400
+G1 X79.732 Y91.811 E93.84168 F2400
+G1 X79.975 Y91.084 E93.86698 F2400
+G1 X80.245 Y90.365 E93.89234 F2400
+G1 X80.540 Y89.653 E93.91777 F2400
+G1 X80.861 Y88.950 E93.94326 F2400
+G1 X81.207 Y88.257 E93.96883 F2400
+G1 X81.579 Y87.575 E93.99447 F2400
+G1 X81.975 Y86.904 E94.02017 F2400
+G1 X82.396 Y86.246 E94.04595 F2400
+G1 X82.841 Y85.602 E94.07179 F2400
+G1 X83.309 Y84.971 E94.09770 F2400
+G1 X83.800 Y84.356 E94.12368 F2400
+G1 X84.315 Y83.757 E94.14973 F2400
+G1 X84.851 Y83.175 E94.17585 F2400
+G1 X85.409 Y82.611 E94.20204 F2400
+G1 X85.988 Y82.065 E94.22830 F2400
+G1 X86.587 Y81.538 E94.25462 F2400
+G1 X87.206 Y81.032 E94.28102 F2400
+G1 X87.844 Y80.546 E94.30748 F2400
+G1 X88.500 Y80.081 E94.33401 F2400
+G1 X89.174 Y79.639 E94.36061 F2400
+G1 X89.865 Y79.220 E94.38728 F2400
+G1 X90.572 Y78.824 E94.41402 F2400
+G1 X91.294 Y78.452 E94.44083 F2400
+G1 X92.031 Y78.105 E94.46771 F2400
+G1 X92.781 Y77.783 E94.49465 F2400
+G1 X93.545 Y77.487 E94.52167 F2400
+G1 X94.320 Y77.217 E94.54875 F2400
+G1 X95.106 Y76.974 E94.57590 F2400
+G1 X95.902 Y76.759 E94.60312 F2400
+G1 X96.707 Y76.570 E94.63041 F2400
+G1 X97.521 Y76.410 E94.65777 F2400
+G1 X98.341 Y76.278 E94.68520 F2400
+G1 X99.168 Y76.175 E94.71270 F2400
+G1 X100.000 Y76.100 E94.74026 F2400
+G1 X100.836 Y76.055 E94.76790 F2400
+G1 X101.676 Y76.039 E94.79560 F2400
+G1 X102.517 Y76.052 E94.82338 F2400
+G1 X103.360 Y76.095 E94.85122 F2400
+G1 X104.202 Y76.168 E94.87913 F2400
+G1 X105.044 Y76.270 E94.90711 F2400
+G1 X105.884 Y76.402 E94.93516 F2400
+G1 X106.720 Y76.564 E94.96327 F2400
+G1 X107.552 Y76.756 E94.99146 F2400
+G1 X108.379 Y76.978 E95.01972 F2400
+G1 X109.200 Y77.228 E95.04804 F2400
+G1 X110.014 Y77.509 E95.07643 F2400
+G1 X110.819 Y77.818 E95.10490 F2400
+G1 X111.615 Y78.156 E95.13343 F2400
+G1 X112.400 Y78.523 E95.16203 F2400
+G1 X113.174 Y78.918 E95.19070 F2400
+G1 X113.935 Y79.340 E95.21943 F2400
+G1 X114.683 Y79.791 E95.24824 F2400
+G1 X115.416 Y80.268 E95.27712 F2400
+G1 X116.134 Y80.772 E95.30606 F2400
+G1 X116.835 Y81.302 E95.33508 F2400
+G1 X117.519 Y81.858 E95.36416 F2400
+G1 X118.185 Y82.439 E95.39331 F2400
+G1 X118.831 Y83.044 E95.42253 F2400
+G1 X119.458 Y83.673 E95.45182 F2400
+G1 X120.063 Y84.325 E95.48118 F2400
+G1 X120.646 Y85.000 E95.51061 F2400
+G1 X121.207 Y85.696 E95.54010 F2400
+G1 X121.744 Y86.413 E95.56967 F2400
+G1 X122.257 Y87.150 E95.59930 F2400
+G1 X122.745 Y87.906 E95.62901 F2400
+G1 X123.207 Y88.681 E95.65878 F2400
+G1 X123.643 Y89.474 E95.68862 F2400
+G1 X124.051 Y90.283 E95.71853 F2400
+G1 X124.432 Y91.107 E95.74851 F2400
+G1 X124.785 Y91.947 E95.77856 F2400
+G1 X125.108 Y92.800 E95.80867 F2400
+G1 X125.402 Y93.666 E95.83886 F2400
+G1 X125.667 Y94.544 E95.86912 F2400
+G1 X125.900 Y95.433 E95.89944 F2400
+G1 X126.103 Y96.331 E95.92983 F2400
+G1 X126.275 Y97.238 E95.96030 F2400
+G1 X126.415 Y98.153 E95.99083 F2400
+G1 X126.524 Y99.074 E96.02143 F2400
+G1 X126.600 Y100.000 E96.05209 F2400
+G1 X74.533 Y54.303 E98.33820 F2400
+G1 X42.324 Y114.672 E100.59619 F2400
+G1 X65.395 Y69.210 E102.27856 F2400
+G1 X98.989 Y45.870 E103.62845 F2400
+G1 X108.894 Y56.140 E104.09932 F2400
+G1 X110.717 Y116.973 E106.10771 F2400
+G1 X52.280 Y85.546 E108.29731 F2400
+G1 X123.328 Y85.560 E110.64189 F2400
+G1 X45.994 Y98.949 E113.23186 F2400
+G1 X119.655 Y96.638 E115.66387 F2400
+G1 X153.351 Y104.521 E116.80586 F2400
+G1 X148.408 Y55.122 E118.44417 F2400
+G0 X132.500 Y100.000 F6000
+G1 X132.480 Y101.134 E118.48160 F3000
+G1 X132.421 Y102.267 E118.51904 F3000
+G1 X132.322 Y103.397 E118.55647 F3000
+G1 X132.184 Y104.523 E118.59391 F3000
+G1 X132.006 Y105.644 E118.63134 F3000
+G1 X131.790 Y106.757 E118.66878 F3000
+G1 X131.535 Y107.862 E118.70622 F3000
+G1 X131.241 Y108.958 E118.74365 F3000
+G1 X130.909 Y110.043 E118.78109 F3000
+G1 X130.540 Y111.116 E118.81852 F3000
+G1 X130.133 Y112.175 E118.85596 F3000
+G1 X129.690 Y113.219 E118.89339 F3000
+G1 X129.211 Y114.247 E118.93083 F3000
+G1 X128.696 Y115.258 E118.96826 F3000
+G1 X128.146 Y116.250 E119.00570 F3000
+G1 X127.562 Y117.222 E119.04313 F3000
+G1 X126.944 Y118.174 E119.08057 F3000
+G1 X126.293 Y119.103 E119.11801 F3000
+G1 X125.610 Y120.009 E119.15544 F3000
+G1 X124.896 Y120.891 E119.19288 F3000
+G1 X124.152 Y121.747 E119.23031 F3000
+G1 X123.379 Y122.576 E119.26775 F3000
+G1 X122.576 Y123.379 E119.30518 F3000
+G1 X121.747 Y124.152 E119.34262 F3000
+G1 X120.891 Y124.896 E119.38005 F3000
+G1 X120.009 Y125.610 E119.41749 F3000
+G1 X119.103 Y126.293 E119.45492 F3000
+G1 X118.174 Y126.944 E119.49236 F3000
+G1 X117.222 Y127.562 E119.52979 F3000
+G1 X116.250 Y128.146 E119.56723 F3000
+G1 X115.258 Y128.696 E119.60467 F3000
+G1 X114.247 Y129.211 E119.64210 F3000
+G1 X113.219 Y129.690 E119.67954 F3000
+G1 X112.175 Y130.133 E119.71697 F3000
+G1 X111.116 Y130.540 E119.75441 F3000
+G1 X110.043 Y130.909 E119.79184 F3000
+G1 X108.958 Y131.241 E119.82928 F3000
+G1 X107.862 Y131.535 E119.86671 F3000
+G1 X106.757 Y131.790 E119.90415 F3000
+G1 X105.644 Y132.006 E119.94158 F3000
+G1 X104.523 Y132.184 E119.97902 F3000
+G1 X103.397 Y132.322 E120.01646 F3000
+G1 X102.267 Y132.421 E120.05389 F3000
+G1 X101.134 Y132.480 E120.09133 F3000
+G1 X100.000 Y132.500 E120.12876 F3000
+G1 X98.866 Y132.480 E120.16620 F3000
+G1 X97.733 Y132.421 E120.20363 F3000
+G1 X96.603 Y132.322 E120.24107 F3000
+G1 X95.477 Y132.184 E120.27850 F3000
+G1 X94.356 Y132.006 E120.31594 F3000
+G1 X93.243 Y131.790 E120.35337 F3000
+G1 X92.138 Y131.535 E120.39081 F3000
+G1 X91.042 Y131.241 E120.42824 F3000
+G1 X89.957 Y130.909 E120.46568 F3000
+G1 X88.884 Y130.540 E120.50312 F3000
+G1 X87.825 Y130.133 E120.54055 F3000
+G1 X86.781 Y129.690 E120.57799 F3000
+G1 X85.753 Y129.211 E120.61542 F3000
+G1 X84.742 Y128.696 E120.65286 F3000
+G1 X83.750 Y128.146 E120.69029 F3000
+G1 X82.778 Y127.562 E120.72773 F3000
+G1 X81.826 Y126.944 E120.76516 F3000
+G1 X80.897 Y126.293 E120.80260 F3000
+G1 X79.991 Y125.610 E120.84003 F3000
+G1 X79.109 Y124.896 E120.87747 F3000
+G1 X78.253 Y124.152 E120.91490 F3000
+G1 X77.424 Y123.379 E120.95234 F3000
+G1 X76.621 Y122.576 E120.98978 F3000
+G1 X75.848 Y121.747 E121.02721 F3000
+G1 X75.104 Y120.891 E121.06465 F3000
+G1 X74.390 Y120.009 E121.10208 F3000
+G1 X73.707 Y119.103 E121.13952 F3000
+G1 X73.056 Y118.174 E121.17695 F3000
+G1 X72.438 Y117.222 E121.21439 F3000
+G1 X71.854 Y116.250 E121.25182 F3000
+G1 X71.304 Y115.258 E121.28926 F3000
+G1 X70.789 Y114.247 E121.32669 F3000
+G1 X70.310 Y113.219 E121.36413 F3000
+G1 X69.867 Y112.175 E121.40157 F3000
+G1 X69.460 Y111.116 E121.43900 F3000
+G1 X69.091 Y110.043 E121.47644 F3000
+G1 X68.759 Y108.958 E121.51387 F3000
+G1 X68.465 Y107.862 E121.55131 F3000
+G1 X68.210 Y106.757 E121.58874 F3000
+G1 X67.994 Y105.644 E121.62618 F3000
+G1 X67.816 Y104.523 E121.66361 F3000
+G1 X67.678 Y103.397 E121.70105 F3000
+G1 X67.579 Y102.267 E121.73848 F3000
+G1 X67.520 Y101.134 E121.77592 F3000
+G1 X67.500 Y100.000 E121.81335 F3000
+G1 X67.520 Y98.866 E121.85079 F3000
+G1 X67.579 Y97.733 E121.88823 F3000
+G1 X67.678 Y96.603 E121.92566 F3000
+G1 X67.816 Y95.477 E121.96310 F3000
+G1 X67.994 Y94.356 E122.00053 F3000
+G1 X68.210 Y93.243 E122.03797 F3000
+G1 X68.465 Y92.138 E122.07540 F3000
+G1 X68.759 Y91.042 E122.11284 F3000
+G1 X69.091 Y89.957 E122.15027 F3000
+G1 X69.460 Y88.884 E122.18771 F3000
+G1 X69.867 Y87.825 E122.22514 F3000
+G1 X70.310 Y86.781 E122.26258 F3000
+G1 X70.789 Y85.753 E122.30002 F3000
+G1 X71.304 Y84.742 E122.33745 F3000
+G1 X71.854 Y83.750 E122.37489 F3000
+G1 X72.438 Y82.778 E122.41232 F3000
+G1 X73.056 Y81.826 E122.44976 F3000
+G1 X73.707 Y80.897 E122.48719 F3000
+G1 X74.390 Y79.991 E122.52463 F3000
+G1 X75.104 Y79.109 E122.56206 F3000
+G1 X75.848 Y78.253 E122.59950 F3000
+G1 X76.621 Y77.424 E122.63693 F3000
+G1 X77.424 Y76.621 E122.67437 F3000
+G1 X78.253 Y75.848 E122.71180 F3000
+G1 X79.109 Y75.104 E122.74924 F3000
+G1 X79.991 Y74.390 E122.78668 F3000
+G1 X80.897 Y73.707 E122.82411 F3000
+G1 X81.826 Y73.056 E122.86155 F3000
+G1 X82.778 Y72.438 E122.89898 F3000
+G1 X83.750 Y71.854 E122.93642 F3000
+G1 X84.742 Y71.304 E122.97385 F3000
+G1 X85.753 Y70.789 E123.01129 F3000
+G1 X86.781 Y70.310 E123.04872 F3000
+G1 X87.825 Y69.867 E123.08616 F3000
+G1 X88.884 Y69.460 E123.12359 F3000
+G1 X89.957 Y69.091 E123.16103 F3000
+G1 X91.042 Y68.759 E123.19847 F3000
+G1 X92.138 Y68.465 E123.23590 F3000
+G1 X93.243 Y68.210 E123.27334 F3000
+G1 X94.356 Y67.994 E123.31077 F3000
+G1 X95.477 Y67.816 E123.34821 F3000
+G1 X96.603 Y67.678 E123.38564 F3000
+G1 X97.733 Y67.579 E123.42308 F3000
+G1 X98.866 Y67.520 E123.46051 F3000
+G1 X100.000 Y67.500 E123.49795 F3000
+G1 X101.134 Y67.520 E123.53538 F3000
+G1 X102.267 Y67.579 E123.57282 F3000
+G1 X103.397 Y67.678 E123.61025 F3000
+G1 X104.523 Y67.816 E123.64769 F3000
+G1 X105.644 Y67.994 E123.68513 F3000
+G1 X106.757 Y68.210 E123.72256 F3000
+G1 X107.862 Y68.465 E123.76000 F3000
+G1 X108.958 Y68.759 E123.79743 F3000
+G1 X110.043 Y69.091 E123.83487 F3000
+G1 X111.116 Y69.460 E123.87230 F3000
+G1 X112.175 Y69.867 E123.90974 F3000
+G1 X113.219 Y70.310 E123.94717 F3000
+G1 X114.247 Y70.789 E123.98461 F3000
+G1 X115.258 Y71.304 E124.02204 F3000
+G1 X116.250 Y71.854 E124.05948 F3000
+G1 X117.222 Y72.438 E124.09691 F3000
+G1 X118.174 Y73.056 E124.13435 F3000
+G1 X119.103 Y73.707 E124.17179 F3000
+G1 X120.009 Y74.390 E124.20922 F3000
+G1 X120.891 Y75.104 E124.24666 F3000
+G1 X121.747 Y75.848 E124.28409 F3000
+G1 X122.576 Y76.621 E124.32153 F3000
+G1 X123.379 Y77.424 E124.35896 F3000
+G1 X124.152 Y78.253 E124.39640 F3000
+G1 X124.896 Y79.109 E124.43383 F3000
+G1 X125.610 Y79.991 E124.47127 F3000
+G1 X126.293 Y80.897 E124.50870 F3000
+G1 X126.944 Y81.826 E124.54614 F3000
+G1 X127.562 Y82.778 E124.58358 F3000
+G1 X128.146 Y83.750 E124.62101 F3000
+G1 X128.696 Y84.742 E124.65845 F3000
+G1 X129.211 Y85.753 E124.69588 F3000
+G1 X129.690 Y86.781 E124.73332 F3000
+G1 X130.133 Y87.825 E124.77075 F3000
+G1 X130.540 Y88.884 E124.80819 F3000
+G1 X130.909 Y89.957 E124.84562 F3000
+G1 X131.241 Y91.042 E124.88306 F3000
+G1 X131.535 Y92.138 E124.92049 F3000
+G1 X131.790 Y93.243 E124.95793 F3000
+G1 X132.006 Y94.356 E124.99536 F3000
+G1 X132.184 Y95.477 E125.03280 F3000
+G1 X132.322 Y96.603 E125.07024 F3000
+G1 X132.421 Y97.733 E125.10767 F3000
+G1 X132.480 Y98.866 E125.14511 F3000
+G1 X132.500 Y100.000 E125.18254 F3000
+G1 X105.057 Y100.177 E126.08818 F2400
+G1 X105.108 Y100.357 E126.09437 F2400
+G1 X105.152 Y100.541 E126.10062 F2400
+G1 X105.189 Y100.729 E126.10694 F2400
+G1 X105.219 Y100.920 E126.11333 F2400
+G1 X105.243 Y101.114 E126.11978 F2400
+G1 X105.259 Y101.311 E126.12630 F2400
+G1 X105.268 Y101.510 E126.13288 F2400
+G1 X105.269 Y101.712 E126.13953 F2400
+G1 X105.262 Y101.915 E126.14624 F2400
+G1 X105.248 Y102.120 E126.15302 F2400
+G1 X105.225 Y102.327 E126.15987 F2400
+G1 X105.195 Y102.534 E126.16678 F2400
+G1 X105.156 Y102.742 E126.17376 F2400
+G1 X105.110 Y102.950 E126.18080 F2400
+G1 X105.054 Y103.158 E126.18792 F2400
+G1 X104.991 Y103.366 E126.19509 F2400
+G1 X104.919 Y103.574 E126.20234 F2400
+G1 X104.838 Y103.780 E126.20965 F2400
+G1 X104.749 Y103.985 E126.21703 F2400
+G1 X104.652 Y104.189 E126.22447 F2400
+G1 X104.546 Y104.390 E126.23198 F2400
+G1 X104.432 Y104.589 E126.23956 F2400
+G1 X104.309 Y104.786 E126.24720 F2400
+G1 X104.178 Y104.979 E126.25491 F2400
+G1 X104.039 Y105.169 E126.26269 F2400
+G1 X103.891 Y105.356 E126.27054 F2400
+G1 X103.735 Y105.538 E126.27845 F2400
+G1 X103.572 Y105.716 E126.28643 F2400
+G1 X103.400 Y105.889 E126.29447 F2400
+G1 X103.221 Y106.057 E126.30259 F2400
+G1 X103.034 Y106.220 E126.31076 F2400
+G1 X102.839 Y106.377 E126.31901 F2400
+G1 X102.637 Y106.527 E126.32733 F2400
+G1 X102.428 Y106.672 E126.33571 F2400
+G1 X102.213 Y106.810 E126.34415 F2400
+G1 X101.990 Y106.940 E126.35267 F2400
+G1 X101.761 Y107.064 E126.36125 F2400
+G1 X101.526 Y107.180 E126.36990 F2400
+G1 X101.285 Y107.288 E126.37862 F2400
+G1 X101.038 Y107.387 E126.38740 F2400
+G1 X100.786 Y107.479 E126.39625 F2400
+G1 X100.529 Y107.562 E126.40517 F2400
+G1 X100.267 Y107.635 E126.41416 F2400
+G1 X100.000 Y107.700 E126.42321 F2400
+G1 X99.729 Y107.755 E126.43233 F2400
+G1 X99.455 Y107.801 E126.44152 F2400
+G1 X99.176 Y107.837 E126.45078 F2400
+G1 X98.895 Y107.863 E126.46010 F2400
+G1 X98.611 Y107.878 E126.46949 F2400
+G1 X98.324 Y107.884 E126.47895 F2400
+G1 X98.036 Y107.879 E126.48848 F2400
+G1 X97.745 Y107.863 E126.49807 F2400
+G1 X97.454 Y107.837 E126.50774 F2400
+G1 X97.161 Y107.799 E126.51747 F2400
+G1 X96.868 Y107.751 E126.52726 F2400
+G1 X96.575 Y107.692 E126.53713 F2400
+G1 X96.283 Y107.622 E126.54706 F2400
+G1 X95.991 Y107.540 E126.55706 F2400
+G1 X95.700 Y107.448 E126.56713 F2400
+G1 X95.411 Y107.344 E126.57726 F2400
+G1 X95.124 Y107.229 E126.58747 F2400
+G1 X94.839 Y107.103 E126.59774 F2400
+G1 X94.558 Y106.966 E126.60808 F2400
+G1 X94.279 Y106.818 E126.61849 F2400
+G1 X94.005 Y106.659 E126.62896 F2400
+G1 X93.734 Y106.488 E126.63950 F2400
+G1 X93.468 Y106.307 E126.65011 F2400
+G1 X93.208 Y106.116 E126.66079 F2400
+G1 X92.952 Y105.914 E126.67154 F2400
+G1 X92.703 Y105.701 E126.68235 F2400
+G1 X92.460 Y105.478 E126.69324 F2400
+G1 X92.224 Y105.245 E126.70419 F2400
+G1 X91.994 Y105.002 E126.71520 F2400
+G1 X91.773 Y104.750 E126.72629 F2400
+G1 X91.559 Y104.488 E126.73744 F2400
+G1 X91.354 Y104.217 E126.74867 F2400
+G1 X91.157 Y103.937 E126.75996 F2400
+G1 X90.969 Y103.649 E126.77132 F2400
+G1 X90.791 Y103.352 E126.78274 F2400
+G1 X90.623 Y103.047 E126.79424 F2400
+G1 X90.464 Y102.734 E126.80580 F2400
+G1 X90.316 Y102.414 E126.81743 F2400
+G1 X90.179 Y102.087 E126.82913 F2400
+G1 X90.053 Y101.754 E126.84090 F2400
+G1 X89.939 Y101.414 E126.85273 F2400
+G1 X89.836 Y101.068 E126.86463 F2400
+G1 X89.745 Y100.717 E126.87661 F2400
+G1 X89.666 Y100.361 E126.88864 F2400
+G1 X89.600 Y100.000 E126.90075 F2400
+G1 X89.546 Y99.635 E126.91293 F2400
+G1 X89.506 Y99.266 E126.92517 F2400
+G1 X89.478 Y98.894 E126.93748 F2400
+G1 X89.464 Y98.519 E126.94987 F2400
+G1 X89.463 Y98.142 E126.96231 F2400
+G1 X89.475 Y97.763 E126.97483 F2400
+G1 X89.501 Y97.382 E126.98742 F2400
+G1 X89.541 Y97.001 E127.00007 F2400
+G1 X89.595 Y96.619 E127.01279 F2400
+G1 X89.663 Y96.238 E127.02558 F2400
+G1 X89.745 Y95.857 E127.03844 F2400
+G1 X89.841 Y95.477 E127.05137 F2400
+G1 X89.951 Y95.099 E127.06436 F2400
+G1 X90.076 Y94.723 E127.07742 F2400
+G1 X90.214 Y94.350 E127.09056 F2400
+G1 X90.366 Y93.980 E127.10376 F2400
+G1 X90.532 Y93.614 E127.11702 F2400
+G1 X90.712 Y93.252 E127.13036 F2400
+G1 X90.906 Y92.895 E127.14377 F2400
+G1 X91.114 Y92.544 E127.15724 F2400
+G1 X91.335 Y92.198 E127.17078 F2400
+G1 X91.569 Y91.859 E127.18439 F2400
+G1 X91.817 Y91.526 E127.19807 F2400
+G1 X92.077 Y91.201 E127.21182 F2400
+G1 X92.351 Y90.884 E127.22563 F2400
+G1 X92.637 Y90.575 E127.23951 F2400
+G1 X92.935 Y90.276 E127.25347 F2400
+G1 X93.245 Y89.985 E127.26749 F2400
+G1 X93.567 Y89.705 E127.28158 F2400
+G1 X93.900 Y89.434 E127.29573 F2400
+G1 X94.244 Y89.175 E127.30996 F2400
+G1 X94.599 Y88.927 E127.32425 F2400
+G1 X94.965 Y88.690 E127.33861 F2400
+G1 X95.340 Y88.466 E127.35305 F2400
+G1 X95.725 Y88.254 E127.36755 F2400
+G1 X96.119 Y88.055 E127.38211 F2400
+G1 X96.521 Y87.869 E127.39675 F2400
+G1 X96.932 Y87.697 E127.41145 F2400
+G1 X97.351 Y87.538 E127.42623 F2400
+G1 X97.777 Y87.394 E127.44107 F2400
+G1 X98.210 Y87.265 E127.45598 F2400
+G1 X98.649 Y87.151 E127.47096 F2400
+G1 X99.095 Y87.052 E127.48601 F2400
+G1 X99.545 Y86.968 E127.50112 F2400
+G1 X100.000 Y86.900 E127.51631 F2400
+G1 X100.459 Y86.848 E127.53156 F2400
+G1 X100.922 Y86.812 E127.54688 F2400
+G1 X101.388 Y86.793 E127.56227 F2400
+G1 X101.857 Y86.790 E127.57773 F2400
+G1 X102.327 Y86.804 E127.59326 F2400
+G1 X102.798 Y86.834 E127.60885 F2400
+G1 X103.271 Y86.882 E127.62452 F2400
+G1 X103.743 Y86.946 E127.64025 F2400
+G1 X104.215 Y87.028 E127.65605 F2400
+G1 X104.686 Y87.126 E127.67192 F2400
+G1 X105.155 Y87.242 E127.68786 F2400
+G1 X105.621 Y87.375 E127.70387 F2400
+G1 X106.085 Y87.525 E127.71994 F2400
+G1 X106.544 Y87.692 E127.73609 F2400
+G1 X107.000 Y87.876 E127.75230 F2400
+G1 X107.451 Y88.076 E127.76858 F2400
+G1 X107.896 Y88.294 E127.78493 F2400
+G1 X108.335 Y88.528 E127.80135 F2400
+G1 X108.767 Y88.779 E127.81784 F2400
+G1 X109.192 Y89.046 E127.83439 F2400
+G1 X109.609 Y89.328 E127.85102 F2400
+G1 X110.017 Y89.627 E127.86771 F2400
+G1 X110.416 Y89.941 E127.88447 F2400
+G1 X110.805 Y90.271 E127.90130 F2400
+G1 X111.184 Y90.615 E127.91820 F2400
+G1 X111.552 Y90.974 E127.93517 F2400
+G1 X111.909 Y91.348 E127.95220 F2400
+G1 X112.253 Y91.735 E127.96931 F2400
+G1 X112.585 Y92.136 E127.98648 F2400
+G1 X112.904 Y92.550 E128.00372 F2400
+G1 X113.209 Y92.977 E128.02104 F2400
+G1 X113.500 Y93.416 E128.03841 F2400
+G1 X113.776 Y93.866 E128.05586 F2400
+G1 X114.038 Y94.328 E128.07338 F2400
+G1 X114.283 Y94.801 E128.09097 F2400
+G1 X114.513 Y95.284 E128.10862 F2400
+G1 X114.727 Y95.777 E128.12634 F2400
+G1 X114.923 Y96.279 E128.14413 F2400
+G1 X115.103 Y96.790 E128.16199 F2400
+G1 X115.265 Y97.308 E128.17992 F2400
+G1 X115.409 Y97.834 E128.19792 F2400
+G1 X115.534 Y98.367 E128.21599 F2400
+G1 X115.642 Y98.906 E128.23412 F2400
+G1 X115.730 Y99.451 E128.25233 F2400
+G1 X115.800 Y100.000 E128.27060 F2400
+G1 X115.850 Y100.554 E128.28894 F2400
+G1 X115.881 Y101.111 E128.30735 F2400
+G1 X115.892 Y101.670 E128.32583 F2400
+G1 X115.884 Y102.232 E128.34437 F2400
+G1 X115.855 Y102.796 E128.36299 F2400
+G1 X115.807 Y103.360 E128.38167 F2400
+G1 X115.738 Y103.924 E128.40043 F2400
+G1 X115.649 Y104.487 E128.41925 F2400
+G1 X115.540 Y105.049 E128.43814 F2400
+G1 X115.411 Y105.609 E128.45710 F2400
+G1 X115.261 Y106.166 E128.47613 F2400
+G1 X115.092 Y106.719 E128.49523 F2400
+G1 X114.902 Y107.268 E128.51439 F2400
+G1 X114.692 Y107.812 E128.53363 F2400
+G1 X114.463 Y108.350 E128.55293 F2400
+G1 X114.213 Y108.881 E128.57230 F2400
+G1 X113.944 Y109.406 E128.59174 F2400
+G1 X113.656 Y109.922 E128.61125 F2400
+G1 X113.349 Y110.429 E128.63083 F2400
+G1 X113.023 Y110.927 E128.65048 F2400
+G1 X112.678 Y111.415 E128.67019 F2400
+G1 X112.315 Y111.893 E128.68998 F2400
+G1 X111.934 Y112.358 E128.70983 F2400
+G1 X111.536 Y112.812 E128.72975 F2400
+G1 X111.120 Y113.253 E128.74974 F2400
+G1 X110.688 Y113.680 E128.76980 F2400
+G1 X110.239 Y114.093 E128.78993 F2400
+G1 X109.775 Y114.492 E128.81013 F2400
+G1 X109.295 Y114.875 E128.83040 F2400
+G1 X108.800 Y115.242 E128.85073 F2400
+G1 X108.291 Y115.593 E128.87113 F2400
+G1 X107.768 Y115.927 E128.89161 F2400
+G1 X107.232 Y116.243 E128.91215 F2400
+G1 X106.683 Y116.541 E128.93276 F2400
+G1 X106.122 Y116.820 E128.95344 F2400
+G1 X105.550 Y117.081 E128.97418 F2400
+G1 X104.967 Y117.322 E128.99500 F2400
+G1 X104.374 Y117.543 E129.01588 F2400
+G1 X103.772 Y117.744 E129.03684 F2400
+G1 X103.160 Y117.924 E129.05786 F2400
+G1 X102.541 Y118.082 E129.07895 F2400
+G1 X101.915 Y118.220 E129.10011 F2400
+G1 X101.282 Y118.335 E129.12134 F2400
+G1 X100.644 Y118.429 E129.14264 F2400
+G1 X100.000 Y118.500 E129.16401 F2400
+G1 X99.352 Y118.549 E129.18544 F2400
+G1 X98.701 Y118.575 E129.20695 F2400
+G1 X98.047 Y118.578 E129.22852 F2400
+G1 X97.392 Y118.558 E129.25016 F2400
+G1 X96.735 Y118.514 E129.27187 F2400
+G1 X96.079 Y118.448 E129.29365 F2400
+G1 X95.423 Y118.358 E129.31550 F2400
+G1 X94.768 Y118.245 E129.33742 F2400
+G1 X94.116 Y118.108 E129.35940 F2400
+G1 X93.467 Y117.948 E129.38146 F2400
+G1 X92.823 Y117.765 E129.40358 F2400
+G1 X92.183 Y117.558 E129.42578 F2400
+G1 X91.548 Y117.329 E129.44804 F2400
+G1 X90.920 Y117.076 E129.47037 F2400
+G1 X90.300 Y116.801 E129.49277 F2400
+G1 X89.688 Y116.503 E129.51523 F2400
+G1 X89.085 Y116.183 E129.53777 F2400
+G1 X88.491 Y115.841 E129.56038 F2400
+G1 X87.908 Y115.477 E129.58305 F2400
+G1 X87.337 Y115.091 E129.60579 F2400
+G1 X86.778 Y114.685 E129.62861 F2400
+G1 X86.232 Y114.257 E129.65149 F2400
+G1 X85.700 Y113.810 E129.67444 F2400
+G1 X85.182 Y113.342 E129.69746 F2400
+G1 X84.679 Y112.856 E129.72054 F2400
+G1 X84.193 Y112.350 E129.74370 F2400
+G1 X83.723 Y111.826 E129.76693 F2400
+G1 X83.270 Y111.285 E129.79022 F2400
+G1 X82.836 Y110.726 E129.81358 F2400
+G1 X82.420 Y110.150 E129.83702 F2400
+G1 X82.023 Y109.558 E129.86052 F2400
+G1 X81.647 Y108.952 E129.88409 F2400
+G1 X81.291 Y108.330 E129.90772 F2400
+G1 X80.956 Y107.694 E129.93143 F2400
+G1 X80.642 Y107.046 E129.95521 F2400
+G1 X80.351 Y106.384 E129.97905 F2400
+G1 X80.083 Y105.711 E130.00297 F2400
+G1 X79.837 Y105.027 E130.02695 F2400
+G1 X79.615 Y104.333 E130.05100 F2400
+G1 X79.418 Y103.629 E130.07512 F2400
+G1 X79.244 Y102.917 E130.09931 F2400
+G1 X79.095 Y102.197 E130.12357 F2400
+G1 X78.971 Y101.470 E130.14790 F2400
+G1 X78.873 Y100.738 E130.17229 F2400
+G1 X78.800 Y100.000 E130.19676 F2400
+G1 X78.753 Y99.258 E130.22129 F2400
+G1 X78.732 Y98.513 E130.24590 F2400
+G1 X78.737 Y97.765 E130.27057 F2400
+G1 X78.769 Y97.016 E130.29531 F2400
+G1 X78.827 Y96.267 E130.32012 F2400
+G1 X78.911 Y95.517 E130.34500 F2400
+G1 X79.022 Y94.770 E130.36994 F2400
+G1 X79.160 Y94.024 E130.39496 F2400
+G1 X79.324 Y93.282 E130.42005 F2400
+G1 X79.515 Y92.544 E130.44520 F2400
+G1 X79.732 Y91.811 E130.47042 F2400
+G1 X79.975 Y91.084 E130.49571 F2400
+G1 X80.245 Y90.365 E130.52107 F2400
+G1 X80.540 Y89.653 E130.54650 F2400
+G1 X80.861 Y88.950 E130.57200 F2400
+G1 X81.207 Y88.257 E130.59757 F2400
+G1 X81.579 Y87.575 E130.62321 F2400
+G1 X81.975 Y86.904 E130.64891 F2400
+G1 X82.396 Y86.246 E130.67469 F2400
+G1 X82.841 Y85.602 E130.70053 F2400
+G1 X83.309 Y84.971 E130.72644 F2400
+G1 X83.800 Y84.356 E130.75242 F2400
+G1 X84.315 Y83.757 E130.77847 F2400
+G1 X84.851 Y83.175 E130.80459 F2400
+G1 X85.409 Y82.611 E130.83078 F2400
+G1 X85.988 Y82.065 E130.85703 F2400
+G1 X86.587 Y81.538 E130.88336 F2400
+G1 X87.206 Y81.032 E130.90975 F2400
+G1 X87.844 Y80.546 E130.93622 F2400
+G1 X88.500 Y80.081 E130.96275 F2400
+G1 X89.174 Y79.639 E130.98935 F2400
+G1 X89.865 Y79.220 E131.01602 F2400
+G1 X90.572 Y78.824 E131.04276 F2400
+G1 X91.294 Y78.452 E131.06957 F2400
+G1 X92.031 Y78.105 E131.09644 F2400
+G1 X92.781 Y77.783 E131.12339 F2400
+G1 X93.545 Y77.487 E131.15040 F2400
+G1 X94.320 Y77.217 E131.17749 F2400
+G1 X95.106 Y76.974 E131.20464 F2400
+G1 X95.902 Y76.759 E131.23186 F2400
+G1 X96.707 Y76.570 E131.25915 F2400
+G1 X97.521 Y76.410 E131.28651 F2400
+G1 X98.341 Y76.278 E131.31394 F2400
+G1 X99.168 Y76.175 E131.34144 F2400
+G1 X100.000 Y76.100 E131.36900 F2400
+G1 X100.836 Y76.055 E131.39664 F2400
+G1 X101.676 Y76.039 E131.42434 F2400
+G1 X102.517 Y76.052 E131.45211 F2400
+G1 X103.360 Y76.095 E131.47996 F2400
+G1 X104.202 Y76.168 E131.50787 F2400
+G1 X105.044 Y76.270 E131.53585 F2400
+G1 X105.884 Y76.402 E131.56390 F2400
+G1 X106.720 Y76.564 E131.59201 F2400
+G1 X107.552 Y76.756 E131.62020 F2400
+G1 X108.379 Y76.978 E131.64845 F2400
+G1 X109.200 Y77.228 E131.67678 F2400
+G1 X110.014 Y77.509 E131.70517 F2400
+G1 X110.819 Y77.818 E131.73363 F2400
+G1 X111.615 Y78.156 E131.76217 F2400
+G1 X112.400 Y78.523 E131.79077 F2400
+G1 X113.174 Y78.918 E131.81943 F2400
+G1 X113.935 Y79.340 E131.84817 F2400
+G1 X114.683 Y79.791 E131.87698 F2400
+G1 X115.416 Y80.268 E131.90586 F2400
+G1 X116.134 Y80.772 E131.93480 F2400
+G1 X116.835 Y81.302 E131.96381 F2400
+G1 X117.519 Y81.858 E131.99290 F2400
+G1 X118.185 Y82.439 E132.02205 F2400
+G1 X118.831 Y83.044 E132.05127 F2400
+G1 X119.458 Y83.673 E132.08056 F2400
+G1 X120.063 Y84.325 E132.10992 F2400
+G1 X120.646 Y85.000 E132.13935 F2400
+G1 X121.207 Y85.696 E132.16884 F2400
+G1 X121.744 Y86.413 E132.19841 F2400
+G1 X122.257 Y87.150 E132.22804 F2400
+G1 X122.745 Y87.906 E132.25775 F2400
+G1 X123.207 Y88.681 E132.28752 F2400
+G1 X123.643 Y89.474 E132.31736 F2400
+G1 X124.051 Y90.283 E132.34727 F2400
+G1 X124.432 Y91.107 E132.37725 F2400
+G1 X124.785 Y91.947 E132.40730 F2400
+G1 X125.108 Y92.800 E132.43741 F2400
+G1 X125.402 Y93.666 E132.46760 F2400
+G1 X125.667 Y94.544 E132.49785 F2400
+G1 X125.900 Y95.433 E132.52818 F2400
+G1 X126.103 Y96.331 E132.55857 F2400
+G1 X126.275 Y97.238 E132.58903 F2400
+G1 X126.415 Y98.153 E132.61956 F2400
+G1 X126.524 Y99.074 E132.65016 F2400
+G1 X126.600 Y100.000 E132.68083 F2400
+G1 X56.713 Y128.813 E135.17542 F2400
+G1 X87.721 Y58.189 E137.72075 F2400
+G1 X151.301 Y78.254 E139.92089 F2400
+G1 X130.097 Y119.860 E141.46189 F2400
+G1 X145.997 Y108.604 E142.10474 F2400
+G1 X130.113 Y78.379 E143.23151 F2400
+G1 X72.391 Y138.547 E145.98302 F2400
+G1 X91.371 Y146.132 E146.65751 F2400
+G1 X119.613 Y108.387 E148.21320 F2400
+G1 X53.770 Y144.444 E150.69050 F2400
+G1 X93.989 Y103.623 E152.58161 F2400
+G1 X88.976 Y66.073 E153.83175 F2400
+M400
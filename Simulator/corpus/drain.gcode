@@ -0,0 +1,147 @@
+G28
+G90
+M82
+G92 E0
+G1 Z0.3 F600
+G1 X49.613 Y159.731 E5.51954 F3714
+M400
+G1 X87.259 Y69.550 E8.74440 F3835
+G1 X119.083 Y64.948 E9.80553 F3978
+G1 X121.238 Y142.734 E12.37345 F3927
+G1 X41.533 Y97.037 E15.40535 F5347
+G4 P39
+G1 X156.636 Y94.136 E19.20497 F1455
+G1 X48.318 Y165.445 E23.48453 F2526
+G1 X30.446 Y84.218 E26.22912 F1231
+G4 P2
+G1 X99.086 Y104.865 E28.59451 F5428
+M400
+G1 X142.799 Y106.596 E30.03815 F4190
+G1 X78.795 Y90.301 E32.21763 F4765
+G1 X100.838 Y78.034 E33.05009 F3109
+G4 P9
+G1 X43.770 Y147.842 E36.02556 F3694
+G1 X100.001 Y153.428 E37.89032 F2990
+G4 P10
+G1 X76.588 Y90.176 E40.11604 F1219
+M400
+G1 X171.694 Y143.433 E43.71311 F3329
+G4 P6
+G1 X139.461 Y84.731 E45.92310 F4103
+G1 X175.293 Y140.039 E48.09782 F5242
+G4 P8
+G1 X96.963 Y164.047 E50.80139 F5285
+G1 X103.851 Y73.494 E53.79828 F5720
+G1 X133.795 Y97.615 E55.06716 F5966
+M400
+G1 X111.783 Y79.090 E56.01655 F3999
+G1 X137.880 Y76.882 E56.88082 F4116
+G4 P27
+G1 X113.230 Y23.833 E58.81120 F5900
+G4 P36
+G1 X142.798 Y157.171 E63.31827 F2050
+G1 X120.935 Y71.287 E66.24285 F1424
+G1 X70.121 Y26.270 E68.48310 F2270
+G1 X173.255 Y140.518 E73.56223 F3726
+M400
+G1 X160.672 Y108.874 E74.68599 F2139
+G1 X105.143 Y165.244 E77.29716 F3169
+G1 X41.433 Y150.337 E79.45638 F3299
+G4 P33
+G1 X37.052 Y75.291 E81.93713 F2139
+G4 P5
+G1 X75.398 Y59.567 E83.30482 F3370
+G1 X176.421 Y157.658 E87.95156 F4562
+G1 X152.200 Y113.534 E89.61260 F1734
+G1 X154.053 Y100.468 E90.04810 F5112
+M400
+G1 X83.561 Y61.616 E92.70427 F4248
+G1 X94.199 Y147.843 E95.57135 F4308
+G4 P40
+G1 X120.698 Y64.276 E98.46440 F1918
+G1 X102.377 Y151.999 E101.42171 F3443
+G1 X104.771 Y61.076 E104.42320 F1590
+G4 P49
+G1 X57.139 Y116.497 E106.83477 F2030
+M400
+G1 X153.843 Y128.052 E110.04870 F2879
+G1 X147.822 Y24.687 E113.46553 F5360
+G1 X132.740 Y33.134 E114.03596 F1296
+G4 P49
+G1 X114.365 Y27.833 E114.66707 F2058
+G1 X26.960 Y79.273 E118.01387 F3501
+G1 X92.004 Y24.555 E120.81881 F4001
+G4 P21
+G1 X119.143 Y63.564 E122.38698 F4788
+G1 X172.586 Y87.202 E124.31541 F2731
+M400
+G1 X97.609 Y131.579 E127.19056 F1390
+G1 X104.117 Y26.364 E130.66929 F5063
+G1 X92.036 Y126.196 E133.98776 F1292
+G1 X79.687 Y21.620 E137.46273 F4858
+G4 P26
+G1 X73.100 Y92.219 E139.80260 F5353
+G1 X161.732 Y43.035 E143.14763 F4220
+G1 X155.790 Y86.686 E144.60140 F4280
+G4 P11
+G1 X24.032 Y161.068 E149.59440 F4076
+G1 X125.915 Y62.489 E154.27271 F3110
+M400
+G1 X82.133 Y158.885 E157.76652 F5071
+G1 X90.622 Y148.770 E158.20228 F2096
+G4 P8
+G1 X55.011 Y20.700 E162.58895 F5541
+G4 P40
+G1 X106.269 Y84.682 E165.29438 F2017
+G1 X154.773 Y158.924 E168.22089 F2273
+G1 X150.563 Y39.709 E172.15744 F4115
+M400
+G1 X158.781 Y138.850 E175.44029 F4253
+G1 X64.938 Y38.783 E179.96742 F1615
+G4 P35
+G1 X52.927 Y129.602 E182.99055 F4526
+G1 X141.040 Y60.527 E186.68527 F2317
+G1 X175.840 Y133.402 E189.35028 F5646
+G4 P42
+G1 X177.969 Y26.063 E192.89317 F3228
+G1 X86.317 Y160.517 E198.26295 F1997
+M400
+G1 X81.904 Y148.268 E198.69260 F5691
+G1 X48.530 Y137.249 E199.85244 F3628
+G1 X139.206 Y70.949 E203.55930 F5791
+G1 X122.579 Y53.465 E204.35553 F3022
+G4 P18
+G1 X48.103 Y58.252 E206.81829 F2369
+G1 X40.125 Y100.452 E208.23554 F1838
+G1 X137.550 Y166.033 E212.11110 F4550
+G4 P43
+G1 X87.905 Y127.690 E214.18109 F5731
+M400
+G1 X76.116 Y74.494 E215.97916 F4224
+G1 X134.131 Y152.790 E219.19492 F3482
+G1 X102.964 Y152.528 E220.22348 F2784
+G1 X136.490 Y52.686 E223.69907 F5932
+G4 P0
+G1 X78.477 Y108.365 E226.35258 F5159
+G1 X78.542 Y165.582 E228.24076 F1344
+G1 X137.387 Y151.290 E230.23911 F4103
+G1 X64.785 Y119.983 E232.84823 F3831
+G4 P37
+G1 X23.635 Y28.024 E236.17288 F2831
+G1 X162.907 Y143.734 E242.14811 F2890
+M400
+G1 X94.152 Y93.395 E244.96012 F4286
+G1 X130.538 Y57.435 E246.64830 F2192
+G1 X162.865 Y24.372 E248.17425 F3366
+G4 P12
+G1 X95.823 Y106.167 E251.66430 F1273
+G1 X79.403 Y129.350 E252.60179 F3089
+G1 X43.107 Y145.512 E253.91293 F3948
+G1 X24.765 Y147.564 E254.52200 F3643
+G4 P24
+G1 X100.481 Y76.700 E257.94425 F2397
+G1 X173.553 Y150.188 E261.36416 F4235
+G1 X105.456 Y26.523 E266.02289 F3465
+G1 X170.907 Y103.529 E269.35797 F5446
+M400
+M400
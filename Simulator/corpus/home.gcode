@@ -0,0 +1,14 @@
+G28
+G90
+G1 X50 Y60 Z10 F6000
+G28
+G1 X120 Y80 Z5 F6000
+G28 X
+G1 X30 F6000
+G28 Y
+G1 Y90 Z20 F6000
+G28 Z
+G1 X80 Y40 Z2 F3000
+G28
+G1 X10 Y10 Z1 F3000
+M400
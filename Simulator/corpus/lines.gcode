@@ -0,0 +1,798 @@
+G28
+G90
+M82
+G92 E0
+G1 Z0.3 F600
+G1 Z0.300 F600
+G1 E-1.50000 F2400
+G0 X60.000 Y57.000 F6000
+G1 E0.00000 F2400
+G1 X140.000 Y57.000 E2.64000 F1800
+G1 X140.000 Y137.000 E5.28000 F1800
+G1 X60.000 Y137.000 E7.92000 F1800
+G1 X60.000 Y57.000 E10.56000 F1800
+G1 E9.06000 F2400
+G0 X62.000 Y59.000 F6000
+G1 E10.56000 F2400
+G1 X138.000 Y59.000 E13.06800 F1800
+G1 X138.000 Y135.000 E15.57600 F1800
+G1 X62.000 Y135.000 E18.08400 F1800
+G1 X62.000 Y59.000 E20.59200 F1800
+G1 E19.09200 F2400
+G0 X64.000 Y61.000 F6000
+G1 E20.59200 F2400
+G1 X136.000 Y61.000 E22.96800 F1800
+G1 X136.000 Y133.000 E25.34400 F1800
+G1 X64.000 Y133.000 E27.72000 F1800
+G1 X64.000 Y61.000 E30.09600 F1800
+G1 X65.000 Y62.400 E30.15278 F3000
+G1 X135.000 Y62.400 E32.46278 F3000
+G1 X135.000 Y63.200 E32.48918 F3000
+G1 X65.000 Y63.200 E34.79918 F3000
+G1 X65.000 Y64.000 E34.82558 F3000
+G1 X135.000 Y64.000 E37.13558 F3000
+G1 X135.000 Y64.800 E37.16198 F3000
+G1 X65.000 Y64.800 E39.47198 F3000
+G1 X65.000 Y65.600 E39.49838 F3000
+G1 X135.000 Y65.600 E41.80838 F3000
+G1 X135.000 Y66.400 E41.83478 F3000
+G1 X65.000 Y66.400 E44.14478 F3000
+G1 X65.000 Y67.200 E44.17118 F3000
+G1 X135.000 Y67.200 E46.48118 F3000
+G1 X135.000 Y68.000 E46.50758 F3000
+G1 X65.000 Y68.000 E48.81758 F3000
+G1 X65.000 Y68.800 E48.84398 F3000
+G1 X135.000 Y68.800 E51.15398 F3000
+G1 X135.000 Y69.600 E51.18038 F3000
+G1 X65.000 Y69.600 E53.49038 F3000
+G1 X65.000 Y70.400 E53.51678 F3000
+G1 X135.000 Y70.400 E55.82678 F3000
+G1 X135.000 Y71.200 E55.85318 F3000
+G1 X65.000 Y71.200 E58.16318 F3000
+G1 X65.000 Y72.000 E58.18958 F3000
+G1 X135.000 Y72.000 E60.49958 F3000
+G1 X135.000 Y72.800 E60.52598 F3000
+G1 X65.000 Y72.800 E62.83598 F3000
+G1 X65.000 Y73.600 E62.86238 F3000
+G1 X135.000 Y73.600 E65.17238 F3000
+G1 X135.000 Y74.400 E65.19878 F3000
+G1 X65.000 Y74.400 E67.50878 F3000
+G1 X65.000 Y75.200 E67.53518 F3000
+G1 X135.000 Y75.200 E69.84518 F3000
+G1 X135.000 Y76.000 E69.87158 F3000
+G1 X65.000 Y76.000 E72.18158 F3000
+G1 X65.000 Y76.800 E72.20798 F3000
+G1 X135.000 Y76.800 E74.51798 F3000
+G1 X135.000 Y77.600 E74.54438 F3000
+G1 X65.000 Y77.600 E76.85438 F3000
+G1 X65.000 Y78.400 E76.88078 F3000
+G1 X135.000 Y78.400 E79.19078 F3000
+G1 X135.000 Y79.200 E79.21718 F3000
+G1 X65.000 Y79.200 E81.52718 F3000
+G1 X65.000 Y80.000 E81.55358 F3000
+G1 X135.000 Y80.000 E83.86358 F3000
+G1 X135.000 Y80.800 E83.88998 F3000
+G1 X65.000 Y80.800 E86.19998 F3000
+G1 X65.000 Y81.600 E86.22638 F3000
+G1 X135.000 Y81.600 E88.53638 F3000
+G1 X135.000 Y82.400 E88.56278 F3000
+G1 X65.000 Y82.400 E90.87278 F3000
+G1 X65.000 Y83.200 E90.89918 F3000
+G1 X135.000 Y83.200 E93.20918 F3000
+G1 X135.000 Y84.000 E93.23558 F3000
+G1 X65.000 Y84.000 E95.54558 F3000
+G1 X65.000 Y84.800 E95.57198 F3000
+G1 X135.000 Y84.800 E97.88198 F3000
+G1 X135.000 Y85.600 E97.90838 F3000
+G1 X65.000 Y85.600 E100.21838 F3000
+G1 X65.000 Y86.400 E100.24478 F3000
+G1 X135.000 Y86.400 E102.55478 F3000
+G1 X135.000 Y87.200 E102.58118 F3000
+G1 X65.000 Y87.200 E104.89118 F3000
+G1 X65.000 Y88.000 E104.91758 F3000
+G1 X135.000 Y88.000 E107.22758 F3000
+G1 X135.000 Y88.800 E107.25398 F3000
+G1 X65.000 Y88.800 E109.56398 F3000
+G1 X65.000 Y89.600 E109.59038 F3000
+G1 X135.000 Y89.600 E111.90038 F3000
+G1 X135.000 Y90.400 E111.92678 F3000
+G1 X65.000 Y90.400 E114.23678 F3000
+G1 X65.000 Y91.200 E114.26318 F3000
+G1 X135.000 Y91.200 E116.57318 F3000
+G1 X135.000 Y92.000 E116.59958 F3000
+G1 X65.000 Y92.000 E118.90958 F3000
+G1 X65.000 Y92.800 E118.93598 F3000
+G1 X135.000 Y92.800 E121.24598 F3000
+G1 X135.000 Y93.600 E121.27238 F3000
+G1 X65.000 Y93.600 E123.58238 F3000
+G1 X65.000 Y94.400 E123.60878 F3000
+G1 X135.000 Y94.400 E125.91878 F3000
+G1 X135.000 Y95.200 E125.94518 F3000
+G1 X65.000 Y95.200 E128.25518 F3000
+G1 X65.000 Y96.000 E128.28158 F3000
+G1 X135.000 Y96.000 E130.59158 F3000
+G1 X135.000 Y96.800 E130.61798 F3000
+G1 X65.000 Y96.800 E132.92798 F3000
+G1 X65.000 Y97.600 E132.95438 F3000
+G1 X135.000 Y97.600 E135.26438 F3000
+G1 X135.000 Y98.400 E135.29078 F3000
+G1 X65.000 Y98.400 E137.60078 F3000
+G1 X65.000 Y99.200 E137.62718 F3000
+G1 X135.000 Y99.200 E139.93718 F3000
+G1 X135.000 Y100.000 E139.96358 F3000
+G1 X65.000 Y100.000 E142.27358 F3000
+G1 X65.000 Y100.800 E142.29998 F3000
+G1 X135.000 Y100.800 E144.60998 F3000
+G1 X135.000 Y101.600 E144.63638 F3000
+G1 X65.000 Y101.600 E146.94638 F3000
+G1 X65.000 Y102.400 E146.97278 F3000
+G1 X135.000 Y102.400 E149.28278 F3000
+G1 X135.000 Y103.200 E149.30918 F3000
+G1 X65.000 Y103.200 E151.61918 F3000
+G1 X65.000 Y104.000 E151.64558 F3000
+G1 X135.000 Y104.000 E153.95558 F3000
+G1 X135.000 Y104.800 E153.98198 F3000
+G1 X65.000 Y104.800 E156.29198 F3000
+G1 X65.000 Y105.600 E156.31838 F3000
+G1 X135.000 Y105.600 E158.62838 F3000
+G1 X135.000 Y106.400 E158.65478 F3000
+G1 X65.000 Y106.400 E160.96478 F3000
+G1 X65.000 Y107.200 E160.99118 F3000
+G1 X135.000 Y107.200 E163.30118 F3000
+G1 X135.000 Y108.000 E163.32758 F3000
+G1 X65.000 Y108.000 E165.63758 F3000
+G1 X65.000 Y108.800 E165.66398 F3000
+G1 X135.000 Y108.800 E167.97398 F3000
+G1 X135.000 Y109.600 E168.00038 F3000
+G1 X65.000 Y109.600 E170.31038 F3000
+G1 X65.000 Y110.400 E170.33678 F3000
+G1 X135.000 Y110.400 E172.64678 F3000
+G1 X135.000 Y111.200 E172.67318 F3000
+G1 X65.000 Y111.200 E174.98318 F3000
+G1 X65.000 Y112.000 E175.00958 F3000
+G1 X135.000 Y112.000 E177.31958 F3000
+G1 X135.000 Y112.800 E177.34598 F3000
+G1 X65.000 Y112.800 E179.65598 F3000
+G1 X65.000 Y113.600 E179.68238 F3000
+G1 X135.000 Y113.600 E181.99238 F3000
+G1 X135.000 Y114.400 E182.01878 F3000
+G1 X65.000 Y114.400 E184.32878 F3000
+G1 X65.000 Y115.200 E184.35518 F3000
+G1 X135.000 Y115.200 E186.66518 F3000
+G1 X135.000 Y116.000 E186.69158 F3000
+G1 X65.000 Y116.000 E189.00158 F3000
+G1 X65.000 Y116.800 E189.02798 F3000
+G1 X135.000 Y116.800 E191.33798 F3000
+G1 X135.000 Y117.600 E191.36438 F3000
+G1 X65.000 Y117.600 E193.67438 F3000
+G1 X65.000 Y118.400 E193.70078 F3000
+G1 X135.000 Y118.400 E196.01078 F3000
+G1 X135.000 Y119.200 E196.03718 F3000
+G1 X65.000 Y119.200 E198.34718 F3000
+G1 X65.000 Y120.000 E198.37358 F3000
+G1 X135.000 Y120.000 E200.68358 F3000
+G1 X135.000 Y120.800 E200.70998 F3000
+G1 X65.000 Y120.800 E203.01998 F3000
+G1 X65.000 Y121.600 E203.04638 F3000
+G1 X135.000 Y121.600 E205.35638 F3000
+G1 X135.000 Y122.400 E205.38278 F3000
+G1 X65.000 Y122.400 E207.69278 F3000
+G1 X65.000 Y123.200 E207.71918 F3000
+G1 X135.000 Y123.200 E210.02918 F3000
+G1 X135.000 Y124.000 E210.05558 F3000
+G1 X65.000 Y124.000 E212.36558 F3000
+G1 X65.000 Y124.800 E212.39198 F3000
+G1 X135.000 Y124.800 E214.70198 F3000
+G1 X135.000 Y125.600 E214.72838 F3000
+G1 X65.000 Y125.600 E217.03838 F3000
+G1 X65.000 Y126.400 E217.06478 F3000
+G1 X135.000 Y126.400 E219.37478 F3000
+G1 X135.000 Y127.200 E219.40118 F3000
+G1 X65.000 Y127.200 E221.71118 F3000
+G1 X65.000 Y128.000 E221.73758 F3000
+G1 X135.000 Y128.000 E224.04758 F3000
+G1 X135.000 Y128.800 E224.07398 F3000
+G1 X65.000 Y128.800 E226.38398 F3000
+G1 X65.000 Y129.600 E226.41038 F3000
+G1 X135.000 Y129.600 E228.72038 F3000
+G1 X135.000 Y130.400 E228.74678 F3000
+G1 X65.000 Y130.400 E231.05678 F3000
+G1 X65.000 Y131.200 E231.08318 F3000
+G1 X135.000 Y131.200 E233.39318 F3000
+G1 X135.000 Y132.000 E233.41958 F3000
+G1 X65.000 Y132.000 E235.72958 F3000
+G1 Z0.500 F600
+G1 E234.22958 F2400
+G0 X60.000 Y57.000 F6000
+G1 E235.72958 F2400
+G1 X140.000 Y57.000 E238.36958 F1800
+G1 X140.000 Y137.000 E241.00958 F1800
+G1 X60.000 Y137.000 E243.64958 F1800
+G1 X60.000 Y57.000 E246.28958 F1800
+G1 E244.78958 F2400
+G0 X62.000 Y59.000 F6000
+G1 E246.28958 F2400
+G1 X138.000 Y59.000 E248.79758 F1800
+G1 X138.000 Y135.000 E251.30558 F1800
+G1 X62.000 Y135.000 E253.81358 F1800
+G1 X62.000 Y59.000 E256.32158 F1800
+G1 E254.82158 F2400
+G0 X64.000 Y61.000 F6000
+G1 E256.32158 F2400
+G1 X136.000 Y61.000 E258.69758 F1800
+G1 X136.000 Y133.000 E261.07358 F1800
+G1 X64.000 Y133.000 E263.44958 F1800
+G1 X64.000 Y61.000 E265.82558 F1800
+G1 X65.000 Y62.400 E265.88235 F3000
+G1 X135.000 Y62.400 E268.19235 F3000
+G1 X135.000 Y63.200 E268.21875 F3000
+G1 X65.000 Y63.200 E270.52875 F3000
+G1 X65.000 Y64.000 E270.55515 F3000
+G1 X135.000 Y64.000 E272.86515 F3000
+G1 X135.000 Y64.800 E272.89155 F3000
+G1 X65.000 Y64.800 E275.20155 F3000
+G1 X65.000 Y65.600 E275.22795 F3000
+G1 X135.000 Y65.600 E277.53795 F3000
+G1 X135.000 Y66.400 E277.56435 F3000
+G1 X65.000 Y66.400 E279.87435 F3000
+G1 X65.000 Y67.200 E279.90075 F3000
+G1 X135.000 Y67.200 E282.21075 F3000
+G1 X135.000 Y68.000 E282.23715 F3000
+G1 X65.000 Y68.000 E284.54715 F3000
+G1 X65.000 Y68.800 E284.57355 F3000
+G1 X135.000 Y68.800 E286.88355 F3000
+G1 X135.000 Y69.600 E286.90995 F3000
+G1 X65.000 Y69.600 E289.21995 F3000
+G1 X65.000 Y70.400 E289.24635 F3000
+G1 X135.000 Y70.400 E291.55635 F3000
+G1 X135.000 Y71.200 E291.58275 F3000
+G1 X65.000 Y71.200 E293.89275 F3000
+G1 X65.000 Y72.000 E293.91915 F3000
+G1 X135.000 Y72.000 E296.22915 F3000
+G1 X135.000 Y72.800 E296.25555 F3000
+G1 X65.000 Y72.800 E298.56555 F3000
+G1 X65.000 Y73.600 E298.59195 F3000
+G1 X135.000 Y73.600 E300.90195 F3000
+G1 X135.000 Y74.400 E300.92835 F3000
+G1 X65.000 Y74.400 E303.23835 F3000
+G1 X65.000 Y75.200 E303.26475 F3000
+G1 X135.000 Y75.200 E305.57475 F3000
+G1 X135.000 Y76.000 E305.60115 F3000
+G1 X65.000 Y76.000 E307.91115 F3000
+G1 X65.000 Y76.800 E307.93755 F3000
+G1 X135.000 Y76.800 E310.24755 F3000
+G1 X135.000 Y77.600 E310.27395 F3000
+G1 X65.000 Y77.600 E312.58395 F3000
+G1 X65.000 Y78.400 E312.61035 F3000
+G1 X135.000 Y78.400 E314.92035 F3000
+G1 X135.000 Y79.200 E314.94675 F3000
+G1 X65.000 Y79.200 E317.25675 F3000
+G1 X65.000 Y80.000 E317.28315 F3000
+G1 X135.000 Y80.000 E319.59315 F3000
+G1 X135.000 Y80.800 E319.61955 F3000
+G1 X65.000 Y80.800 E321.92955 F3000
+G1 X65.000 Y81.600 E321.95595 F3000
+G1 X135.000 Y81.600 E324.26595 F3000
+G1 X135.000 Y82.400 E324.29235 F3000
+G1 X65.000 Y82.400 E326.60235 F3000
+G1 X65.000 Y83.200 E326.62875 F3000
+G1 X135.000 Y83.200 E328.93875 F3000
+G1 X135.000 Y84.000 E328.96515 F3000
+G1 X65.000 Y84.000 E331.27515 F3000
+G1 X65.000 Y84.800 E331.30155 F3000
+G1 X135.000 Y84.800 E333.61155 F3000
+G1 X135.000 Y85.600 E333.63795 F3000
+G1 X65.000 Y85.600 E335.94795 F3000
+G1 X65.000 Y86.400 E335.97435 F3000
+G1 X135.000 Y86.400 E338.28435 F3000
+G1 X135.000 Y87.200 E338.31075 F3000
+G1 X65.000 Y87.200 E340.62075 F3000
+G1 X65.000 Y88.000 E340.64715 F3000
+G1 X135.000 Y88.000 E342.95715 F3000
+G1 X135.000 Y88.800 E342.98355 F3000
+G1 X65.000 Y88.800 E345.29355 F3000
+G1 X65.000 Y89.600 E345.31995 F3000
+G1 X135.000 Y89.600 E347.62995 F3000
+G1 X135.000 Y90.400 E347.65635 F3000
+G1 X65.000 Y90.400 E349.96635 F3000
+G1 X65.000 Y91.200 E349.99275 F3000
+G1 X135.000 Y91.200 E352.30275 F3000
+G1 X135.000 Y92.000 E352.32915 F3000
+G1 X65.000 Y92.000 E354.63915 F3000
+G1 X65.000 Y92.800 E354.66555 F3000
+G1 X135.000 Y92.800 E356.97555 F3000
+G1 X135.000 Y93.600 E357.00195 F3000
+G1 X65.000 Y93.600 E359.31195 F3000
+G1 X65.000 Y94.400 E359.33835 F3000
+G1 X135.000 Y94.400 E361.64835 F3000
+G1 X135.000 Y95.200 E361.67475 F3000
+G1 X65.000 Y95.200 E363.98475 F3000
+G1 X65.000 Y96.000 E364.01115 F3000
+G1 X135.000 Y96.000 E366.32115 F3000
+G1 X135.000 Y96.800 E366.34755 F3000
+G1 X65.000 Y96.800 E368.65755 F3000
+G1 X65.000 Y97.600 E368.68395 F3000
+G1 X135.000 Y97.600 E370.99395 F3000
+G1 X135.000 Y98.400 E371.02035 F3000
+G1 X65.000 Y98.400 E373.33035 F3000
+G1 X65.000 Y99.200 E373.35675 F3000
+G1 X135.000 Y99.200 E375.66675 F3000
+G1 X135.000 Y100.000 E375.69315 F3000
+G1 X65.000 Y100.000 E378.00315 F3000
+G1 X65.000 Y100.800 E378.02955 F3000
+G1 X135.000 Y100.800 E380.33955 F3000
+G1 X135.000 Y101.600 E380.36595 F3000
+G1 X65.000 Y101.600 E382.67595 F3000
+G1 X65.000 Y102.400 E382.70235 F3000
+G1 X135.000 Y102.400 E385.01235 F3000
+G1 X135.000 Y103.200 E385.03875 F3000
+G1 X65.000 Y103.200 E387.34875 F3000
+G1 X65.000 Y104.000 E387.37515 F3000
+G1 X135.000 Y104.000 E389.68515 F3000
+G1 X135.000 Y104.800 E389.71155 F3000
+G1 X65.000 Y104.800 E392.02155 F3000
+G1 X65.000 Y105.600 E392.04795 F3000
+G1 X135.000 Y105.600 E394.35795 F3000
+G1 X135.000 Y106.400 E394.38435 F3000
+G1 X65.000 Y106.400 E396.69435 F3000
+G1 X65.000 Y107.200 E396.72075 F3000
+G1 X135.000 Y107.200 E399.03075 F3000
+G1 X135.000 Y108.000 E399.05715 F3000
+G1 X65.000 Y108.000 E401.36715 F3000
+G1 X65.000 Y108.800 E401.39355 F3000
+G1 X135.000 Y108.800 E403.70355 F3000
+G1 X135.000 Y109.600 E403.72995 F3000
+G1 X65.000 Y109.600 E406.03995 F3000
+G1 X65.000 Y110.400 E406.06635 F3000
+G1 X135.000 Y110.400 E408.37635 F3000
+G1 X135.000 Y111.200 E408.40275 F3000
+G1 X65.000 Y111.200 E410.71275 F3000
+G1 X65.000 Y112.000 E410.73915 F3000
+G1 X135.000 Y112.000 E413.04915 F3000
+G1 X135.000 Y112.800 E413.07555 F3000
+G1 X65.000 Y112.800 E415.38555 F3000
+G1 X65.000 Y113.600 E415.41195 F3000
+G1 X135.000 Y113.600 E417.72195 F3000
+G1 X135.000 Y114.400 E417.74835 F3000
+G1 X65.000 Y114.400 E420.05835 F3000
+G1 X65.000 Y115.200 E420.08475 F3000
+G1 X135.000 Y115.200 E422.39475 F3000
+G1 X135.000 Y116.000 E422.42115 F3000
+G1 X65.000 Y116.000 E424.73115 F3000
+G1 X65.000 Y116.800 E424.75755 F3000
+G1 X135.000 Y116.800 E427.06755 F3000
+G1 X135.000 Y117.600 E427.09395 F3000
+G1 X65.000 Y117.600 E429.40395 F3000
+G1 X65.000 Y118.400 E429.43035 F3000
+G1 X135.000 Y118.400 E431.74035 F3000
+G1 X135.000 Y119.200 E431.76675 F3000
+G1 X65.000 Y119.200 E434.07675 F3000
+G1 X65.000 Y120.000 E434.10315 F3000
+G1 X135.000 Y120.000 E436.41315 F3000
+G1 X135.000 Y120.800 E436.43955 F3000
+G1 X65.000 Y120.800 E438.74955 F3000
+G1 X65.000 Y121.600 E438.77595 F3000
+G1 X135.000 Y121.600 E441.08595 F3000
+G1 X135.000 Y122.400 E441.11235 F3000
+G1 X65.000 Y122.400 E443.42235 F3000
+G1 X65.000 Y123.200 E443.44875 F3000
+G1 X135.000 Y123.200 E445.75875 F3000
+G1 X135.000 Y124.000 E445.78515 F3000
+G1 X65.000 Y124.000 E448.09515 F3000
+G1 X65.000 Y124.800 E448.12155 F3000
+G1 X135.000 Y124.800 E450.43155 F3000
+G1 X135.000 Y125.600 E450.45795 F3000
+G1 X65.000 Y125.600 E452.76795 F3000
+G1 X65.000 Y126.400 E452.79435 F3000
+G1 X135.000 Y126.400 E455.10435 F3000
+G1 X135.000 Y127.200 E455.13075 F3000
+G1 X65.000 Y127.200 E457.44075 F3000
+G1 X65.000 Y128.000 E457.46715 F3000
+G1 X135.000 Y128.000 E459.77715 F3000
+G1 X135.000 Y128.800 E459.80355 F3000
+G1 X65.000 Y128.800 E462.11355 F3000
+G1 X65.000 Y129.600 E462.13995 F3000
+G1 X135.000 Y129.600 E464.44995 F3000
+G1 X135.000 Y130.400 E464.47635 F3000
+G1 X65.000 Y130.400 E466.78635 F3000
+G1 X65.000 Y131.200 E466.81275 F3000
+G1 X135.000 Y131.200 E469.12275 F3000
+G1 X135.000 Y132.000 E469.14915 F3000
+G1 X65.000 Y132.000 E471.45915 F3000
+G1 Z0.700 F600
+G1 E469.95915 F2400
+G0 X60.000 Y57.000 F6000
+G1 E471.45915 F2400
+G1 X140.000 Y57.000 E474.09915 F1800
+G1 X140.000 Y137.000 E476.73915 F1800
+G1 X60.000 Y137.000 E479.37915 F1800
+G1 X60.000 Y57.000 E482.01915 F1800
+G1 E480.51915 F2400
+G0 X62.000 Y59.000 F6000
+G1 E482.01915 F2400
+G1 X138.000 Y59.000 E484.52715 F1800
+G1 X138.000 Y135.000 E487.03515 F1800
+G1 X62.000 Y135.000 E489.54315 F1800
+G1 X62.000 Y59.000 E492.05115 F1800
+G1 E490.55115 F2400
+G0 X64.000 Y61.000 F6000
+G1 E492.05115 F2400
+G1 X136.000 Y61.000 E494.42715 F1800
+G1 X136.000 Y133.000 E496.80315 F1800
+G1 X64.000 Y133.000 E499.17915 F1800
+G1 X64.000 Y61.000 E501.55515 F1800
+G1 X65.000 Y62.400 E501.61193 F3000
+G1 X135.000 Y62.400 E503.92193 F3000
+G1 X135.000 Y63.200 E503.94833 F3000
+G1 X65.000 Y63.200 E506.25833 F3000
+G1 X65.000 Y64.000 E506.28473 F3000
+G1 X135.000 Y64.000 E508.59473 F3000
+G1 X135.000 Y64.800 E508.62113 F3000
+G1 X65.000 Y64.800 E510.93113 F3000
+G1 X65.000 Y65.600 E510.95753 F3000
+G1 X135.000 Y65.600 E513.26753 F3000
+G1 X135.000 Y66.400 E513.29393 F3000
+G1 X65.000 Y66.400 E515.60393 F3000
+G1 X65.000 Y67.200 E515.63033 F3000
+G1 X135.000 Y67.200 E517.94033 F3000
+G1 X135.000 Y68.000 E517.96673 F3000
+G1 X65.000 Y68.000 E520.27673 F3000
+G1 X65.000 Y68.800 E520.30313 F3000
+G1 X135.000 Y68.800 E522.61313 F3000
+G1 X135.000 Y69.600 E522.63953 F3000
+G1 X65.000 Y69.600 E524.94953 F3000
+G1 X65.000 Y70.400 E524.97593 F3000
+G1 X135.000 Y70.400 E527.28593 F3000
+G1 X135.000 Y71.200 E527.31233 F3000
+G1 X65.000 Y71.200 E529.62233 F3000
+G1 X65.000 Y72.000 E529.64873 F3000
+G1 X135.000 Y72.000 E531.95873 F3000
+G1 X135.000 Y72.800 E531.98513 F3000
+G1 X65.000 Y72.800 E534.29513 F3000
+G1 X65.000 Y73.600 E534.32153 F3000
+G1 X135.000 Y73.600 E536.63153 F3000
+G1 X135.000 Y74.400 E536.65793 F3000
+G1 X65.000 Y74.400 E538.96793 F3000
+G1 X65.000 Y75.200 E538.99433 F3000
+G1 X135.000 Y75.200 E541.30433 F3000
+G1 X135.000 Y76.000 E541.33073 F3000
+G1 X65.000 Y76.000 E543.64073 F3000
+G1 X65.000 Y76.800 E543.66713 F3000
+G1 X135.000 Y76.800 E545.97713 F3000
+G1 X135.000 Y77.600 E546.00353 F3000
+G1 X65.000 Y77.600 E548.31353 F3000
+G1 X65.000 Y78.400 E548.33993 F3000
+G1 X135.000 Y78.400 E550.64993 F3000
+G1 X135.000 Y79.200 E550.67633 F3000
+G1 X65.000 Y79.200 E552.98633 F3000
+G1 X65.000 Y80.000 E553.01273 F3000
+G1 X135.000 Y80.000 E555.32273 F3000
+G1 X135.000 Y80.800 E555.34913 F3000
+G1 X65.000 Y80.800 E557.65913 F3000
+G1 X65.000 Y81.600 E557.68553 F3000
+G1 X135.000 Y81.600 E559.99553 F3000
+G1 X135.000 Y82.400 E560.02193 F3000
+G1 X65.000 Y82.400 E562.33193 F3000
+G1 X65.000 Y83.200 E562.35833 F3000
+G1 X135.000 Y83.200 E564.66833 F3000
+G1 X135.000 Y84.000 E564.69473 F3000
+G1 X65.000 Y84.000 E567.00473 F3000
+G1 X65.000 Y84.800 E567.03113 F3000
+G1 X135.000 Y84.800 E569.34113 F3000
+G1 X135.000 Y85.600 E569.36753 F3000
+G1 X65.000 Y85.600 E571.67753 F3000
+G1 X65.000 Y86.400 E571.70393 F3000
+G1 X135.000 Y86.400 E574.01393 F3000
+G1 X135.000 Y87.200 E574.04033 F3000
+G1 X65.000 Y87.200 E576.35033 F3000
+G1 X65.000 Y88.000 E576.37673 F3000
+G1 X135.000 Y88.000 E578.68673 F3000
+G1 X135.000 Y88.800 E578.71313 F3000
+G1 X65.000 Y88.800 E581.02313 F3000
+G1 X65.000 Y89.600 E581.04953 F3000
+G1 X135.000 Y89.600 E583.35953 F3000
+G1 X135.000 Y90.400 E583.38593 F3000
+G1 X65.000 Y90.400 E585.69593 F3000
+G1 X65.000 Y91.200 E585.72233 F3000
+G1 X135.000 Y91.200 E588.03233 F3000
+G1 X135.000 Y92.000 E588.05873 F3000
+G1 X65.000 Y92.000 E590.36873 F3000
+G1 X65.000 Y92.800 E590.39513 F3000
+G1 X135.000 Y92.800 E592.70513 F3000
+G1 X135.000 Y93.600 E592.73153 F3000
+G1 X65.000 Y93.600 E595.04153 F3000
+G1 X65.000 Y94.400 E595.06793 F3000
+G1 X135.000 Y94.400 E597.37793 F3000
+G1 X135.000 Y95.200 E597.40433 F3000
+G1 X65.000 Y95.200 E599.71433 F3000
+G1 X65.000 Y96.000 E599.74073 F3000
+G1 X135.000 Y96.000 E602.05073 F3000
+G1 X135.000 Y96.800 E602.07713 F3000
+G1 X65.000 Y96.800 E604.38713 F3000
+G1 X65.000 Y97.600 E604.41353 F3000
+G1 X135.000 Y97.600 E606.72353 F3000
+G1 X135.000 Y98.400 E606.74993 F3000
+G1 X65.000 Y98.400 E609.05993 F3000
+G1 X65.000 Y99.200 E609.08633 F3000
+G1 X135.000 Y99.200 E611.39633 F3000
+G1 X135.000 Y100.000 E611.42273 F3000
+G1 X65.000 Y100.000 E613.73273 F3000
+G1 X65.000 Y100.800 E613.75913 F3000
+G1 X135.000 Y100.800 E616.06913 F3000
+G1 X135.000 Y101.600 E616.09553 F3000
+G1 X65.000 Y101.600 E618.40553 F3000
+G1 X65.000 Y102.400 E618.43193 F3000
+G1 X135.000 Y102.400 E620.74193 F3000
+G1 X135.000 Y103.200 E620.76833 F3000
+G1 X65.000 Y103.200 E623.07833 F3000
+G1 X65.000 Y104.000 E623.10473 F3000
+G1 X135.000 Y104.000 E625.41473 F3000
+G1 X135.000 Y104.800 E625.44113 F3000
+G1 X65.000 Y104.800 E627.75113 F3000
+G1 X65.000 Y105.600 E627.77753 F3000
+G1 X135.000 Y105.600 E630.08753 F3000
+G1 X135.000 Y106.400 E630.11393 F3000
+G1 X65.000 Y106.400 E632.42393 F3000
+G1 X65.000 Y107.200 E632.45033 F3000
+G1 X135.000 Y107.200 E634.76033 F3000
+G1 X135.000 Y108.000 E634.78673 F3000
+G1 X65.000 Y108.000 E637.09673 F3000
+G1 X65.000 Y108.800 E637.12313 F3000
+G1 X135.000 Y108.800 E639.43313 F3000
+G1 X135.000 Y109.600 E639.45953 F3000
+G1 X65.000 Y109.600 E641.76953 F3000
+G1 X65.000 Y110.400 E641.79593 F3000
+G1 X135.000 Y110.400 E644.10593 F3000
+G1 X135.000 Y111.200 E644.13233 F3000
+G1 X65.000 Y111.200 E646.44233 F3000
+G1 X65.000 Y112.000 E646.46873 F3000
+G1 X135.000 Y112.000 E648.77873 F3000
+G1 X135.000 Y112.800 E648.80513 F3000
+G1 X65.000 Y112.800 E651.11513 F3000
+G1 X65.000 Y113.600 E651.14153 F3000
+G1 X135.000 Y113.600 E653.45153 F3000
+G1 X135.000 Y114.400 E653.47793 F3000
+G1 X65.000 Y114.400 E655.78793 F3000
+G1 X65.000 Y115.200 E655.81433 F3000
+G1 X135.000 Y115.200 E658.12433 F3000
+G1 X135.000 Y116.000 E658.15073 F3000
+G1 X65.000 Y116.000 E660.46073 F3000
+G1 X65.000 Y116.800 E660.48713 F3000
+G1 X135.000 Y116.800 E662.79713 F3000
+G1 X135.000 Y117.600 E662.82353 F3000
+G1 X65.000 Y117.600 E665.13353 F3000
+G1 X65.000 Y118.400 E665.15993 F3000
+G1 X135.000 Y118.400 E667.46993 F3000
+G1 X135.000 Y119.200 E667.49633 F3000
+G1 X65.000 Y119.200 E669.80633 F3000
+G1 X65.000 Y120.000 E669.83273 F3000
+G1 X135.000 Y120.000 E672.14273 F3000
+G1 X135.000 Y120.800 E672.16913 F3000
+G1 X65.000 Y120.800 E674.47913 F3000
+G1 X65.000 Y121.600 E674.50553 F3000
+G1 X135.000 Y121.600 E676.81553 F3000
+G1 X135.000 Y122.400 E676.84193 F3000
+G1 X65.000 Y122.400 E679.15193 F3000
+G1 X65.000 Y123.200 E679.17833 F3000
+G1 X135.000 Y123.200 E681.48833 F3000
+G1 X135.000 Y124.000 E681.51473 F3000
+G1 X65.000 Y124.000 E683.82473 F3000
+G1 X65.000 Y124.800 E683.85113 F3000
+G1 X135.000 Y124.800 E686.16113 F3000
+G1 X135.000 Y125.600 E686.18753 F3000
+G1 X65.000 Y125.600 E688.49753 F3000
+G1 X65.000 Y126.400 E688.52393 F3000
+G1 X135.000 Y126.400 E690.83393 F3000
+G1 X135.000 Y127.200 E690.86033 F3000
+G1 X65.000 Y127.200 E693.17033 F3000
+G1 X65.000 Y128.000 E693.19673 F3000
+G1 X135.000 Y128.000 E695.50673 F3000
+G1 X135.000 Y128.800 E695.53313 F3000
+G1 X65.000 Y128.800 E697.84313 F3000
+G1 X65.000 Y129.600 E697.86953 F3000
+G1 X135.000 Y129.600 E700.17953 F3000
+G1 X135.000 Y130.400 E700.20593 F3000
+G1 X65.000 Y130.400 E702.51593 F3000
+G1 X65.000 Y131.200 E702.54233 F3000
+G1 X135.000 Y131.200 E704.85233 F3000
+G1 X135.000 Y132.000 E704.87873 F3000
+G1 X65.000 Y132.000 E707.18873 F3000
+G1 Z0.900 F600
+G1 E705.68873 F2400
+G0 X60.000 Y57.000 F6000
+G1 E707.18873 F2400
+G1 X140.000 Y57.000 E709.82873 F1800
+G1 X140.000 Y137.000 E712.46873 F1800
+G1 X60.000 Y137.000 E715.10873 F1800
+G1 X60.000 Y57.000 E717.74873 F1800
+G1 E716.24873 F2400
+G0 X62.000 Y59.000 F6000
+G1 E717.74873 F2400
+G1 X138.000 Y59.000 E720.25673 F1800
+G1 X138.000 Y135.000 E722.76473 F1800
+G1 X62.000 Y135.000 E725.27273 F1800
+G1 X62.000 Y59.000 E727.78073 F1800
+G1 E726.28073 F2400
+G0 X64.000 Y61.000 F6000
+G1 E727.78073 F2400
+G1 X136.000 Y61.000 E730.15673 F1800
+G1 X136.000 Y133.000 E732.53273 F1800
+G1 X64.000 Y133.000 E734.90873 F1800
+G1 X64.000 Y61.000 E737.28473 F1800
+G1 X65.000 Y62.400 E737.34150 F3000
+G1 X135.000 Y62.400 E739.65150 F3000
+G1 X135.000 Y63.200 E739.67790 F3000
+G1 X65.000 Y63.200 E741.98790 F3000
+G1 X65.000 Y64.000 E742.01430 F3000
+G1 X135.000 Y64.000 E744.32430 F3000
+G1 X135.000 Y64.800 E744.35070 F3000
+G1 X65.000 Y64.800 E746.66070 F3000
+G1 X65.000 Y65.600 E746.68710 F3000
+G1 X135.000 Y65.600 E748.99710 F3000
+G1 X135.000 Y66.400 E749.02350 F3000
+G1 X65.000 Y66.400 E751.33350 F3000
+G1 X65.000 Y67.200 E751.35990 F3000
+G1 X135.000 Y67.200 E753.66990 F3000
+G1 X135.000 Y68.000 E753.69630 F3000
+G1 X65.000 Y68.000 E756.00630 F3000
+G1 X65.000 Y68.800 E756.03270 F3000
+G1 X135.000 Y68.800 E758.34270 F3000
+G1 X135.000 Y69.600 E758.36910 F3000
+G1 X65.000 Y69.600 E760.67910 F3000
+G1 X65.000 Y70.400 E760.70550 F3000
+G1 X135.000 Y70.400 E763.01550 F3000
+G1 X135.000 Y71.200 E763.04190 F3000
+G1 X65.000 Y71.200 E765.35190 F3000
+G1 X65.000 Y72.000 E765.37830 F3000
+G1 X135.000 Y72.000 E767.68830 F3000
+G1 X135.000 Y72.800 E767.71470 F3000
+G1 X65.000 Y72.800 E770.02470 F3000
+G1 X65.000 Y73.600 E770.05110 F3000
+G1 X135.000 Y73.600 E772.36110 F3000
+G1 X135.000 Y74.400 E772.38750 F3000
+G1 X65.000 Y74.400 E774.69750 F3000
+G1 X65.000 Y75.200 E774.72390 F3000
+G1 X135.000 Y75.200 E777.03390 F3000
+G1 X135.000 Y76.000 E777.06030 F3000
+G1 X65.000 Y76.000 E779.37030 F3000
+G1 X65.000 Y76.800 E779.39670 F3000
+G1 X135.000 Y76.800 E781.70670 F3000
+G1 X135.000 Y77.600 E781.73310 F3000
+G1 X65.000 Y77.600 E784.04310 F3000
+G1 X65.000 Y78.400 E784.06950 F3000
+G1 X135.000 Y78.400 E786.37950 F3000
+G1 X135.000 Y79.200 E786.40590 F3000
+G1 X65.000 Y79.200 E788.71590 F3000
+G1 X65.000 Y80.000 E788.74230 F3000
+G1 X135.000 Y80.000 E791.05230 F3000
+G1 X135.000 Y80.800 E791.07870 F3000
+G1 X65.000 Y80.800 E793.38870 F3000
+G1 X65.000 Y81.600 E793.41510 F3000
+G1 X135.000 Y81.600 E795.72510 F3000
+G1 X135.000 Y82.400 E795.75150 F3000
+G1 X65.000 Y82.400 E798.06150 F3000
+G1 X65.000 Y83.200 E798.08790 F3000
+G1 X135.000 Y83.200 E800.39790 F3000
+G1 X135.000 Y84.000 E800.42430 F3000
+G1 X65.000 Y84.000 E802.73430 F3000
+G1 X65.000 Y84.800 E802.76070 F3000
+G1 X135.000 Y84.800 E805.07070 F3000
+G1 X135.000 Y85.600 E805.09710 F3000
+G1 X65.000 Y85.600 E807.40710 F3000
+G1 X65.000 Y86.400 E807.43350 F3000
+G1 X135.000 Y86.400 E809.74350 F3000
+G1 X135.000 Y87.200 E809.76990 F3000
+G1 X65.000 Y87.200 E812.07990 F3000
+G1 X65.000 Y88.000 E812.10630 F3000
+G1 X135.000 Y88.000 E814.41630 F3000
+G1 X135.000 Y88.800 E814.44270 F3000
+G1 X65.000 Y88.800 E816.75270 F3000
+G1 X65.000 Y89.600 E816.77910 F3000
+G1 X135.000 Y89.600 E819.08910 F3000
+G1 X135.000 Y90.400 E819.11550 F3000
+G1 X65.000 Y90.400 E821.42550 F3000
+G1 X65.000 Y91.200 E821.45190 F3000
+G1 X135.000 Y91.200 E823.76190 F3000
+G1 X135.000 Y92.000 E823.78830 F3000
+G1 X65.000 Y92.000 E826.09830 F3000
+G1 X65.000 Y92.800 E826.12470 F3000
+G1 X135.000 Y92.800 E828.43470 F3000
+G1 X135.000 Y93.600 E828.46110 F3000
+G1 X65.000 Y93.600 E830.77110 F3000
+G1 X65.000 Y94.400 E830.79750 F3000
+G1 X135.000 Y94.400 E833.10750 F3000
+G1 X135.000 Y95.200 E833.13390 F3000
+G1 X65.000 Y95.200 E835.44390 F3000
+G1 X65.000 Y96.000 E835.47030 F3000
+G1 X135.000 Y96.000 E837.78030 F3000
+G1 X135.000 Y96.800 E837.80670 F3000
+G1 X65.000 Y96.800 E840.11670 F3000
+G1 X65.000 Y97.600 E840.14310 F3000
+G1 X135.000 Y97.600 E842.45310 F3000
+G1 X135.000 Y98.400 E842.47950 F3000
+G1 X65.000 Y98.400 E844.78950 F3000
+G1 X65.000 Y99.200 E844.81590 F3000
+G1 X135.000 Y99.200 E847.12590 F3000
+G1 X135.000 Y100.000 E847.15230 F3000
+G1 X65.000 Y100.000 E849.46230 F3000
+G1 X65.000 Y100.800 E849.48870 F3000
+G1 X135.000 Y100.800 E851.79870 F3000
+G1 X135.000 Y101.600 E851.82510 F3000
+G1 X65.000 Y101.600 E854.13510 F3000
+G1 X65.000 Y102.400 E854.16150 F3000
+G1 X135.000 Y102.400 E856.47150 F3000
+G1 X135.000 Y103.200 E856.49790 F3000
+G1 X65.000 Y103.200 E858.80790 F3000
+G1 X65.000 Y104.000 E858.83430 F3000
+G1 X135.000 Y104.000 E861.14430 F3000
+G1 X135.000 Y104.800 E861.17070 F3000
+G1 X65.000 Y104.800 E863.48070 F3000
+G1 X65.000 Y105.600 E863.50710 F3000
+G1 X135.000 Y105.600 E865.81710 F3000
+G1 X135.000 Y106.400 E865.84350 F3000
+G1 X65.000 Y106.400 E868.15350 F3000
+G1 X65.000 Y107.200 E868.17990 F3000
+G1 X135.000 Y107.200 E870.48990 F3000
+G1 X135.000 Y108.000 E870.51630 F3000
+G1 X65.000 Y108.000 E872.82630 F3000
+G1 X65.000 Y108.800 E872.85270 F3000
+G1 X135.000 Y108.800 E875.16270 F3000
+G1 X135.000 Y109.600 E875.18910 F3000
+G1 X65.000 Y109.600 E877.49910 F3000
+G1 X65.000 Y110.400 E877.52550 F3000
+G1 X135.000 Y110.400 E879.83550 F3000
+G1 X135.000 Y111.200 E879.86190 F3000
+G1 X65.000 Y111.200 E882.17190 F3000
+G1 X65.000 Y112.000 E882.19830 F3000
+G1 X135.000 Y112.000 E884.50830 F3000
+G1 X135.000 Y112.800 E884.53470 F3000
+G1 X65.000 Y112.800 E886.84470 F3000
+G1 X65.000 Y113.600 E886.87110 F3000
+G1 X135.000 Y113.600 E889.18110 F3000
+G1 X135.000 Y114.400 E889.20750 F3000
+G1 X65.000 Y114.400 E891.51750 F3000
+G1 X65.000 Y115.200 E891.54390 F3000
+G1 X135.000 Y115.200 E893.85390 F3000
+G1 X135.000 Y116.000 E893.88030 F3000
+G1 X65.000 Y116.000 E896.19030 F3000
+G1 X65.000 Y116.800 E896.21670 F3000
+G1 X135.000 Y116.800 E898.52670 F3000
+G1 X135.000 Y117.600 E898.55310 F3000
+G1 X65.000 Y117.600 E900.86310 F3000
+G1 X65.000 Y118.400 E900.88950 F3000
+G1 X135.000 Y118.400 E903.19950 F3000
+G1 X135.000 Y119.200 E903.22590 F3000
+G1 X65.000 Y119.200 E905.53590 F3000
+G1 X65.000 Y120.000 E905.56230 F3000
+G1 X135.000 Y120.000 E907.87230 F3000
+G1 X135.000 Y120.800 E907.89870 F3000
+G1 X65.000 Y120.800 E910.20870 F3000
+G1 X65.000 Y121.600 E910.23510 F3000
+G1 X135.000 Y121.600 E912.54510 F3000
+G1 X135.000 Y122.400 E912.57150 F3000
+G1 X65.000 Y122.400 E914.88150 F3000
+G1 X65.000 Y123.200 E914.90790 F3000
+G1 X135.000 Y123.200 E917.21790 F3000
+G1 X135.000 Y124.000 E917.24430 F3000
+G1 X65.000 Y124.000 E919.55430 F3000
+G1 X65.000 Y124.800 E919.58070 F3000
+G1 X135.000 Y124.800 E921.89070 F3000
+G1 X135.000 Y125.600 E921.91710 F3000
+G1 X65.000 Y125.600 E924.22710 F3000
+G1 X65.000 Y126.400 E924.25350 F3000
+G1 X135.000 Y126.400 E926.56350 F3000
+G1 X135.000 Y127.200 E926.58990 F3000
+G1 X65.000 Y127.200 E928.89990 F3000
+G1 X65.000 Y128.000 E928.92630 F3000
+G1 X135.000 Y128.000 E931.23630 F3000
+G1 X135.000 Y128.800 E931.26270 F3000
+G1 X65.000 Y128.800 E933.57270 F3000
+G1 X65.000 Y129.600 E933.59910 F3000
+G1 X135.000 Y129.600 E935.90910 F3000
+G1 X135.000 Y130.400 E935.93550 F3000
+G1 X65.000 Y130.400 E938.24550 F3000
+G1 X65.000 Y131.200 E938.27190 F3000
+G1 X135.000 Y131.200 E940.58190 F3000
+G1 X135.000 Y132.000 E940.60830 F3000
+G1 X65.000 Y132.000 E942.91830 F3000
+M400
@@ -0,0 +1,1998 @@
+G28
+G92 E0
+G90
+M82
+G1 Z0.3 F600
+G0 X60.000 Y60.000 F6000
+G1 X60.050 Y60.000 E0.00165 F1800
+G1 X60.100 Y60.000 E0.00330 F1800
+G1 X60.150 Y60.000 E0.00495 F1800
+G1 X60.200 Y60.000 E0.00660 F1800
+G1 X60.250 Y60.000 E0.00825 F1800
+G1 X60.300 Y60.000 E0.00990 F1800
+G1 X60.350 Y60.000 E0.01155 F1800
+G1 X60.400 Y60.000 E0.01320 F1800
+G1 X60.450 Y60.000 E0.01485 F1800
+G1 X60.500 Y60.000 E0.01650 F1800
+G1 X60.550 Y60.000 E0.01815 F1800
+G1 X60.600 Y60.000 E0.01980 F1800
+G1 X60.650 Y60.000 E0.02145 F1800
+G1 X60.700 Y60.000 E0.02310 F1800
+G1 X60.750 Y60.000 E0.02475 F1800
+G1 X60.800 Y60.000 E0.02640 F1800
+G1 X60.850 Y60.000 E0.02805 F1800
+G1 X60.900 Y60.000 E0.02970 F1800
+G1 X60.950 Y60.000 E0.03135 F1800
+G1 X61.000 Y60.000 E0.03300 F1800
+G1 X61.050 Y60.000 E0.03465 F1800
+G1 X61.100 Y60.000 E0.03630 F1800
+G1 X61.150 Y60.000 E0.03795 F1800
+G1 X61.200 Y60.000 E0.03960 F1800
+G1 X61.250 Y60.000 E0.04125 F1800
+G1 X61.300 Y60.000 E0.04290 F1800
+G1 X61.350 Y60.000 E0.04455 F1800
+G1 X61.400 Y60.000 E0.04620 F1800
+G1 X61.450 Y60.000 E0.04785 F1800
+G1 X61.500 Y60.000 E0.04950 F1800
+G1 X61.550 Y60.000 E0.05115 F1800
+G1 X61.600 Y60.000 E0.05280 F1800
+G1 X61.650 Y60.000 E0.05445 F1800
+G1 X61.700 Y60.000 E0.05610 F1800
+G1 X61.750 Y60.000 E0.05775 F1800
+G1 X61.800 Y60.000 E0.05940 F1800
+G1 X61.850 Y60.000 E0.06105 F1800
+G1 X61.900 Y60.000 E0.06270 F1800
+G1 X61.950 Y60.000 E0.06435 F1800
+G1 X62.000 Y60.000 E0.06600 F1800
+G1 X62.000 Y60.050 E0.06765 F1800
+G1 X62.000 Y60.100 E0.06930 F1800
+G1 X62.000 Y60.150 E0.07095 F1800
+G1 X62.000 Y60.200 E0.07260 F1800
+G1 X62.000 Y60.250 E0.07425 F1800
+G1 X62.000 Y60.300 E0.07590 F1800
+G1 X62.000 Y60.350 E0.07755 F1800
+G1 X62.000 Y60.400 E0.07920 F1800
+G1 X62.000 Y60.450 E0.08085 F1800
+G1 X62.000 Y60.500 E0.08250 F1800
+G1 X62.000 Y60.550 E0.08415 F1800
+G1 X62.000 Y60.600 E0.08580 F1800
+G1 X62.000 Y60.650 E0.08745 F1800
+G1 X62.000 Y60.700 E0.08910 F1800
+G1 X62.000 Y60.750 E0.09075 F1800
+G1 X62.000 Y60.800 E0.09240 F1800
+G1 X62.000 Y60.850 E0.09405 F1800
+G1 X62.000 Y60.900 E0.09570 F1800
+G1 X62.000 Y60.950 E0.09735 F1800
+G1 X62.000 Y61.000 E0.09900 F1800
+G1 X62.000 Y61.050 E0.10065 F1800
+G1 X62.000 Y61.100 E0.10230 F1800
+G1 X62.000 Y61.150 E0.10395 F1800
+G1 X62.000 Y61.200 E0.10560 F1800
+G1 X62.000 Y61.250 E0.10725 F1800
+G1 X62.000 Y61.300 E0.10890 F1800
+G1 X62.000 Y61.350 E0.11055 F1800
+G1 X62.000 Y61.400 E0.11220 F1800
+G1 X62.000 Y61.450 E0.11385 F1800
+G1 X62.000 Y61.500 E0.11550 F1800
+G1 X62.000 Y61.550 E0.11715 F1800
+G1 X62.000 Y61.600 E0.11880 F1800
+G1 X62.000 Y61.650 E0.12045 F1800
+G1 X62.000 Y61.700 E0.12210 F1800
+G1 X62.000 Y61.750 E0.12375 F1800
+G1 X62.000 Y61.800 E0.12540 F1800
+G1 X62.000 Y61.850 E0.12705 F1800
+G1 X62.000 Y61.900 E0.12870 F1800
+G1 X62.000 Y61.950 E0.13035 F1800
+G1 X62.000 Y62.000 E0.13200 F1800
+G1 X61.950 Y62.000 E0.13365 F1800
+G1 X61.900 Y62.000 E0.13530 F1800
+G1 X61.850 Y62.000 E0.13695 F1800
+G1 X61.800 Y62.000 E0.13860 F1800
+G1 X61.750 Y62.000 E0.14025 F1800
+G1 X61.700 Y62.000 E0.14190 F1800
+G1 X61.650 Y62.000 E0.14355 F1800
+G1 X61.600 Y62.000 E0.14520 F1800
+G1 X61.550 Y62.000 E0.14685 F1800
+G1 X61.500 Y62.000 E0.14850 F1800
+G1 X61.450 Y62.000 E0.15015 F1800
+G1 X61.400 Y62.000 E0.15180 F1800
+G1 X61.350 Y62.000 E0.15345 F1800
+G1 X61.300 Y62.000 E0.15510 F1800
+G1 X61.250 Y62.000 E0.15675 F1800
+G1 X61.200 Y62.000 E0.15840 F1800
+G1 X61.150 Y62.000 E0.16005 F1800
+G1 X61.100 Y62.000 E0.16170 F1800
+G1 X61.050 Y62.000 E0.16335 F1800
+G1 X61.000 Y62.000 E0.16500 F1800
+G1 X60.950 Y62.000 E0.16665 F1800
+G1 X60.900 Y62.000 E0.16830 F1800
+G1 X60.850 Y62.000 E0.16995 F1800
+G1 X60.800 Y62.000 E0.17160 F1800
+G1 X60.750 Y62.000 E0.17325 F1800
+G1 X60.700 Y62.000 E0.17490 F1800
+G1 X60.650 Y62.000 E0.17655 F1800
+G1 X60.600 Y62.000 E0.17820 F1800
+G1 X60.550 Y62.000 E0.17985 F1800
+G1 X60.500 Y62.000 E0.18150 F1800
+G1 X60.450 Y62.000 E0.18315 F1800
+G1 X60.400 Y62.000 E0.18480 F1800
+G1 X60.350 Y62.000 E0.18645 F1800
+G1 X60.300 Y62.000 E0.18810 F1800
+G1 X60.250 Y62.000 E0.18975 F1800
+G1 X60.200 Y62.000 E0.19140 F1800
+G1 X60.150 Y62.000 E0.19305 F1800
+G1 X60.100 Y62.000 E0.19470 F1800
+G1 X60.050 Y62.000 E0.19635 F1800
+G1 X60.000 Y62.000 E0.19800 F1800
+G1 X60.000 Y61.950 E0.19965 F1800
+G1 X60.000 Y61.900 E0.20130 F1800
+G1 X60.000 Y61.850 E0.20295 F1800
+G1 X60.000 Y61.800 E0.20460 F1800
+G1 X60.000 Y61.750 E0.20625 F1800
+G1 X60.000 Y61.700 E0.20790 F1800
+G1 X60.000 Y61.650 E0.20955 F1800
+G1 X60.000 Y61.600 E0.21120 F1800
+G1 X60.000 Y61.550 E0.21285 F1800
+G1 X60.000 Y61.500 E0.21450 F1800
+G1 X60.000 Y61.450 E0.21615 F1800
+G1 X60.000 Y61.400 E0.21780 F1800
+G1 X60.000 Y61.350 E0.21945 F1800
+G1 X60.000 Y61.300 E0.22110 F1800
+G1 X60.000 Y61.250 E0.22275 F1800
+G1 X60.000 Y61.200 E0.22440 F1800
+G1 X60.000 Y61.150 E0.22605 F1800
+G1 X60.000 Y61.100 E0.22770 F1800
+G1 X60.000 Y61.050 E0.22935 F1800
+G1 X60.000 Y61.000 E0.23100 F1800
+G1 X60.000 Y60.950 E0.23265 F1800
+G1 X60.000 Y60.900 E0.23430 F1800
+G1 X60.000 Y60.850 E0.23595 F1800
+G1 X60.000 Y60.800 E0.23760 F1800
+G1 X60.000 Y60.750 E0.23925 F1800
+G1 X60.000 Y60.700 E0.24090 F1800
+G1 X60.000 Y60.650 E0.24255 F1800
+G1 X60.000 Y60.600 E0.24420 F1800
+G1 X60.000 Y60.550 E0.24585 F1800
+G1 X60.000 Y60.500 E0.24750 F1800
+G1 X60.000 Y60.450 E0.24915 F1800
+G1 X60.000 Y60.400 E0.25080 F1800
+G1 X60.000 Y60.350 E0.25245 F1800
+G1 X60.000 Y60.300 E0.25410 F1800
+G1 X60.000 Y60.250 E0.25575 F1800
+G1 X60.000 Y60.200 E0.25740 F1800
+G1 X60.000 Y60.150 E0.25905 F1800
+G1 X60.000 Y60.100 E0.26070 F1800
+G1 X60.000 Y60.050 E0.26235 F1800
+G1 X60.000 Y60.000 E0.26400 F1800
+G1 X60.060 Y60.000 E0.26598 F1800
+G1 X60.120 Y60.000 E0.26796 F1800
+G1 X60.180 Y60.000 E0.26994 F1800
+G1 X60.240 Y60.000 E0.27192 F1800
+G1 X60.300 Y60.000 E0.27390 F1800
+G1 X60.360 Y60.000 E0.27588 F1800
+G1 X60.420 Y60.000 E0.27786 F1800
+G1 X60.480 Y60.000 E0.27984 F1800
+G1 X60.540 Y60.000 E0.28182 F1800
+G1 X60.600 Y60.000 E0.28380 F1800
+G1 X60.660 Y60.000 E0.28578 F1800
+G1 X60.720 Y60.000 E0.28776 F1800
+G1 X60.780 Y60.000 E0.28974 F1800
+G1 X60.840 Y60.000 E0.29172 F1800
+G1 X60.900 Y60.000 E0.29370 F1800
+G1 X60.960 Y60.000 E0.29568 F1800
+G1 X61.020 Y60.000 E0.29766 F1800
+G1 X61.080 Y60.000 E0.29964 F1800
+G1 X61.140 Y60.000 E0.30162 F1800
+G1 X61.200 Y60.000 E0.30360 F1800
+G1 X61.260 Y60.000 E0.30558 F1800
+G1 X61.320 Y60.000 E0.30756 F1800
+G1 X61.380 Y60.000 E0.30954 F1800
+G1 X61.440 Y60.000 E0.31152 F1800
+G1 X61.500 Y60.000 E0.31350 F1800
+G1 X61.560 Y60.000 E0.31548 F1800
+G1 X61.620 Y60.000 E0.31746 F1800
+G1 X61.680 Y60.000 E0.31944 F1800
+G1 X61.740 Y60.000 E0.32142 F1800
+G1 X61.800 Y60.000 E0.32340 F1800
+G1 X61.860 Y60.000 E0.32538 F1800
+G1 X61.920 Y60.000 E0.32736 F1800
+G1 X61.980 Y60.000 E0.32934 F1800
+G1 X62.040 Y60.000 E0.33132 F1800
+G1 X62.100 Y60.000 E0.33330 F1800
+G1 X62.100 Y60.060 E0.33528 F1800
+G1 X62.100 Y60.120 E0.33726 F1800
+G1 X62.100 Y60.180 E0.33924 F1800
+G1 X62.100 Y60.240 E0.34122 F1800
+G1 X62.100 Y60.300 E0.34320 F1800
+G1 X62.100 Y60.360 E0.34518 F1800
+G1 X62.100 Y60.420 E0.34716 F1800
+G1 X62.100 Y60.480 E0.34914 F1800
+G1 X62.100 Y60.540 E0.35112 F1800
+G1 X62.100 Y60.600 E0.35310 F1800
+G1 X62.100 Y60.660 E0.35508 F1800
+G1 X62.100 Y60.720 E0.35706 F1800
+G1 X62.100 Y60.780 E0.35904 F1800
+G1 X62.100 Y60.840 E0.36102 F1800
+G1 X62.100 Y60.900 E0.36300 F1800
+G1 X62.100 Y60.960 E0.36498 F1800
+G1 X62.100 Y61.020 E0.36696 F1800
+G1 X62.100 Y61.080 E0.36894 F1800
+G1 X62.100 Y61.140 E0.37092 F1800
+G1 X62.100 Y61.200 E0.37290 F1800
+G1 X62.100 Y61.260 E0.37488 F1800
+G1 X62.100 Y61.320 E0.37686 F1800
+G1 X62.100 Y61.380 E0.37884 F1800
+G1 X62.100 Y61.440 E0.38082 F1800
+G1 X62.100 Y61.500 E0.38280 F1800
+G1 X62.100 Y61.560 E0.38478 F1800
+G1 X62.100 Y61.620 E0.38676 F1800
+G1 X62.100 Y61.680 E0.38874 F1800
+G1 X62.100 Y61.740 E0.39072 F1800
+G1 X62.100 Y61.800 E0.39270 F1800
+G1 X62.100 Y61.860 E0.39468 F1800
+G1 X62.100 Y61.920 E0.39666 F1800
+G1 X62.100 Y61.980 E0.39864 F1800
+G1 X62.100 Y62.040 E0.40062 F1800
+G1 X62.100 Y62.100 E0.40260 F1800
+G1 X62.040 Y62.100 E0.40458 F1800
+G1 X61.980 Y62.100 E0.40656 F1800
+G1 X61.920 Y62.100 E0.40854 F1800
+G1 X61.860 Y62.100 E0.41052 F1800
+G1 X61.800 Y62.100 E0.41250 F1800
+G1 X61.740 Y62.100 E0.41448 F1800
+G1 X61.680 Y62.100 E0.41646 F1800
+G1 X61.620 Y62.100 E0.41844 F1800
+G1 X61.560 Y62.100 E0.42042 F1800
+G1 X61.500 Y62.100 E0.42240 F1800
+G1 X61.440 Y62.100 E0.42438 F1800
+G1 X61.380 Y62.100 E0.42636 F1800
+G1 X61.320 Y62.100 E0.42834 F1800
+G1 X61.260 Y62.100 E0.43032 F1800
+G1 X61.200 Y62.100 E0.43230 F1800
+G1 X61.140 Y62.100 E0.43428 F1800
+G1 X61.080 Y62.100 E0.43626 F1800
+G1 X61.020 Y62.100 E0.43824 F1800
+G1 X60.960 Y62.100 E0.44022 F1800
+G1 X60.900 Y62.100 E0.44220 F1800
+G1 X60.840 Y62.100 E0.44418 F1800
+G1 X60.780 Y62.100 E0.44616 F1800
+G1 X60.720 Y62.100 E0.44814 F1800
+G1 X60.660 Y62.100 E0.45012 F1800
+G1 X60.600 Y62.100 E0.45210 F1800
+G1 X60.540 Y62.100 E0.45408 F1800
+G1 X60.480 Y62.100 E0.45606 F1800
+G1 X60.420 Y62.100 E0.45804 F1800
+G1 X60.360 Y62.100 E0.46002 F1800
+G1 X60.300 Y62.100 E0.46200 F1800
+G1 X60.240 Y62.100 E0.46398 F1800
+G1 X60.180 Y62.100 E0.46596 F1800
+G1 X60.120 Y62.100 E0.46794 F1800
+G1 X60.060 Y62.100 E0.46992 F1800
+G1 X60.000 Y62.100 E0.47190 F1800
+G1 X60.000 Y62.040 E0.47388 F1800
+G1 X60.000 Y61.980 E0.47586 F1800
+G1 X60.000 Y61.920 E0.47784 F1800
+G1 X60.000 Y61.860 E0.47982 F1800
+G1 X60.000 Y61.800 E0.48180 F1800
+G1 X60.000 Y61.740 E0.48378 F1800
+G1 X60.000 Y61.680 E0.48576 F1800
+G1 X60.000 Y61.620 E0.48774 F1800
+G1 X60.000 Y61.560 E0.48972 F1800
+G1 X60.000 Y61.500 E0.49170 F1800
+G1 X60.000 Y61.440 E0.49368 F1800
+G1 X60.000 Y61.380 E0.49566 F1800
+G1 X60.000 Y61.320 E0.49764 F1800
+G1 X60.000 Y61.260 E0.49962 F1800
+G1 X60.000 Y61.200 E0.50160 F1800
+G1 X60.000 Y61.140 E0.50358 F1800
+G1 X60.000 Y61.080 E0.50556 F1800
+G1 X60.000 Y61.020 E0.50754 F1800
+G1 X60.000 Y60.960 E0.50952 F1800
+G1 X60.000 Y60.900 E0.51150 F1800
+G1 X60.000 Y60.840 E0.51348 F1800
+G1 X60.000 Y60.780 E0.51546 F1800
+G1 X60.000 Y60.720 E0.51744 F1800
+G1 X60.000 Y60.660 E0.51942 F1800
+G1 X60.000 Y60.600 E0.52140 F1800
+G1 X60.000 Y60.540 E0.52338 F1800
+G1 X60.000 Y60.480 E0.52536 F1800
+G1 X60.000 Y60.420 E0.52734 F1800
+G1 X60.000 Y60.360 E0.52932 F1800
+G1 X60.000 Y60.300 E0.53130 F1800
+G1 X60.000 Y60.240 E0.53328 F1800
+G1 X60.000 Y60.180 E0.53526 F1800
+G1 X60.000 Y60.120 E0.53724 F1800
+G1 X60.000 Y60.060 E0.53922 F1800
+G1 X60.000 Y60.000 E0.54120 F1800
+G1 X60.070 Y60.000 E0.54351 F1800
+G1 X60.140 Y60.000 E0.54582 F1800
+G1 X60.210 Y60.000 E0.54813 F1800
+G1 X60.280 Y60.000 E0.55044 F1800
+G1 X60.350 Y60.000 E0.55275 F1800
+G1 X60.420 Y60.000 E0.55506 F1800
+G1 X60.490 Y60.000 E0.55737 F1800
+G1 X60.560 Y60.000 E0.55968 F1800
+G1 X60.630 Y60.000 E0.56199 F1800
+G1 X60.700 Y60.000 E0.56430 F1800
+G1 X60.770 Y60.000 E0.56661 F1800
+G1 X60.840 Y60.000 E0.56892 F1800
+G1 X60.910 Y60.000 E0.57123 F1800
+G1 X60.980 Y60.000 E0.57354 F1800
+G1 X61.050 Y60.000 E0.57585 F1800
+G1 X61.120 Y60.000 E0.57816 F1800
+G1 X61.190 Y60.000 E0.58047 F1800
+G1 X61.260 Y60.000 E0.58278 F1800
+G1 X61.330 Y60.000 E0.58509 F1800
+G1 X61.400 Y60.000 E0.58740 F1800
+G1 X61.470 Y60.000 E0.58971 F1800
+G1 X61.540 Y60.000 E0.59202 F1800
+G1 X61.610 Y60.000 E0.59433 F1800
+G1 X61.680 Y60.000 E0.59664 F1800
+G1 X61.750 Y60.000 E0.59895 F1800
+G1 X61.820 Y60.000 E0.60126 F1800
+G1 X61.890 Y60.000 E0.60357 F1800
+G1 X61.960 Y60.000 E0.60588 F1800
+G1 X62.030 Y60.000 E0.60819 F1800
+G1 X62.100 Y60.000 E0.61050 F1800
+G1 X62.170 Y60.000 E0.61281 F1800
+G1 X62.170 Y60.070 E0.61512 F1800
+G1 X62.170 Y60.140 E0.61743 F1800
+G1 X62.170 Y60.210 E0.61974 F1800
+G1 X62.170 Y60.280 E0.62205 F1800
+G1 X62.170 Y60.350 E0.62436 F1800
+G1 X62.170 Y60.420 E0.62667 F1800
+G1 X62.170 Y60.490 E0.62898 F1800
+G1 X62.170 Y60.560 E0.63129 F1800
+G1 X62.170 Y60.630 E0.63360 F1800
+G1 X62.170 Y60.700 E0.63591 F1800
+G1 X62.170 Y60.770 E0.63822 F1800
+G1 X62.170 Y60.840 E0.64053 F1800
+G1 X62.170 Y60.910 E0.64284 F1800
+G1 X62.170 Y60.980 E0.64515 F1800
+G1 X62.170 Y61.050 E0.64746 F1800
+G1 X62.170 Y61.120 E0.64977 F1800
+G1 X62.170 Y61.190 E0.65208 F1800
+G1 X62.170 Y61.260 E0.65439 F1800
+G1 X62.170 Y61.330 E0.65670 F1800
+G1 X62.170 Y61.400 E0.65901 F1800
+G1 X62.170 Y61.470 E0.66132 F1800
+G1 X62.170 Y61.540 E0.66363 F1800
+G1 X62.170 Y61.610 E0.66594 F1800
+G1 X62.170 Y61.680 E0.66825 F1800
+G1 X62.170 Y61.750 E0.67056 F1800
+G1 X62.170 Y61.820 E0.67287 F1800
+G1 X62.170 Y61.890 E0.67518 F1800
+G1 X62.170 Y61.960 E0.67749 F1800
+G1 X62.170 Y62.030 E0.67980 F1800
+G1 X62.170 Y62.100 E0.68211 F1800
+G1 X62.170 Y62.170 E0.68442 F1800
+G1 X62.100 Y62.170 E0.68673 F1800
+G1 X62.030 Y62.170 E0.68904 F1800
+G1 X61.960 Y62.170 E0.69135 F1800
+G1 X61.890 Y62.170 E0.69366 F1800
+G1 X61.820 Y62.170 E0.69597 F1800
+G1 X61.750 Y62.170 E0.69828 F1800
+G1 X61.680 Y62.170 E0.70059 F1800
+G1 X61.610 Y62.170 E0.70290 F1800
+G1 X61.540 Y62.170 E0.70521 F1800
+G1 X61.470 Y62.170 E0.70752 F1800
+G1 X61.400 Y62.170 E0.70983 F1800
+G1 X61.330 Y62.170 E0.71214 F1800
+G1 X61.260 Y62.170 E0.71445 F1800
+G1 X61.190 Y62.170 E0.71676 F1800
+G1 X61.120 Y62.170 E0.71907 F1800
+G1 X61.050 Y62.170 E0.72138 F1800
+G1 X60.980 Y62.170 E0.72369 F1800
+G1 X60.910 Y62.170 E0.72600 F1800
+G1 X60.840 Y62.170 E0.72831 F1800
+G1 X60.770 Y62.170 E0.73062 F1800
+G1 X60.700 Y62.170 E0.73293 F1800
+G1 X60.630 Y62.170 E0.73524 F1800
+G1 X60.560 Y62.170 E0.73755 F1800
+G1 X60.490 Y62.170 E0.73986 F1800
+G1 X60.420 Y62.170 E0.74217 F1800
+G1 X60.350 Y62.170 E0.74448 F1800
+G1 X60.280 Y62.170 E0.74679 F1800
+G1 X60.210 Y62.170 E0.74910 F1800
+G1 X60.140 Y62.170 E0.75141 F1800
+G1 X60.070 Y62.170 E0.75372 F1800
+G1 X60.000 Y62.170 E0.75603 F1800
+G1 X60.000 Y62.100 E0.75834 F1800
+G1 X60.000 Y62.030 E0.76065 F1800
+G1 X60.000 Y61.960 E0.76296 F1800
+G1 X60.000 Y61.890 E0.76527 F1800
+G1 X60.000 Y61.820 E0.76758 F1800
+G1 X60.000 Y61.750 E0.76989 F1800
+G1 X60.000 Y61.680 E0.77220 F1800
+G1 X60.000 Y61.610 E0.77451 F1800
+G1 X60.000 Y61.540 E0.77682 F1800
+G1 X60.000 Y61.470 E0.77913 F1800
+G1 X60.000 Y61.400 E0.78144 F1800
+G1 X60.000 Y61.330 E0.78375 F1800
+G1 X60.000 Y61.260 E0.78606 F1800
+G1 X60.000 Y61.190 E0.78837 F1800
+G1 X60.000 Y61.120 E0.79068 F1800
+G1 X60.000 Y61.050 E0.79299 F1800
+G1 X60.000 Y60.980 E0.79530 F1800
+G1 X60.000 Y60.910 E0.79761 F1800
+G1 X60.000 Y60.840 E0.79992 F1800
+G1 X60.000 Y60.770 E0.80223 F1800
+G1 X60.000 Y60.700 E0.80454 F1800
+G1 X60.000 Y60.630 E0.80685 F1800
+G1 X60.000 Y60.560 E0.80916 F1800
+G1 X60.000 Y60.490 E0.81147 F1800
+G1 X60.000 Y60.420 E0.81378 F1800
+G1 X60.000 Y60.350 E0.81609 F1800
+G1 X60.000 Y60.280 E0.81840 F1800
+G1 X60.000 Y60.210 E0.82071 F1800
+G1 X60.000 Y60.140 E0.82302 F1800
+G1 X60.000 Y60.070 E0.82533 F1800
+G1 X60.000 Y60.000 E0.82764 F1800
+G1 X60.080 Y60.000 E0.83028 F1800
+G1 X60.160 Y60.000 E0.83292 F1800
+G1 X60.240 Y60.000 E0.83556 F1800
+G1 X60.320 Y60.000 E0.83820 F1800
+G1 X60.400 Y60.000 E0.84084 F1800
+G1 X60.480 Y60.000 E0.84348 F1800
+G1 X60.560 Y60.000 E0.84612 F1800
+G1 X60.640 Y60.000 E0.84876 F1800
+G1 X60.720 Y60.000 E0.85140 F1800
+G1 X60.800 Y60.000 E0.85404 F1800
+G1 X60.880 Y60.000 E0.85668 F1800
+G1 X60.960 Y60.000 E0.85932 F1800
+G1 X61.040 Y60.000 E0.86196 F1800
+G1 X61.120 Y60.000 E0.86460 F1800
+G1 X61.200 Y60.000 E0.86724 F1800
+G1 X61.280 Y60.000 E0.86988 F1800
+G1 X61.360 Y60.000 E0.87252 F1800
+G1 X61.440 Y60.000 E0.87516 F1800
+G1 X61.520 Y60.000 E0.87780 F1800
+G1 X61.600 Y60.000 E0.88044 F1800
+G1 X61.680 Y60.000 E0.88308 F1800
+G1 X61.760 Y60.000 E0.88572 F1800
+G1 X61.840 Y60.000 E0.88836 F1800
+G1 X61.920 Y60.000 E0.89100 F1800
+G1 X62.000 Y60.000 E0.89364 F1800
+G1 X62.080 Y60.000 E0.89628 F1800
+G1 X62.160 Y60.000 E0.89892 F1800
+G1 X62.240 Y60.000 E0.90156 F1800
+G1 X62.320 Y60.000 E0.90420 F1800
+G1 X62.320 Y60.080 E0.90684 F1800
+G1 X62.320 Y60.160 E0.90948 F1800
+G1 X62.320 Y60.240 E0.91212 F1800
+G1 X62.320 Y60.320 E0.91476 F1800
+G1 X62.320 Y60.400 E0.91740 F1800
+G1 X62.320 Y60.480 E0.92004 F1800
+G1 X62.320 Y60.560 E0.92268 F1800
+G1 X62.320 Y60.640 E0.92532 F1800
+G1 X62.320 Y60.720 E0.92796 F1800
+G1 X62.320 Y60.800 E0.93060 F1800
+G1 X62.320 Y60.880 E0.93324 F1800
+G1 X62.320 Y60.960 E0.93588 F1800
+G1 X62.320 Y61.040 E0.93852 F1800
+G1 X62.320 Y61.120 E0.94116 F1800
+G1 X62.320 Y61.200 E0.94380 F1800
+G1 X62.320 Y61.280 E0.94644 F1800
+G1 X62.320 Y61.360 E0.94908 F1800
+G1 X62.320 Y61.440 E0.95172 F1800
+G1 X62.320 Y61.520 E0.95436 F1800
+G1 X62.320 Y61.600 E0.95700 F1800
+G1 X62.320 Y61.680 E0.95964 F1800
+G1 X62.320 Y61.760 E0.96228 F1800
+G1 X62.320 Y61.840 E0.96492 F1800
+G1 X62.320 Y61.920 E0.96756 F1800
+G1 X62.320 Y62.000 E0.97020 F1800
+G1 X62.320 Y62.080 E0.97284 F1800
+G1 X62.320 Y62.160 E0.97548 F1800
+G1 X62.320 Y62.240 E0.97812 F1800
+G1 X62.320 Y62.320 E0.98076 F1800
+G1 X62.240 Y62.320 E0.98340 F1800
+G1 X62.160 Y62.320 E0.98604 F1800
+G1 X62.080 Y62.320 E0.98868 F1800
+G1 X62.000 Y62.320 E0.99132 F1800
+G1 X61.920 Y62.320 E0.99396 F1800
+G1 X61.840 Y62.320 E0.99660 F1800
+G1 X61.760 Y62.320 E0.99924 F1800
+G1 X61.680 Y62.320 E1.00188 F1800
+G1 X61.600 Y62.320 E1.00452 F1800
+G1 X61.520 Y62.320 E1.00716 F1800
+G1 X61.440 Y62.320 E1.00980 F1800
+G1 X61.360 Y62.320 E1.01244 F1800
+G1 X61.280 Y62.320 E1.01508 F1800
+G1 X61.200 Y62.320 E1.01772 F1800
+G1 X61.120 Y62.320 E1.02036 F1800
+G1 X61.040 Y62.320 E1.02300 F1800
+G1 X60.960 Y62.320 E1.02564 F1800
+G1 X60.880 Y62.320 E1.02828 F1800
+G1 X60.800 Y62.320 E1.03092 F1800
+G1 X60.720 Y62.320 E1.03356 F1800
+G1 X60.640 Y62.320 E1.03620 F1800
+G1 X60.560 Y62.320 E1.03884 F1800
+G1 X60.480 Y62.320 E1.04148 F1800
+G1 X60.400 Y62.320 E1.04412 F1800
+G1 X60.320 Y62.320 E1.04676 F1800
+G1 X60.240 Y62.320 E1.04940 F1800
+G1 X60.160 Y62.320 E1.05204 F1800
+G1 X60.080 Y62.320 E1.05468 F1800
+G1 X60.000 Y62.320 E1.05732 F1800
+G1 X60.000 Y62.240 E1.05996 F1800
+G1 X60.000 Y62.160 E1.06260 F1800
+G1 X60.000 Y62.080 E1.06524 F1800
+G1 X60.000 Y62.000 E1.06788 F1800
+G1 X60.000 Y61.920 E1.07052 F1800
+G1 X60.000 Y61.840 E1.07316 F1800
+G1 X60.000 Y61.760 E1.07580 F1800
+G1 X60.000 Y61.680 E1.07844 F1800
+G1 X60.000 Y61.600 E1.08108 F1800
+G1 X60.000 Y61.520 E1.08372 F1800
+G1 X60.000 Y61.440 E1.08636 F1800
+G1 X60.000 Y61.360 E1.08900 F1800
+G1 X60.000 Y61.280 E1.09164 F1800
+G1 X60.000 Y61.200 E1.09428 F1800
+G1 X60.000 Y61.120 E1.09692 F1800
+G1 X60.000 Y61.040 E1.09956 F1800
+G1 X60.000 Y60.960 E1.10220 F1800
+G1 X60.000 Y60.880 E1.10484 F1800
+G1 X60.000 Y60.800 E1.10748 F1800
+G1 X60.000 Y60.720 E1.11012 F1800
+G1 X60.000 Y60.640 E1.11276 F1800
+G1 X60.000 Y60.560 E1.11540 F1800
+G1 X60.000 Y60.480 E1.11804 F1800
+G1 X60.000 Y60.400 E1.12068 F1800
+G1 X60.000 Y60.320 E1.12332 F1800
+G1 X60.000 Y60.240 E1.12596 F1800
+G1 X60.000 Y60.160 E1.12860 F1800
+G1 X60.000 Y60.080 E1.13124 F1800
+G1 X60.000 Y60.000 E1.13388 F1800
+G1 X60.090 Y60.000 E1.13685 F1800
+G1 X60.180 Y60.000 E1.13982 F1800
+G1 X60.270 Y60.000 E1.14279 F1800
+G1 X60.360 Y60.000 E1.14576 F1800
+G1 X60.450 Y60.000 E1.14873 F1800
+G1 X60.540 Y60.000 E1.15170 F1800
+G1 X60.630 Y60.000 E1.15467 F1800
+G1 X60.720 Y60.000 E1.15764 F1800
+G1 X60.810 Y60.000 E1.16061 F1800
+G1 X60.900 Y60.000 E1.16358 F1800
+G1 X60.990 Y60.000 E1.16655 F1800
+G1 X61.080 Y60.000 E1.16952 F1800
+G1 X61.170 Y60.000 E1.17249 F1800
+G1 X61.260 Y60.000 E1.17546 F1800
+G1 X61.350 Y60.000 E1.17843 F1800
+G1 X61.440 Y60.000 E1.18140 F1800
+G1 X61.530 Y60.000 E1.18437 F1800
+G1 X61.620 Y60.000 E1.18734 F1800
+G1 X61.710 Y60.000 E1.19031 F1800
+G1 X61.800 Y60.000 E1.19328 F1800
+G1 X61.890 Y60.000 E1.19625 F1800
+G1 X61.980 Y60.000 E1.19922 F1800
+G1 X62.070 Y60.000 E1.20219 F1800
+G1 X62.160 Y60.000 E1.20516 F1800
+G1 X62.250 Y60.000 E1.20813 F1800
+G1 X62.340 Y60.000 E1.21110 F1800
+G1 X62.430 Y60.000 E1.21407 F1800
+G1 X62.430 Y60.090 E1.21704 F1800
+G1 X62.430 Y60.180 E1.22001 F1800
+G1 X62.430 Y60.270 E1.22298 F1800
+G1 X62.430 Y60.360 E1.22595 F1800
+G1 X62.430 Y60.450 E1.22892 F1800
+G1 X62.430 Y60.540 E1.23189 F1800
+G1 X62.430 Y60.630 E1.23486 F1800
+G1 X62.430 Y60.720 E1.23783 F1800
+G1 X62.430 Y60.810 E1.24080 F1800
+G1 X62.430 Y60.900 E1.24377 F1800
+G1 X62.430 Y60.990 E1.24674 F1800
+G1 X62.430 Y61.080 E1.24971 F1800
+G1 X62.430 Y61.170 E1.25268 F1800
+G1 X62.430 Y61.260 E1.25565 F1800
+G1 X62.430 Y61.350 E1.25862 F1800
+G1 X62.430 Y61.440 E1.26159 F1800
+G1 X62.430 Y61.530 E1.26456 F1800
+G1 X62.430 Y61.620 E1.26753 F1800
+G1 X62.430 Y61.710 E1.27050 F1800
+G1 X62.430 Y61.800 E1.27347 F1800
+G1 X62.430 Y61.890 E1.27644 F1800
+G1 X62.430 Y61.980 E1.27941 F1800
+G1 X62.430 Y62.070 E1.28238 F1800
+G1 X62.430 Y62.160 E1.28535 F1800
+G1 X62.430 Y62.250 E1.28832 F1800
+G1 X62.430 Y62.340 E1.29129 F1800
+G1 X62.430 Y62.430 E1.29426 F1800
+G1 X62.340 Y62.430 E1.29723 F1800
+G1 X62.250 Y62.430 E1.30020 F1800
+G1 X62.160 Y62.430 E1.30317 F1800
+G1 X62.070 Y62.430 E1.30614 F1800
+G1 X61.980 Y62.430 E1.30911 F1800
+G1 X61.890 Y62.430 E1.31208 F1800
+G1 X61.800 Y62.430 E1.31505 F1800
+G1 X61.710 Y62.430 E1.31802 F1800
+G1 X61.620 Y62.430 E1.32099 F1800
+G1 X61.530 Y62.430 E1.32396 F1800
+G1 X61.440 Y62.430 E1.32693 F1800
+G1 X61.350 Y62.430 E1.32990 F1800
+G1 X61.260 Y62.430 E1.33287 F1800
+G1 X61.170 Y62.430 E1.33584 F1800
+G1 X61.080 Y62.430 E1.33881 F1800
+G1 X60.990 Y62.430 E1.34178 F1800
+G1 X60.900 Y62.430 E1.34475 F1800
+G1 X60.810 Y62.430 E1.34772 F1800
+G1 X60.720 Y62.430 E1.35069 F1800
+G1 X60.630 Y62.430 E1.35366 F1800
+G1 X60.540 Y62.430 E1.35663 F1800
+G1 X60.450 Y62.430 E1.35960 F1800
+G1 X60.360 Y62.430 E1.36257 F1800
+G1 X60.270 Y62.430 E1.36554 F1800
+G1 X60.180 Y62.430 E1.36851 F1800
+G1 X60.090 Y62.430 E1.37148 F1800
+G1 X60.000 Y62.430 E1.37445 F1800
+G1 X60.000 Y62.340 E1.37742 F1800
+G1 X60.000 Y62.250 E1.38039 F1800
+G1 X60.000 Y62.160 E1.38336 F1800
+G1 X60.000 Y62.070 E1.38633 F1800
+G1 X60.000 Y61.980 E1.38930 F1800
+G1 X60.000 Y61.890 E1.39227 F1800
+G1 X60.000 Y61.800 E1.39524 F1800
+G1 X60.000 Y61.710 E1.39821 F1800
+G1 X60.000 Y61.620 E1.40118 F1800
+G1 X60.000 Y61.530 E1.40415 F1800
+G1 X60.000 Y61.440 E1.40712 F1800
+G1 X60.000 Y61.350 E1.41009 F1800
+G1 X60.000 Y61.260 E1.41306 F1800
+G1 X60.000 Y61.170 E1.41603 F1800
+G1 X60.000 Y61.080 E1.41900 F1800
+G1 X60.000 Y60.990 E1.42197 F1800
+G1 X60.000 Y60.900 E1.42494 F1800
+G1 X60.000 Y60.810 E1.42791 F1800
+G1 X60.000 Y60.720 E1.43088 F1800
+G1 X60.000 Y60.630 E1.43385 F1800
+G1 X60.000 Y60.540 E1.43682 F1800
+G1 X60.000 Y60.450 E1.43979 F1800
+G1 X60.000 Y60.360 E1.44276 F1800
+G1 X60.000 Y60.270 E1.44573 F1800
+G1 X60.000 Y60.180 E1.44870 F1800
+G1 X60.000 Y60.090 E1.45167 F1800
+G1 X60.000 Y60.000 E1.45464 F1800
+G1 X60.100 Y60.000 E1.45794 F1800
+G1 X60.200 Y60.000 E1.46124 F1800
+G1 X60.300 Y60.000 E1.46454 F1800
+G1 X60.400 Y60.000 E1.46784 F1800
+G1 X60.500 Y60.000 E1.47114 F1800
+G1 X60.600 Y60.000 E1.47444 F1800
+G1 X60.700 Y60.000 E1.47774 F1800
+G1 X60.800 Y60.000 E1.48104 F1800
+G1 X60.900 Y60.000 E1.48434 F1800
+G1 X61.000 Y60.000 E1.48764 F1800
+G1 X61.100 Y60.000 E1.49094 F1800
+G1 X61.200 Y60.000 E1.49424 F1800
+G1 X61.300 Y60.000 E1.49754 F1800
+G1 X61.400 Y60.000 E1.50084 F1800
+G1 X61.500 Y60.000 E1.50414 F1800
+G1 X61.600 Y60.000 E1.50744 F1800
+G1 X61.700 Y60.000 E1.51074 F1800
+G1 X61.800 Y60.000 E1.51404 F1800
+G1 X61.900 Y60.000 E1.51734 F1800
+G1 X62.000 Y60.000 E1.52064 F1800
+G1 X62.100 Y60.000 E1.52394 F1800
+G1 X62.200 Y60.000 E1.52724 F1800
+G1 X62.300 Y60.000 E1.53054 F1800
+G1 X62.400 Y60.000 E1.53384 F1800
+G1 X62.500 Y60.000 E1.53714 F1800
+G1 X62.500 Y60.100 E1.54044 F1800
+G1 X62.500 Y60.200 E1.54374 F1800
+G1 X62.500 Y60.300 E1.54704 F1800
+G1 X62.500 Y60.400 E1.55034 F1800
+G1 X62.500 Y60.500 E1.55364 F1800
+G1 X62.500 Y60.600 E1.55694 F1800
+G1 X62.500 Y60.700 E1.56024 F1800
+G1 X62.500 Y60.800 E1.56354 F1800
+G1 X62.500 Y60.900 E1.56684 F1800
+G1 X62.500 Y61.000 E1.57014 F1800
+G1 X62.500 Y61.100 E1.57344 F1800
+G1 X62.500 Y61.200 E1.57674 F1800
+G1 X62.500 Y61.300 E1.58004 F1800
+G1 X62.500 Y61.400 E1.58334 F1800
+G1 X62.500 Y61.500 E1.58664 F1800
+G1 X62.500 Y61.600 E1.58994 F1800
+G1 X62.500 Y61.700 E1.59324 F1800
+G1 X62.500 Y61.800 E1.59654 F1800
+G1 X62.500 Y61.900 E1.59984 F1800
+G1 X62.500 Y62.000 E1.60314 F1800
+G1 X62.500 Y62.100 E1.60644 F1800
+G1 X62.500 Y62.200 E1.60974 F1800
+G1 X62.500 Y62.300 E1.61304 F1800
+G1 X62.500 Y62.400 E1.61634 F1800
+G1 X62.500 Y62.500 E1.61964 F1800
+G1 X62.400 Y62.500 E1.62294 F1800
+G1 X62.300 Y62.500 E1.62624 F1800
+G1 X62.200 Y62.500 E1.62954 F1800
+G1 X62.100 Y62.500 E1.63284 F1800
+G1 X62.000 Y62.500 E1.63614 F1800
+G1 X61.900 Y62.500 E1.63944 F1800
+G1 X61.800 Y62.500 E1.64274 F1800
+G1 X61.700 Y62.500 E1.64604 F1800
+G1 X61.600 Y62.500 E1.64934 F1800
+G1 X61.500 Y62.500 E1.65264 F1800
+G1 X61.400 Y62.500 E1.65594 F1800
+G1 X61.300 Y62.500 E1.65924 F1800
+G1 X61.200 Y62.500 E1.66254 F1800
+G1 X61.100 Y62.500 E1.66584 F1800
+G1 X61.000 Y62.500 E1.66914 F1800
+G1 X60.900 Y62.500 E1.67244 F1800
+G1 X60.800 Y62.500 E1.67574 F1800
+G1 X60.700 Y62.500 E1.67904 F1800
+G1 X60.600 Y62.500 E1.68234 F1800
+G1 X60.500 Y62.500 E1.68564 F1800
+G1 X60.400 Y62.500 E1.68894 F1800
+G1 X60.300 Y62.500 E1.69224 F1800
+G1 X60.200 Y62.500 E1.69554 F1800
+G1 X60.100 Y62.500 E1.69884 F1800
+G1 X60.000 Y62.500 E1.70214 F1800
+G1 X60.000 Y62.400 E1.70544 F1800
+G1 X60.000 Y62.300 E1.70874 F1800
+G1 X60.000 Y62.200 E1.71204 F1800
+G1 X60.000 Y62.100 E1.71534 F1800
+G1 X60.000 Y62.000 E1.71864 F1800
+G1 X60.000 Y61.900 E1.72194 F1800
+G1 X60.000 Y61.800 E1.72524 F1800
+G1 X60.000 Y61.700 E1.72854 F1800
+G1 X60.000 Y61.600 E1.73184 F1800
+G1 X60.000 Y61.500 E1.73514 F1800
+G1 X60.000 Y61.400 E1.73844 F1800
+G1 X60.000 Y61.300 E1.74174 F1800
+G1 X60.000 Y61.200 E1.74504 F1800
+G1 X60.000 Y61.100 E1.74834 F1800
+G1 X60.000 Y61.000 E1.75164 F1800
+G1 X60.000 Y60.900 E1.75494 F1800
+G1 X60.000 Y60.800 E1.75824 F1800
+G1 X60.000 Y60.700 E1.76154 F1800
+G1 X60.000 Y60.600 E1.76484 F1800
+G1 X60.000 Y60.500 E1.76814 F1800
+G1 X60.000 Y60.400 E1.77144 F1800
+G1 X60.000 Y60.300 E1.77474 F1800
+G1 X60.000 Y60.200 E1.77804 F1800
+G1 X60.000 Y60.100 E1.78134 F1800
+G1 X60.000 Y60.000 E1.78464 F1800
+G1 X60.050 Y60.000 E1.78629 F1800
+G1 X60.100 Y60.000 E1.78794 F1800
+G1 X60.150 Y60.000 E1.78959 F1800
+G1 X60.200 Y60.000 E1.79124 F1800
+G1 X60.250 Y60.000 E1.79289 F1800
+G1 X60.300 Y60.000 E1.79454 F1800
+G1 X60.350 Y60.000 E1.79619 F1800
+G1 X60.400 Y60.000 E1.79784 F1800
+G1 X60.450 Y60.000 E1.79949 F1800
+G1 X60.500 Y60.000 E1.80114 F1800
+G1 X60.550 Y60.000 E1.80279 F1800
+G1 X60.600 Y60.000 E1.80444 F1800
+G1 X60.650 Y60.000 E1.80609 F1800
+G1 X60.700 Y60.000 E1.80774 F1800
+G1 X60.750 Y60.000 E1.80939 F1800
+G1 X60.800 Y60.000 E1.81104 F1800
+G1 X60.850 Y60.000 E1.81269 F1800
+G1 X60.900 Y60.000 E1.81434 F1800
+G1 X60.950 Y60.000 E1.81599 F1800
+G1 X61.000 Y60.000 E1.81764 F1800
+G1 X61.050 Y60.000 E1.81929 F1800
+G1 X61.100 Y60.000 E1.82094 F1800
+G1 X61.150 Y60.000 E1.82259 F1800
+G1 X61.200 Y60.000 E1.82424 F1800
+G1 X61.250 Y60.000 E1.82589 F1800
+G1 X61.300 Y60.000 E1.82754 F1800
+G1 X61.350 Y60.000 E1.82919 F1800
+G1 X61.400 Y60.000 E1.83084 F1800
+G1 X61.450 Y60.000 E1.83249 F1800
+G1 X61.500 Y60.000 E1.83414 F1800
+G1 X61.550 Y60.000 E1.83579 F1800
+G1 X61.600 Y60.000 E1.83744 F1800
+G1 X61.650 Y60.000 E1.83909 F1800
+G1 X61.700 Y60.000 E1.84074 F1800
+G1 X61.750 Y60.000 E1.84239 F1800
+G1 X61.800 Y60.000 E1.84404 F1800
+G1 X61.850 Y60.000 E1.84569 F1800
+G1 X61.900 Y60.000 E1.84734 F1800
+G1 X61.950 Y60.000 E1.84899 F1800
+G1 X62.000 Y60.000 E1.85064 F1800
+G1 X62.050 Y60.000 E1.85229 F1800
+G1 X62.100 Y60.000 E1.85394 F1800
+G1 X62.150 Y60.000 E1.85559 F1800
+G1 X62.200 Y60.000 E1.85724 F1800
+G1 X62.250 Y60.000 E1.85889 F1800
+G1 X62.300 Y60.000 E1.86054 F1800
+G1 X62.350 Y60.000 E1.86219 F1800
+G1 X62.400 Y60.000 E1.86384 F1800
+G1 X62.450 Y60.000 E1.86549 F1800
+G1 X62.500 Y60.000 E1.86714 F1800
+G1 X62.550 Y60.000 E1.86879 F1800
+G1 X62.600 Y60.000 E1.87044 F1800
+G1 X62.600 Y60.050 E1.87209 F1800
+G1 X62.600 Y60.100 E1.87374 F1800
+G1 X62.600 Y60.150 E1.87539 F1800
+G1 X62.600 Y60.200 E1.87704 F1800
+G1 X62.600 Y60.250 E1.87869 F1800
+G1 X62.600 Y60.300 E1.88034 F1800
+G1 X62.600 Y60.350 E1.88199 F1800
+G1 X62.600 Y60.400 E1.88364 F1800
+G1 X62.600 Y60.450 E1.88529 F1800
+G1 X62.600 Y60.500 E1.88694 F1800
+G1 X62.600 Y60.550 E1.88859 F1800
+G1 X62.600 Y60.600 E1.89024 F1800
+G1 X62.600 Y60.650 E1.89189 F1800
+G1 X62.600 Y60.700 E1.89354 F1800
+G1 X62.600 Y60.750 E1.89519 F1800
+G1 X62.600 Y60.800 E1.89684 F1800
+G1 X62.600 Y60.850 E1.89849 F1800
+G1 X62.600 Y60.900 E1.90014 F1800
+G1 X62.600 Y60.950 E1.90179 F1800
+G1 X62.600 Y61.000 E1.90344 F1800
+G1 X62.600 Y61.050 E1.90509 F1800
+G1 X62.600 Y61.100 E1.90674 F1800
+G1 X62.600 Y61.150 E1.90839 F1800
+G1 X62.600 Y61.200 E1.91004 F1800
+G1 X62.600 Y61.250 E1.91169 F1800
+G1 X62.600 Y61.300 E1.91334 F1800
+G1 X62.600 Y61.350 E1.91499 F1800
+G1 X62.600 Y61.400 E1.91664 F1800
+G1 X62.600 Y61.450 E1.91829 F1800
+G1 X62.600 Y61.500 E1.91994 F1800
+G1 X62.600 Y61.550 E1.92159 F1800
+G1 X62.600 Y61.600 E1.92324 F1800
+G1 X62.600 Y61.650 E1.92489 F1800
+G1 X62.600 Y61.700 E1.92654 F1800
+G1 X62.600 Y61.750 E1.92819 F1800
+G1 X62.600 Y61.800 E1.92984 F1800
+G1 X62.600 Y61.850 E1.93149 F1800
+G1 X62.600 Y61.900 E1.93314 F1800
+G1 X62.600 Y61.950 E1.93479 F1800
+G1 X62.600 Y62.000 E1.93644 F1800
+G1 X62.600 Y62.050 E1.93809 F1800
+G1 X62.600 Y62.100 E1.93974 F1800
+G1 X62.600 Y62.150 E1.94139 F1800
+G1 X62.600 Y62.200 E1.94304 F1800
+G1 X62.600 Y62.250 E1.94469 F1800
+G1 X62.600 Y62.300 E1.94634 F1800
+G1 X62.600 Y62.350 E1.94799 F1800
+G1 X62.600 Y62.400 E1.94964 F1800
+G1 X62.600 Y62.450 E1.95129 F1800
+G1 X62.600 Y62.500 E1.95294 F1800
+G1 X62.600 Y62.550 E1.95459 F1800
+G1 X62.600 Y62.600 E1.95624 F1800
+G1 X62.550 Y62.600 E1.95789 F1800
+G1 X62.500 Y62.600 E1.95954 F1800
+G1 X62.450 Y62.600 E1.96119 F1800
+G1 X62.400 Y62.600 E1.96284 F1800
+G1 X62.350 Y62.600 E1.96449 F1800
+G1 X62.300 Y62.600 E1.96614 F1800
+G1 X62.250 Y62.600 E1.96779 F1800
+G1 X62.200 Y62.600 E1.96944 F1800
+G1 X62.150 Y62.600 E1.97109 F1800
+G1 X62.100 Y62.600 E1.97274 F1800
+G1 X62.050 Y62.600 E1.97439 F1800
+G1 X62.000 Y62.600 E1.97604 F1800
+G1 X61.950 Y62.600 E1.97769 F1800
+G1 X61.900 Y62.600 E1.97934 F1800
+G1 X61.850 Y62.600 E1.98099 F1800
+G1 X61.800 Y62.600 E1.98264 F1800
+G1 X61.750 Y62.600 E1.98429 F1800
+G1 X61.700 Y62.600 E1.98594 F1800
+G1 X61.650 Y62.600 E1.98759 F1800
+G1 X61.600 Y62.600 E1.98924 F1800
+G1 X61.550 Y62.600 E1.99089 F1800
+G1 X61.500 Y62.600 E1.99254 F1800
+G1 X61.450 Y62.600 E1.99419 F1800
+G1 X61.400 Y62.600 E1.99584 F1800
+G1 X61.350 Y62.600 E1.99749 F1800
+G1 X61.300 Y62.600 E1.99914 F1800
+G1 X61.250 Y62.600 E2.00079 F1800
+G1 X61.200 Y62.600 E2.00244 F1800
+G1 X61.150 Y62.600 E2.00409 F1800
+G1 X61.100 Y62.600 E2.00574 F1800
+G1 X61.050 Y62.600 E2.00739 F1800
+G1 X61.000 Y62.600 E2.00904 F1800
+G1 X60.950 Y62.600 E2.01069 F1800
+G1 X60.900 Y62.600 E2.01234 F1800
+G1 X60.850 Y62.600 E2.01399 F1800
+G1 X60.800 Y62.600 E2.01564 F1800
+G1 X60.750 Y62.600 E2.01729 F1800
+G1 X60.700 Y62.600 E2.01894 F1800
+G1 X60.650 Y62.600 E2.02059 F1800
+G1 X60.600 Y62.600 E2.02224 F1800
+G1 X60.550 Y62.600 E2.02389 F1800
+G1 X60.500 Y62.600 E2.02554 F1800
+G1 X60.450 Y62.600 E2.02719 F1800
+G1 X60.400 Y62.600 E2.02884 F1800
+G1 X60.350 Y62.600 E2.03049 F1800
+G1 X60.300 Y62.600 E2.03214 F1800
+G1 X60.250 Y62.600 E2.03379 F1800
+G1 X60.200 Y62.600 E2.03544 F1800
+G1 X60.150 Y62.600 E2.03709 F1800
+G1 X60.100 Y62.600 E2.03874 F1800
+G1 X60.050 Y62.600 E2.04039 F1800
+G1 X60.000 Y62.600 E2.04204 F1800
+G1 X60.000 Y62.550 E2.04369 F1800
+G1 X60.000 Y62.500 E2.04534 F1800
+G1 X60.000 Y62.450 E2.04699 F1800
+G1 X60.000 Y62.400 E2.04864 F1800
+G1 X60.000 Y62.350 E2.05029 F1800
+G1 X60.000 Y62.300 E2.05194 F1800
+G1 X60.000 Y62.250 E2.05359 F1800
+G1 X60.000 Y62.200 E2.05524 F1800
+G1 X60.000 Y62.150 E2.05689 F1800
+G1 X60.000 Y62.100 E2.05854 F1800
+G1 X60.000 Y62.050 E2.06019 F1800
+G1 X60.000 Y62.000 E2.06184 F1800
+G1 X60.000 Y61.950 E2.06349 F1800
+G1 X60.000 Y61.900 E2.06514 F1800
+G1 X60.000 Y61.850 E2.06679 F1800
+G1 X60.000 Y61.800 E2.06844 F1800
+G1 X60.000 Y61.750 E2.07009 F1800
+G1 X60.000 Y61.700 E2.07174 F1800
+G1 X60.000 Y61.650 E2.07339 F1800
+G1 X60.000 Y61.600 E2.07504 F1800
+G1 X60.000 Y61.550 E2.07669 F1800
+G1 X60.000 Y61.500 E2.07834 F1800
+G1 X60.000 Y61.450 E2.07999 F1800
+G1 X60.000 Y61.400 E2.08164 F1800
+G1 X60.000 Y61.350 E2.08329 F1800
+G1 X60.000 Y61.300 E2.08494 F1800
+G1 X60.000 Y61.250 E2.08659 F1800
+G1 X60.000 Y61.200 E2.08824 F1800
+G1 X60.000 Y61.150 E2.08989 F1800
+G1 X60.000 Y61.100 E2.09154 F1800
+G1 X60.000 Y61.050 E2.09319 F1800
+G1 X60.000 Y61.000 E2.09484 F1800
+G1 X60.000 Y60.950 E2.09649 F1800
+G1 X60.000 Y60.900 E2.09814 F1800
+G1 X60.000 Y60.850 E2.09979 F1800
+G1 X60.000 Y60.800 E2.10144 F1800
+G1 X60.000 Y60.750 E2.10309 F1800
+G1 X60.000 Y60.700 E2.10474 F1800
+G1 X60.000 Y60.650 E2.10639 F1800
+G1 X60.000 Y60.600 E2.10804 F1800
+G1 X60.000 Y60.550 E2.10969 F1800
+G1 X60.000 Y60.500 E2.11134 F1800
+G1 X60.000 Y60.450 E2.11299 F1800
+G1 X60.000 Y60.400 E2.11464 F1800
+G1 X60.000 Y60.350 E2.11629 F1800
+G1 X60.000 Y60.300 E2.11794 F1800
+G1 X60.000 Y60.250 E2.11959 F1800
+G1 X60.000 Y60.200 E2.12124 F1800
+G1 X60.000 Y60.150 E2.12289 F1800
+G1 X60.000 Y60.100 E2.12454 F1800
+G1 X60.000 Y60.050 E2.12619 F1800
+G1 X60.000 Y60.000 E2.12784 F1800
+G1 X60.060 Y60.000 E2.12982 F1800
+G1 X60.120 Y60.000 E2.13180 F1800
+G1 X60.180 Y60.000 E2.13378 F1800
+G1 X60.240 Y60.000 E2.13576 F1800
+G1 X60.300 Y60.000 E2.13774 F1800
+G1 X60.360 Y60.000 E2.13972 F1800
+G1 X60.420 Y60.000 E2.14170 F1800
+G1 X60.480 Y60.000 E2.14368 F1800
+G1 X60.540 Y60.000 E2.14566 F1800
+G1 X60.600 Y60.000 E2.14764 F1800
+G1 X60.660 Y60.000 E2.14962 F1800
+G1 X60.720 Y60.000 E2.15160 F1800
+G1 X60.780 Y60.000 E2.15358 F1800
+G1 X60.840 Y60.000 E2.15556 F1800
+G1 X60.900 Y60.000 E2.15754 F1800
+G1 X60.960 Y60.000 E2.15952 F1800
+G1 X61.020 Y60.000 E2.16150 F1800
+G1 X61.080 Y60.000 E2.16348 F1800
+G1 X61.140 Y60.000 E2.16546 F1800
+G1 X61.200 Y60.000 E2.16744 F1800
+G1 X61.260 Y60.000 E2.16942 F1800
+G1 X61.320 Y60.000 E2.17140 F1800
+G1 X61.380 Y60.000 E2.17338 F1800
+G1 X61.440 Y60.000 E2.17536 F1800
+G1 X61.500 Y60.000 E2.17734 F1800
+G1 X61.560 Y60.000 E2.17932 F1800
+G1 X61.620 Y60.000 E2.18130 F1800
+G1 X61.680 Y60.000 E2.18328 F1800
+G1 X61.740 Y60.000 E2.18526 F1800
+G1 X61.800 Y60.000 E2.18724 F1800
+G1 X61.860 Y60.000 E2.18922 F1800
+G1 X61.920 Y60.000 E2.19120 F1800
+G1 X61.980 Y60.000 E2.19318 F1800
+G1 X62.040 Y60.000 E2.19516 F1800
+G1 X62.100 Y60.000 E2.19714 F1800
+G1 X62.160 Y60.000 E2.19912 F1800
+G1 X62.220 Y60.000 E2.20110 F1800
+G1 X62.280 Y60.000 E2.20308 F1800
+G1 X62.340 Y60.000 E2.20506 F1800
+G1 X62.400 Y60.000 E2.20704 F1800
+G1 X62.460 Y60.000 E2.20902 F1800
+G1 X62.520 Y60.000 E2.21100 F1800
+G1 X62.580 Y60.000 E2.21298 F1800
+G1 X62.640 Y60.000 E2.21496 F1800
+G1 X62.700 Y60.000 E2.21694 F1800
+G1 X62.700 Y60.060 E2.21892 F1800
+G1 X62.700 Y60.120 E2.22090 F1800
+G1 X62.700 Y60.180 E2.22288 F1800
+G1 X62.700 Y60.240 E2.22486 F1800
+G1 X62.700 Y60.300 E2.22684 F1800
+G1 X62.700 Y60.360 E2.22882 F1800
+G1 X62.700 Y60.420 E2.23080 F1800
+G1 X62.700 Y60.480 E2.23278 F1800
+G1 X62.700 Y60.540 E2.23476 F1800
+G1 X62.700 Y60.600 E2.23674 F1800
+G1 X62.700 Y60.660 E2.23872 F1800
+G1 X62.700 Y60.720 E2.24070 F1800
+G1 X62.700 Y60.780 E2.24268 F1800
+G1 X62.700 Y60.840 E2.24466 F1800
+G1 X62.700 Y60.900 E2.24664 F1800
+G1 X62.700 Y60.960 E2.24862 F1800
+G1 X62.700 Y61.020 E2.25060 F1800
+G1 X62.700 Y61.080 E2.25258 F1800
+G1 X62.700 Y61.140 E2.25456 F1800
+G1 X62.700 Y61.200 E2.25654 F1800
+G1 X62.700 Y61.260 E2.25852 F1800
+G1 X62.700 Y61.320 E2.26050 F1800
+G1 X62.700 Y61.380 E2.26248 F1800
+G1 X62.700 Y61.440 E2.26446 F1800
+G1 X62.700 Y61.500 E2.26644 F1800
+G1 X62.700 Y61.560 E2.26842 F1800
+G1 X62.700 Y61.620 E2.27040 F1800
+G1 X62.700 Y61.680 E2.27238 F1800
+G1 X62.700 Y61.740 E2.27436 F1800
+G1 X62.700 Y61.800 E2.27634 F1800
+G1 X62.700 Y61.860 E2.27832 F1800
+G1 X62.700 Y61.920 E2.28030 F1800
+G1 X62.700 Y61.980 E2.28228 F1800
+G1 X62.700 Y62.040 E2.28426 F1800
+G1 X62.700 Y62.100 E2.28624 F1800
+G1 X62.700 Y62.160 E2.28822 F1800
+G1 X62.700 Y62.220 E2.29020 F1800
+G1 X62.700 Y62.280 E2.29218 F1800
+G1 X62.700 Y62.340 E2.29416 F1800
+G1 X62.700 Y62.400 E2.29614 F1800
+G1 X62.700 Y62.460 E2.29812 F1800
+G1 X62.700 Y62.520 E2.30010 F1800
+G1 X62.700 Y62.580 E2.30208 F1800
+G1 X62.700 Y62.640 E2.30406 F1800
+G1 X62.700 Y62.700 E2.30604 F1800
+G1 X62.640 Y62.700 E2.30802 F1800
+G1 X62.580 Y62.700 E2.31000 F1800
+G1 X62.520 Y62.700 E2.31198 F1800
+G1 X62.460 Y62.700 E2.31396 F1800
+G1 X62.400 Y62.700 E2.31594 F1800
+G1 X62.340 Y62.700 E2.31792 F1800
+G1 X62.280 Y62.700 E2.31990 F1800
+G1 X62.220 Y62.700 E2.32188 F1800
+G1 X62.160 Y62.700 E2.32386 F1800
+G1 X62.100 Y62.700 E2.32584 F1800
+G1 X62.040 Y62.700 E2.32782 F1800
+G1 X61.980 Y62.700 E2.32980 F1800
+G1 X61.920 Y62.700 E2.33178 F1800
+G1 X61.860 Y62.700 E2.33376 F1800
+G1 X61.800 Y62.700 E2.33574 F1800
+G1 X61.740 Y62.700 E2.33772 F1800
+G1 X61.680 Y62.700 E2.33970 F1800
+G1 X61.620 Y62.700 E2.34168 F1800
+G1 X61.560 Y62.700 E2.34366 F1800
+G1 X61.500 Y62.700 E2.34564 F1800
+G1 X61.440 Y62.700 E2.34762 F1800
+G1 X61.380 Y62.700 E2.34960 F1800
+G1 X61.320 Y62.700 E2.35158 F1800
+G1 X61.260 Y62.700 E2.35356 F1800
+G1 X61.200 Y62.700 E2.35554 F1800
+G1 X61.140 Y62.700 E2.35752 F1800
+G1 X61.080 Y62.700 E2.35950 F1800
+G1 X61.020 Y62.700 E2.36148 F1800
+G1 X60.960 Y62.700 E2.36346 F1800
+G1 X60.900 Y62.700 E2.36544 F1800
+G1 X60.840 Y62.700 E2.36742 F1800
+G1 X60.780 Y62.700 E2.36940 F1800
+G1 X60.720 Y62.700 E2.37138 F1800
+G1 X60.660 Y62.700 E2.37336 F1800
+G1 X60.600 Y62.700 E2.37534 F1800
+G1 X60.540 Y62.700 E2.37732 F1800
+G1 X60.480 Y62.700 E2.37930 F1800
+G1 X60.420 Y62.700 E2.38128 F1800
+G1 X60.360 Y62.700 E2.38326 F1800
+G1 X60.300 Y62.700 E2.38524 F1800
+G1 X60.240 Y62.700 E2.38722 F1800
+G1 X60.180 Y62.700 E2.38920 F1800
+G1 X60.120 Y62.700 E2.39118 F1800
+G1 X60.060 Y62.700 E2.39316 F1800
+G1 X60.000 Y62.700 E2.39514 F1800
+G1 X60.000 Y62.640 E2.39712 F1800
+G1 X60.000 Y62.580 E2.39910 F1800
+G1 X60.000 Y62.520 E2.40108 F1800
+G1 X60.000 Y62.460 E2.40306 F1800
+G1 X60.000 Y62.400 E2.40504 F1800
+G1 X60.000 Y62.340 E2.40702 F1800
+G1 X60.000 Y62.280 E2.40900 F1800
+G1 X60.000 Y62.220 E2.41098 F1800
+G1 X60.000 Y62.160 E2.41296 F1800
+G1 X60.000 Y62.100 E2.41494 F1800
+G1 X60.000 Y62.040 E2.41692 F1800
+G1 X60.000 Y61.980 E2.41890 F1800
+G1 X60.000 Y61.920 E2.42088 F1800
+G1 X60.000 Y61.860 E2.42286 F1800
+G1 X60.000 Y61.800 E2.42484 F1800
+G1 X60.000 Y61.740 E2.42682 F1800
+G1 X60.000 Y61.680 E2.42880 F1800
+G1 X60.000 Y61.620 E2.43078 F1800
+G1 X60.000 Y61.560 E2.43276 F1800
+G1 X60.000 Y61.500 E2.43474 F1800
+G1 X60.000 Y61.440 E2.43672 F1800
+G1 X60.000 Y61.380 E2.43870 F1800
+G1 X60.000 Y61.320 E2.44068 F1800
+G1 X60.000 Y61.260 E2.44266 F1800
+G1 X60.000 Y61.200 E2.44464 F1800
+G1 X60.000 Y61.140 E2.44662 F1800
+G1 X60.000 Y61.080 E2.44860 F1800
+G1 X60.000 Y61.020 E2.45058 F1800
+G1 X60.000 Y60.960 E2.45256 F1800
+G1 X60.000 Y60.900 E2.45454 F1800
+G1 X60.000 Y60.840 E2.45652 F1800
+G1 X60.000 Y60.780 E2.45850 F1800
+G1 X60.000 Y60.720 E2.46048 F1800
+G1 X60.000 Y60.660 E2.46246 F1800
+G1 X60.000 Y60.600 E2.46444 F1800
+G1 X60.000 Y60.540 E2.46642 F1800
+G1 X60.000 Y60.480 E2.46840 F1800
+G1 X60.000 Y60.420 E2.47038 F1800
+G1 X60.000 Y60.360 E2.47236 F1800
+G1 X60.000 Y60.300 E2.47434 F1800
+G1 X60.000 Y60.240 E2.47632 F1800
+G1 X60.000 Y60.180 E2.47830 F1800
+G1 X60.000 Y60.120 E2.48028 F1800
+G1 X60.000 Y60.060 E2.48226 F1800
+G1 X60.000 Y60.000 E2.48424 F1800
+G1 X60.070 Y60.000 E2.48655 F1800
+G1 X60.140 Y60.000 E2.48886 F1800
+G1 X60.210 Y60.000 E2.49117 F1800
+G1 X60.280 Y60.000 E2.49348 F1800
+G1 X60.350 Y60.000 E2.49579 F1800
+G1 X60.420 Y60.000 E2.49810 F1800
+G1 X60.490 Y60.000 E2.50041 F1800
+G1 X60.560 Y60.000 E2.50272 F1800
+G1 X60.630 Y60.000 E2.50503 F1800
+G1 X60.700 Y60.000 E2.50734 F1800
+G1 X60.770 Y60.000 E2.50965 F1800
+G1 X60.840 Y60.000 E2.51196 F1800
+G1 X60.910 Y60.000 E2.51427 F1800
+G1 X60.980 Y60.000 E2.51658 F1800
+G1 X61.050 Y60.000 E2.51889 F1800
+G1 X61.120 Y60.000 E2.52120 F1800
+G1 X61.190 Y60.000 E2.52351 F1800
+G1 X61.260 Y60.000 E2.52582 F1800
+G1 X61.330 Y60.000 E2.52813 F1800
+G1 X61.400 Y60.000 E2.53044 F1800
+G1 X61.470 Y60.000 E2.53275 F1800
+G1 X61.540 Y60.000 E2.53506 F1800
+G1 X61.610 Y60.000 E2.53737 F1800
+G1 X61.680 Y60.000 E2.53968 F1800
+G1 X61.750 Y60.000 E2.54199 F1800
+G1 X61.820 Y60.000 E2.54430 F1800
+G1 X61.890 Y60.000 E2.54661 F1800
+G1 X61.960 Y60.000 E2.54892 F1800
+G1 X62.030 Y60.000 E2.55123 F1800
+G1 X62.100 Y60.000 E2.55354 F1800
+G1 X62.170 Y60.000 E2.55585 F1800
+G1 X62.240 Y60.000 E2.55816 F1800
+G1 X62.310 Y60.000 E2.56047 F1800
+G1 X62.380 Y60.000 E2.56278 F1800
+G1 X62.450 Y60.000 E2.56509 F1800
+G1 X62.520 Y60.000 E2.56740 F1800
+G1 X62.590 Y60.000 E2.56971 F1800
+G1 X62.660 Y60.000 E2.57202 F1800
+G1 X62.730 Y60.000 E2.57433 F1800
+G1 X62.800 Y60.000 E2.57664 F1800
+G1 X62.800 Y60.070 E2.57895 F1800
+G1 X62.800 Y60.140 E2.58126 F1800
+G1 X62.800 Y60.210 E2.58357 F1800
+G1 X62.800 Y60.280 E2.58588 F1800
+G1 X62.800 Y60.350 E2.58819 F1800
+G1 X62.800 Y60.420 E2.59050 F1800
+G1 X62.800 Y60.490 E2.59281 F1800
+G1 X62.800 Y60.560 E2.59512 F1800
+G1 X62.800 Y60.630 E2.59743 F1800
+G1 X62.800 Y60.700 E2.59974 F1800
+G1 X62.800 Y60.770 E2.60205 F1800
+G1 X62.800 Y60.840 E2.60436 F1800
+G1 X62.800 Y60.910 E2.60667 F1800
+G1 X62.800 Y60.980 E2.60898 F1800
+G1 X62.800 Y61.050 E2.61129 F1800
+G1 X62.800 Y61.120 E2.61360 F1800
+G1 X62.800 Y61.190 E2.61591 F1800
+G1 X62.800 Y61.260 E2.61822 F1800
+G1 X62.800 Y61.330 E2.62053 F1800
+G1 X62.800 Y61.400 E2.62284 F1800
+G1 X62.800 Y61.470 E2.62515 F1800
+G1 X62.800 Y61.540 E2.62746 F1800
+G1 X62.800 Y61.610 E2.62977 F1800
+G1 X62.800 Y61.680 E2.63208 F1800
+G1 X62.800 Y61.750 E2.63439 F1800
+G1 X62.800 Y61.820 E2.63670 F1800
+G1 X62.800 Y61.890 E2.63901 F1800
+G1 X62.800 Y61.960 E2.64132 F1800
+G1 X62.800 Y62.030 E2.64363 F1800
+G1 X62.800 Y62.100 E2.64594 F1800
+G1 X62.800 Y62.170 E2.64825 F1800
+G1 X62.800 Y62.240 E2.65056 F1800
+G1 X62.800 Y62.310 E2.65287 F1800
+G1 X62.800 Y62.380 E2.65518 F1800
+G1 X62.800 Y62.450 E2.65749 F1800
+G1 X62.800 Y62.520 E2.65980 F1800
+G1 X62.800 Y62.590 E2.66211 F1800
+G1 X62.800 Y62.660 E2.66442 F1800
+G1 X62.800 Y62.730 E2.66673 F1800
+G1 X62.800 Y62.800 E2.66904 F1800
+G1 X62.730 Y62.800 E2.67135 F1800
+G1 X62.660 Y62.800 E2.67366 F1800
+G1 X62.590 Y62.800 E2.67597 F1800
+G1 X62.520 Y62.800 E2.67828 F1800
+G1 X62.450 Y62.800 E2.68059 F1800
+G1 X62.380 Y62.800 E2.68290 F1800
+G1 X62.310 Y62.800 E2.68521 F1800
+G1 X62.240 Y62.800 E2.68752 F1800
+G1 X62.170 Y62.800 E2.68983 F1800
+G1 X62.100 Y62.800 E2.69214 F1800
+G1 X62.030 Y62.800 E2.69445 F1800
+G1 X61.960 Y62.800 E2.69676 F1800
+G1 X61.890 Y62.800 E2.69907 F1800
+G1 X61.820 Y62.800 E2.70138 F1800
+G1 X61.750 Y62.800 E2.70369 F1800
+G1 X61.680 Y62.800 E2.70600 F1800
+G1 X61.610 Y62.800 E2.70831 F1800
+G1 X61.540 Y62.800 E2.71062 F1800
+G1 X61.470 Y62.800 E2.71293 F1800
+G1 X61.400 Y62.800 E2.71524 F1800
+G1 X61.330 Y62.800 E2.71755 F1800
+G1 X61.260 Y62.800 E2.71986 F1800
+G1 X61.190 Y62.800 E2.72217 F1800
+G1 X61.120 Y62.800 E2.72448 F1800
+G1 X61.050 Y62.800 E2.72679 F1800
+G1 X60.980 Y62.800 E2.72910 F1800
+G1 X60.910 Y62.800 E2.73141 F1800
+G1 X60.840 Y62.800 E2.73372 F1800
+G1 X60.770 Y62.800 E2.73603 F1800
+G1 X60.700 Y62.800 E2.73834 F1800
+G1 X60.630 Y62.800 E2.74065 F1800
+G1 X60.560 Y62.800 E2.74296 F1800
+G1 X60.490 Y62.800 E2.74527 F1800
+G1 X60.420 Y62.800 E2.74758 F1800
+G1 X60.350 Y62.800 E2.74989 F1800
+G1 X60.280 Y62.800 E2.75220 F1800
+G1 X60.210 Y62.800 E2.75451 F1800
+G1 X60.140 Y62.800 E2.75682 F1800
+G1 X60.070 Y62.800 E2.75913 F1800
+G1 X60.000 Y62.800 E2.76144 F1800
+G1 X60.000 Y62.730 E2.76375 F1800
+G1 X60.000 Y62.660 E2.76606 F1800
+G1 X60.000 Y62.590 E2.76837 F1800
+G1 X60.000 Y62.520 E2.77068 F1800
+G1 X60.000 Y62.450 E2.77299 F1800
+G1 X60.000 Y62.380 E2.77530 F1800
+G1 X60.000 Y62.310 E2.77761 F1800
+G1 X60.000 Y62.240 E2.77992 F1800
+G1 X60.000 Y62.170 E2.78223 F1800
+G1 X60.000 Y62.100 E2.78454 F1800
+G1 X60.000 Y62.030 E2.78685 F1800
+G1 X60.000 Y61.960 E2.78916 F1800
+G1 X60.000 Y61.890 E2.79147 F1800
+G1 X60.000 Y61.820 E2.79378 F1800
+G1 X60.000 Y61.750 E2.79609 F1800
+G1 X60.000 Y61.680 E2.79840 F1800
+G1 X60.000 Y61.610 E2.80071 F1800
+G1 X60.000 Y61.540 E2.80302 F1800
+G1 X60.000 Y61.470 E2.80533 F1800
+G1 X60.000 Y61.400 E2.80764 F1800
+G1 X60.000 Y61.330 E2.80995 F1800
+G1 X60.000 Y61.260 E2.81226 F1800
+G1 X60.000 Y61.190 E2.81457 F1800
+G1 X60.000 Y61.120 E2.81688 F1800
+G1 X60.000 Y61.050 E2.81919 F1800
+G1 X60.000 Y60.980 E2.82150 F1800
+G1 X60.000 Y60.910 E2.82381 F1800
+G1 X60.000 Y60.840 E2.82612 F1800
+G1 X60.000 Y60.770 E2.82843 F1800
+G1 X60.000 Y60.700 E2.83074 F1800
+G1 X60.000 Y60.630 E2.83305 F1800
+G1 X60.000 Y60.560 E2.83536 F1800
+G1 X60.000 Y60.490 E2.83767 F1800
+G1 X60.000 Y60.420 E2.83998 F1800
+G1 X60.000 Y60.350 E2.84229 F1800
+G1 X60.000 Y60.280 E2.84460 F1800
+G1 X60.000 Y60.210 E2.84691 F1800
+G1 X60.000 Y60.140 E2.84922 F1800
+G1 X60.000 Y60.070 E2.85153 F1800
+G1 X60.000 Y60.000 E2.85384 F1800
+G1 X60.080 Y60.000 E2.85648 F1800
+G1 X60.160 Y60.000 E2.85912 F1800
+G1 X60.240 Y60.000 E2.86176 F1800
+G1 X60.320 Y60.000 E2.86440 F1800
+G1 X60.400 Y60.000 E2.86704 F1800
+G1 X60.480 Y60.000 E2.86968 F1800
+G1 X60.560 Y60.000 E2.87232 F1800
+G1 X60.640 Y60.000 E2.87496 F1800
+G1 X60.720 Y60.000 E2.87760 F1800
+G1 X60.800 Y60.000 E2.88024 F1800
+G1 X60.880 Y60.000 E2.88288 F1800
+G1 X60.960 Y60.000 E2.88552 F1800
+G1 X61.040 Y60.000 E2.88816 F1800
+G1 X61.120 Y60.000 E2.89080 F1800
+G1 X61.200 Y60.000 E2.89344 F1800
+G1 X61.280 Y60.000 E2.89608 F1800
+G1 X61.360 Y60.000 E2.89872 F1800
+G1 X61.440 Y60.000 E2.90136 F1800
+G1 X61.520 Y60.000 E2.90400 F1800
+G1 X61.600 Y60.000 E2.90664 F1800
+G1 X61.680 Y60.000 E2.90928 F1800
+G1 X61.760 Y60.000 E2.91192 F1800
+G1 X61.840 Y60.000 E2.91456 F1800
+G1 X61.920 Y60.000 E2.91720 F1800
+G1 X62.000 Y60.000 E2.91984 F1800
+G1 X62.080 Y60.000 E2.92248 F1800
+G1 X62.160 Y60.000 E2.92512 F1800
+G1 X62.240 Y60.000 E2.92776 F1800
+G1 X62.320 Y60.000 E2.93040 F1800
+G1 X62.400 Y60.000 E2.93304 F1800
+G1 X62.480 Y60.000 E2.93568 F1800
+G1 X62.560 Y60.000 E2.93832 F1800
+G1 X62.640 Y60.000 E2.94096 F1800
+G1 X62.720 Y60.000 E2.94360 F1800
+G1 X62.800 Y60.000 E2.94624 F1800
+G1 X62.880 Y60.000 E2.94888 F1800
+G1 X62.880 Y60.080 E2.95152 F1800
+G1 X62.880 Y60.160 E2.95416 F1800
+G1 X62.880 Y60.240 E2.95680 F1800
+G1 X62.880 Y60.320 E2.95944 F1800
+G1 X62.880 Y60.400 E2.96208 F1800
+G1 X62.880 Y60.480 E2.96472 F1800
+G1 X62.880 Y60.560 E2.96736 F1800
+G1 X62.880 Y60.640 E2.97000 F1800
+G1 X62.880 Y60.720 E2.97264 F1800
+G1 X62.880 Y60.800 E2.97528 F1800
+G1 X62.880 Y60.880 E2.97792 F1800
+G1 X62.880 Y60.960 E2.98056 F1800
+G1 X62.880 Y61.040 E2.98320 F1800
+G1 X62.880 Y61.120 E2.98584 F1800
+G1 X62.880 Y61.200 E2.98848 F1800
+G1 X62.880 Y61.280 E2.99112 F1800
+G1 X62.880 Y61.360 E2.99376 F1800
+G1 X62.880 Y61.440 E2.99640 F1800
+G1 X62.880 Y61.520 E2.99904 F1800
+G1 X62.880 Y61.600 E3.00168 F1800
+G1 X62.880 Y61.680 E3.00432 F1800
+G1 X62.880 Y61.760 E3.00696 F1800
+G1 X62.880 Y61.840 E3.00960 F1800
+G1 X62.880 Y61.920 E3.01224 F1800
+G1 X62.880 Y62.000 E3.01488 F1800
+G1 X62.880 Y62.080 E3.01752 F1800
+G1 X62.880 Y62.160 E3.02016 F1800
+G1 X62.880 Y62.240 E3.02280 F1800
+G1 X62.880 Y62.320 E3.02544 F1800
+G1 X62.880 Y62.400 E3.02808 F1800
+G1 X62.880 Y62.480 E3.03072 F1800
+G1 X62.880 Y62.560 E3.03336 F1800
+G1 X62.880 Y62.640 E3.03600 F1800
+G1 X62.880 Y62.720 E3.03864 F1800
+G1 X62.880 Y62.800 E3.04128 F1800
+G1 X62.880 Y62.880 E3.04392 F1800
+G1 X62.800 Y62.880 E3.04656 F1800
+G1 X62.720 Y62.880 E3.04920 F1800
+G1 X62.640 Y62.880 E3.05184 F1800
+G1 X62.560 Y62.880 E3.05448 F1800
+G1 X62.480 Y62.880 E3.05712 F1800
+G1 X62.400 Y62.880 E3.05976 F1800
+G1 X62.320 Y62.880 E3.06240 F1800
+G1 X62.240 Y62.880 E3.06504 F1800
+G1 X62.160 Y62.880 E3.06768 F1800
+G1 X62.080 Y62.880 E3.07032 F1800
+G1 X62.000 Y62.880 E3.07296 F1800
+G1 X61.920 Y62.880 E3.07560 F1800
+G1 X61.840 Y62.880 E3.07824 F1800
+G1 X61.760 Y62.880 E3.08088 F1800
+G1 X61.680 Y62.880 E3.08352 F1800
+G1 X61.600 Y62.880 E3.08616 F1800
+G1 X61.520 Y62.880 E3.08880 F1800
+G1 X61.440 Y62.880 E3.09144 F1800
+G1 X61.360 Y62.880 E3.09408 F1800
+G1 X61.280 Y62.880 E3.09672 F1800
+G1 X61.200 Y62.880 E3.09936 F1800
+G1 X61.120 Y62.880 E3.10200 F1800
+G1 X61.040 Y62.880 E3.10464 F1800
+G1 X60.960 Y62.880 E3.10728 F1800
+G1 X60.880 Y62.880 E3.10992 F1800
+G1 X60.800 Y62.880 E3.11256 F1800
+G1 X60.720 Y62.880 E3.11520 F1800
+G1 X60.640 Y62.880 E3.11784 F1800
+G1 X60.560 Y62.880 E3.12048 F1800
+G1 X60.480 Y62.880 E3.12312 F1800
+G1 X60.400 Y62.880 E3.12576 F1800
+G1 X60.320 Y62.880 E3.12840 F1800
+G1 X60.240 Y62.880 E3.13104 F1800
+G1 X60.160 Y62.880 E3.13368 F1800
+G1 X60.080 Y62.880 E3.13632 F1800
+G1 X60.000 Y62.880 E3.13896 F1800
+G1 X60.000 Y62.800 E3.14160 F1800
+G1 X60.000 Y62.720 E3.14424 F1800
+G1 X60.000 Y62.640 E3.14688 F1800
+G1 X60.000 Y62.560 E3.14952 F1800
+G1 X60.000 Y62.480 E3.15216 F1800
+G1 X60.000 Y62.400 E3.15480 F1800
+G1 X60.000 Y62.320 E3.15744 F1800
+G1 X60.000 Y62.240 E3.16008 F1800
+G1 X60.000 Y62.160 E3.16272 F1800
+G1 X60.000 Y62.080 E3.16536 F1800
+G1 X60.000 Y62.000 E3.16800 F1800
+G1 X60.000 Y61.920 E3.17064 F1800
+G1 X60.000 Y61.840 E3.17328 F1800
+G1 X60.000 Y61.760 E3.17592 F1800
+G1 X60.000 Y61.680 E3.17856 F1800
+G1 X60.000 Y61.600 E3.18120 F1800
+G1 X60.000 Y61.520 E3.18384 F1800
+G1 X60.000 Y61.440 E3.18648 F1800
+G1 X60.000 Y61.360 E3.18912 F1800
+G1 X60.000 Y61.280 E3.19176 F1800
+G1 X60.000 Y61.200 E3.19440 F1800
+G1 X60.000 Y61.120 E3.19704 F1800
+G1 X60.000 Y61.040 E3.19968 F1800
+G1 X60.000 Y60.960 E3.20232 F1800
+G1 X60.000 Y60.880 E3.20496 F1800
+G1 X60.000 Y60.800 E3.20760 F1800
+G1 X60.000 Y60.720 E3.21024 F1800
+G1 X60.000 Y60.640 E3.21288 F1800
+G1 X60.000 Y60.560 E3.21552 F1800
+G1 X60.000 Y60.480 E3.21816 F1800
+G1 X60.000 Y60.400 E3.22080 F1800
+G1 X60.000 Y60.320 E3.22344 F1800
+G1 X60.000 Y60.240 E3.22608 F1800
+G1 X60.000 Y60.160 E3.22872 F1800
+G1 X60.000 Y60.080 E3.23136 F1800
+G1 X60.000 Y60.000 E3.23400 F1800
+G0 X120.000 Y100.000 F6000
+G1 X119.999 Y100.080 E3.23664 F2400
+G1 X119.996 Y100.160 E3.23927 F2400
+G1 X119.990 Y100.239 E3.24191 F2400
+G1 X119.983 Y100.319 E3.24454 F2400
+G1 X119.973 Y100.398 E3.24718 F2400
+G1 X119.962 Y100.477 E3.24981 F2400
+G1 X119.948 Y100.556 E3.25245 F2400
+G1 X119.932 Y100.634 E3.25509 F2400
+G1 X119.914 Y100.712 E3.25772 F2400
+G1 X119.894 Y100.789 E3.26036 F2400
+G1 X119.872 Y100.866 E3.26299 F2400
+G1 X119.848 Y100.942 E3.26563 F2400
+G1 X119.822 Y101.018 E3.26826 F2400
+G1 X119.794 Y101.092 E3.27090 F2400
+G1 X119.764 Y101.166 E3.27353 F2400
+G1 X119.732 Y101.240 E3.27617 F2400
+G1 X119.698 Y101.312 E3.27881 F2400
+G1 X119.662 Y101.383 E3.28144 F2400
+G1 X119.624 Y101.454 E3.28408 F2400
+G1 X119.585 Y101.523 E3.28671 F2400
+G1 X119.543 Y101.591 E3.28935 F2400
+G1 X119.500 Y101.658 E3.29198 F2400
+G1 X119.455 Y101.724 E3.29462 F2400
+G1 X119.408 Y101.789 E3.29726 F2400
+G1 X119.360 Y101.853 E3.29989 F2400
+G1 X119.310 Y101.915 E3.30253 F2400
+G1 X119.258 Y101.976 E3.30516 F2400
+G1 X119.204 Y102.035 E3.30780 F2400
+G1 X119.149 Y102.093 E3.31043 F2400
+G1 X119.093 Y102.149 E3.31307 F2400
+G1 X119.035 Y102.204 E3.31571 F2400
+G1 X118.976 Y102.258 E3.31834 F2400
+G1 X118.915 Y102.310 E3.32098 F2400
+G1 X118.853 Y102.360 E3.32361 F2400
+G1 X118.789 Y102.408 E3.32625 F2400
+G1 X118.724 Y102.455 E3.32888 F2400
+G1 X118.658 Y102.500 E3.33152 F2400
+G1 X118.591 Y102.543 E3.33416 F2400
+G1 X118.523 Y102.585 E3.33679 F2400
+G1 X118.454 Y102.624 E3.33943 F2400
+G1 X118.383 Y102.662 E3.34206 F2400
+G1 X118.312 Y102.698 E3.34470 F2400
+G1 X118.240 Y102.732 E3.34733 F2400
+G1 X118.166 Y102.764 E3.34997 F2400
+G1 X118.092 Y102.794 E3.35260 F2400
+G1 X118.018 Y102.822 E3.35524 F2400
+G1 X117.942 Y102.848 E3.35788 F2400
+G1 X117.866 Y102.872 E3.36051 F2400
+G1 X117.789 Y102.894 E3.36315 F2400
+G1 X117.712 Y102.914 E3.36578 F2400
+G1 X117.634 Y102.932 E3.36842 F2400
+G1 X117.556 Y102.948 E3.37105 F2400
+G1 X117.477 Y102.962 E3.37369 F2400
+G1 X117.398 Y102.973 E3.37633 F2400
+G1 X117.319 Y102.983 E3.37896 F2400
+G1 X117.239 Y102.990 E3.38160 F2400
+G1 X117.160 Y102.996 E3.38423 F2400
+G1 X117.080 Y102.999 E3.38687 F2400
+G1 X117.000 Y103.000 E3.38950 F2400
+G1 X116.920 Y102.999 E3.39214 F2400
+G1 X116.840 Y102.996 E3.39478 F2400
+G1 X116.761 Y102.990 E3.39741 F2400
+G1 X116.681 Y102.983 E3.40005 F2400
+G1 X116.602 Y102.973 E3.40268 F2400
+G1 X116.523 Y102.962 E3.40532 F2400
+G1 X116.444 Y102.948 E3.40795 F2400
+G1 X116.366 Y102.932 E3.41059 F2400
+G1 X116.288 Y102.914 E3.41323 F2400
+G1 X116.211 Y102.894 E3.41586 F2400
+G1 X116.134 Y102.872 E3.41850 F2400
+G1 X116.058 Y102.848 E3.42113 F2400
+G1 X115.982 Y102.822 E3.42377 F2400
+G1 X115.908 Y102.794 E3.42640 F2400
+G1 X115.834 Y102.764 E3.42904 F2400
+G1 X115.760 Y102.732 E3.43167 F2400
+G1 X115.688 Y102.698 E3.43431 F2400
+G1 X115.617 Y102.662 E3.43695 F2400
+G1 X115.546 Y102.624 E3.43958 F2400
+G1 X115.477 Y102.585 E3.44222 F2400
+G1 X115.409 Y102.543 E3.44485 F2400
+G1 X115.342 Y102.500 E3.44749 F2400
+G1 X115.276 Y102.455 E3.45012 F2400
+G1 X115.211 Y102.408 E3.45276 F2400
+G1 X115.147 Y102.360 E3.45540 F2400
+G1 X115.085 Y102.310 E3.45803 F2400
+G1 X115.024 Y102.258 E3.46067 F2400
+G1 X114.965 Y102.204 E3.46330 F2400
+G1 X114.907 Y102.149 E3.46594 F2400
+G1 X114.851 Y102.093 E3.46857 F2400
+G1 X114.796 Y102.035 E3.47121 F2400
+G1 X114.742 Y101.976 E3.47385 F2400
+G1 X114.690 Y101.915 E3.47648 F2400
+G1 X114.640 Y101.853 E3.47912 F2400
+G1 X114.592 Y101.789 E3.48175 F2400
+G1 X114.545 Y101.724 E3.48439 F2400
+G1 X114.500 Y101.658 E3.48702 F2400
+G1 X114.457 Y101.591 E3.48966 F2400
+G1 X114.415 Y101.523 E3.49230 F2400
+G1 X114.376 Y101.454 E3.49493 F2400
+G1 X114.338 Y101.383 E3.49757 F2400
+G1 X114.302 Y101.312 E3.50020 F2400
+G1 X114.268 Y101.240 E3.50284 F2400
+G1 X114.236 Y101.166 E3.50547 F2400
+G1 X114.206 Y101.092 E3.50811 F2400
+G1 X114.178 Y101.018 E3.51074 F2400
+G1 X114.152 Y100.942 E3.51338 F2400
+G1 X114.128 Y100.866 E3.51602 F2400
+G1 X114.106 Y100.789 E3.51865 F2400
+G1 X114.086 Y100.712 E3.52129 F2400
+G1 X114.068 Y100.634 E3.52392 F2400
+G1 X114.052 Y100.556 E3.52656 F2400
+G1 X114.038 Y100.477 E3.52919 F2400
+G1 X114.027 Y100.398 E3.53183 F2400
+G1 X114.017 Y100.319 E3.53447 F2400
+G1 X114.010 Y100.239 E3.53710 F2400
+G1 X114.004 Y100.160 E3.53974 F2400
+G1 X114.001 Y100.080 E3.54237 F2400
+G1 X114.000 Y100.000 E3.54501 F2400
+G1 X114.001 Y99.920 E3.54764 F2400
+G1 X114.004 Y99.840 E3.55028 F2400
+G1 X114.010 Y99.761 E3.55292 F2400
+G1 X114.017 Y99.681 E3.55555 F2400
+G1 X114.027 Y99.602 E3.55819 F2400
+G1 X114.038 Y99.523 E3.56082 F2400
+G1 X114.052 Y99.444 E3.56346 F2400
+G1 X114.068 Y99.366 E3.56609 F2400
+G1 X114.086 Y99.288 E3.56873 F2400
+G1 X114.106 Y99.211 E3.57137 F2400
+G1 X114.128 Y99.134 E3.57400 F2400
+G1 X114.152 Y99.058 E3.57664 F2400
+G1 X114.178 Y98.982 E3.57927 F2400
+G1 X114.206 Y98.908 E3.58191 F2400
+G1 X114.236 Y98.834 E3.58454 F2400
+G1 X114.268 Y98.760 E3.58718 F2400
+G1 X114.302 Y98.688 E3.58981 F2400
+G1 X114.338 Y98.617 E3.59245 F2400
+G1 X114.376 Y98.546 E3.59509 F2400
+G1 X114.415 Y98.477 E3.59772 F2400
+G1 X114.457 Y98.409 E3.60036 F2400
+G1 X114.500 Y98.342 E3.60299 F2400
+G1 X114.545 Y98.276 E3.60563 F2400
+G1 X114.592 Y98.211 E3.60826 F2400
+G1 X114.640 Y98.147 E3.61090 F2400
+G1 X114.690 Y98.085 E3.61354 F2400
+G1 X114.742 Y98.024 E3.61617 F2400
+G1 X114.796 Y97.965 E3.61881 F2400
+G1 X114.851 Y97.907 E3.62144 F2400
+G1 X114.907 Y97.851 E3.62408 F2400
+G1 X114.965 Y97.796 E3.62671 F2400
+G1 X115.024 Y97.742 E3.62935 F2400
+G1 X115.085 Y97.690 E3.63199 F2400
+G1 X115.147 Y97.640 E3.63462 F2400
+G1 X115.211 Y97.592 E3.63726 F2400
+G1 X115.276 Y97.545 E3.63989 F2400
+G1 X115.342 Y97.500 E3.64253 F2400
+G1 X115.409 Y97.457 E3.64516 F2400
+G1 X115.477 Y97.415 E3.64780 F2400
+G1 X115.546 Y97.376 E3.65044 F2400
+G1 X115.617 Y97.338 E3.65307 F2400
+G1 X115.688 Y97.302 E3.65571 F2400
+G1 X115.760 Y97.268 E3.65834 F2400
+G1 X115.834 Y97.236 E3.66098 F2400
+G1 X115.908 Y97.206 E3.66361 F2400
+G1 X115.982 Y97.178 E3.66625 F2400
+G1 X116.058 Y97.152 E3.66888 F2400
+G1 X116.134 Y97.128 E3.67152 F2400
+G1 X116.211 Y97.106 E3.67416 F2400
+G1 X116.288 Y97.086 E3.67679 F2400
+G1 X116.366 Y97.068 E3.67943 F2400
+G1 X116.444 Y97.052 E3.68206 F2400
+G1 X116.523 Y97.038 E3.68470 F2400
+G1 X116.602 Y97.027 E3.68733 F2400
+G1 X116.681 Y97.017 E3.68997 F2400
+G1 X116.761 Y97.010 E3.69261 F2400
+G1 X116.840 Y97.004 E3.69524 F2400
+G1 X116.920 Y97.001 E3.69788 F2400
+G1 X117.000 Y97.000 E3.70051 F2400
+G1 X117.080 Y97.001 E3.70315 F2400
+G1 X117.160 Y97.004 E3.70578 F2400
+G1 X117.239 Y97.010 E3.70842 F2400
+G1 X117.319 Y97.017 E3.71106 F2400
+G1 X117.398 Y97.027 E3.71369 F2400
+G1 X117.477 Y97.038 E3.71633 F2400
+G1 X117.556 Y97.052 E3.71896 F2400
+G1 X117.634 Y97.068 E3.72160 F2400
+G1 X117.712 Y97.086 E3.72423 F2400
+G1 X117.789 Y97.106 E3.72687 F2400
+G1 X117.866 Y97.128 E3.72951 F2400
+G1 X117.942 Y97.152 E3.73214 F2400
+G1 X118.018 Y97.178 E3.73478 F2400
+G1 X118.092 Y97.206 E3.73741 F2400
+G1 X118.166 Y97.236 E3.74005 F2400
+G1 X118.240 Y97.268 E3.74268 F2400
+G1 X118.312 Y97.302 E3.74532 F2400
+G1 X118.383 Y97.338 E3.74795 F2400
+G1 X118.454 Y97.376 E3.75059 F2400
+G1 X118.523 Y97.415 E3.75323 F2400
+G1 X118.591 Y97.457 E3.75586 F2400
+G1 X118.658 Y97.500 E3.75850 F2400
+G1 X118.724 Y97.545 E3.76113 F2400
+G1 X118.789 Y97.592 E3.76377 F2400
+G1 X118.853 Y97.640 E3.76640 F2400
+G1 X118.915 Y97.690 E3.76904 F2400
+G1 X118.976 Y97.742 E3.77168 F2400
+G1 X119.035 Y97.796 E3.77431 F2400
+G1 X119.093 Y97.851 E3.77695 F2400
+G1 X119.149 Y97.907 E3.77958 F2400
+G1 X119.204 Y97.965 E3.78222 F2400
+G1 X119.258 Y98.024 E3.78485 F2400
+G1 X119.310 Y98.085 E3.78749 F2400
+G1 X119.360 Y98.147 E3.79013 F2400
+G1 X119.408 Y98.211 E3.79276 F2400
+G1 X119.455 Y98.276 E3.79540 F2400
+G1 X119.500 Y98.342 E3.79803 F2400
+G1 X119.543 Y98.409 E3.80067 F2400
+G1 X119.585 Y98.477 E3.80330 F2400
+G1 X119.624 Y98.546 E3.80594 F2400
+G1 X119.662 Y98.617 E3.80858 F2400
+G1 X119.698 Y98.688 E3.81121 F2400
+G1 X119.732 Y98.760 E3.81385 F2400
+G1 X119.764 Y98.834 E3.81648 F2400
+G1 X119.794 Y98.908 E3.81912 F2400
+G1 X119.822 Y98.982 E3.82175 F2400
+G1 X119.848 Y99.058 E3.82439 F2400
+G1 X119.872 Y99.134 E3.82702 F2400
+G1 X119.894 Y99.211 E3.82966 F2400
+G1 X119.914 Y99.288 E3.83230 F2400
+G1 X119.932 Y99.366 E3.83493 F2400
+G1 X119.948 Y99.444 E3.83757 F2400
+G1 X119.962 Y99.523 E3.84020 F2400
+G1 X119.973 Y99.602 E3.84284 F2400
+G1 X119.983 Y99.681 E3.84547 F2400
+G1 X119.990 Y99.761 E3.84811 F2400
+G1 X119.996 Y99.840 E3.85075 F2400
+G1 X119.999 Y99.920 E3.85338 F2400
+G1 X120.000 Y100.000 E3.85602 F2400
+G1 X119.999 Y100.080 E3.85866 F2400
+G1 X119.997 Y100.160 E3.86130 F2400
+G1 X119.993 Y100.240 E3.86394 F2400
+G1 X119.987 Y100.320 E3.86658 F2400
+G1 X119.980 Y100.400 E3.86922 F2400
+G1 X119.971 Y100.479 E3.87186 F2400
+G1 X119.961 Y100.558 E3.87451 F2400
+G1 X119.949 Y100.638 E3.87715 F2400
+G1 X119.935 Y100.716 E3.87979 F2400
+G1 X119.920 Y100.795 E3.88243 F2400
+G1 X119.903 Y100.873 E3.88507 F2400
+G1 X119.885 Y100.951 E3.88771 F2400
+G1 X119.865 Y101.029 E3.89035 F2400
+G1 X119.844 Y101.106 E3.89300 F2400
+G1 X119.821 Y101.183 E3.89564 F2400
+G1 X119.797 Y101.259 E3.89828 F2400
+G1 X119.771 Y101.335 E3.90092 F2400
+G1 X119.743 Y101.410 E3.90356 F2400
+G1 X119.714 Y101.484 E3.90620 F2400
+G1 X119.684 Y101.558 E3.90884 F2400
+G1 X119.652 Y101.632 E3.91148 F2400
+G1 X119.619 Y101.705 E3.91413 F2400
+G1 X119.584 Y101.777 E3.91677 F2400
+G1 X119.548 Y101.848 E3.91941 F2400
+G1 X119.510 Y101.919 E3.92205 F2400
+G1 X119.471 Y101.988 E3.92469 F2400
+G1 X119.430 Y102.057 E3.92733 F2400
+G1 X119.388 Y102.126 E3.92997 F2400
+G1 X119.345 Y102.193 E3.93261 F2400
+G1 X119.301 Y102.260 E3.93526 F2400
+G1 X119.255 Y102.325 E3.93790 F2400
+G1 X119.208 Y102.390 E3.94054 F2400
+G1 X119.159 Y102.454 E3.94318 F2400
+G1 X119.109 Y102.516 E3.94582 F2400
+G1 X119.058 Y102.578 E3.94846 F2400
+G1 X119.006 Y102.639 E3.95110 F2400
+G1 X118.953 Y102.698 E3.95374 F2400
+G1 X118.898 Y102.757 E3.95639 F2400
+G1 X118.843 Y102.814 E3.95903 F2400
+G1 X118.786 Y102.871 E3.96167 F2400
+G1 X118.728 Y102.926 E3.96431 F2400
+G1 X118.669 Y102.980 E3.96695 F2400
+G1 X118.608 Y103.033 E3.96959 F2400
+G1 X118.547 Y103.084 E3.97223 F2400
+G1 X118.485 Y103.134 E3.97488 F2400
+G1 X118.422 Y103.184 E3.97752 F2400
+G1 X118.358 Y103.231 E3.98016 F2400
+G1 X118.292 Y103.278 E3.98280 F2400
+G1 X118.226 Y103.323 E3.98544 F2400
+G1 X118.160 Y103.367 E3.98808 F2400
+G1 X118.092 Y103.410 E3.99072 F2400
+G1 X118.023 Y103.451 E3.99336 F2400
+G1 X117.954 Y103.490 E3.99601 F2400
+G1 X117.883 Y103.529 E3.99865 F2400
+G1 X117.812 Y103.566 E4.00129 F2400
+G1 X117.741 Y103.601 E4.00393 F2400
+G1 X117.668 Y103.635 E4.00657 F2400
+G1 X117.595 Y103.668 E4.00921 F2400
+G1 X117.521 Y103.699 E4.01185 F2400
+G1 X117.447 Y103.729 E4.01449 F2400
+G1 X117.372 Y103.757 E4.01714 F2400
+G1 X117.297 Y103.784 E4.01978 F2400
+G1 X117.221 Y103.809 E4.02242 F2400
+G1 X117.144 Y103.833 E4.02506 F2400
+G1 X117.067 Y103.855 E4.02770 F2400
+G1 X116.990 Y103.876 E4.03034 F2400
+G1 X116.912 Y103.895 E4.03298 F2400
+G1 X116.834 Y103.912 E4.03563 F2400
+G1 X116.756 Y103.928 E4.03827 F2400
+G1 X116.677 Y103.942 E4.04091 F2400
+G1 X116.598 Y103.955 E4.04355 F2400
+G1 X116.519 Y103.966 E4.04619 F2400
+G1 X116.439 Y103.976 E4.04883 F2400
+G1 X116.360 Y103.984 E4.05147 F2400
+G1 X116.280 Y103.990 E4.05411 F2400
+G1 X116.200 Y103.995 E4.05676 F2400
+G1 X116.120 Y103.998 E4.05940 F2400
+G1 X116.040 Y104.000 E4.06204 F2400
+G1 X115.960 Y104.000 E4.06468 F2400
+G1 X115.880 Y103.998 E4.06732 F2400
+G1 X115.800 Y103.995 E4.06996 F2400
+G1 X115.720 Y103.990 E4.07260 F2400
+G1 X115.640 Y103.984 E4.07524 F2400
+G1 X115.561 Y103.976 E4.07789 F2400
+G1 X115.481 Y103.966 E4.08053 F2400
+G1 X115.402 Y103.955 E4.08317 F2400
+G1 X115.323 Y103.942 E4.08581 F2400
+G1 X115.244 Y103.928 E4.08845 F2400
+G1 X115.166 Y103.912 E4.09109 F2400
+G1 X115.088 Y103.895 E4.09373 F2400
+G1 X115.010 Y103.876 E4.09637 F2400
+G1 X114.933 Y103.855 E4.09902 F2400
+G1 X114.856 Y103.833 E4.10166 F2400
+G1 X114.779 Y103.809 E4.10430 F2400
+G1 X114.703 Y103.784 E4.10694 F2400
+G1 X114.628 Y103.757 E4.10958 F2400
+G1 X114.553 Y103.729 E4.11222 F2400
+G1 X114.479 Y103.699 E4.11486 F2400
+G1 X114.405 Y103.668 E4.11751 F2400
+G1 X114.332 Y103.635 E4.12015 F2400
+G1 X114.259 Y103.601 E4.12279 F2400
+G1 X114.188 Y103.566 E4.12543 F2400
+G1 X114.117 Y103.529 E4.12807 F2400
+G1 X114.046 Y103.490 E4.13071 F2400
+G1 X113.977 Y103.451 E4.13335 F2400
+G1 X113.908 Y103.410 E4.13599 F2400
+G1 X113.840 Y103.367 E4.13864 F2400
+G1 X113.774 Y103.323 E4.14128 F2400
+G1 X113.708 Y103.278 E4.14392 F2400
+G1 X113.642 Y103.231 E4.14656 F2400
+G1 X113.578 Y103.184 E4.14920 F2400
+G1 X113.515 Y103.134 E4.15184 F2400
+G1 X113.453 Y103.084 E4.15448 F2400
+G1 X113.392 Y103.033 E4.15712 F2400
+G1 X113.331 Y102.980 E4.15977 F2400
+G1 X113.272 Y102.926 E4.16241 F2400
+G1 X113.214 Y102.871 E4.16505 F2400
+G1 X113.157 Y102.814 E4.16769 F2400
+G1 X113.102 Y102.757 E4.17033 F2400
+G1 X113.047 Y102.698 E4.17297 F2400
+G1 X112.994 Y102.639 E4.17561 F2400
+G1 X112.942 Y102.578 E4.17825 F2400
+G1 X112.891 Y102.516 E4.18090 F2400
+G1 X112.841 Y102.454 E4.18354 F2400
+G1 X112.792 Y102.390 E4.18618 F2400
+G1 X112.745 Y102.325 E4.18882 F2400
+G1 X112.699 Y102.260 E4.19146 F2400
+G1 X112.655 Y102.193 E4.19410 F2400
+G1 X112.612 Y102.126 E4.19674 F2400
+G1 X112.570 Y102.057 E4.19939 F2400
+G1 X112.529 Y101.988 E4.20203 F2400
+G1 X112.490 Y101.919 E4.20467 F2400
+G1 X112.452 Y101.848 E4.20731 F2400
+G1 X112.416 Y101.777 E4.20995 F2400
+G1 X112.381 Y101.705 E4.21259 F2400
+G1 X112.348 Y101.632 E4.21523 F2400
+G1 X112.316 Y101.558 E4.21787 F2400
+G1 X112.286 Y101.484 E4.22052 F2400
+G1 X112.257 Y101.410 E4.22316 F2400
+G1 X112.229 Y101.335 E4.22580 F2400
+G1 X112.203 Y101.259 E4.22844 F2400
+G1 X112.179 Y101.183 E4.23108 F2400
+G1 X112.156 Y101.106 E4.23372 F2400
+G1 X112.135 Y101.029 E4.23636 F2400
+G1 X112.115 Y100.951 E4.23900 F2400
+G1 X112.097 Y100.873 E4.24165 F2400
+G1 X112.080 Y100.795 E4.24429 F2400
+G1 X112.065 Y100.716 E4.24693 F2400
+G1 X112.051 Y100.638 E4.24957 F2400
+G1 X112.039 Y100.558 E4.25221 F2400
+G1 X112.029 Y100.479 E4.25485 F2400
+G1 X112.020 Y100.400 E4.25749 F2400
+G1 X112.013 Y100.320 E4.26014 F2400
+G1 X112.007 Y100.240 E4.26278 F2400
+G1 X112.003 Y100.160 E4.26542 F2400
+G1 X112.001 Y100.080 E4.26806 F2400
+G1 X112.000 Y100.000 E4.27070 F2400
+G1 X112.001 Y99.920 E4.27334 F2400
+G1 X112.003 Y99.840 E4.27598 F2400
+G1 X112.007 Y99.760 E4.27862 F2400
+G1 X112.013 Y99.680 E4.28127 F2400
+G1 X112.020 Y99.600 E4.28391 F2400
+G1 X112.029 Y99.521 E4.28655 F2400
+G1 X112.039 Y99.442 E4.28919 F2400
+G1 X112.051 Y99.362 E4.29183 F2400
+G1 X112.065 Y99.284 E4.29447 F2400
+G1 X112.080 Y99.205 E4.29711 F2400
+G1 X112.097 Y99.127 E4.29975 F2400
+G1 X112.115 Y99.049 E4.30240 F2400
+G1 X112.135 Y98.971 E4.30504 F2400
+G1 X112.156 Y98.894 E4.30768 F2400
+G1 X112.179 Y98.817 E4.31032 F2400
+G1 X112.203 Y98.741 E4.31296 F2400
+G1 X112.229 Y98.665 E4.31560 F2400
+G1 X112.257 Y98.590 E4.31824 F2400
+G1 X112.286 Y98.516 E4.32088 F2400
+G1 X112.316 Y98.442 E4.32353 F2400
+G1 X112.348 Y98.368 E4.32617 F2400
+G1 X112.381 Y98.295 E4.32881 F2400
+G1 X112.416 Y98.223 E4.33145 F2400
+G1 X112.452 Y98.152 E4.33409 F2400
+G1 X112.490 Y98.081 E4.33673 F2400
+G1 X112.529 Y98.012 E4.33937 F2400
+G1 X112.570 Y97.943 E4.34202 F2400
+G1 X112.612 Y97.874 E4.34466 F2400
+G1 X112.655 Y97.807 E4.34730 F2400
+G1 X112.699 Y97.740 E4.34994 F2400
+G1 X112.745 Y97.675 E4.35258 F2400
+G1 X112.792 Y97.610 E4.35522 F2400
+G1 X112.841 Y97.546 E4.35786 F2400
+G1 X112.891 Y97.484 E4.36050 F2400
+G1 X112.942 Y97.422 E4.36315 F2400
+G1 X112.994 Y97.361 E4.36579 F2400
+G1 X113.047 Y97.302 E4.36843 F2400
+G1 X113.102 Y97.243 E4.37107 F2400
+G1 X113.157 Y97.186 E4.37371 F2400
+G1 X113.214 Y97.129 E4.37635 F2400
+G1 X113.272 Y97.074 E4.37899 F2400
+G1 X113.331 Y97.020 E4.38163 F2400
+G1 X113.392 Y96.967 E4.38428 F2400
+G1 X113.453 Y96.916 E4.38692 F2400
+G1 X113.515 Y96.866 E4.38956 F2400
+G1 X113.578 Y96.816 E4.39220 F2400
+G1 X113.642 Y96.769 E4.39484 F2400
+G1 X113.708 Y96.722 E4.39748 F2400
+G1 X113.774 Y96.677 E4.40012 F2400
+G1 X113.840 Y96.633 E4.40277 F2400
+G1 X113.908 Y96.590 E4.40541 F2400
+G1 X113.977 Y96.549 E4.40805 F2400
+G1 X114.046 Y96.510 E4.41069 F2400
+G1 X114.117 Y96.471 E4.41333 F2400
+G1 X114.188 Y96.434 E4.41597 F2400
+G1 X114.259 Y96.399 E4.41861 F2400
+G1 X114.332 Y96.365 E4.42125 F2400
+G1 X114.405 Y96.332 E4.42390 F2400
+G1 X114.479 Y96.301 E4.42654 F2400
+G1 X114.553 Y96.271 E4.42918 F2400
+G1 X114.628 Y96.243 E4.43182 F2400
+G1 X114.703 Y96.216 E4.43446 F2400
+G1 X114.779 Y96.191 E4.43710 F2400
+G1 X114.856 Y96.167 E4.43974 F2400
+G1 X114.933 Y96.145 E4.44238 F2400
+G1 X115.010 Y96.124 E4.44503 F2400
+G1 X115.088 Y96.105 E4.44767 F2400
+G1 X115.166 Y96.088 E4.45031 F2400
+G1 X115.244 Y96.072 E4.45295 F2400
+G1 X115.323 Y96.058 E4.45559 F2400
+G1 X115.402 Y96.045 E4.45823 F2400
+G1 X115.481 Y96.034 E4.46087 F2400
+G1 X115.561 Y96.024 E4.46351 F2400
+G1 X115.640 Y96.016 E4.46616 F2400
+G1 X115.720 Y96.010 E4.46880 F2400
+G1 X115.800 Y96.005 E4.47144 F2400
+G1 X115.880 Y96.002 E4.47408 F2400
+G1 X115.960 Y96.000 E4.47672 F2400
+G1 X116.040 Y96.000 E4.47936 F2400
+G1 X116.120 Y96.002 E4.48200 F2400
+G1 X116.200 Y96.005 E4.48465 F2400
+G1 X116.280 Y96.010 E4.48729 F2400
+G1 X116.360 Y96.016 E4.48993 F2400
+G1 X116.439 Y96.024 E4.49257 F2400
+G1 X116.519 Y96.034 E4.49521 F2400
+G1 X116.598 Y96.045 E4.49785 F2400
+G1 X116.677 Y96.058 E4.50049 F2400
+G1 X116.756 Y96.072 E4.50313 F2400
+G1 X116.834 Y96.088 E4.50578 F2400
+G1 X116.912 Y96.105 E4.50842 F2400
+G1 X116.990 Y96.124 E4.51106 F2400
+G1 X117.067 Y96.145 E4.51370 F2400
+G1 X117.144 Y96.167 E4.51634 F2400
+G1 X117.221 Y96.191 E4.51898 F2400
+G1 X117.297 Y96.216 E4.52162 F2400
+G1 X117.372 Y96.243 E4.52426 F2400
+G1 X117.447 Y96.271 E4.52691 F2400
+G1 X117.521 Y96.301 E4.52955 F2400
+G1 X117.595 Y96.332 E4.53219 F2400
+G1 X117.668 Y96.365 E4.53483 F2400
+G1 X117.741 Y96.399 E4.53747 F2400
+G1 X117.812 Y96.434 E4.54011 F2400
+G1 X117.883 Y96.471 E4.54275 F2400
+G1 X117.954 Y96.510 E4.54539 F2400
+G1 X118.023 Y96.549 E4.54804 F2400
+G1 X118.092 Y96.590 E4.55068 F2400
+G1 X118.160 Y96.633 E4.55332 F2400
+G1 X118.226 Y96.677 E4.55596 F2400
+G1 X118.292 Y96.722 E4.55860 F2400
+G1 X118.358 Y96.769 E4.56124 F2400
+G1 X118.422 Y96.816 E4.56388 F2400
+G1 X118.485 Y96.866 E4.56653 F2400
+G1 X118.547 Y96.916 E4.56917 F2400
+G1 X118.608 Y96.967 E4.57181 F2400
+G1 X118.669 Y97.020 E4.57445 F2400
+G1 X118.728 Y97.074 E4.57709 F2400
+G1 X118.786 Y97.129 E4.57973 F2400
+G1 X118.843 Y97.186 E4.58237 F2400
+G1 X118.898 Y97.243 E4.58501 F2400
+G1 X118.953 Y97.302 E4.58766 F2400
+G1 X119.006 Y97.361 E4.59030 F2400
+G1 X119.058 Y97.422 E4.59294 F2400
+G1 X119.109 Y97.484 E4.59558 F2400
+G1 X119.159 Y97.546 E4.59822 F2400
+G1 X119.208 Y97.610 E4.60086 F2400
+G1 X119.255 Y97.675 E4.60350 F2400
+G1 X119.301 Y97.740 E4.60614 F2400
+G1 X119.345 Y97.807 E4.60879 F2400
+G1 X119.388 Y97.874 E4.61143 F2400
+G1 X119.430 Y97.943 E4.61407 F2400
+G1 X119.471 Y98.012 E4.61671 F2400
+G1 X119.510 Y98.081 E4.61935 F2400
+G1 X119.548 Y98.152 E4.62199 F2400
+G1 X119.584 Y98.223 E4.62463 F2400
+G1 X119.619 Y98.295 E4.62728 F2400
+G1 X119.652 Y98.368 E4.62992 F2400
+G1 X119.684 Y98.442 E4.63256 F2400
+G1 X119.714 Y98.516 E4.63520 F2400
+G1 X119.743 Y98.590 E4.63784 F2400
+G1 X119.771 Y98.665 E4.64048 F2400
+G1 X119.797 Y98.741 E4.64312 F2400
+G1 X119.821 Y98.817 E4.64576 F2400
+G1 X119.844 Y98.894 E4.64841 F2400
+G1 X119.865 Y98.971 E4.65105 F2400
+G1 X119.885 Y99.049 E4.65369 F2400
+G1 X119.903 Y99.127 E4.65633 F2400
+G1 X119.920 Y99.205 E4.65897 F2400
+G1 X119.935 Y99.284 E4.66161 F2400
+G1 X119.949 Y99.362 E4.66425 F2400
+G1 X119.961 Y99.442 E4.66689 F2400
+G1 X119.971 Y99.521 E4.66954 F2400
+G1 X119.980 Y99.600 E4.67218 F2400
+G1 X119.987 Y99.680 E4.67482 F2400
+G1 X119.993 Y99.760 E4.67746 F2400
+G1 X119.997 Y99.840 E4.68010 F2400
+G1 X119.999 Y99.920 E4.68274 F2400
+G1 X120.000 Y100.000 E4.68538 F2400
+M400
@@ -0,0 +1,50 @@
+G28
+G90
+M82
+G92 E0
+G1 Z0.3 F600
+G0 X50.000 Y50.000 F6000
+G1 X90.000 Y50.000 E1.32000 F1800
+G1 X90.000 Y90.000 E2.64000 F1800
+G1 X50.000 Y90.000 E3.96000 F1800
+G1 X50.000 Y50.000 E5.28000 F1800
+M220 S150
+G1 X88.000 Y50.000 E6.53400 F1800
+G1 X88.000 Y88.000 E7.78800 F1800
+G1 X50.000 Y88.000 E9.04200 F1800
+G1 X50.000 Y50.000 E10.29600 F1800
+M221 S90
+G1 X86.000 Y50.000 E11.48400 F1800
+G1 X86.000 Y86.000 E12.67200 F1800
+G1 X50.000 Y86.000 E13.86000 F1800
+G1 X50.000 Y50.000 E15.04800 F1800
+M220 S50
+M221 S110
+G1 X84.000 Y50.000 E16.17000 F1800
+G1 X84.000 Y84.000 E17.29200 F1800
+G1 X50.000 Y84.000 E18.41400 F1800
+G1 X50.000 Y50.000 E19.53600 F1800
+M220 S100
+M221 S100
+G92 E0
+G1 X82.000 Y50.000 E1.05600 F1800
+G1 X82.000 Y82.000 E2.11200 F1800
+G1 X50.000 Y82.000 E3.16800 F1800
+G1 X50.000 Y50.000 E4.22400 F1800
+G92 X60 Y60
+G0 X90.000 Y90.000 F6000
+G1 X150 Y90 F1200
+G1 X150 Y150 F1200
+M410
+G1 X100 Y100 F3000
+G1 X110 Y120 F3000
+G4 P6000
+G1 X60 Y60 F6000
+G1 X70 Y80 Z1 F6000
+M410
+G1 X20 Y30 F6000
+G4 P6000
+G1 X40 Y40 F6000
+G28
+G1 X10 Y10 F6000
+M400
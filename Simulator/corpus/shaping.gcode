@@ -0,0 +1,306 @@
+G28
+G90
+M204 S3000
+M201 X3000 Y3000
+G1 X100 Y100 F6000
+G1 X137.362 Y98.306 F6671
+G1 X108.723 Y101.829 F6678
+G1 X115.874 Y123.222 F3946
+G1 X60.413 Y100.065 F4588
+G1 X138.672 Y71.469 F3149
+G1 X124.956 Y102.877 F3056
+G1 X63.533 Y126.966 F6720
+G1 X61.522 Y62.785 F4440
+G1 X129.303 Y72.122 F8281
+G1 X65.257 Y72.310 F6442
+G1 X127.482 Y124.761 F4977
+G1 X135.006 Y96.519 F7049
+G1 X62.861 Y76.013 F6532
+G1 X101.952 Y104.633 F4987
+G1 X79.283 Y86.276 F4080
+G1 X109.913 Y113.718 F7807
+G1 X90.046 Y95.177 F5547
+G1 X88.701 Y65.822 F6876
+G1 X109.994 Y122.685 F3505
+G1 X111.005 Y73.401 F6965
+G1 X66.057 Y107.991 F7484
+G1 X94.546 Y118.113 F5961
+G1 X88.510 Y123.320 F4732
+G1 X105.771 Y119.181 F6844
+G1 X115.918 Y106.866 F4276
+G1 X107.781 Y77.182 F3748
+G1 X131.572 Y96.031 F3865
+G1 X65.140 Y126.077 F8647
+G1 X70.335 Y103.019 F7215
+G1 X89.342 Y61.513 F5790
+G1 X68.785 Y107.882 F8847
+G1 X70.315 Y118.179 F4912
+G1 X124.812 Y95.717 F7387
+G1 X134.983 Y76.531 F8495
+G1 X89.164 Y120.604 F5739
+G1 X72.242 Y127.738 F6727
+G1 X130.864 Y98.176 F7247
+G1 X80.874 Y88.873 F7252
+G1 X65.783 Y73.527 F6104
+G1 X109.886 Y65.823 F6529
+G1 X100.212 Y112.325 F5013
+G1 X87.796 Y64.122 F4251
+G1 X69.921 Y113.167 F8008
+G1 X120.429 Y124.226 F6060
+G1 X73.902 Y125.981 F8338
+G1 X104.917 Y60.730 F4523
+G1 X138.497 Y128.129 F5408
+G1 X112.984 Y100.848 F7596
+G1 X62.710 Y106.024 F3121
+G1 X131.735 Y95.273 F6762
+G1 X81.798 Y126.477 F4401
+G1 X60.506 Y66.953 F8429
+G1 X134.872 Y94.997 F6190
+G1 X124.867 Y96.104 F4135
+G1 X117.636 Y98.635 F8676
+G1 X71.135 Y111.069 F5164
+G1 X139.264 Y65.156 F4427
+G1 X120.308 Y79.546 F8100
+G1 X67.102 Y118.059 F5533
+G1 X123.013 Y105.551 F5737
+G1 X139.792 Y80.624 F4935
+G1 X86.266 Y82.580 F6441
+G1 X133.599 Y127.807 F4829
+G1 X119.939 Y110.941 F4247
+G1 X104.567 Y119.933 F5696
+G1 X92.417 Y126.638 F4337
+G1 X72.151 Y75.511 F4840
+G1 X130.723 Y61.396 F5548
+G1 X69.476 Y86.274 F4228
+G1 X75.596 Y87.590 F6905
+G1 X95.610 Y103.691 F7076
+G1 X84.189 Y92.727 F3796
+G1 X86.868 Y123.523 F4703
+G1 X75.618 Y86.658 F7451
+G1 X78.830 Y88.403 F6202
+G1 X78.460 Y63.670 F3302
+G1 X81.637 Y92.399 F6952
+G1 X81.629 Y68.626 F7392
+G1 X78.777 Y99.421 F5320
+G1 X62.032 Y69.545 F3173
+G1 X89.747 Y126.795 F6093
+G1 X68.639 Y66.341 F6871
+G1 X136.940 Y124.763 F7105
+G1 X120.759 Y128.313 F5076
+G1 X68.044 Y90.532 F6168
+G1 X98.541 Y106.193 F3048
+G1 X68.950 Y98.519 F6273
+G1 X106.179 Y79.562 F5469
+G1 X78.548 Y68.749 F5245
+G1 X75.682 Y91.768 F5681
+G1 X92.305 Y99.716 F6523
+G1 X73.213 Y80.359 F6620
+G1 X72.523 Y129.036 F3711
+G1 X85.629 Y95.340 F7798
+G1 X106.742 Y61.227 F3817
+G1 X83.555 Y100.130 F3096
+G1 X86.974 Y101.590 F5832
+G1 X84.592 Y69.371 F7368
+G1 X78.304 Y89.821 F7699
+G1 X118.417 Y101.755 F5899
+G1 X113.221 Y70.325 F3091
+G1 X95.248 Y106.722 F3205
+G1 X122.769 Y60.271 F4621
+G1 X79.606 Y85.478 F5290
+G1 X92.755 Y121.375 F6563
+G1 X99.275 Y111.845 F8372
+G1 X75.210 Y104.720 F7247
+G1 X127.284 Y119.234 F5392
+G1 X135.195 Y116.577 F3016
+G1 X105.318 Y125.834 F3000
+G1 X85.554 Y111.100 F8449
+G1 X104.883 Y100.028 F5728
+G1 X94.859 Y64.041 F5208
+G1 X81.796 Y105.181 F3464
+G1 X135.845 Y120.758 F3410
+G1 X88.308 Y97.165 F4755
+G1 X123.695 Y82.663 F8863
+G1 X77.097 Y123.618 F3941
+G1 X62.168 Y99.395 F7292
+G1 X125.541 Y85.917 F6277
+G1 X139.234 Y69.627 F4801
+G1 X102.578 Y125.718 F4788
+G1 X119.624 Y106.065 F5413
+G1 X135.807 Y94.375 F8068
+G1 X129.460 Y112.078 F6489
+G1 X126.506 Y71.340 F3006
+G1 X139.439 Y88.636 F8288
+G1 X83.073 Y112.737 F4917
+G1 X87.229 Y65.451 F4680
+G1 X115.764 Y126.855 F8689
+G1 X123.673 Y60.055 F3140
+G1 X71.818 Y64.314 F6531
+G1 X120.075 Y69.010 F6987
+G1 X98.375 Y102.430 F4500
+G1 X111.944 Y112.715 F7492
+G1 X98.941 Y103.760 F7848
+G1 X122.686 Y97.123 F5584
+G1 X100.204 Y115.751 F4629
+G1 X96.072 Y71.873 F8671
+G1 X112.380 Y86.130 F5552
+G1 X99.289 Y87.586 F3864
+G1 X133.849 Y92.719 F6567
+G1 X110.791 Y86.645 F4150
+G1 X138.059 Y81.265 F5051
+G1 X86.113 Y107.124 F4402
+G1 X113.475 Y119.697 F4092
+G1 X115.766 Y95.187 F5705
+G1 X85.898 Y63.855 F7444
+G1 X136.904 Y116.746 F8814
+G1 X127.804 Y78.578 F7118
+G1 X120.111 Y125.877 F4847
+G1 X122.964 Y96.038 F3061
+G1 X69.532 Y61.404 F5990
+G1 X69.731 Y67.552 F7363
+G1 X105.903 Y76.572 F5316
+G1 X105.716 Y83.373 F4743
+G1 X75.015 Y83.295 F4447
+G1 X114.455 Y97.776 F3351
+G1 X112.191 Y116.542 F7204
+G1 X91.717 Y123.861 F3212
+G1 X139.559 Y116.713 F3697
+G1 X73.542 Y72.745 F4767
+G1 X77.436 Y72.969 F7050
+G1 X66.626 Y127.462 F8126
+G1 X78.590 Y119.039 F5251
+G1 X125.785 Y121.262 F3699
+G1 X116.572 Y84.053 F8328
+G1 X68.394 Y76.011 F8333
+G1 X101.690 Y73.608 F8008
+G1 X117.160 Y105.991 F6666
+G1 X121.219 Y72.321 F3931
+G1 X123.967 Y122.122 F5162
+G1 X107.156 Y104.872 F4240
+G1 X83.533 Y62.167 F3093
+G1 X121.925 Y127.422 F3184
+G1 X84.023 Y83.083 F6239
+G1 X77.315 Y115.971 F7036
+G1 X90.976 Y94.617 F5332
+G1 X84.005 Y86.907 F6453
+G1 X89.618 Y93.747 F5024
+G1 X65.523 Y128.010 F4077
+G1 X136.650 Y121.982 F6399
+G1 X107.019 Y80.169 F3851
+G1 X131.810 Y107.037 F7390
+G1 X69.126 Y125.094 F3271
+G1 X124.562 Y80.010 F6975
+G1 X134.529 Y128.800 F7860
+G1 X88.657 Y100.437 F6354
+G1 X84.044 Y119.177 F3122
+G1 X120.895 Y121.573 F7602
+G1 X123.954 Y73.269 F8826
+G1 X64.465 Y78.704 F4578
+G1 X122.743 Y122.510 F7128
+G1 X125.149 Y66.021 F6349
+G1 X63.229 Y78.893 F6915
+G1 X139.663 Y108.498 F8457
+G1 X90.110 Y68.482 F7403
+G1 X120.842 Y115.325 F4412
+G1 X61.486 Y124.996 F3121
+G1 X121.994 Y91.408 F4217
+G1 X134.691 Y69.323 F5142
+G1 X126.776 Y119.097 F3062
+G1 X123.239 Y118.546 F5609
+G1 X111.190 Y104.313 F7169
+G1 X63.487 Y60.063 F3755
+G1 X91.000 Y119.131 F7776
+G1 X71.839 Y69.532 F8894
+G1 X96.499 Y73.778 F5005
+G1 X117.785 Y101.973 F4605
+G1 X109.127 Y85.795 F5358
+G1 X66.177 Y65.454 F3910
+G1 X87.264 Y83.103 F8050
+G1 X130.645 Y125.660 F4541
+G1 X62.446 Y76.712 F6070
+G1 X133.572 Y103.974 F8583
+G1 X106.505 Y116.997 F4388
+G1 X138.054 Y113.778 F4889
+G1 X120.650 Y110.984 F6435
+G1 X105.325 Y95.153 F6162
+G1 X105.038 Y108.890 F5480
+G1 X65.170 Y62.814 F5795
+G1 X95.707 Y111.160 F8659
+G1 X90.045 Y102.648 F6632
+G1 X108.794 Y128.420 F8091
+G1 X113.986 Y70.960 F8019
+G1 X127.439 Y128.795 F8475
+G1 X73.221 Y129.287 F4591
+G1 X107.622 Y115.475 F4213
+G1 X90.281 Y80.861 F3177
+G1 X77.849 Y115.849 F4104
+G1 X85.858 Y64.952 F5807
+G1 X100.057 Y126.857 F4811
+G1 X74.394 Y85.067 F7420
+G1 X79.821 Y93.036 F6741
+G1 X97.676 Y98.173 F3418
+G1 X117.572 Y97.930 F6221
+G1 X93.127 Y81.299 F8045
+G1 X88.323 Y123.539 F5311
+G1 X89.812 Y70.791 F3451
+G1 X128.232 Y61.022 F3969
+G1 X111.847 Y61.755 F4403
+G1 X110.845 Y61.155 F5921
+G1 X104.551 Y107.030 F8855
+G1 X103.122 Y109.663 F6512
+G1 X116.606 Y96.848 F4298
+G1 X65.775 Y100.682 F4383
+G1 X64.815 Y120.291 F4203
+G1 X129.131 Y93.474 F4426
+G1 X88.613 Y93.440 F6796
+G1 X64.999 Y98.233 F8520
+G1 X78.019 Y69.699 F5251
+G1 X70.510 Y114.719 F8042
+G1 X74.572 Y84.018 F3538
+G1 X86.856 Y82.897 F5735
+G1 X121.694 Y72.623 F4025
+G1 X117.579 Y109.879 F4716
+G1 X107.971 Y69.656 F5216
+G1 X73.450 Y79.272 F7459
+G1 X111.688 Y103.485 F8128
+G1 X71.710 Y63.409 F3022
+G1 X117.426 Y95.860 F7055
+G1 X74.615 Y114.837 F7100
+G1 X70.335 Y72.451 F6936
+G1 X94.530 Y119.038 F7214
+G1 X138.173 Y89.393 F6374
+G1 X83.647 Y77.108 F5268
+G1 X105.078 Y95.718 F7155
+G1 X138.772 Y79.314 F4969
+G1 X108.590 Y81.710 F8665
+G1 X88.912 Y118.014 F8618
+G1 X115.382 Y74.710 F8498
+G1 X91.522 Y70.925 F3536
+G1 X62.148 Y123.544 F8168
+G1 X102.985 Y97.325 F4291
+G1 X66.762 Y124.660 F5581
+G1 X79.143 Y79.797 F8168
+G1 X113.142 Y85.524 F6712
+G1 X114.799 Y81.755 F6377
+G1 X130.806 Y78.984 F6705
+G1 X88.728 Y90.713 F3612
+G1 X65.790 Y90.674 F6207
+G1 X109.274 Y87.490 F4085
+G1 X138.501 Y72.795 F6763
+G1 X103.088 Y106.688 F5208
+G1 X119.445 Y89.077 F6493
+G1 X69.214 Y97.270 F3865
+G1 X124.857 Y129.745 F3915
+G1 X61.874 Y77.914 F3584
+G1 X138.101 Y110.957 F4945
+G1 X76.146 Y113.892 F4281
+G1 X81.825 Y106.545 F5914
+G1 X100.567 Y63.830 F7401
+G1 X73.884 Y95.813 F3455
+G1 X91.292 Y61.701 F7900
+G1 X91.588 Y121.783 F6018
+G1 X136.147 Y83.026 F4178
+G1 X61.646 Y108.944 F5941
+G1 X73.602 Y66.850 F8335
+G1 X137.014 Y110.660 F7864
+G1 X137.311 Y98.134 F4561
+M400
@@ -0,0 +1,147 @@
+# Encodes a G-code file as the frames of BINARY_PROTOCOL (Tuna/binary_protocol.hpp), and compares how many moves per
+# second the serial port carries as frames and as ASCII lines.
+#
+#   ruby encode.rb print.gcode                    # writes print.bin
+#   ruby encode.rb -o out.bin -p 32 print.gcode   # frames of up to 32 bytes of payload (BINARY_FRAME_SIZE)
+#   ruby encode.rb -n print.gcode                 # only the comparison
+#
+# Comments and blank lines are dropped, as the firmware drops them. A G0/G1 becomes a move when all it has is X Y Z E F,
+# each with a value that is whole in its units (1/1000; E 1/100000). Anything else is sent as its text. The frames run
+# from sequence 0, as after M935 S1, and each takes as many records as its payload fits. The simulator runs the output
+# with -x, and models the serial port for both with -L. An M935 S0 ends its frame, and the rest of the file follows the
+# frames as the ASCII lines it is, as the host would send it once the printer is back on text.
+#
+# ASCII lines are counted as a host streams them, with a line number and a checksum: "N<n> <command>*<checksum>\n".
+# Every byte takes 10 bits on the wire (8N1). What the printer sends back is not counted.
+
+$SYNC = 0xF5
+$TEXT_RECORD = 0x40
+$RAPID_BIT = 5
+$PARAMS = "XYZEF"
+$SCALES = [1000, 1000, 1000, 100000, 1000]
+$MAX_CMD_SIZE = 64
+$BAUDS = [115200, 250000]
+
+$payload_size = 64
+$output = nil
+$write = true
+
+args = ARGV.dup
+input = nil
+while (arg = args.shift)
+	if (arg == "-o" && args.length != 0)
+		$output = args.shift
+	elsif (arg == "-p" && args.length != 0)
+		$payload_size = Integer(args.shift)
+		raise ArgumentError.new("the payload must be 16 to 250 bytes") if (!(16..250).include?($payload_size))
+	elsif (arg == "-n")
+		$write = false
+	elsif (arg.start_with?("-") || input)
+		raise ArgumentError.new("usage: encode.rb [-o output] [-p payload] [-n] file.gcode")
+	else
+		input = arg
+	end
+end
+raise ArgumentError.new("usage: encode.rb [-o output] [-p payload] [-n] file.gcode") if (!input)
+$output ||= input.sub(/\.[^.\/]*\z/, "") + ".bin"
+$text_size = [$payload_size - 2, $MAX_CMD_SIZE - 1].min
+
+# avr-libc's _crc_ccitt_update.
+def crc_ccitt_update(crc, data)
+	data = (data ^ crc) & 0xFF
+	data = (data ^ (data << 4)) & 0xFF
+	return (((data << 8) | (crc >> 8)) ^ (data >> 4) ^ (data << 3)) & 0xFFFF
+end
+
+def varint(value)
+	bytes = []
+	loop {
+		byte = value & 0x7F
+		value >>= 7
+		if (value == 0)
+			bytes << byte
+			return bytes
+		end
+		bytes << (byte | 0x80)
+	}
+end
+
+# The parameters of a G0/G1 in their units, as [header, values], or nil if it has to go as text.
+def move_params(command)
+	words = command.split(" ")
+	return nil if (words.shift !~ /\AG0*([01])\z/)
+	header = ($1 == "0") ? (1 << $RAPID_BIT) : 0
+	values = []
+	words.each { |word|
+		index = $PARAMS.index(word[0])
+		return nil if (!index || header & (1 << index) != 0)
+		return nil if (word[1..-1] !~ /\A([+-]?)(\d*)(?:\.(\d*))?\z/ || ($2.empty? && $3.to_s.empty?))
+		value = Rational($1 + ($2.empty? ? "0" : $2) + "." + ($3.to_s.empty? ? "0" : $3)) * $SCALES[index]
+		return nil if (value.denominator != 1 || value.abs >= 2**31)
+		header |= 1 << index
+		values[index] = value.to_i
+	}
+	return [header, values]
+end
+
+last = [0] * $PARAMS.length
+records = []
+text = []
+commands = moves = ascii_bytes = text_bytes = 0
+File.foreach(input) { |line|
+	command = line.sub(/;.*/m, "").strip
+	next if (command.empty?)
+	commands += 1
+	ascii = "N#{commands} #{command}"
+	ascii_bytes += ascii.length + "*#{ascii.bytes.reduce(0, :^)}\n".length
+	if (records.last == :flush)
+		text << command
+		text_bytes += ascii.length + "*#{ascii.bytes.reduce(0, :^)}\n".length
+		next
+	end
+
+	params = move_params(command)
+	if (params)
+		header, values = params
+		record = [header]
+		values.each_with_index { |value, i|
+			next if (!value)
+			delta = value - last[i]
+			record += varint(delta >= 0 ? 2 * delta : -2 * delta - 1)
+			last[i] = value
+		}
+		moves += 1
+	else
+		raise RuntimeError.new("#{input}: command too long for a frame: #{command}") if (command.length > $text_size)
+		record = [$TEXT_RECORD, command.length] + command.bytes
+	end
+	records << record
+	records << :flush if (command =~ /\AM935\b.*\sS0*(\s|\z)/)
+}
+
+frames = []
+payload = []
+(records + [:flush]).each { |record|
+	if (record == :flush || payload.length + record.length > $payload_size)
+		frames << payload if (!payload.empty?)
+		payload = []
+	end
+	payload += record if (record != :flush)
+}
+stream = []
+frames.each_with_index { |payload, sequence|
+	frame = [sequence & 0xFF, payload.length] + payload
+	crc = frame.reduce(0xFFFF) { |crc, byte| crc_ccitt_update(crc, byte) }
+	stream += [$SYNC] + frame + [crc & 0xFF, crc >> 8]
+}
+
+File.binwrite($output, stream.pack("C*") + text.map { |command| command + "\n" }.join) if ($write)
+
+def report(name, bytes, commands, moves)
+	rates = $BAUDS.map { |baud| "#{baud} baud: %.0f moves/s" % [moves * baud / 10.0 / [bytes, 1].max] }
+	puts "%-7s %9d bytes, %5.2f bytes/command; %s" % [name, bytes, bytes.to_f / [commands, 1].max, rates.join(", ")]
+end
+
+puts "#{input}: #{commands} commands, #{moves} moves encoded, #{commands - moves} as text; #{frames.length} frames"
+report("ascii:", ascii_bytes, commands, moves)
+report("binary:", stream.length + text_bytes, commands, moves)
@@ -0,0 +1,22 @@
+#pragma once
+
+// Host stand-in for avr-libc's <avr/eeprom.h>. The EEPROM is a plain array defined in Simulator/registers.cpp.
+
+#include <stdint.h>
+#include <stddef.h>
+#include <string.h>
+
+namespace sim
+{
+  extern uint8_t eeprom[4096];
+}
+
+#define EEMEM
+
+inline uint8_t eeprom_read_byte(const uint8_t *addr) { return sim::eeprom[size_t(addr) & 0xFFF]; }
+inline void eeprom_write_byte(uint8_t *addr, uint8_t value) { sim::eeprom[size_t(addr) & 0xFFF] = value; }
+inline void eeprom_update_byte(uint8_t *addr, uint8_t value) { eeprom_write_byte(addr, value); }
+inline void eeprom_read_block(void *dst, const void *src, size_t n) { memcpy(dst, &sim::eeprom[size_t(src) & 0xFFF], n); }
+inline void eeprom_write_block(const void *src, void *dst, size_t n) { memcpy(&sim::eeprom[size_t(dst) & 0xFFF], src, n); }
+inline void eeprom_update_block(const void *src, void *dst, size_t n) { eeprom_write_block(src, dst, n); }
+inline bool eeprom_is_ready() { return true; }
@@ -0,0 +1,16 @@
+#pragma once
+
+// Host stand-in for avr-libc's <avr/interrupt.h>. Vectors are dispatched by the simulator, which keeps SREG_I clear
+// while one runs, and which only preempts the main loop with one (-S) while SREG_I is set. sei and cli are compiler
+// barriers, as on the AVR.
+
+#include <avr/io.h>
+
+#define sei() do { __asm__ __volatile__ ("" ::: "memory"); SREG |= (1 << SREG_I); } while (0)
+#define cli() do { SREG &= ~(1 << SREG_I); __asm__ __volatile__ ("" ::: "memory"); } while (0)
+#define ISR(vector, ...) extern "C" void vector(void)
+#define SIGNAL(vector) extern "C" void vector(void)
+#define ISR_BLOCK
+#define ISR_NOBLOCK
+#define ISR_NAKED
+#define ISR_ALIASOF(v)
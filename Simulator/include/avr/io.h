@@ -0,0 +1,289 @@
+#pragma once
+
+// Host stand-in for avr-libc's <avr/io.h> (ATmega2560).
+//
+// Every I/O register the firmware touches is an ordinary global defined in Simulator/registers.cpp. The output port
+// registers (PORTx) notify the simulator on every write so that step/direction edges can be traced, as do writes to the
+// input registers (PINx), which toggle the port bits written as ones, as on the hardware. TCNT0 advances
+// the simulated clock whenever it is read (so that step pulse busy-waits terminate), and TCNT1 reports the number of
+// timer ticks that have elapsed since the current compare match - that is, the modeled cost of the ISR so far.
+// UCSR0A reports UDRE0 and TXC0 from the modeled transmitter, and advances the clock as TCNT0 does; bytes written to
+// UDR0 are transmitted.
+
+#include <stdint.h>
+
+namespace sim
+{
+  enum class port : uint8_t { A, B, C, D, E, F, G, H, J, K, L, count };
+
+  // How a port was written: a value stored, a read-modify-write (|=, &=, ^=), or bits toggled through PINx.
+  enum class port_write : uint8_t { store, modify, toggle };
+
+  void port_written(port which, uint8_t previous, uint8_t value, port_write how);
+  uint8_t read_tcnt0();
+  uint16_t read_tcnt1();
+  void write_tcnt1(uint16_t value);
+  uint8_t read_ucsr0a();
+  void write_udr0(uint8_t value);
+
+  class port_register final
+  {
+    const port m_Port;
+    uint8_t m_Value = 0;
+
+    inline void set(uint8_t value, port_write how)
+    {
+      const uint8_t previous = m_Value;
+      m_Value = value;
+      if (previous != value)
+      {
+        port_written(m_Port, previous, value, how);
+      }
+    }
+
+  public:
+    constexpr port_register(port which) : m_Port(which) {}
+    port_register(const port_register &) = delete;
+
+    constexpr port id() const { return m_Port; }
+
+    inline operator uint8_t () const { return m_Value; }
+    inline port_register & operator = (uint8_t value) { set(value, port_write::store); return *this; }
+    inline port_register & operator |= (uint8_t value) { set(m_Value | value, port_write::modify); return *this; }
+    inline port_register & operator &= (uint8_t value) { set(m_Value & value, port_write::modify); return *this; }
+    inline port_register & operator ^= (uint8_t value) { set(m_Value ^ value, port_write::modify); return *this; }
+    inline void toggle(uint8_t value) { set(m_Value ^ value, port_write::toggle); }
+  };
+
+  class pin_register final
+  {
+    volatile uint8_t m_Value = 0;       // Input levels, set by the simulator. First, so the register's address is its own.
+    port_register &m_Port;
+
+  public:
+    pin_register(port_register &port) : m_Port(port) {}
+    pin_register(const pin_register &) = delete;
+
+    inline volatile uint8_t * levels() { return &m_Value; }
+
+    inline operator volatile uint8_t & () { return m_Value; }
+    inline pin_register & operator = (uint8_t value) { m_Port.toggle(value); return *this; }
+  };
+
+  struct tcnt0_register final
+  {
+    inline operator uint8_t () const { return read_tcnt0(); }
+    inline tcnt0_register & operator = (uint8_t) { return *this; }
+  };
+
+  struct tcnt1_register final
+  {
+    inline operator uint16_t () const { return read_tcnt1(); }
+    inline tcnt1_register & operator = (uint16_t value) { write_tcnt1(value); return *this; }
+  };
+
+  class ucsr0a_register final
+  {
+    uint8_t m_Control = 0;              // U2X0 and MPCM0. The flags are the transmitter's; writing TXC0 has no effect.
+
+  public:
+    inline operator uint8_t () const { return uint8_t(read_ucsr0a() | m_Control); }
+    inline ucsr0a_register & operator = (uint8_t value) { m_Control = value & 0x03; return *this; }
+    inline ucsr0a_register & operator |= (uint8_t value) { return *this = uint8_t(m_Control | value); }
+    inline ucsr0a_register & operator &= (uint8_t value) { return *this = uint8_t(m_Control & value); }
+  };
+
+  // Only transmits: the simulator hands received bytes to the firmware itself.
+  struct udr0_register final
+  {
+    inline operator uint8_t () const { return 0; }
+    inline udr0_register & operator = (uint8_t value) { write_udr0(value); return *this; }
+  };
+}
+
+#define _SIM_PORT(X) \
+  extern sim::port_register PORT ## X; \
+  extern sim::pin_register PIN ## X; \
+  extern volatile uint8_t DDR ## X; \
+  enum : uint8_t { \
+    PIN ## X ## 0 = 0, PIN ## X ## 1, PIN ## X ## 2, PIN ## X ## 3, PIN ## X ## 4, PIN ## X ## 5, PIN ## X ## 6, PIN ## X ## 7, \
+    P ## X ## 0 = 0, P ## X ## 1, P ## X ## 2, P ## X ## 3, P ## X ## 4, P ## X ## 5, P ## X ## 6, P ## X ## 7, \
+    DD ## X ## 0 = 0, DD ## X ## 1, DD ## X ## 2, DD ## X ## 3, DD ## X ## 4, DD ## X ## 5, DD ## X ## 6, DD ## X ## 7 \
+  };
+
+_SIM_PORT(A)
+_SIM_PORT(B)
+_SIM_PORT(C)
+_SIM_PORT(D)
+_SIM_PORT(E)
+_SIM_PORT(F)
+_SIM_PORT(G)
+_SIM_PORT(H)
+_SIM_PORT(J)
+_SIM_PORT(K)
+_SIM_PORT(L)
+
+#undef _SIM_PORT
+
+extern volatile uint8_t SREG;
+#define SREG_I 7
+
+extern sim::tcnt0_register TCNT0;
+extern sim::tcnt1_register TCNT1;
+extern sim::ucsr0a_register UCSR0A;
+extern sim::udr0_register UDR0;
+
+extern volatile uint8_t
+  TCCR0A, TCCR0B, OCR0A, OCR0B, TIMSK0, TIFR0,
+  TCCR1A, TCCR1B, TCCR1C, TIMSK1, TIFR1,
+  TCCR2A, TCCR2B, TCNT2, OCR2A, OCR2B, TIMSK2, TIFR2, ASSR,
+  TCCR3A, TCCR3B, TCCR3C, TIMSK3, TIFR3,
+  TCCR4A, TCCR4B, TCCR4C, TIMSK4, TIFR4,
+  TCCR5A, TCCR5B, TCCR5C, TIMSK5, TIFR5,
+  OCR3AL, OCR3BL, OCR3CL, OCR4AL, OCR4BL, OCR4CL, OCR5AL, OCR5BL, OCR5CL,
+  ADCSRA, ADCSRB, ADMUX, DIDR0, DIDR2, ADCL, ADCH,
+  PCICR, PCIFR, PCMSK0, PCMSK1, PCMSK2, EICRA, EICRB, EIMSK, EIFR,
+  SPCR, SPSR, SPDR, TWCR, TWSR, TWBR, TWDR, TWAR,
+  UCSR0B, UCSR0C, UBRR0H, UBRR0L,
+  UCSR1A, UCSR1B, UCSR1C, UDR1, UBRR1H, UBRR1L,
+  UCSR2A, UCSR2B, UCSR2C, UDR2, UBRR2H, UBRR2L,
+  UCSR3A, UCSR3B, UCSR3C, UDR3, UBRR3H, UBRR3L,
+  EECR, EEDR, MCUSR, MCUCR, WDTCSR, GPIOR0, SMCR, PRR0, PRR1;
+
+extern volatile uint16_t
+  OCR1A, OCR1B, OCR1C, ICR1,
+  TCNT3, OCR3A, OCR3B, OCR3C, ICR3,
+  TCNT4, OCR4A, OCR4B, OCR4C, ICR4,
+  TCNT5, OCR5A, OCR5B, OCR5C, ICR5,
+  ADC, ADCW, EEAR, UBRR0, UBRR1, UBRR2, UBRR3;
+
+// Timer bits
+enum : uint8_t
+{
+  WGM00 = 0, WGM01 = 1, COM0B0 = 4, COM0B1 = 5, COM0A0 = 6, COM0A1 = 7,
+  CS00 = 0, CS01 = 1, CS02 = 2, WGM02 = 3,
+  TOIE0 = 0, OCIE0A = 1, OCIE0B = 2,
+  TOV0 = 0, OCF0A = 1, OCF0B = 2,
+
+  WGM10 = 0, WGM11 = 1, COM1C0 = 2, COM1C1 = 3, COM1B0 = 4, COM1B1 = 5, COM1A0 = 6, COM1A1 = 7,
+  CS10 = 0, CS11 = 1, CS12 = 2, WGM12 = 3, WGM13 = 4,
+  TOIE1 = 0, OCIE1A = 1, OCIE1B = 2, OCIE1C = 3, ICIE1 = 5,
+  TOV1 = 0, OCF1A = 1, OCF1B = 2, OCF1C = 3, ICF1 = 5,
+
+  WGM20 = 0, WGM21 = 1, COM2B0 = 4, COM2B1 = 5, COM2A0 = 6, COM2A1 = 7,
+  CS20 = 0, CS21 = 1, CS22 = 2, WGM22 = 3,
+  TOIE2 = 0, OCIE2A = 1, OCIE2B = 2,
+
+  WGM30 = 0, WGM31 = 1, COM3C0 = 2, COM3C1 = 3, COM3B0 = 4, COM3B1 = 5, COM3A0 = 6, COM3A1 = 7,
+  CS30 = 0, CS31 = 1, CS32 = 2, WGM32 = 3, WGM33 = 4,
+  WGM40 = 0, WGM41 = 1, COM4C0 = 2, COM4C1 = 3, COM4B0 = 4, COM4B1 = 5, COM4A0 = 6, COM4A1 = 7,
+  CS40 = 0, CS41 = 1, CS42 = 2, WGM42 = 3, WGM43 = 4,
+  WGM50 = 0, WGM51 = 1, COM5C0 = 2, COM5C1 = 3, COM5B0 = 4, COM5B1 = 5, COM5A0 = 6, COM5A1 = 7,
+  CS50 = 0, CS51 = 1, CS52 = 2, WGM52 = 3, WGM53 = 4,
+};
+
+// ADC bits
+enum : uint8_t
+{
+  ADPS0 = 0, ADPS1 = 1, ADPS2 = 2, ADIE = 3, ADIF = 4, ADATE = 5, ADSC = 6, ADEN = 7,
+  MUX0 = 0, MUX1 = 1, MUX2 = 2, MUX3 = 3, MUX4 = 4, ADLAR = 5, REFS0 = 6, REFS1 = 7,
+  MUX5 = 3,
+};
+
+// External/pin change interrupt bits
+enum : uint8_t
+{
+  PCIE0 = 0, PCIE1 = 1, PCIE2 = 2,
+  PCIF0 = 0, PCIF1 = 1, PCIF2 = 2,
+  PCINT0 = 0, PCINT1, PCINT2, PCINT3, PCINT4, PCINT5, PCINT6, PCINT7,
+  PCINT8 = 0, PCINT9, PCINT10, PCINT11, PCINT12, PCINT13, PCINT14, PCINT15,
+  PCINT16 = 0, PCINT17, PCINT18, PCINT19, PCINT20, PCINT21, PCINT22, PCINT23,
+  INT0 = 0, INT1, INT2, INT3, INT4, INT5, INT6, INT7,
+  ISC00 = 0, ISC01, ISC10, ISC11, ISC20, ISC21, ISC30, ISC31,
+  ISC40 = 0, ISC41, ISC50, ISC51, ISC60, ISC61, ISC70, ISC71,
+};
+
+// USART bits
+enum : uint8_t
+{
+  MPCM0 = 0, U2X0 = 1, UPE0 = 2, DOR0 = 3, FE0 = 4, UDRE0 = 5, TXC0 = 6, RXC0 = 7,
+  TXB80 = 0, RXB80 = 1, UCSZ02 = 2, TXEN0 = 3, RXEN0 = 4, UDRIE0 = 5, TXCIE0 = 6, RXCIE0 = 7,
+  UCPOL0 = 0, UCSZ00 = 1, UCSZ01 = 2, USBS0 = 3, UPM00 = 4, UPM01 = 5, UMSEL00 = 6, UMSEL01 = 7,
+  U2X1 = 1, UDRE1 = 5, TXC1 = 6, RXC1 = 7, TXEN1 = 3, RXEN1 = 4, UDRIE1 = 5, RXCIE1 = 7,
+  U2X2 = 1, UDRE2 = 5, TXC2 = 6, RXC2 = 7, TXEN2 = 3, RXEN2 = 4, UDRIE2 = 5, RXCIE2 = 7,
+  U2X3 = 1, UDRE3 = 5, TXC3 = 6, RXC3 = 7, TXEN3 = 3, RXEN3 = 4, UDRIE3 = 5, RXCIE3 = 7,
+};
+
+// SPI/TWI/EEPROM/misc bits
+enum : uint8_t
+{
+  SPR0 = 0, SPR1 = 1, CPHA = 2, CPOL = 3, MSTR = 4, DORD = 5, SPE = 6, SPIE = 7,
+  SPI2X = 0, WCOL = 6, SPIF = 7,
+  TWIE = 0, TWEN = 2, TWWC = 3, TWSTO = 4, TWSTA = 5, TWEA = 6, TWINT = 7,
+  EERE = 0, EEPE = 1, EEMPE = 2, EERIE = 3,
+  PORF = 0, EXTRF = 1, BORF = 2, WDRF = 3, JTRF = 4,
+  WDP0 = 0, WDP1 = 1, WDP2 = 2, WDE = 3, WDCE = 4, WDP3 = 5, WDIE = 6, WDIF = 7,
+  SE = 0, SM0 = 1, SM1 = 2, SM2 = 3,
+};
+
+// avr-libc defines registers as macros, and the firmware tests for their presence.
+#define TCCR0A TCCR0A
+#define TCCR0B TCCR0B
+#define TCCR1A TCCR1A
+#define TCCR1B TCCR1B
+#define TCCR2A TCCR2A
+#define TCCR2B TCCR2B
+#define TCCR3A TCCR3A
+#define TCCR3B TCCR3B
+#define TCCR4A TCCR4A
+#define TCCR4B TCCR4B
+#define TCCR4C TCCR4C
+#define TCCR5A TCCR5A
+#define TCCR5B TCCR5B
+#define TCNT0 TCNT0
+#define TIMSK0 TIMSK0
+#define ADCSRA ADCSRA
+#define ADCSRB ADCSRB
+#define ADCL ADCL
+#define UCSR0B UCSR0B
+#define UBRR0H UBRR0H
+#define UBRR1H UBRR1H
+#define UBRR2H UBRR2H
+#define UBRR3H UBRR3H
+#define WGM01 WGM01
+#define WGM10 WGM10
+#define WGM20 WGM20
+#define WGM30 WGM30
+#define WGM40 WGM40
+#define WGM50 WGM50
+#define TOIE0 TOIE0
+#define CS00 CS00
+#define CS01 CS01
+#define CS10 CS10
+#define CS11 CS11
+#define CS22 CS22
+#define CS31 CS31
+#define CS41 CS41
+#define CS51 CS51
+#define MUX5 MUX5
+#define COM0A1 COM0A1
+#define COM0B1 COM0B1
+#define COM1A1 COM1A1
+#define COM1B1 COM1B1
+#define COM1C1 COM1C1
+#define COM2A1 COM2A1
+#define COM2B1 COM2B1
+#define COM3A1 COM3A1
+#define COM3B1 COM3B1
+#define COM3C1 COM3C1
+#define COM4A1 COM4A1
+#define COM4B1 COM4B1
+#define COM4C1 COM4C1
+#define COM5A1 COM5A1
+#define COM5B1 COM5B1
+#define COM5C1 COM5C1
+
+#define RAMEND 0x21FF
+#define E2END 0xFFF
+#define FLASHEND 0x3FFFF
+#define SPM_PAGESIZE 256
@@ -0,0 +1,17 @@
+#pragma once
+
+// Force-included into every simulator translation unit. Provides what avr-gcc and avr-libc supply implicitly to the
+// firmware, which a host compiler does not.
+
+#include <math.h>
+
+// avr-gcc's native 24-bit integer types. The host has none, so they are widened to 32 bits (see tunalib/types.hpp).
+typedef unsigned int __uint24;
+typedef signed int __int24;
+
+// Have tunalib's __assume check its condition, and report it here (validate.cpp) instead of taking it for granted.
+#define __checked_assume 1
+void __assume_failed(const char *expression, const char *file, int line);
+
+// avr-libc's <math.h> extension.
+static inline float square(float x) { return x * x; }
@@ -0,0 +1,130 @@
+#pragma once
+
+// Simulator core: the simulated clock, Timer1 compare-match dispatch and the step/direction trace.
+
+#include <stdint.h>
+#include <stdio.h>
+
+struct block_t;
+
+namespace sim
+{
+  // CPU clock. Timer1 and Timer0 both run at F_CPU / 8 (2MHz on a 16MHz part).
+  constexpr uint32_t cpu_hz = 16'000'000;
+  constexpr uint32_t timer_prescale = 8;
+
+  enum class motor : uint8_t { X, Y, Z, E, count };
+
+  struct motor_stats final
+  {
+    int64_t position = 0;          // In steps, as observed on the step/direction pins.
+    uint64_t steps = 0;
+    uint64_t direction_changes = 0;
+    uint64_t last_step_cycle = 0;
+    uint64_t min_step_interval = UINT64_MAX; // In cycles. Gives the peak step rate.
+  };
+
+  struct isr_stats final
+  {
+    uint64_t calls = 0;
+    uint64_t cycles = 0;           // Total modeled cycles spent inside the ISR.
+    uint64_t max_cycles = 0;
+    uint64_t clamped = 0;          // Exits where OCR1A was at or within 16 ticks of TCNT1 (the "don't run faster" clamp).
+    uint64_t missed = 0;           // Exits where OCR1A had already been passed; the hardware would wrap all of Timer1.
+    uint64_t idle = 0;             // Calls made without a block to execute while more G-code was still pending.
+    uint64_t advance_calls = 0;    // LIN_ADVANCE ISR calls (counted with ISR_PROFILING only).
+    uint64_t event_calls = 0;      // Calls that only stepped, without a ramp update (MULTI_RATE_STEPPING with ISR_PROFILING).
+    uint64_t step_writes = 0;      // Port (or PINx toggle) writes that changed at least one step pin, either edge.
+    uint64_t step_cycles = 0;      // The cycles those writes take on the AVR, by the instructions they compile to.
+    uint64_t preempted = 0;        // Calls made from the host timer, wherever the main loop was (-S).
+    uint64_t deferred = 0;         // Host timer signals that found interrupts disabled, or the stepper ISR off.
+  };
+
+  struct endstop_stats final
+  {
+    uint32_t hits = 0;             // Moves into the endstop that the stepper stopped.
+    uint32_t missed = 0;           // Moves into the endstop that ran to their end instead.
+    uint64_t steps = 0;            // Steps taken from the edge until the move stopped, over all hits.
+    uint64_t max_steps = 0;
+    uint64_t cycles = 0;           // From the edge to the start of the ISR that saw it, over all hits.
+    uint64_t max_cycles = 0;
+  };
+
+  struct validation_stats final
+  {
+    uint32_t blocks = 0;           // Blocks picked up by the stepper ISR.
+    uint32_t idle_checks = 0;      // Checks made with everything stepped.
+    uint32_t aborted = 0;          // Blocks cut short by an endstop.
+    uint32_t dropped = 0;          // Blocks discarded unstepped after a quick stop.
+    uint32_t failures = 0;         // Failed checks, including failed assumptions.
+    uint32_t assumptions = 0;      // Failed __assume statements.
+  };
+
+  struct config final
+  {
+    FILE *trace = nullptr;         // Step/direction trace output; null disables tracing.
+    uint32_t isr_cycles = 350;     // Modeled fixed cost of one Timer1 ISR, charged at entry.
+    uint32_t event_cycles = 200;   // Modeled cost of a Timer1 ISR that only steps, instead of isr_cycles
+                                   // (MULTI_RATE_STEPPING with ISR_PROFILING).
+    uint32_t plan_cycles = 16000;  // Modeled main-loop time consumed per G-code line, during which ISRs keep running.
+    FILE *blocks = nullptr;        // Per-block trapezoid dump, written as each block is picked up; null disables it.
+    FILE *profile = nullptr;       // Velocity profile output; null disables it.
+    uint32_t profile_cycles = cpu_hz / 200; // Width of one velocity profile sample.
+    bool plan_only = false;        // Never run the stepper ISR; blocks are discarded as soon as the planner needs room.
+    float spectrum_from = 0.0f;    // Frequencies (Hz) at which to report the X and Y position spectrum; none if 0.
+    float spectrum_to = 0.0f;
+    float spectrum_step = 1.0f;
+    uint32_t preempt_seed = 0;     // Seed of the random host timer that preempts the main loop with stepper ISRs; 0 disables it.
+    uint32_t serial_baud = 0;      // USART0 transmits at this rate (-T); 0 disables the transmitter.
+  };
+
+  extern config settings;
+  extern motor_stats motors[uint8_t(motor::count)];
+  extern isr_stats stepper_isr;
+  extern endstop_stats endstop_latency[3];
+  extern validation_stats validation;
+  extern bool input_pending;
+
+  // Current simulated time, in CPU cycles.
+  uint64_t now();
+
+  // Map the firmware's step/direction/endstop pins. Called once at startup, before Stepper::init.
+  void bind_pins();
+
+  // Run the simulated machine until the given cycle, dispatching every Timer1 compare match that falls before it.
+  void run_until(uint64_t cycle);
+
+  // Run until the next stepper ISR (or, if the ISR is disabled, for one millisecond).
+  void step_once();
+
+  // A byte the firmware sent is out of USART0 by 'cycle', and read by the host (simulator.cpp).
+  void serial_received(uint8_t c, uint64_t cycle);
+
+  // Start and stop the host timer that runs stepper ISRs wherever the main loop is (-S).
+  void start_preemption();
+  void stop_preemption();
+
+  // Whether the stepper ISR running now was started by the host timer, and so may have stopped the main loop anywhere.
+  bool isr_preempted_main();
+
+  // Write one line of the block dump for a block about to be executed.
+  void dump_block(const block_t *block);
+
+  // Check the positions after a stepper ISR that picked up, ended or dropped a block (validate.cpp), from where they
+  // were before it.
+  void validate_isr_enter();
+  void validate_isr();
+
+  // Check the positions once everything buffered has been stepped.
+  void validate_idle();
+
+  // The positions are about to be lost, as by a quick stop, or were just set, as by G92 or homing.
+  void position_lost();
+  void position_set();
+
+  // Write out the last, partial velocity profile sample.
+  void flush_profile();
+
+  // Write the human-readable summary.
+  void report(FILE *out);
+}
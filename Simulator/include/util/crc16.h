@@ -0,0 +1,13 @@
+#pragma once
+
+// Host stand-in for avr-libc's <util/crc16.h>: the C equivalents given in its documentation.
+
+#include <stdint.h>
+
+// CRC-CCITT, reflected (polynomial 0x8408), as used by PPP and IrDA. Start from 0xFFFF.
+static inline uint16_t _crc_ccitt_update(uint16_t crc, uint8_t data)
+{
+  data ^= uint8_t(crc);
+  data ^= uint8_t(data << 4);
+  return uint16_t(((uint16_t(data) << 8) | (crc >> 8)) ^ uint8_t(data >> 4) ^ (uint16_t(data) << 3));
+}
@@ -0,0 +1,6 @@
+#pragma once
+
+// Host stand-in for avr-libc's <util/delay.h>. Busy-wait delays take no simulated time.
+
+#define _delay_ms(ms)
+#define _delay_us(us)
@@ -0,0 +1,848 @@
+// Fake ATmega2560 register file and the simulated clock.
+//
+// Timer1 is modeled as it is configured by Stepper::init: CTC mode on OCR1A at F_CPU / 8. Each compare match calls
+// TIMER1_COMPA_vect synchronously. The time spent inside the ISR is modeled as a fixed entry cost plus 8 cycles for
+// every read of TCNT0 (which is what the step pulse busy-waits spin on), so reads of TCNT1 inside the ISR observe the
+// ISR's own cost exactly as the firmware's "don't run faster than possible" clamp expects.
+//
+// Built with ISR_PROFILING, the firmware's own profiler counts the LIN_ADVANCE ISR calls made by each compare match,
+// and each is charged a modeled cost of its own, after the handler returns.
+//
+// The X and Y steps can be summed into a position spectrum (-F), for comparing builds or settings of INPUT_SHAPING.
+//
+// Endstop pins follow the motor positions on every step. With ENDSTOP_INTERRUPTS_FEATURE, a change on a pin whose pin
+// change interrupt is enabled calls that interrupt's handler right after the stepper ISR returns.
+//
+// Built with MULTI_RATE_STEPPING as well, an interrupt is charged only event_cycles at entry. The rest of isr_cycles is
+// charged as soon as the profiler's path shows that it does more than step (a ramp update, no block...), before the
+// handler reads TCNT1 for its clamp.
+//
+// Writes to an input register (PINx) toggle the port bits written as ones, as on the hardware, and go through the same
+// edge detection as port writes. Every write that changes a step pin is counted, so BATCHED_STEP_PULSES (one toggle per
+// port for all the axes stepping) can be compared against a write per axis, and so are the cycles the AVR takes for it,
+// by the instruction the write compiles to (port_write_cycles). The masks a batched write is built from are not
+// counted.
+//
+// Interrupts run with the I bit of SREG clear, as on the hardware. With -S, a host timer signals every 1 to 40us (of
+// host time, at random) and runs the next stepper ISR wherever the main loop is, unless the I bit is clear: the
+// planner then gets interrupted at any instruction, as on the printer, instead of only where it waits.
+//
+// With -T, USART0 transmits at the -L baud rate, 10 bits a byte: UDR0 takes a byte once the one before it has moved on
+// to the shift register, and each byte is handed to the simulated host once it is out. Built with SERIAL_TX_LANES, the
+// data register empty interrupt runs whenever it is enabled and UDR0 is free, between stepper ISRs; its own cost is not
+// charged. Reading UCSR0A costs a microsecond, during which interrupts run if enabled, so busy-waits on it end.
+
+#include <tuna.h>
+
+#include "stepper.h"
+#include "endstops.h"
+#include "isr_profile.hpp"
+
+#include <sim/simulator.h>
+
+#include <math.h>
+#include <signal.h>
+#include <time.h>
+#include <vector>
+
+extern "C" void TIMER1_COMPA_vect(void);
+#if ENABLED(SERIAL_TX_LANES)
+  extern "C" void USART0_UDRE_vect(void);
+#endif
+#if ENABLED(ENDSTOP_INTERRUPTS_FEATURE)
+  extern "C" void PCINT0_vect(void);
+  extern "C" void PCINT1_vect(void);
+  extern "C" void PCINT2_vect(void);
+#endif
+
+#define _SIM_PORT_DEFINE(X) \
+  sim::port_register PORT ## X { sim::port::X }; \
+  sim::pin_register PIN ## X { PORT ## X }; \
+  volatile uint8_t DDR ## X;
+
+_SIM_PORT_DEFINE(A)
+_SIM_PORT_DEFINE(B)
+_SIM_PORT_DEFINE(C)
+_SIM_PORT_DEFINE(D)
+_SIM_PORT_DEFINE(E)
+_SIM_PORT_DEFINE(F)
+_SIM_PORT_DEFINE(G)
+_SIM_PORT_DEFINE(H)
+_SIM_PORT_DEFINE(J)
+_SIM_PORT_DEFINE(K)
+_SIM_PORT_DEFINE(L)
+
+#undef _SIM_PORT_DEFINE
+
+volatile uint8_t SREG;
+
+sim::tcnt0_register TCNT0;
+sim::tcnt1_register TCNT1;
+sim::ucsr0a_register UCSR0A;
+sim::udr0_register UDR0;
+
+volatile uint8_t
+  TCCR0A, TCCR0B, OCR0A, OCR0B, TIMSK0, TIFR0,
+  TCCR1A, TCCR1B, TCCR1C, TIMSK1, TIFR1,
+  TCCR2A, TCCR2B, TCNT2, OCR2A, OCR2B, TIMSK2, TIFR2, ASSR,
+  TCCR3A, TCCR3B, TCCR3C, TIMSK3, TIFR3,
+  TCCR4A, TCCR4B, TCCR4C, TIMSK4, TIFR4,
+  TCCR5A, TCCR5B, TCCR5C, TIMSK5, TIFR5,
+  OCR3AL, OCR3BL, OCR3CL, OCR4AL, OCR4BL, OCR4CL, OCR5AL, OCR5BL, OCR5CL,
+  ADCSRA, ADCSRB, ADMUX, DIDR0, DIDR2, ADCL, ADCH,
+  PCICR, PCIFR, PCMSK0, PCMSK1, PCMSK2, EICRA, EICRB, EIMSK, EIFR,
+  SPCR, SPSR, SPDR, TWCR, TWSR, TWBR, TWDR, TWAR,
+  UCSR0B, UCSR0C, UBRR0H, UBRR0L,
+  UCSR1A, UCSR1B, UCSR1C, UDR1, UBRR1H, UBRR1L,
+  UCSR2A, UCSR2B, UCSR2C, UDR2, UBRR2H, UBRR2L,
+  UCSR3A, UCSR3B, UCSR3C, UDR3, UBRR3H, UBRR3L,
+  EECR, EEDR, MCUSR, MCUCR, WDTCSR, GPIOR0, SMCR, PRR0, PRR1;
+
+volatile uint16_t
+  OCR1A, OCR1B, OCR1C, ICR1,
+  TCNT3, OCR3A, OCR3B, OCR3C, ICR3,
+  TCNT4, OCR4A, OCR4B, OCR4C, ICR4,
+  TCNT5, OCR5A, OCR5B, OCR5C, ICR5,
+  ADC, ADCW, EEAR, UBRR0, UBRR1, UBRR2, UBRR3;
+
+namespace sim
+{
+  uint8_t eeprom[4096];
+
+  config settings;
+  motor_stats motors[uint8_t(motor::count)];
+  isr_stats stepper_isr;
+  endstop_stats endstop_latency[3];
+  bool input_pending = false;
+
+  namespace
+  {
+    uint64_t cycles = 0;
+    uint64_t compare_cycle = 0;      // Cycle of the most recent Timer1 compare match (Timer1 reset to 0 there).
+    #if ENABLED(MULTI_RATE_STEPPING) && ENABLED(ISR_PROFILING)
+      bool isr_cost_pending = false;   // The current interrupt was charged event_cycles, and may owe the rest of isr_cycles.
+
+      void charge_isr_path()
+      {
+        if (isr_cost_pending && Tuna::IsrProfile::stepper_path != Tuna::IsrProfile::path::event)
+        {
+          isr_cost_pending = false;
+          if (settings.isr_cycles > settings.event_cycles)
+          {
+            cycles += settings.isr_cycles - settings.event_cycles;
+          }
+        }
+      }
+    #endif
+    uint64_t next_compare = 0;
+    uint64_t usart_free = 0;         // When the last byte written to UDR0 is out of the shift register (-T).
+
+    uint64_t byte_cycles()
+    {
+      return uint64_t(10) * cpu_hz / settings.serial_baud;
+    }
+
+    // When UDR0 is free for another byte: the one in it has moved on to the shift register.
+    uint64_t udr0_free()
+    {
+      const uint64_t shift = byte_cycles();
+      return (usart_free > shift) ? usart_free - shift : 0;
+    }
+
+    // The data register empty interrupt is enabled, and due by 'cycle'.
+    bool udre_due(uint64_t cycle)
+    {
+      return settings.serial_baud && TEST(UCSR0B, UDRIE0) && max(udr0_free(), cycles) <= cycle;
+    }
+
+    void dispatch_udre()
+    {
+      cycles = max(udr0_free(), cycles);
+      #if ENABLED(SERIAL_TX_LANES)
+        USART0_UDRE_vect();
+      #else
+        UCSR0B &= ~(1 << UDRIE0);
+      #endif
+    }
+
+    struct pin_binding final
+    {
+      port which = port::count;
+      uint8_t mask = 0;
+    };
+
+    struct motor_binding final
+    {
+      pin_binding step, dir;
+      bool step_active;   // Pin level which constitutes a step.
+      bool dir_positive;  // Pin level which indicates positive motion.
+    };
+
+    struct endstop_binding final
+    {
+      volatile uint8_t *pin = nullptr;
+      uint8_t mask = 0;
+      bool inverting = false;
+    };
+
+    // A move running into an endstop, followed until it stops.
+    struct endstop_edge final
+    {
+      bool triggered = false;        // Switch state at the last step.
+      bool watching = false;
+      bool noticed = false;          // The firmware has reported the hit.
+      uint64_t cycle = 0;            // Of the step that reached the switch.
+      uint64_t notice_cycle = 0;     // Start of the ISR that reported it.
+      int64_t position = 0;
+      const block_t *block = nullptr;
+    };
+
+    motor_binding motor_pins[uint8_t(motor::count)];
+    endstop_binding endstop_pins[XYZ];
+    endstop_edge endstop_edges[XYZ];
+    uint8_t pin_changes = 0;         // PCICR bits of the pin change interrupts owed.
+    bool dir_level[uint8_t(motor::count)];
+
+    const char motor_names[] = "XYZE";
+
+    uint64_t profile_sample = 0;     // Index of the velocity profile sample being accumulated.
+    uint32_t profile_steps[uint8_t(motor::count)];
+    bool profile_started = false;
+
+    void write_profile_sample()
+    {
+      const double scale = double(cpu_hz) / settings.profile_cycles;
+      fprintf(settings.profile, "%.3f", double(profile_sample * settings.profile_cycles) * 1000.0 / cpu_hz);
+      for (uint8_t i = 0; i < uint8_t(motor::count); ++i)
+      {
+        fprintf(settings.profile, ",%.0f", profile_steps[i] * scale);
+        profile_steps[i] = 0;
+      }
+      fputc('\n', settings.profile);
+    }
+
+    void profile_step(motor m)
+    {
+      if (!settings.profile)
+      {
+        return;
+      }
+      const uint64_t sample = cycles / settings.profile_cycles;
+      if (!profile_started)
+      {
+        profile_started = true;
+        profile_sample = sample;
+      }
+      // Samples without steps are written too, so stops show up as zero speed.
+      while (profile_sample < sample)
+      {
+        write_profile_sample();
+        ++profile_sample;
+      }
+      ++profile_steps[uint8_t(m)];
+    }
+
+    // Fourier sums of the X and Y steps at each frequency of the position spectrum (-F).
+    struct spectrum_point final
+    {
+      double hz;
+      double re[2], im[2];
+    };
+    std::vector<spectrum_point> spectrum;
+
+    void spectrum_step(motor m, int sign)
+    {
+      const double t = double(cycles) / cpu_hz;
+      for (auto &point : spectrum)
+      {
+        const double phase = 2.0 * M_PI * point.hz * t;
+        point.re[uint8_t(m)] += sign * cos(phase);
+        point.im[uint8_t(m)] -= sign * sin(phase);
+      }
+    }
+
+    void trace(motor m, const char *event)
+    {
+      if (!settings.trace)
+      {
+        return;
+      }
+      fprintf(settings.trace, "%llu,%c,%s,%lld\n",
+        (unsigned long long)cycles, motor_names[uint8_t(m)], event, (long long)motors[uint8_t(m)].position);
+    }
+
+    // PCICR bit of the pin change interrupt an endstop pin has enabled, if any. PJ0 is PCINT9.
+    uint8_t pin_change_group(const endstop_binding &endstop)
+    {
+      if (endstop.pin == PINB.levels())
+      {
+        return (PCMSK0 & endstop.mask) ? uint8_t(1 << PCIE0) : 0;
+      }
+      if (endstop.pin == PINJ.levels())
+      {
+        return (PCMSK1 & uint8_t(endstop.mask << 1)) ? uint8_t(1 << PCIE1) : 0;
+      }
+      if (endstop.pin == PINK.levels())
+      {
+        return (PCMSK2 & endstop.mask) ? uint8_t(1 << PCIE2) : 0;
+      }
+      return 0;
+    }
+
+    void update_endstops()
+    {
+      for (uint8_t i = 0; i < XYZ; ++i)
+      {
+        const auto &endstop = endstop_pins[i];
+        if (!endstop.pin)
+        {
+          continue;
+        }
+        // Endstops sit at step position 0; Marlin treats a pin level differing from 'inverting' as triggered.
+        const bool triggered = motors[i].position <= 0;
+        if (triggered != endstop.inverting)
+        {
+          *endstop.pin |= endstop.mask;
+        }
+        else
+        {
+          *endstop.pin &= ~endstop.mask;
+        }
+
+        auto &edge = endstop_edges[i];
+        if (triggered == edge.triggered)
+        {
+          continue;
+        }
+        edge.triggered = triggered;
+        pin_changes |= pin_change_group(endstop);
+        if (triggered && Stepper::current_block)
+        {
+          edge = { true, true, false, cycles, 0, motors[i].position, Stepper::current_block };
+        }
+      }
+    }
+
+    // Run the pin change interrupts of the endstop edges made by the last stepper ISR.
+    void dispatch_pin_changes()
+    {
+      const uint8_t groups = pin_changes & PCICR;
+      pin_changes = 0;
+      #if ENABLED(ENDSTOP_INTERRUPTS_FEATURE)
+        if (groups & (1 << PCIE0))
+        {
+          PCINT0_vect();
+        }
+        if (groups & (1 << PCIE1))
+        {
+          PCINT1_vect();
+        }
+        if (groups & (1 << PCIE2))
+        {
+          PCINT2_vect();
+        }
+      #else
+        (void)groups;
+      #endif
+    }
+
+    // Follow each move that ran into an endstop until its block is gone, then record how long it took to stop.
+    void watch_endstops()
+    {
+      for (uint8_t i = 0; i < XYZ; ++i)
+      {
+        auto &edge = endstop_edges[i];
+        if (!edge.watching)
+        {
+          continue;
+        }
+        // The firmware reports a hit on an axis with its _MIN bit (X_MIN, Y_MIN and Z_MIN are 0, 1 and 2).
+        if (!edge.noticed && TEST(Endstops::endstop_hit_bits, i))
+        {
+          edge.noticed = true;
+          edge.notice_cycle = compare_cycle;
+        }
+        if (Stepper::current_block == edge.block)
+        {
+          continue;
+        }
+        edge.watching = false;
+        auto &stats = endstop_latency[i];
+        if (!edge.noticed)
+        {
+          ++stats.missed;
+          continue;
+        }
+        const uint64_t steps = uint64_t(llabs(motors[i].position - edge.position));
+        const uint64_t latency = edge.notice_cycle - edge.cycle;
+        ++stats.hits;
+        stats.steps += steps;
+        stats.cycles += latency;
+        stats.max_steps = max(stats.max_steps, steps);
+        stats.max_cycles = max(stats.max_cycles, latency);
+      }
+    }
+
+    void dispatch_stepper_isr()
+    {
+      cycles = next_compare;
+      compare_cycle = cycles;
+      #if ENABLED(MULTI_RATE_STEPPING) && ENABLED(ISR_PROFILING)
+        // Until the handler picks a path, it is taken to be a step event.
+        Tuna::IsrProfile::stepper_path = Tuna::IsrProfile::path::event;
+        isr_cost_pending = true;
+        cycles += min(settings.event_cycles, settings.isr_cycles);
+        const auto &event = Tuna::IsrProfile::path_stats[uint8_t(Tuna::IsrProfile::path::event)];
+        const uint32_t event_before = event.count;
+      #else
+        cycles += settings.isr_cycles;
+      #endif
+
+      if (!Stepper::current_block && input_pending)
+      {
+        ++stepper_isr.idle;
+      }
+
+      update_endstops();
+      validate_isr_enter();
+      const block_t *previous_block = Stepper::current_block;
+      #if ENABLED(ISR_PROFILING)
+        const auto &advance = Tuna::IsrProfile::path_stats[uint8_t(Tuna::IsrProfile::path::advance)];
+        const uint32_t advance_before = advance.count;
+      #endif
+      TIMER1_COMPA_vect();
+      if (Stepper::current_block && Stepper::current_block != previous_block)
+      {
+        dump_block(Stepper::current_block);
+      }
+      validate_isr();
+      dispatch_pin_changes();
+      watch_endstops();
+      #if ENABLED(MULTI_RATE_STEPPING) && ENABLED(ISR_PROFILING)
+        charge_isr_path();
+        isr_cost_pending = false;
+        stepper_isr.event_calls += event.count - event_before;
+      #endif
+      #if ENABLED(ISR_PROFILING)
+        stepper_isr.advance_calls += advance.count - advance_before;
+      #endif
+
+      const uint64_t spent = cycles - compare_cycle;
+      const uint64_t elapsed_ticks = spent / timer_prescale;
+      ++stepper_isr.calls;
+      stepper_isr.cycles += spent;
+      if (spent > stepper_isr.max_cycles)
+      {
+        stepper_isr.max_cycles = spent;
+      }
+
+      const uint16_t ocr = OCR1A;
+      if (ocr < elapsed_ticks)
+      {
+        // The compare value was already passed; Timer1 counts all the way around before matching again.
+        ++stepper_isr.missed;
+        next_compare = compare_cycle + (uint64_t(0x10000) + ocr + 1) * timer_prescale;
+      }
+      else
+      {
+        if (ocr <= elapsed_ticks + 16)
+        {
+          ++stepper_isr.clamped;
+        }
+        next_compare = compare_cycle + (uint64_t(ocr) + 1) * timer_prescale;
+      }
+    }
+
+    bool stepper_isr_enabled()
+    {
+      return !settings.plan_only && TEST(TIMSK1, OCIE1A);
+    }
+
+    timer_t preemption_timer;
+    bool preempting = false;
+    bool in_timer_isr = false;
+    uint32_t preemption_random;
+
+    void arm_preemption()
+    {
+      // xorshift32
+      uint32_t x = preemption_random;
+      x ^= x << 13;
+      x ^= x >> 17;
+      x ^= x << 5;
+      preemption_random = x;
+      itimerspec when = {};
+      when.it_value.tv_nsec = long(1000 + x % 39001);
+      timer_settime(preemption_timer, 0, &when, nullptr);
+    }
+
+    void preempt(int)
+    {
+      if (TEST(SREG, SREG_I) && stepper_isr_enabled())
+      {
+        ++stepper_isr.preempted;
+        in_timer_isr = true;
+        step_once();
+        in_timer_isr = false;
+      }
+      else
+      {
+        ++stepper_isr.deferred;
+      }
+      arm_preemption();
+    }
+
+    // The cycles a port write takes on the AVR, by the instruction it compiles to. Ports A to G are in the I/O space:
+    // sbi or cbi for a single bit (2), in, and or or, out otherwise (3), and out for a value or a toggle (1). H to L
+    // are not: lds, and or or, sts (5), inside the critical section fastio takes for them (in SREG, cli, out SREG: 3),
+    // and sts for a value or a toggle (2).
+    uint8_t port_write_cycles(const port which, const uint8_t changed, const port_write how)
+    {
+      const bool io_space = which <= port::G;
+      if (how != port_write::modify)
+      {
+        return io_space ? 1 : 2;
+      }
+      if (!io_space)
+      {
+        return 8;
+      }
+      return (changed & (changed - 1)) ? 3 : 2;
+    }
+  }
+
+  uint64_t now()
+  {
+    return cycles;
+  }
+
+  uint8_t read_tcnt0()
+  {
+    // A busy-wait iteration costs roughly one Timer0 tick.
+    cycles += timer_prescale;
+    return uint8_t(cycles / timer_prescale);
+  }
+
+  uint8_t read_ucsr0a()
+  {
+    const uint64_t until = cycles + cpu_hz / 1'000'000;
+    if (TEST(SREG, SREG_I))
+    {
+      run_until(until);
+    }
+    else
+    {
+      cycles = until;
+    }
+    if (!settings.serial_baud)
+    {
+      return (1 << UDRE0) | (1 << TXC0);
+    }
+    return ((udr0_free() <= cycles) ? (1 << UDRE0) : 0) | ((usart_free <= cycles) ? (1 << TXC0) : 0);
+  }
+
+  void write_udr0(uint8_t value)
+  {
+    if (!settings.serial_baud)
+    {
+      return;
+    }
+    usart_free = max(usart_free, cycles) + byte_cycles();
+    serial_received(value, usart_free);
+  }
+
+  uint16_t read_tcnt1()
+  {
+    #if ENABLED(MULTI_RATE_STEPPING) && ENABLED(ISR_PROFILING)
+      charge_isr_path();
+    #endif
+    return uint16_t((cycles - compare_cycle) / timer_prescale);
+  }
+
+  void write_tcnt1(uint16_t value)
+  {
+    compare_cycle = cycles - uint64_t(value) * timer_prescale;
+    next_compare = compare_cycle + (uint64_t(OCR1A) + 1) * timer_prescale;
+  }
+
+  void port_written(port which, uint8_t previous, uint8_t value, port_write how)
+  {
+    const uint8_t changed = previous ^ value;
+
+    for (uint8_t i = 0; i < uint8_t(motor::count); ++i)
+    {
+      if (motor_pins[i].step.which == which && (changed & motor_pins[i].step.mask))
+      {
+        ++stepper_isr.step_writes;
+        stepper_isr.step_cycles += port_write_cycles(which, changed, how);
+        break;
+      }
+    }
+
+    for (uint8_t i = 0; i < uint8_t(motor::count); ++i)
+    {
+      const auto &binding = motor_pins[i];
+      auto &stats = motors[i];
+
+      if (binding.dir.which == which && (changed & binding.dir.mask))
+      {
+        dir_level[i] = bool(value & binding.dir.mask);
+        ++stats.direction_changes;
+        trace(motor(i), (dir_level[i] == binding.dir_positive) ? "dir+" : "dir-");
+      }
+
+      if (binding.step.which == which && (changed & binding.step.mask) && bool(value & binding.step.mask) == binding.step_active)
+      {
+        stats.position += (dir_level[i] == binding.dir_positive) ? 1 : -1;
+        ++stats.steps;
+        if (stats.steps > 1)
+        {
+          const uint64_t interval = cycles - stats.last_step_cycle;
+          if (interval < stats.min_step_interval)
+          {
+            stats.min_step_interval = interval;
+          }
+        }
+        stats.last_step_cycle = cycles;
+        trace(motor(i), "step");
+        profile_step(motor(i));
+        if (i < 2 && !spectrum.empty())
+        {
+          spectrum_step(motor(i), (dir_level[i] == binding.dir_positive) ? 1 : -1);
+        }
+        if (i < XYZ)
+        {
+          update_endstops();
+        }
+      }
+    }
+  }
+
+  void bind_pins()
+  {
+    #define _SIM_PIN(IO) pin_binding { (DIO ## IO ## _WPORT).id(), uint8_t(1 << (DIO ## IO ## _PIN)) }
+    #define SIM_PIN(IO) _SIM_PIN(IO)
+    #define SIM_MOTOR(M, AXIS, INVERT_STEP, INVERT_DIR) \
+      motor_pins[uint8_t(motor::M)] = { SIM_PIN(AXIS ## _STEP_PIN), SIM_PIN(AXIS ## _DIR_PIN), !(INVERT_STEP), !(INVERT_DIR) }
+
+    SIM_MOTOR(X, X, INVERT_X_STEP_PIN, INVERT_X_DIR);
+    SIM_MOTOR(Y, Y, INVERT_Y_STEP_PIN, INVERT_Y_DIR);
+    SIM_MOTOR(Z, Z, INVERT_Z_STEP_PIN, INVERT_Z_DIR);
+    SIM_MOTOR(E, E0, INVERT_E_STEP_PIN, INVERT_E0_DIR);
+
+    #define _SIM_ENDSTOP(IO, INVERTING) endstop_binding { (DIO ## IO ## _RPORT).levels(), uint8_t(1 << (DIO ## IO ## _PIN)), INVERTING }
+    #define SIM_ENDSTOP(IO, INVERTING) _SIM_ENDSTOP(IO, INVERTING)
+
+    #if HAS_X_MIN
+      endstop_pins[X_AXIS] = SIM_ENDSTOP(X_MIN_PIN, X_MIN_ENDSTOP_INVERTING);
+    #endif
+    #if HAS_Y_MIN
+      endstop_pins[Y_AXIS] = SIM_ENDSTOP(Y_MIN_PIN, Y_MIN_ENDSTOP_INVERTING);
+    #endif
+    #if HAS_Z_MIN
+      endstop_pins[Z_AXIS] = SIM_ENDSTOP(Z_MIN_PIN, Z_MIN_ENDSTOP_INVERTING);
+    #endif
+
+    #undef SIM_ENDSTOP
+    #undef _SIM_ENDSTOP
+    #undef SIM_MOTOR
+    #undef SIM_PIN
+    #undef _SIM_PIN
+
+    for (uint8_t i = 0; i < uint8_t(motor::count); ++i)
+    {
+      dir_level[i] = motor_pins[i].dir_positive;
+    }
+
+    if (settings.spectrum_from > 0.0f)
+    {
+      for (float hz = settings.spectrum_from; hz <= settings.spectrum_to + settings.spectrum_step * 0.5f; hz += settings.spectrum_step)
+      {
+        spectrum.push_back({ hz, { 0.0, 0.0 }, { 0.0, 0.0 } });
+      }
+    }
+  }
+
+  void run_until(uint64_t cycle)
+  {
+    Tuna::critical_section _critsec;
+    for (;;)
+    {
+      const bool stepper_due = stepper_isr_enabled() && next_compare <= cycle;
+      if (udre_due(stepper_due ? next_compare : cycle))
+      {
+        dispatch_udre();
+      }
+      else if (stepper_due)
+      {
+        dispatch_stepper_isr();
+      }
+      else
+      {
+        break;
+      }
+    }
+    if (cycles < cycle)
+    {
+      cycles = cycle;
+    }
+  }
+
+  void step_once()
+  {
+    Tuna::critical_section _critsec;
+    if (stepper_isr_enabled())
+    {
+      if (next_compare < cycles)
+      {
+        next_compare = cycles;
+      }
+      while (udre_due(next_compare))
+      {
+        dispatch_udre();
+      }
+      dispatch_stepper_isr();
+    }
+    else
+    {
+      const uint64_t until = cycles + cpu_hz / 1000;
+      while (udre_due(until))
+      {
+        dispatch_udre();
+      }
+      cycles = until;
+    }
+  }
+
+  void start_preemption()
+  {
+    preemption_random = settings.preempt_seed;
+    struct sigaction action = {};
+    action.sa_handler = preempt;
+    action.sa_flags = SA_RESTART;
+    sigemptyset(&action.sa_mask);
+    sigaction(SIGALRM, &action, nullptr);
+    sigevent event = {};
+    event.sigev_notify = SIGEV_SIGNAL;
+    event.sigev_signo = SIGALRM;
+    if (timer_create(CLOCK_MONOTONIC, &event, &preemption_timer) != 0)
+    {
+      perror("timer_create");
+      exit(1);
+    }
+    preempting = true;
+    arm_preemption();
+  }
+
+  bool isr_preempted_main()
+  {
+    return in_timer_isr;
+  }
+
+  void stop_preemption()
+  {
+    if (!preempting)
+    {
+      return;
+    }
+    preempting = false;
+    signal(SIGALRM, SIG_IGN);
+    timer_delete(preemption_timer);
+  }
+
+  void flush_profile()
+  {
+    if (settings.profile && profile_started)
+    {
+      write_profile_sample();
+    }
+  }
+
+  void dump_block(const block_t *block)
+  {
+    if (!settings.blocks)
+    {
+      return;
+    }
+    fprintf(settings.blocks, "%lu,%lu,%lu,%lu,%lu,%lu,%lu\n",
+      (unsigned long)block->step_event_count, (unsigned long)block->nominal_rate,
+      (unsigned long)block->initial_rate, (unsigned long)block->final_rate,
+      (unsigned long)block->accelerate_until, (unsigned long)block->decelerate_after,
+      (unsigned long)block->acceleration_rate);
+  }
+
+  void report(FILE *out)
+  {
+    const double seconds = double(cycles) / cpu_hz;
+    fprintf(out, "simulated time: %.6f s (%llu cycles)\n", seconds, (unsigned long long)cycles);
+    for (uint8_t i = 0; i < uint8_t(motor::count); ++i)
+    {
+      const auto &stats = motors[i];
+      // Two steps in the same cycle have no rate: the peak is then reported as coincident.
+      char peak[32] = "coincident";
+      if (stats.min_step_interval != 0)
+      {
+        const double peak_rate = (stats.min_step_interval != UINT64_MAX) ? double(cpu_hz) / stats.min_step_interval : 0.0;
+        snprintf(peak, sizeof(peak), "%.0f steps/s", peak_rate);
+      }
+      fprintf(out, "%c: position %lld steps, %llu steps, %llu direction changes, peak %s\n",
+        motor_names[i], (long long)stats.position, (unsigned long long)stats.steps,
+        (unsigned long long)stats.direction_changes, peak);
+    }
+    fprintf(out, "stepper isr: %llu calls, mean %.1f cycles, max %llu cycles, %llu clamped, %llu missed, %llu starved\n",
+      (unsigned long long)stepper_isr.calls,
+      stepper_isr.calls ? double(stepper_isr.cycles) / stepper_isr.calls : 0.0,
+      (unsigned long long)stepper_isr.max_cycles,
+      (unsigned long long)stepper_isr.clamped,
+      (unsigned long long)stepper_isr.missed,
+      (unsigned long long)stepper_isr.idle);
+    if (settings.preempt_seed)
+    {
+      fprintf(out, "preemption: %llu stepper ISRs run from the host timer, %llu held off with interrupts disabled\n",
+        (unsigned long long)stepper_isr.preempted, (unsigned long long)stepper_isr.deferred);
+    }
+    uint64_t steps = 0;
+    for (const auto &stats : motors)
+    {
+      steps += stats.steps;
+    }
+    fprintf(out, "step pin writes: %llu for %llu steps (%.2f per step), %llu cycles (%.2f per step)\n",
+      (unsigned long long)stepper_isr.step_writes, (unsigned long long)steps,
+      steps ? double(stepper_isr.step_writes) / steps : 0.0, (unsigned long long)stepper_isr.step_cycles,
+      steps ? double(stepper_isr.step_cycles) / steps : 0.0);
+    #if ENABLED(ISR_PROFILING)
+      fprintf(out, "advance isr: %llu calls\n", (unsigned long long)stepper_isr.advance_calls);
+    #endif
+    #if ENABLED(ISR_PROFILING)
+      fprintf(out, "endstop polls: %lu interrupts between steps\n",
+        (unsigned long)Tuna::IsrProfile::path_stats[uint8_t(Tuna::IsrProfile::path::split)].count);
+    #endif
+    for (uint8_t i = 0; i < XYZ; ++i)
+    {
+      const auto &stats = endstop_latency[i];
+      if (!stats.hits && !stats.missed)
+      {
+        continue;
+      }
+      fprintf(out, "%c endstop: %lu hits, %lu missed, stopped %.1f steps (max %llu) and %.1f us (max %.1f) after the edge\n",
+        motor_names[i], (unsigned long)stats.hits, (unsigned long)stats.missed,
+        stats.hits ? double(stats.steps) / stats.hits : 0.0, (unsigned long long)stats.max_steps,
+        stats.hits ? double(stats.cycles) * 1e6 / cpu_hz / stats.hits : 0.0, double(stats.max_cycles) * 1e6 / cpu_hz);
+    }
+    if (!spectrum.empty())
+    {
+      fprintf(out, "position spectrum (mm*s):\n");
+      for (const auto &point : spectrum)
+      {
+        const double omega = 2.0 * M_PI * point.hz;
+        fprintf(out, "  %7.2f Hz: X %.4e Y %.4e\n", point.hz,
+          hypot(point.re[0], point.im[0]) / omega * planner.steps_to_mm[X_AXIS],
+          hypot(point.re[1], point.im[1]) / omega * planner.steps_to_mm[Y_AXIS]);
+      }
+    }
+    #if ENABLED(MULTI_RATE_STEPPING) && ENABLED(ISR_PROFILING)
+      fprintf(out, "step events: %llu calls without a ramp update, modeled at %u cycles\n",
+        (unsigned long long)stepper_isr.event_calls, (unsigned)min(settings.event_cycles, settings.isr_cycles));
+    #endif
+  }
+}
@@ -0,0 +1,1949 @@
+// Host-native motion simulator.
+//
+// Drives the firmware's own Planner, Stepper and Endstops against the fake register layer in registers.cpp, and
+// writes a timestamped step/direction trace for a G-code file:
+//
+//   simulator [options] <file.gcode>
+//     -o <file>         write the trace to <file> (default: stdout)
+//     -n                do not write a trace; only print the summary
+//     -i <cycles>       modeled fixed cost of one stepper ISR (default 350)
+//     -p <cycles>       modeled main-loop time per G-code line (default 16000)
+//     -B <file>         write the trapezoid of every block to <file> as it is picked up
+//     -v <file>         write the velocity profile to <file>, in 5ms samples
+//     -s <lines>:<ms>   stall the input for <ms> after every <lines> lines, as a host or SD card read might
+//     -b                plan only: never run the stepper ISR, discard blocks as soon as the planner needs room, and
+//                       report the host time spent planning. Implies -n.
+//     -F <hz>[:<to>:<step>]  report the spectrum of the X and Y motor positions at <hz>, or from <hz> to <to>
+//     -r <file>         compare each M933 dump with the next one in <file>, as logged from the printer (needs
+//                       STEP_RECORDING)
+//     -R <file>         write each M933 dump to <file>, as the printer would (needs STEP_RECORDING)
+//     -S <seed>         stress the planner/stepper handoff: run stepper ISRs from a host timer, at random points of the
+//                       main loop, as well as where it waits
+//     -x                the input is binary frames, as encode.rb writes them, up to an M935 S0 (needs BINARY_PROTOCOL)
+//     -L <baud>[:<max>] model the serial port the input streams through, at <baud>; with BAUD_SWITCHING, bytes at a rate
+//                       above <max> arrive with framing errors
+//     -T <ms>[:<lines>] with -L, model the port's output as well: an "ok" for every command, a temperature report
+//                       every <ms> (none if 0), and <lines> debug lines with each report (not with -x)
+//     -P                time the command path only: queue, parse and read every command, with nothing planned
+//     -C                after the run, time the curve tracer alone on its G5 curves, against the float subdivision it
+//                       replaced (needs BEZIER_CURVE_SUPPORT)
+//     -A                check the line assembler against crafted byte streams, instead of running a file (needs
+//                       RX_LINE_ASSEMBLER)
+//
+// The trace is CSV: cycle,motor,event,position. 'cycle' is in 16MHz CPU cycles, 'event' is 'step', 'dir+' or 'dir-',
+// and 'position' is the motor position in steps after the event, as observed on the pins. The summary is written to
+// stderr.
+//
+// The velocity profile is CSV: ms,X,Y,Z,E, with the speed of each motor in steps/s averaged over the sample starting at
+// 'ms'. Two stepper builds (e.g. with and without S_CURVE_ACCELERATION) can be compared by plotting their profiles.
+//
+// The block dump is CSV: steps,nominal_rate,initial_rate,final_rate,accelerate_until,decelerate_after,acceleration_rate.
+// Two planner builds (e.g. with and without PLANNER_FIXED_POINT) can be compared by diffing their dumps. With -b, the
+// planner always works against a full buffer, which is its worst case; the time reported is host time, and is only
+// meaningful relative to another build run on the same host.
+//
+// Built with PLANNER_PROFILING, the summary also reports how many blocks the planner visited per new segment, built
+// with SEGMENT_MERGING, how many moves were merged, built with STEPPER_RAMP_CACHE, the ramp cache's hit rates (as
+// M934), and built with ARC_SUPPORT, how many arcs were planned natively (NATIVE_ARCS) or as segments. A NATIVE_ARCS
+// build and a plain ARC_SUPPORT build can be checked against each other by comparing their traces of the same arcs.
+//
+// Built with BEZIER_CURVE_SUPPORT, G5 curves are planned by the firmware's cubic_b_spline, and the summary reports how
+// many segments they took and, unless -b, how far the exact curve strays from them at worst (in mm, sampled 16384 times
+// per curve). With -b, the segments/s reported then measure the curve tracer and the planner together. With -C, the
+// run's curves are traced again by bezier_tracer alone, and by the float subdivision it replaced, and the summary
+// reports the segments, the deviation and the host time per segment of each.
+//
+// Endstops sit at step position 0 of their motor. For every move that runs into one, the summary reports how many steps
+// the motor took, and how long it was, from the step that reached the switch until the move stopped. Built with
+// ENDSTOP_INTERRUPTS_FEATURE, an endstop pin change calls its pin change interrupt right after the stepper ISR that made
+// it, as the hardware would; the endstop pins then have to be moved onto pin change interrupt pins, as with
+// -DX_STOP_PIN=10 -DY_STOP_PIN=11 -DZ_STOP_PIN=12.
+//
+// Built with ISR_PROFILING, the summary also counts the LIN_ADVANCE ISR calls, so two advance implementations can be
+// compared on the same G-code; what a call costs is only measured on the board (M930). Built with MULTI_RATE_STEPPING
+// as well, the interrupts that only step, without updating the speed ramp, are charged -e cycles instead of -i, and
+// counted.
+//
+// The position spectrum (-F) is |P(f)| of each motor's stepped position over the whole run, in mm*s: the Fourier sum of
+// its steps, divided by 2*pi*f. Built with INPUT_SHAPING, the spectrum of a run should be notched at the frequency set
+// with M593, compared with the same run with shaping disabled (M593 F0): with D0, |P(f)| drops to the timing error of
+// the step trains. Damping widens the notch, and leaves its bottom at |1 - K| / (1 + K) for ZV.
+//
+// Built with STEP_RECORDING, M933 records the stepper ISR's step stream as the firmware does. With -r, each M933 dump is
+// compared with the next dump in the log of the same G-code run on the printer: from the first block each has a header
+// for, or, once a ring has wrapped (M933 S2), back from the last entry of each. Intervals, step_loops and advance
+// offsets that differ come from the planner math; clamp flags come from the ISR scheduling, which the simulator only
+// models. For the two to line up, arm and dump the record at a standstill (after M400). Two builds can be compared the
+// same way, with -R from one and -r into the other.
+//
+// Every run is validated as it goes (validate.cpp): unless -b, each block must move its axes by exactly its steps, and
+// the planner's position must match the stepper's count plus what is still buffered, at every block pickup and every
+// time the stepper runs dry. The firmware's __assume statements are checked as well, instead of being left to the
+// optimizer. Failures are reported with the simulated time they happened at, and the summary counts them; the exit
+// status is then 3. Feed and flow overrides (M220, M221), G92 and quick stops (M410) mid-print exercise the paths that
+// rebase or drop positions. validate.rb runs a whole corpus of G-code files and summarizes them.
+//
+// The planner hands blocks to the stepper ISR without critical sections, which only shows when the ISR lands in the
+// middle of planning. With -S, a host timer fires every 1 to 40us (at random, from <seed>) and runs the next stepper ISR
+// right there, unless interrupts are disabled, so a run exercises the handoff at thousands of points; the validation
+// then also catches a block picked up while the planner was rewriting it, or rewritten while it ran. The summary counts
+// the ISRs the timer ran, and the signals held off by a critical section. Runs with the same seed are not repeatable,
+// as the timer runs in host time.
+//
+// With -L, each command reaches the main loop only once its bytes are through the serial port, as a host streams them:
+// ASCII lines with a line number and a checksum, or, with -x, frames, shared evenly between their records. The host
+// only sends a command once one of the BUFSIZE before it has left the command queue. The summary reports how long the
+// main loop waited for input; a port too slow for the moves shows as stepper ISRs starved. Built with BINARY_PROTOCOL,
+// a G-code file and its encoding (-x) trace identically.
+//
+// Built with RX_LINE_ASSEMBLER, each command is numbered and summed as a host sends it, fed byte by byte to the USART0
+// receive interrupt's LineAssembler, and run as the line it finishes. Every line is checked against what was sent, cut
+// at MAX_CMD_SIZE - 1 characters as the firmware cuts it; lines that differ count as validation failures. A line that
+// was cut (as long G5s are) would be resent forever on the printer, so the summary counts it, and it runs as read.
+// -A checks what a host does not send: blank lines, comments, escapes, overlong lines, a full ring, and bytes the USART
+// flags as overrun or in error. The exit status is then 3 if any stream was assembled differently than expected.
+//
+// Built with BAUD_SWITCHING, an M938 B<baud> with -L runs as loop runs it: the host waits for its "ok", and both ends
+// move to the new rate, through the firmware's BaudSwitch. The next numbered line confirms it. A line sent at a rate the
+// link does not carry (above -L's <max>) is lost in framing errors: the firmware goes back to the rate before once
+// M938's timeout is up, the host with it, and the host sends the line again. A rate the link carries that goes
+// unconfirmed, one it does not that is confirmed, and the two ends at different rates at the end count as validation
+// failures; the summary counts the switches, the confirmations, the fallbacks and the lines sent again.
+//
+// With -T as well, the firmware answers every command with an "ok" (as ADVANCED_OK words it), which the host waits for
+// before it sends another BUFSIZE ahead, and reports temperatures every <ms> (as M155 would), each followed by <lines>
+// lines of Log::d. Without SERIAL_TX_LANES, all of it goes through HardwareSerial's ring of SERIAL_TX_BUFFER_SIZE, and
+// the main loop waits while it is full; built with it, through the firmware's SerialTx, with the reports on the status
+// lane and the logs on the debug lane, sent by the data register empty interrupt (registers.cpp). The summary reports
+// the lines the host read, how long each "ok" took to reach it, and how long the main loop waited for room.
+//
+// Built with PREPARSED_COMMANDS, commands go through the firmware's CommandQueue, kept full as loop keeps it, and the
+// summary reports how deep it got. The trace is the same as without. With -P, the file is run through the command path
+// alone, over and over for a second: queued, loaded into the parser and read as a move's handler reads it (or parsed
+// from a slot, without PREPARSED_COMMANDS), and the summary reports commands/s and the queue's RAM and depth.
+//
+// Only motion commands are interpreted (G0-G5, G28, G90-G92, M82-M83, M201, M203-M205, M220, M221, M400, M410, M593,
+// M933, M935 and M938); everything else is accepted and ignored. Heaters, fans and the LCD are not simulated, and the
+// serial port is only modeled with -L.
+
+#include <tuna.h>
+
+#include "planner.h"
+#include "stepper.h"
+#include "endstops.h"
+#include "gcode.h"
+#include "thermal/thermal.hpp"
+#if ENABLED(ARC_SUPPORT)
+  #include "planner_arc.h"
+#endif
+#if ENABLED(BEZIER_CURVE_SUPPORT)
+  #include "planner_bezier.h"
+  #include "bezier_tracer.hpp"
+#endif
+#if ENABLED(STEP_RECORDING)
+  #include "step_record.hpp"
+#endif
+#if ENABLED(BINARY_PROTOCOL)
+  #include "binary_protocol.hpp"
+#endif
+#if ENABLED(PREPARSED_COMMANDS)
+  #include "command_queue.hpp"
+#endif
+#if ENABLED(RX_LINE_ASSEMBLER)
+  #include "line_assembler.hpp"
+#endif
+#if ENABLED(SERIAL_TX_LANES)
+  #include "serial_tx.hpp"
+#endif
+#if ENABLED(BAUD_SWITCHING)
+  #include "baud_switch.hpp"
+#endif
+#include <deque>
+#include <string>
+#include <vector>
+
+#include <sim/simulator.h>
+
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+// Firmware state normally owned by Marlin_main.cpp.
+float current_position[XYZE] = { 0.0 };
+bool axis_homed[XYZ] = { false }, axis_known_position[XYZ] = { false };
+int16_t feedrate_percentage = 100;
+int16_t flow_percentage[EXTRUDERS] = { 100 };
+float volumetric_multiplier[EXTRUDERS] = { 1.0 };
+uint8 fanSpeeds[FAN_COUNT] = { 0 };
+
+namespace
+{
+  float feedrate_mm_s = 1500.0f / 60.0f;
+  bool relative_mode = false;
+  bool relative_e = false;
+  uint32_t unhandled = 0;
+  uint32_t segments = 0;
+  unsigned long stall_lines = 0, stall_ms = 0, lines = 0;
+
+  // -L: the serial port.
+  uint32_t link_baud = 0;
+  uint64_t link_free = 0;               // When the port is through with what was sent before
+  uint64_t link_left[BUFSIZE] = {};     // When the last BUFSIZE commands left the queue, by command number
+  uint64_t link_waited = 0;             // Cycles the main loop waited for input
+  uint64_t link_bytes = 0;
+  uint32_t link_commands = 0;
+  #if ENABLED(BAUD_SWITCHING)
+    uint32_t link_max = 0;              // The fastest rate the link carries; 0 for any
+    uint32_t baud_switches = 0, baud_confirmed = 0, baud_fallbacks = 0, baud_resent = 0, baud_unsupported = 0;
+  #endif
+
+  // -T: the port's output.
+  bool serial_out = false;
+  uint32_t report_ms = 0;               // Temperature reports every report_ms; none if 0
+  uint32_t report_debug_lines = 0;      // Log::d lines after each report
+  uint64_t next_report = 0;
+  uint32_t oks_read = 0;                // By the host
+  std::deque<uint64_t> oks_sent;        // When each "ok" the host has not read yet was written
+  uint64_t ok_latency = 0, ok_latency_max = 0;
+  uint32_t status_lines = 0, debug_lines = 0;
+  uint64_t serial_bytes = 0;
+  char host_line[MAX_CMD_SIZE * 2];
+  uint32_t host_line_length = 0;
+  #if DISABLED(SERIAL_TX_LANES)
+    // HardwareSerial: SERIAL_TX_BUFFER_SIZE - 1 bytes in the ring, one in UDR0 and one in the shift register.
+    uint64_t ring_free = 0;             // When the last byte written is out
+    uint32_t ring_stalls = 0;           // Writes that waited for room
+    uint64_t ring_stall_cycles = 0;
+  #endif
+  #if ENABLED(ARC_SUPPORT)
+    uint32_t native_arcs = 0, segmented_arcs = 0;
+  #endif
+  #if ENABLED(BEZIER_CURVE_SUPPORT)
+    uint32_t curves = 0, curve_segments = 0;
+    float curve_path[1025][2];          // The segment ends of the current curve, from its start
+    uint16_t curve_points = 0;          // 0 unless a curve is being traced
+    double curve_deviation = 0.0;
+    constexpr uint32_t curve_samples = 16384;
+    double curve_sample[curve_samples + 1][2];
+
+    struct traced_curve final
+    {
+      float control[3][2];              // The control points and the end point, relative to the start point
+    };
+    bool time_curves = false;           // -C
+    std::vector<traced_curve> timed_curves;
+  #endif
+
+  #if ENABLED(STEP_RECORDING)
+    // One line of an M933 dump.
+    struct record_line final
+    {
+      bool block;
+      uint32_t value;                   // step_event_count of a block, or the interval of a ramp update
+      uint32_t step_loops;
+      int32_t advance;
+      bool clamped;
+    };
+
+    FILE *record_log = nullptr;         // -r
+    FILE *record_out = nullptr;         // -R
+    bool record_header_read = false;    // The log's next "Step record:" line has been read already
+    uint32_t record_dumps = 0, record_compared = 0, record_blocks = 0, record_unmatched = 0;
+    uint32_t record_intervals = 0, record_loops = 0, record_advances = 0, record_misaligned = 0;
+    uint32_t record_log_clamped = 0, record_sim_clamped = 0;
+    char record_first[200] = "";
+
+    bool parse_record_line(const char *line, record_line &r)
+    {
+      r = {};
+      if (line[0] == 'B') {
+        r.block = true;
+        return sscanf(line + 1, "%u", &r.value) == 1;
+      }
+      char flag[4] = "";
+      if (line[0] != 'S' || sscanf(line + 1, "%u %u %d %3s", &r.value, &r.step_loops, &r.advance, flag) < 3) return false;
+      r.clamped = flag[0] == 'C';
+      return true;
+    }
+
+    // The next dump in the log, and whether the ring had wrapped, or false at its end.
+    bool read_log_dump(std::vector<record_line> &dump, bool &wrapped)
+    {
+      char line[256];
+      while (!record_header_read)
+      {
+        if (!fgets(line, sizeof(line), record_log)) return false;
+        record_header_read = !strncmp(line, "Step record:", 12);
+      }
+      record_header_read = false;
+      unsigned entries;
+      unsigned long dropped = 0;
+      sscanf(line + 12, "%u entries, %lu dropped", &entries, &dropped);
+      wrapped = dropped != 0;
+      while (fgets(line, sizeof(line), record_log))
+      {
+        if (!strncmp(line, "Step record:", 12)) {
+          record_header_read = true;
+          break;
+        }
+        record_line r;
+        if (parse_record_line(line, r)) dump.push_back(r);
+      }
+      return true;
+    }
+
+    void format_record_line(char *out, size_t size, const record_line *r)
+    {
+      if (!r) snprintf(out, size, "(none)");
+      else if (r->block) snprintf(out, size, "B%u", r->value);
+      else snprintf(out, size, "S%u %u %d%s", r->value, r->step_loops, r->advance, r->clamped ? " C" : "");
+    }
+
+    // As gcode_M933 dumping, and compared with the next dump in the log.
+    void compare_record()
+    {
+      Tuna::StepRecord::recording = Tuna::StepRecord::mode::stopped;
+      std::vector<record_line> simulated, logged;
+      for (uint16_t i = 0; i < Tuna::StepRecord::recorded; ++i)
+      {
+        const auto &e = Tuna::StepRecord::entries[(Tuna::StepRecord::head - Tuna::StepRecord::recorded + i) & (Tuna::StepRecord::size - 1)];
+        if (e.step_loops == Tuna::StepRecord::block_marker)
+          simulated.push_back({ true, (uint32_t(uint16_t(e.advance)) << 16) | e.interval, 0, 0, false });
+        else
+          simulated.push_back({ false, e.interval, uint32_t(e.step_loops & ~Tuna::StepRecord::clamped_flag), e.advance, (e.step_loops & Tuna::StepRecord::clamped_flag) != 0 });
+      }
+      if (record_out)
+      {
+        fprintf(record_out, "Step record: %u entries, %lu dropped%s\n", unsigned(Tuna::StepRecord::recorded),
+          (unsigned long)Tuna::StepRecord::dropped, Tuna::StepRecord::full ? ", full" : "");
+        for (const record_line &r : simulated)
+        {
+          char text[64];
+          format_record_line(text, sizeof(text), &r);
+          fprintf(record_out, "%s\n", text);
+        }
+      }
+      bool wrapped;
+      if (!record_log || !read_log_dump(logged, wrapped)) return;
+      ++record_dumps;
+
+      // Both from their first block header; or, if either ring wrapped, both to their last entry.
+      const auto first_block = [](const std::vector<record_line> &v) {
+        size_t i = 0;
+        while (i < v.size() && !v[i].block) ++i;
+        return i;
+      };
+      size_t s, l;
+      if (wrapped || Tuna::StepRecord::dropped)
+      {
+        const size_t common = min(simulated.size(), logged.size());
+        s = simulated.size() - common;
+        l = logged.size() - common;
+      }
+      else
+      {
+        s = first_block(simulated);
+        l = first_block(logged);
+      }
+      record_unmatched += s + l;
+      for (; s < simulated.size() && l < logged.size(); ++s, ++l)
+      {
+        const record_line &a = logged[l], &b = simulated[s];
+        ++record_compared;
+        record_log_clamped += a.clamped;
+        record_sim_clamped += b.clamped;
+        bool differs;
+        if (a.block || b.block)
+        {
+          differs = a.block != b.block || a.value != b.value;
+          record_misaligned += differs;
+          record_blocks += !differs;
+        }
+        else
+        {
+          record_intervals += a.value != b.value;
+          record_loops += a.step_loops != b.step_loops;
+          record_advances += a.advance != b.advance;
+          differs = a.value != b.value || a.step_loops != b.step_loops || a.advance != b.advance;
+        }
+        if (differs && !record_first[0])
+        {
+          char la[64], sa[64];
+          format_record_line(la, sizeof(la), &a);
+          format_record_line(sa, sizeof(sa), &b);
+          snprintf(record_first, sizeof(record_first), "dump %u entry %u: logged %s, simulated %s", record_dumps, unsigned(l), la, sa);
+        }
+      }
+      record_unmatched += (simulated.size() - s) + (logged.size() - l);
+    }
+  #endif
+
+  const char axis_codes[XYZE] = { 'X', 'Y', 'Z', 'E' };
+
+  void usage(const char *self)
+  {
+    fprintf(stderr, "usage: %s [-o trace.csv] [-n] [-i isr_cycles] [-e event_cycles] [-p plan_cycles] [-B blocks.csv] [-v profile.csv] [-s lines:ms] [-b] [-F hz[:to:step]] [-r record.log] [-R record.log] [-S seed] [-x] [-L baud[:max]] [-T ms[:lines]] [-P] [-C] [-A] <file.gcode>\n", self);
+    exit(2);
+  }
+
+  void reset_settings()
+  {
+    // As MarlinSettings::reset.
+    static const float steps_per_mm[] = DEFAULT_AXIS_STEPS_PER_UNIT, max_feedrate[] = DEFAULT_MAX_FEEDRATE;
+    static const uint32 max_acceleration[] = DEFAULT_MAX_ACCELERATION;
+    LOOP_XYZE_N(i) {
+      planner.axis_steps_per_mm[i] = steps_per_mm[i < COUNT(steps_per_mm) ? i : COUNT(steps_per_mm) - 1];
+      planner.max_feedrate_mm_s[i] = max_feedrate[i < COUNT(max_feedrate) ? i : COUNT(max_feedrate) - 1];
+      planner.max_acceleration_mm_per_s2[i] = max_acceleration[i < COUNT(max_acceleration) ? i : COUNT(max_acceleration) - 1];
+    }
+
+    planner.acceleration = DEFAULT_ACCELERATION;
+    planner.retract_acceleration = DEFAULT_RETRACT_ACCELERATION;
+    planner.travel_acceleration = DEFAULT_TRAVEL_ACCELERATION;
+    planner.min_feedrate_mm_s = DEFAULT_MINIMUMFEEDRATE;
+    planner.min_segment_time = DEFAULT_MINSEGMENTTIME;
+    planner.min_travel_feedrate_mm_s = DEFAULT_MINTRAVELFEEDRATE;
+    planner.max_jerk[X_AXIS] = DEFAULT_XJERK;
+    planner.max_jerk[Y_AXIS] = DEFAULT_YJERK;
+    planner.max_jerk[Z_AXIS] = DEFAULT_ZJERK;
+    planner.max_jerk[E_AXIS] = DEFAULT_EJERK;
+    #if ENABLED(JUNCTION_DEVIATION)
+      planner.junction_deviation_mm = JUNCTION_DEVIATION_MM;
+    #endif
+
+    planner.refresh_positioning();
+    planner.reset_acceleration_rates();
+  }
+
+  double host_seconds()
+  {
+    timespec now;
+    clock_gettime(CLOCK_MONOTONIC, &now);
+    return double(now.tv_sec) + double(now.tv_nsec) * 1e-9;
+  }
+
+  void move_to_destination()
+  {
+    ++segments;
+    planner.buffer_line(current_position[X_AXIS], current_position[Y_AXIS], current_position[Z_AXIS], current_position[E_AXIS], MMS_SCALED(feedrate_mm_s), 0);
+  }
+
+  // As stepper.synchronize, then check the positions with everything stepped.
+  void synchronize()
+  {
+    stepper.synchronize();
+    sim::validate_idle();
+  }
+
+  // As Marlin's do_homing_move: move from a zeroed position, then clear the endstop hit report.
+  void homing_move(const AxisEnum axis, const float distance, const float fr_mm_s)
+  {
+    planner.set_position_mm(axis, 0.0f);
+    sim::position_set();
+    current_position[axis] = distance;
+    const float saved_feedrate = feedrate_mm_s;
+    feedrate_mm_s = fr_mm_s;
+    move_to_destination();
+    synchronize();
+    endstops.hit_on_purpose();
+    feedrate_mm_s = saved_feedrate;
+  }
+
+  void home_axis(const AxisEnum axis)
+  {
+    static const float max_length[] = { X_MAX_POS - X_MIN_POS, Y_MAX_POS - Y_MIN_POS, Z_MAX_POS - Z_MIN_POS };
+    static const float homing_feedrate_mm_s[] = { HOMING_FEEDRATE_X, HOMING_FEEDRATE_Y, HOMING_FEEDRATE_Z };
+    static const float bump_mm[] = { X_HOME_BUMP_MM, Y_HOME_BUMP_MM, Z_HOME_BUMP_MM };
+    static const uint8_t bump_divisor[] = HOMING_BUMP_DIVISOR;
+
+    // As Marlin's homeaxis: run toward the endstop, back off, run into it again slowly, and set the axis to its minimum.
+    endstops.enable(true);
+    homing_move(axis, -1.5f * max_length[axis], homing_feedrate_mm_s[axis]);
+    if (bump_mm[axis] != 0.0f)
+    {
+      homing_move(axis, bump_mm[axis], homing_feedrate_mm_s[axis]);
+      homing_move(axis, -2.0f * bump_mm[axis], homing_feedrate_mm_s[axis] / bump_divisor[axis]);
+    }
+    endstops.not_homing();
+
+    current_position[axis] = 0.0f;
+    planner.set_position_mm(axis, current_position[axis]);
+    sim::position_set();
+    axis_homed[axis] = axis_known_position[axis] = true;
+  }
+
+  // The next command arrives, once its bytes are through the port and the host has had room to send it.
+  void link_receive(const uint32_t bytes)
+  {
+    if (!link_baud) return;
+    // With -T, the host has room once it has read the "ok" of the command BUFSIZE before.
+    while (serial_out && oks_read + BUFSIZE <= link_commands)
+    {
+      const uint64_t from = sim::now();
+      sim::run_until(from + uint64_t(10) * sim::cpu_hz / link_baud);
+      link_waited += sim::now() - from;
+    }
+    link_free = max(link_free, link_left[link_commands % BUFSIZE]) + uint64_t(bytes) * 10 * sim::cpu_hz / link_baud;
+    link_bytes += bytes;
+    if (link_free > sim::now())
+    {
+      link_waited += link_free - sim::now();
+      sim::run_until(link_free);
+    }
+  }
+
+  // The command received last has left the queue.
+  void link_done()
+  {
+    if (!link_baud) return;
+    if (!serial_out) link_left[link_commands % BUFSIZE] = sim::now();
+    ++link_commands;
+  }
+
+  enum class lane : uint8_t { protocol, status, debug }; // As Tuna::SerialTx::lane
+
+  // As the firmware writes a line to MYSERIAL.
+  void serial_write(const char *text, const lane to)
+  {
+    #if ENABLED(SERIAL_TX_LANES)
+      const Tuna::SerialTx::scope _lane(static_cast<Tuna::SerialTx::lane>(to));
+      Tuna::serialTx.write(text);
+    #else
+      UNUSED(to);
+      const uint64_t byte = uint64_t(10) * sim::cpu_hz / link_baud;
+      for (; *text; ++text)
+      {
+        // As HardwareSerial::write: a byte waits while SERIAL_TX_BUFFER_SIZE + 1 are still to go out.
+        const uint64_t room = (ring_free > SERIAL_TX_BUFFER_SIZE * byte) ? ring_free - SERIAL_TX_BUFFER_SIZE * byte : 0;
+        if (room > sim::now())
+        {
+          ++ring_stalls;
+          ring_stall_cycles += room - sim::now();
+          sim::run_until(room);
+        }
+        ring_free = max(ring_free, sim::now()) + byte;
+        sim::serial_received(uint8_t(*text), ring_free);
+      }
+    #endif
+  }
+
+  // As ok_to_send, with ADVANCED_OK, once the command received last has run.
+  void ok_to_send()
+  {
+    if (!serial_out) return;
+    char ok[48];
+    #if ENABLED(PREPARSED_COMMANDS)
+      const int room = Tuna::CommandQueue::room();
+    #else
+      const int room = BUFSIZE - 1;
+    #endif
+    snprintf(ok, sizeof(ok), "ok N%lu P%d B%d\n", (unsigned long)link_commands + 1, int(BLOCK_BUFFER_SIZE - planner.movesplanned() - 1), room);
+    oks_sent.push_back(sim::now());
+    serial_write(ok, lane::protocol);
+  }
+
+  // As auto_report_temperatures, and a calibration logging with Log::d, every report_ms.
+  void report_temperatures()
+  {
+    if (!serial_out || !report_ms || sim::now() < next_report) return;
+    next_report = sim::now() + uint64_t(report_ms) * (sim::cpu_hz / 1000);
+    serial_write(" T:210.00 /210.00 B:60.00 /60.00 @:127 B@:0\n", lane::status);
+    for (uint32_t i = 0; i < report_debug_lines; ++i)
+    {
+      serial_write("SimpleManager:   low_target: 190.000000\n", lane::debug);
+    }
+  }
+
+  // As gcode_get_destination.
+  void get_destination(float (&destination)[XYZE])
+  {
+    COPY(destination, current_position);
+    LOOP_XYZE(i) {
+      if (parser.seenval(axis_codes[i]))
+      {
+        const float v = parser.value_axis_units((AxisEnum)i);
+        destination[i] = (relative_mode || (i == E_AXIS && relative_e)) ? current_position[i] + v : v;
+      }
+    }
+    if (parser.seenval('F') && parser.value_feedrate() > 0.0f)
+    {
+      feedrate_mm_s = MMM_TO_MMS(parser.value_feedrate());
+    }
+  }
+
+  // The move of a G0/G1.
+  void line_to(const float (&destination)[XYZE])
+  {
+    #if ENABLED(SEGMENT_MERGING)
+      // As line_to_destination.
+      if (planner.merge_line(current_position, destination, MMS_SCALED(feedrate_mm_s), 0))
+      {
+        ++segments;
+        COPY(current_position, destination);
+        return;
+      }
+    #endif
+    COPY(current_position, destination);
+    move_to_destination();
+  }
+
+  #if ENABLED(BINARY_PROTOCOL)
+    uint32_t binary_moves = 0;
+  #endif
+
+  #if ENABLED(BINARY_PROTOCOL) && DISABLED(PREPARSED_COMMANDS)
+    // As binary_move, from the values decoded into the queue slot. A G0 runs at the last F, as G0 runs here.
+    void binary_move(const char *command)
+    {
+      const bool axis_relative[XYZE] = { false, false, false, relative_e };
+      float destination[XYZE];
+      Tuna::BinaryProtocol::get_destination(command, current_position, relative_mode, axis_relative, destination, feedrate_mm_s);
+      line_to(destination);
+    }
+  #endif
+
+  #if ENABLED(ARC_SUPPORT)
+
+    // As gcode_G2_G3, from the offset on. The segments but the last come back through clamp_to_software_endstops, which
+    // counts them.
+    void arc_to(const float (&destination)[XYZE], const float (&offset)[2], const bool clockwise)
+    {
+      if (!plan_arc(current_position, destination, offset, clockwise, MMS_SCALED(feedrate_mm_s), 0)) return;
+      ++segments;
+      #if ENABLED(NATIVE_ARCS)
+        if (TEST(planner.block_buffer[BLOCK_MOD(planner.block_buffer_head - 1)].flag, BLOCK_BIT_ARC)) ++native_arcs;
+        else
+      #endif
+      ++segmented_arcs;
+      COPY(current_position, destination);
+    }
+
+  #endif
+
+  #if ENABLED(BEZIER_CURVE_SUPPORT)
+
+    double segment_distance(const double px, const double py, const float (&a)[2], const float (&b)[2])
+    {
+      const double dx = double(b[0]) - a[0], dy = double(b[1]) - a[1], length_sq = dx * dx + dy * dy;
+      double u = length_sq > 0.0 ? ((px - a[0]) * dx + (py - a[1]) * dy) / length_sq : 0.0;
+      u = u < 0.0 ? 0.0 : u > 1.0 ? 1.0 : u;
+      return hypot(px - (a[0] + u * dx), py - (a[1] + u * dy));
+    }
+
+    // The largest distance of the curve p[0], p[1], p[2], p[3] from the path of segments through it, as the exact curve
+    // sampled finer than any segment. A segment ends at the sample closest to its end point, from the first one within
+    // 0.02 mm of it.
+    double path_deviation(const double (&p)[4][2], const float (*path)[2], const uint16_t points)
+    {
+      for (uint32_t i = 0; i <= curve_samples; ++i)
+      {
+        const double t = double(i) / curve_samples, s = 1.0 - t;
+        for (uint8_t axis = 0; axis < 2; ++axis) curve_sample[i][axis] = s * s * s * p[0][axis] + 3.0 * s * s * t * p[1][axis] + 3.0 * s * t * t * p[2][axis] + t * t * t * p[3][axis];
+      }
+
+      const auto end_distance = [path](const uint32_t i, const uint16_t point) {
+        return hypot(curve_sample[i][X_AXIS] - path[point][X_AXIS], curve_sample[i][Y_AXIS] - path[point][Y_AXIS]);
+      };
+      double deviation = 0.0;
+      uint32_t i = 0;
+      for (uint16_t point = 1; point < points; ++point)
+      {
+        uint32_t end = curve_samples;
+        if (point < points - 1)
+        {
+          for (end = i; end < curve_samples && end_distance(end, point) > 0.02; ++end) {}
+          while (end < curve_samples && end_distance(end + 1, point) < end_distance(end, point)) ++end;
+        }
+        for (; i <= end; ++i)
+        {
+          NOLESS(deviation, segment_distance(curve_sample[i][X_AXIS], curve_sample[i][Y_AXIS], path[point - 1], path[point]));
+        }
+        i = end;
+      }
+      return deviation;
+    }
+
+    // As plan_cubic_move. The segments come back through clamp_to_software_endstops, which records them.
+    void plan_cubic_move(const float (&destination)[XYZE], const float (&offset)[4])
+    {
+      ++curves;
+      curve_path[0][0] = current_position[X_AXIS];
+      curve_path[0][1] = current_position[Y_AXIS];
+      curve_points = 1;
+      cubic_b_spline(current_position, destination, offset, MMS_SCALED(feedrate_mm_s), 0);
+
+      if (!sim::settings.plan_only && curve_points > 1)
+      {
+        const double p[4][2] = {
+          { current_position[X_AXIS], current_position[Y_AXIS] },
+          { current_position[X_AXIS] + offset[0], current_position[Y_AXIS] + offset[1] },
+          { destination[X_AXIS] + offset[2], destination[Y_AXIS] + offset[3] },
+          { destination[X_AXIS], destination[Y_AXIS] }
+        };
+        NOLESS(curve_deviation, path_deviation(p, curve_path, curve_points));
+      }
+      if (time_curves)
+      {
+        // As cubic_b_spline takes it.
+        const traced_curve c = { {
+          { offset[0], offset[1] },
+          { destination[X_AXIS] + offset[2] - current_position[X_AXIS], destination[Y_AXIS] + offset[3] - current_position[Y_AXIS] },
+          { destination[X_AXIS] - current_position[X_AXIS], destination[Y_AXIS] - current_position[Y_AXIS] }
+        } };
+        timed_curves.push_back(c);
+      }
+
+      curve_points = 0;
+      COPY(current_position, destination);
+    }
+
+    // The curve tracer's segment ends for a curve relative to its start, into curve_path. Returns how many there are,
+    // with the start.
+    uint16_t fixed_trace(const float (&control)[3][2], const float min_length)
+    {
+      Tuna::bezier_tracer tracer;
+      tracer.init(control, BEZIER_TOLERANCE, min_length);
+      uint16_t points = 1;
+      curve_path[0][0] = curve_path[0][1] = 0.0f;
+      while (tracer.next())
+      {
+        if (points == COUNT(curve_path)) continue;
+        const bool last = tracer.t >= tracer.t_end;
+        curve_path[points][0] = last ? control[2][0] : tracer.x * tracer.unit;
+        curve_path[points][1] = last ? control[2][1] : tracer.y * tracer.unit;
+        ++points;
+      }
+      return points;
+    }
+
+    // The same from the float subdivision cubic_b_spline used before the curve tracer: De Casteljau evaluations at
+    // every candidate step, which is halved while the midpoint of a segment strays more than the tolerance from the
+    // curve (as the sum of X and Y), and doubled while it does not, between MIN_STEP and MAX_STEP.
+    uint16_t float_trace(const float (&control)[3][2])
+    {
+      constexpr float min_step = 0.002f, max_step = 0.1f;
+      const auto eval = [&control](const uint8_t axis, const float t) {
+        const auto interp = [](const float a, const float b, const float t) { return (1.0f - t) * a + t * b; };
+        const float iab = interp(0.0f, control[0][axis], t), ibc = interp(control[0][axis], control[1][axis], t),
+                    icd = interp(control[1][axis], control[2][axis], t);
+        return interp(interp(iab, ibc, t), interp(ibc, icd, t), t);
+      };
+      const auto dist1 = [](const float x1, const float y1, const float x2, const float y2) { return FABS(x1 - x2) + FABS(y1 - y2); };
+
+      uint16_t points = 1;
+      curve_path[0][0] = curve_path[0][1] = 0.0f;
+      float t = 0.0f, step = max_step, x = 0.0f, y = 0.0f;
+      while (t < 1.0f)
+      {
+        bool did_reduce = false;
+        float new_t = min(t + step, 1.0f), new_x = eval(X_AXIS, new_t), new_y = eval(Y_AXIS, new_t);
+        for (;;)
+        {
+          if (new_t - t < min_step) break;
+          const float candidate_t = 0.5f * (t + new_t), candidate_x = eval(X_AXIS, candidate_t), candidate_y = eval(Y_AXIS, candidate_t);
+          if (dist1(candidate_x, candidate_y, 0.5f * (x + new_x), 0.5f * (y + new_y)) <= BEZIER_TOLERANCE) break;
+          new_t = candidate_t;
+          new_x = candidate_x;
+          new_y = candidate_y;
+          did_reduce = true;
+        }
+        if (!did_reduce) for (;;)
+        {
+          if (new_t - t > max_step) break;
+          const float candidate_t = t + 2.0f * (new_t - t);
+          if (candidate_t >= 1.0f) break;
+          const float candidate_x = eval(X_AXIS, candidate_t), candidate_y = eval(Y_AXIS, candidate_t);
+          if (dist1(new_x, new_y, 0.5f * (x + candidate_x), 0.5f * (y + candidate_y)) > BEZIER_TOLERANCE) break;
+          new_t = candidate_t;
+          new_x = candidate_x;
+          new_y = candidate_y;
+        }
+        step = new_t - t;
+        t = new_t;
+        x = new_x;
+        y = new_y;
+        if (points == COUNT(curve_path)) continue;
+        curve_path[points][0] = x;
+        curve_path[points][1] = y;
+        ++points;
+      }
+      return points;
+    }
+
+    // -C: once the run is done, traces each of its curves with the curve tracer alone, with nothing planned, and with the
+    // float subdivision it replaced. Reports the segments each made, how far they stray from the curves, and what a
+    // segment costs, timed over and over for a second of host time.
+    void time_curve_tracers()
+    {
+      if (timed_curves.empty()) return;
+      const float min_length = float(BEZIER_MIN_SEGMENT_STEPS) / max(planner.axis_steps_per_mm[X_AXIS], planner.axis_steps_per_mm[Y_AXIS]);
+      const auto measure = [](const char *name, const auto &trace) {
+        unsigned long segments = 0;
+        double deviation = 0.0;
+        for (const traced_curve &c : timed_curves)
+        {
+          const uint16_t points = trace(c.control);
+          const double p[4][2] = {
+            { 0.0, 0.0 }, { c.control[0][0], c.control[0][1] }, { c.control[1][0], c.control[1][1] }, { c.control[2][0], c.control[2][1] }
+          };
+          NOLESS(deviation, path_deviation(p, curve_path, points));
+          segments += points - 1;
+        }
+
+        unsigned long traced = 0;
+        const double start = host_seconds();
+        double elapsed;
+        do
+        {
+          for (const traced_curve &c : timed_curves) traced += trace(c.control) - 1;
+        } while ((elapsed = host_seconds() - start) < 1.0);
+
+        fprintf(stderr, "curve tracer, %s: %lu segments, max deviation %.4f mm, %.1f ns/segment\n", name, segments, deviation,
+          elapsed * 1e9 / traced);
+      };
+      measure("fixed point", [min_length](const float (&control)[3][2]) { return fixed_trace(control, min_length); });
+      measure("float", [](const float (&control)[3][2]) { return float_trace(control); });
+    }
+
+  #endif
+
+  void dwell(const millis_t ms)
+  {
+    synchronize();
+    sim::run_until(sim::now() + uint64_t(ms) * (sim::cpu_hz / 1000));
+  }
+
+  void process_command()
+  {
+    const char letter = parser.command_letter;
+    const uint16_t code = parser.codenum;
+
+    if (letter == 'G')
+    {
+      switch (code)
+      {
+      case 0:
+      case 1: {
+        float destination[XYZE];
+        get_destination(destination);
+        line_to(destination);
+      } return;
+      #if ENABLED(ARC_SUPPORT)
+        case 2:
+        case 3: {
+          // As gcode_G2_G3.
+          float destination[XYZE], offset[2] = { 0.0f, 0.0f };
+          get_destination(destination);
+          if (parser.seenval('R'))
+          {
+            const float r = parser.value_linear_units(),
+                        p1 = current_position[X_AXIS], q1 = current_position[Y_AXIS],
+                        p2 = destination[X_AXIS], q2 = destination[Y_AXIS];
+            if (r && (p2 != p1 || q2 != q1))
+            {
+              const float e = (code == 2) ^ (r < 0) ? -1 : 1,
+                          dx = p2 - p1, dy = q2 - q1,
+                          d = HYPOT(dx, dy),
+                          h = SQRT(sq(r) - sq(d * 0.5)),
+                          mx = (p1 + p2) * 0.5, my = (q1 + q2) * 0.5,
+                          sx = -dy / d, sy = dx / d,
+                          cx = mx + e * h * sx, cy = my + e * h * sy;
+              offset[0] = cx - p1;
+              offset[1] = cy - q1;
+            }
+          }
+          else
+          {
+            if (parser.seenval('I')) offset[0] = parser.value_linear_units();
+            if (parser.seenval('J')) offset[1] = parser.value_linear_units();
+          }
+          if (offset[0] || offset[1]) arc_to(destination, offset, code == 2);
+        } return;
+      #endif
+      #if ENABLED(BEZIER_CURVE_SUPPORT)
+        case 5: {
+          // As gcode_G5.
+          float destination[XYZE];
+          get_destination(destination);
+          const float offset[4] = { parser.linearval('I'), parser.linearval('J'), parser.linearval('P'), parser.linearval('Q') };
+          plan_cubic_move(destination, offset);
+        } return;
+      #endif
+      case 4:
+        dwell(parser.seenval('S') ? parser.value_millis_from_seconds() : parser.seenval('P') ? parser.value_millis() : 0);
+        return;
+      case 28: {
+        synchronize();
+        #if ENABLED(INPUT_SHAPING)
+          stepper.suspend_shaping(true);
+        #endif
+        // Homing moves are not scaled by M220.
+        const int16_t saved_feedrate_percentage = feedrate_percentage;
+        feedrate_percentage = 100;
+        const bool all = !(parser.seen('X') || parser.seen('Y') || parser.seen('Z'));
+        // One axis at a time: X, Y, then Z.
+        if (all || parser.seen('X')) home_axis(X_AXIS);
+        if (all || parser.seen('Y')) home_axis(Y_AXIS);
+        if (all || parser.seen('Z')) home_axis(Z_AXIS);
+        feedrate_percentage = saved_feedrate_percentage;
+        #if ENABLED(INPUT_SHAPING)
+          stepper.suspend_shaping(false);
+        #endif
+      } return;
+      case 90:
+        relative_mode = false;
+        return;
+      case 91:
+        relative_mode = true;
+        return;
+      case 92:
+        synchronize();
+        LOOP_XYZE(i) {
+          if (parser.seenval(axis_codes[i]))
+          {
+            current_position[i] = parser.value_axis_units((AxisEnum)i);
+            planner.set_position_mm((AxisEnum)i, current_position[i]);
+          }
+        }
+        sim::position_set();
+        return;
+      }
+    }
+    else if (letter == 'M')
+    {
+      switch (code)
+      {
+      case 82:
+        relative_e = false;
+        return;
+      case 83:
+        relative_e = true;
+        return;
+      case 201:
+        LOOP_XYZE(i) {
+          if (parser.seen(axis_codes[i]))
+          {
+            planner.max_acceleration_mm_per_s2[i] = parser.value_axis_units((AxisEnum)i);
+          }
+        }
+        planner.reset_acceleration_rates();
+        return;
+      case 203:
+        LOOP_XYZE(i) {
+          if (parser.seen(axis_codes[i]))
+          {
+            planner.max_feedrate_mm_s[i] = parser.value_axis_units((AxisEnum)i);
+          }
+        }
+        return;
+      case 204:
+        if (parser.seen('S'))
+        {
+          planner.travel_acceleration = planner.acceleration = parser.value_linear_units();
+        }
+        if (parser.seen('P')) planner.acceleration = parser.value_linear_units();
+        if (parser.seen('R')) planner.retract_acceleration = parser.value_linear_units();
+        if (parser.seen('T')) planner.travel_acceleration = parser.value_linear_units();
+        return;
+      case 205:
+        if (parser.seen('S')) planner.min_feedrate_mm_s = parser.value_linear_units();
+        if (parser.seen('T')) planner.min_travel_feedrate_mm_s = parser.value_linear_units();
+        if (parser.seen('B')) planner.min_segment_time = parser.value_millis();
+        if (parser.seen('X')) planner.max_jerk[X_AXIS] = parser.value_linear_units();
+        if (parser.seen('Y')) planner.max_jerk[Y_AXIS] = parser.value_linear_units();
+        if (parser.seen('Z')) planner.max_jerk[Z_AXIS] = parser.value_linear_units();
+        if (parser.seen('E')) planner.max_jerk[E_AXIS] = parser.value_linear_units();
+        #if ENABLED(JUNCTION_DEVIATION)
+          if (parser.seen('J')) planner.junction_deviation_mm = max(parser.value_linear_units(), 0.0f);
+        #endif
+        return;
+      case 220:
+        if (parser.seenval('S')) feedrate_percentage = parser.value_int();
+        return;
+      case 221:
+        if (parser.seenval('S')) flow_percentage[0] = parser.value_int();
+        return;
+      case 400:
+        synchronize();
+        return;
+      case 410:
+        // As quickstop_stepper.
+        sim::position_lost();
+        stepper.quick_stop();
+        stepper.synchronize();
+        LOOP_XYZE(i) current_position[i] = stepper.get_axis_position_mm((AxisEnum)i);
+        planner.set_position_mm_kinematic(current_position);
+        sim::position_set();
+        return;
+      #if ENABLED(INPUT_SHAPING)
+        case 593: {
+          // As gcode_M593, without the report.
+          const bool seen_x = parser.seen('X'), seen_y = parser.seen('Y');
+          for (uint8 i = X_AXIS; i <= Y_AXIS; ++i)
+          {
+            if ((seen_x || seen_y) && !(i == X_AXIS ? seen_x : seen_y)) continue;
+            Stepper::shaping_setting setting = stepper.get_shaping(AxisEnum(i));
+            if (parser.seenval('T') && parser.value_byte() <= uint8(Tuna::shaper_type::MZV)) setting.type = Tuna::shaper_type(parser.value_byte());
+            if (parser.seenval('F')) setting.frequency = (parser.value_float() > 0.0f) ? max(parser.value_float(), float(SHAPING_MIN_FREQ)) : 0.0f;
+            if (parser.seenval('D')) setting.zeta = clamp(parser.value_float(), 0.0f, 0.99f);
+            stepper.set_shaping(AxisEnum(i), setting);
+          }
+        } return;
+      #endif
+      #if ENABLED(BINARY_PROTOCOL)
+        case 935:
+          // As gcode_M935, without the report.
+          if (parser.seen('S')) Tuna::BinaryProtocol::set_active(parser.value_bool());
+          return;
+      #endif
+      #if ENABLED(BAUD_SWITCHING)
+        case 938:
+          // As gcode_M938, without the report.
+          if (parser.seenval('B'))
+          {
+            if (!Tuna::BaudSwitch::request(parser.value_ulong()))
+            {
+              ++baud_unsupported;
+              return;
+            }
+            if (parser.seenval('T')) Tuna::BaudSwitch::timeout = max(parser.value_ushort(), uint16(100));
+          }
+          return;
+      #endif
+      #if ENABLED(STEP_RECORDING)
+        case 933:
+          if (parser.seen('S'))
+          {
+            if (parser.value_byte() <= uint8(Tuna::StepRecord::mode::ring)) Tuna::StepRecord::start(Tuna::StepRecord::mode(parser.value_byte()));
+          }
+          else
+          {
+            compare_record();
+          }
+          return;
+      #endif
+      }
+    }
+
+    ++unhandled;
+  }
+
+  // Drops the comment and the blanks around the command on a line, as a host does before sending it.
+  char * strip_line(char *line)
+  {
+    char *comment = strchr(line, ';');
+    if (comment) *comment = '\0';
+    char *start = line;
+    while (*start == ' ' || *start == '\t') ++start;
+    char *end = start + strlen(start);
+    while (end > start && (end[-1] == '\n' || end[-1] == '\r' || end[-1] == ' ' || end[-1] == '\t')) *--end = '\0';
+    return start;
+  }
+
+  // As a host sends a command: "N<n> <command>*<checksum>\n". Returns its length.
+  using numbered_line = char[MAX_CMD_SIZE * 2 + 24];
+  uint32_t number_line(numbered_line &numbered, const char *command, const unsigned long n)
+  {
+    const int length = snprintf(numbered, sizeof(numbered), "N%lu %s", n, command);
+    uint8_t checksum = 0;
+    for (int i = 0; i < length; ++i) checksum ^= uint8_t(numbered[i]);
+    return length + snprintf(numbered + length, sizeof(numbered) - length, "*%u\n", unsigned(checksum));
+  }
+
+  uint32_t numbered_length(const char *command, const unsigned long n)
+  {
+    numbered_line numbered;
+    return number_line(numbered, command, n);
+  }
+
+  #if ENABLED(RX_LINE_ASSEMBLER)
+    uint32_t assembler_mismatches = 0;    // Lines the receive interrupt finished differently than the host sent them
+
+    // As the receive interrupt takes a command, numbered as a host sends it, and get_serial_commands claims the line.
+    // Checks the line, its '*' and its checksum against what was sent, cut at MAX_CMD_SIZE - 1 characters as
+    // get_serial_commands cuts it. Returns the line to run, or nullptr; LineAssembler::pop it after, if available.
+    // A line that was cut would only be resent on the printer, so the command is run as it was read instead.
+    char * assemble_line(char *command, const unsigned long n)
+    {
+      numbered_line numbered;
+      const uint32_t length = number_line(numbered, command, n);
+      for (uint32_t i = 0; i < length; ++i) Tuna::LineAssembler::receive(0, uint8_t(numbered[i]));
+
+      numbered[length - 1] = '\0';
+      const bool cut = length - 1 > MAX_CMD_SIZE - 1;
+      if (cut) numbered[MAX_CMD_SIZE - 1] = '\0';
+      const char *star = strchr(numbered, '*');
+      uint8_t checksum = 0;
+      for (const char *c = numbered; *c && c != star; ++c) checksum ^= uint8_t(*c);
+
+      Tuna::LineAssembler::line *line = Tuna::LineAssembler::available() ? &Tuna::LineAssembler::front() : nullptr;
+      if (line && !strcmp(line->text, numbered) && line->star == (star ? star - numbered + 1 : 0) && line->checksum == checksum)
+      {
+        return cut ? command : line->text;
+      }
+
+      if (++assembler_mismatches <= 20)
+      {
+        fprintf(stderr, "validation: line %lu: sent \"%s\", assembled \"%s\" (star %u, checksum %u)\n", n, numbered,
+          line ? line->text : "", line ? unsigned(line->star) : 0u, line ? unsigned(line->checksum) : 0u);
+      }
+      ++sim::validation.failures;
+      return nullptr;
+    }
+
+    // -A: feeds crafted byte streams to the receive interrupt, each from an empty ring, and checks the lines it finishes
+    // and its counters against what get_serial_commands would have made of the same bytes. Returns the streams that
+    // failed.
+    uint32_t check_assembler()
+    {
+      using Tuna::LineAssembler;
+      struct stream final
+      {
+        const char *name;
+        std::string bytes;
+        const char *status;                 // Per byte: 'O' overrun, 'F' framing error; none if shorter
+        std::string lines;                  // Finished, each up to its '*' and ended with '\n'
+        LineAssembler::counters expected;   // lines is the number of lines finished
+        bool claim = true;                  // Claim each line as it is finished, as loop() keeps up
+      };
+
+      // RX_LINES waiting: the next is dropped whole, and a G28 after it taken once they are claimed (below).
+      std::string full, full_lines;
+      for (uint8_t i = 0; i <= RX_LINES; ++i)
+      {
+        const std::string line = "G1 X" + std::to_string(i) + "\n";
+        full += line;
+        if (i < RX_LINES) full_lines += line;
+      }
+
+      const std::string longest(MAX_CMD_SIZE - 1, 'X'), too_long(MAX_CMD_SIZE + 9, 'X');
+      const stream streams[] = {
+        { "plain", "G1 X1\r\nG1 Y2\n", "", "G1 X1\nG1 Y2\n", { 2, 0, 0, 0, 0 } },
+        { "numbered", "N12 G1 X1*82\n", "", "N12 G1 X1\n", { 1, 0, 0, 0, 0 } },
+        { "blank and leading spaces", "\n\r\n   \n  G28\n", "", "G28\n", { 1, 0, 0, 0, 0 } },
+        { "comments", "; alone\nG1 X1 ; after\nG1 Y2;\n", "", "G1 X1 \nG1 Y2\n", { 2, 0, 0, 0, 0 } },
+        { "escapes", "M117 a\\;b\\\\c\n", "", "M117 a;b\\c\n", { 1, 0, 0, 0, 0 } },
+        { "longest", longest + "\n", "", longest + "\n", { 1, 0, 0, 0, 0 } },
+        { "truncated", too_long + "\nG28\n", "", longest + "\nG28\n", { 2, 0, 1, 0, 0 } },
+        { "overrun", "G1 X1\n", "..O", "G1 X1\n", { 1, 0, 0, 1, 0 } },
+        { "framing errors", "G1 X12\n", "....F", "G1 X2\n", { 1, 0, 0, 0, 1 } },
+        { "overflow", full, "", full_lines + "G28\n", { RX_LINES + 1, 1, 0, 0, 0 }, false },
+      };
+
+      uint32_t failed = 0;
+      for (const stream &s : streams)
+      {
+        LineAssembler::clear();
+        LineAssembler::stats = {};
+        std::string lines;
+        const auto claim = [&lines]() {
+          const LineAssembler::line &l = LineAssembler::front();
+          std::string text = l.text;
+          uint8_t checksum = 0;
+          for (size_t i = 0; i < text.length() && (!l.star || i < size_t(l.star - 1)); ++i) checksum ^= uint8_t(text[i]);
+          if (l.star) text.resize(l.star - 1);
+          if (checksum != l.checksum || (l.star && l.text[l.star - 1] != '*')) text += " (bad checksum or '*')";
+          lines += text + "\n";
+          LineAssembler::pop();
+        };
+        for (size_t i = 0, flagged = strlen(s.status); i < s.bytes.length(); ++i)
+        {
+          const char f = i < flagged ? s.status[i] : '.';
+          LineAssembler::receive(f == 'O' ? _BV(DOR0) : f == 'F' ? _BV(FE0) : 0, uint8_t(s.bytes[i]));
+          if (s.claim && LineAssembler::available()) claim();
+        }
+        while (LineAssembler::available()) claim();
+        if (!s.claim)
+        {
+          // The ring has room again.
+          for (const char *c = "G28\n"; *c; ++c) LineAssembler::receive(0, uint8_t(*c));
+          if (LineAssembler::available()) claim();
+        }
+
+        const std::string &expected = s.lines;
+        const LineAssembler::counters &counted = s.expected;
+        const auto &c = LineAssembler::stats;
+        if (lines == expected && c.lines == counted.lines && c.overflows == counted.overflows && c.truncated == counted.truncated
+          && c.overruns == counted.overruns && c.errors == counted.errors)
+        {
+          continue;
+        }
+        ++failed;
+        fprintf(stderr, "line assembler: %s: %lu lines, %u overflows, %u truncated, %u overruns, %u errors; expected %lu, %u, %u, %u, %u\n",
+          s.name, (unsigned long)c.lines, unsigned(c.overflows), unsigned(c.truncated), unsigned(c.overruns), unsigned(c.errors),
+          (unsigned long)counted.lines, unsigned(counted.overflows), unsigned(counted.truncated), unsigned(counted.overruns),
+          unsigned(counted.errors));
+        if (lines != expected) fprintf(stderr, "line assembler: %s: lines\n%sexpected\n%s", s.name, lines.c_str(), expected.c_str());
+      }
+      LineAssembler::clear();
+      LineAssembler::stats = {};
+
+      fprintf(stderr, "line assembler: %u streams, %lu failed\n", unsigned(COUNT(streams)), (unsigned long)failed);
+      return failed;
+    }
+  #endif
+
+  #if ENABLED(BAUD_SWITCHING)
+    // Whether the link carries the rate both ends are at.
+    bool link_clean()
+    {
+      return !link_max || link_baud <= link_max;
+    }
+
+    // As manage_baud_switch in idle, after the command run last. The host moves with the firmware: to the rate it
+    // asked for once it has the "ok", back once it has waited for a confirmation as long.
+    void manage_baud_switch()
+    {
+      if (!link_baud) return;
+      if (Tuna::BaudSwitch::pending && serial_out)
+      {
+        // As MYSERIAL.flush(): the "ok" goes at the old rate.
+        #if ENABLED(SERIAL_TX_LANES)
+          Tuna::serialTx.flush();
+        #else
+          sim::run_until(max(ring_free, sim::now()));
+        #endif
+      }
+      const uint32_t from = link_baud;
+      switch (Tuna::BaudSwitch::update(millis()))
+      {
+      case Tuna::BaudSwitch::action::switched:
+        ++baud_switches;
+        break;
+      case Tuna::BaudSwitch::action::fell_back:
+        ++baud_fallbacks;
+        if (link_clean())
+        {
+          fprintf(stderr, "validation: %.6f s: no confirmation at %lu baud, which the link carries\n", double(sim::now()) / sim::cpu_hz,
+            (unsigned long)from);
+          ++sim::validation.failures;
+        }
+        break;
+      default:
+        return;
+      }
+      link_baud = Tuna::BaudSwitch::baud;
+      if (serial_out) sim::settings.serial_baud = link_baud;
+      #if ENABLED(RX_LINE_ASSEMBLER)
+        Tuna::LineAssembler::clear();
+      #endif
+    }
+
+    // The host sends command 'n' at a rate the link does not carry: the firmware only takes framing errors, until it
+    // goes back to the rate before, and the host with it.
+    void lose_line(const char *command, const unsigned long n)
+    {
+      numbered_line numbered;
+      const uint32_t length = number_line(numbered, command, n);
+      link_receive(length);
+      #if ENABLED(RX_LINE_ASSEMBLER)
+        for (uint32_t i = 0; i < length; ++i) Tuna::LineAssembler::receive(_BV(FE0), uint8_t(numbered[i]));
+      #endif
+      while (Tuna::BaudSwitch::fallback)
+      {
+        sim::run_until(sim::now() + sim::cpu_hz / 1000);
+        manage_baud_switch();
+      }
+      ++baud_resent;
+    }
+
+    // As serial_command_received, with command 'n' as the host numbered it.
+    void line_received(const char *command, const unsigned long n)
+    {
+      numbered_line numbered;
+      number_line(numbered, command, n);
+      const bool unconfirmed = Tuna::BaudSwitch::fallback;
+      Tuna::BaudSwitch::line_received(numbered);
+      if (!unconfirmed || Tuna::BaudSwitch::fallback) return;
+      ++baud_confirmed;
+      if (!link_clean())
+      {
+        fprintf(stderr, "validation: %.6f s: confirmed %lu baud, which the link does not carry\n", double(sim::now()) / sim::cpu_hz,
+          (unsigned long)link_baud);
+        ++sim::validation.failures;
+      }
+    }
+  #endif
+
+  // As loop, with the next command of the queue, which took 'bytes' on the serial port. With PREPARSED_COMMANDS, that
+  // is the front of the CommandQueue, and 'command' is not used.
+  void run_command(char *command, const uint32_t bytes)
+  {
+    link_receive(bytes);
+    #if ENABLED(BINARY_PROTOCOL) && DISABLED(PREPARSED_COMMANDS)
+      // As process_next_command: a G0/G1, decoded already.
+      if (command[0] == Tuna::BinaryProtocol::move_tag)
+      {
+        binary_move(command);
+      }
+      else
+    #endif
+    {
+      #if ENABLED(PREPARSED_COMMANDS)
+        UNUSED(command);
+        Tuna::CommandQueue::load();
+      #else
+        parser.parse(command);
+      #endif
+      #if ENABLED(SEGMENT_MERGING)
+        // As process_next_command and loop.
+        if (!(parser.command_letter == 'G' && parser.codenum <= 1)) planner.flush_merged();
+      #endif
+      process_command();
+      ok_to_send();
+      #if ENABLED(PREPARSED_COMMANDS)
+        Tuna::CommandQueue::pop();
+      #endif
+      #if ENABLED(BAUD_SWITCHING)
+        manage_baud_switch();
+      #endif
+    }
+    #if ENABLED(SEGMENT_MERGING)
+      planner.poll_merged();
+    #endif
+    link_done();
+    report_temperatures();
+
+    sim::run_until(sim::now() + sim::settings.plan_cycles);
+    if (stall_lines && ++lines % stall_lines == 0)
+    {
+      sim::run_until(sim::now() + uint64_t(stall_ms) * (sim::cpu_hz / 1000));
+    }
+  }
+
+  #if ENABLED(PREPARSED_COMMANDS)
+    // The command queue, kept as full as the input allows, as loop keeps it. Queuing takes no simulated time, and a
+    // command's bytes are through the port (-L) as it runs, so the trace is that of running each command as it is read.
+    uint32_t queued_bytes[256];           // The bytes each queued command took on the serial port, from the front
+    uint8_t queued_front = 0;
+    uint64_t queue_full_depth = 0;        // Commands queued, summed over the times the queue was full
+    uint32_t queue_full = 0;
+    uint8_t queue_min_depth = 255, queue_max_depth = 0;
+
+    // Runs commands from the front until the queue has room for another one.
+    void make_room(const bool run = true)
+    {
+      if (Tuna::CommandQueue::has_room()) return;
+      const uint8_t depth = Tuna::CommandQueue::count;
+      queue_full_depth += depth;
+      ++queue_full;
+      queue_min_depth = min(queue_min_depth, depth);
+      queue_max_depth = max(queue_max_depth, depth);
+      if (!run) return;
+      while (!Tuna::CommandQueue::has_room()) run_command(nullptr, queued_bytes[queued_front++]);
+    }
+
+    // The command queued last took 'bytes' on the serial port.
+    void queued(const uint32_t bytes)
+    {
+      queued_bytes[uint8_t(queued_front + Tuna::CommandQueue::count - 1)] = bytes;
+    }
+
+    void queue_command(char *command, const uint32_t bytes)
+    {
+      make_room();
+      Tuna::CommandQueue::enqueue(command, false);
+      queued(bytes);
+    }
+
+    void report_queue(FILE *out)
+    {
+      fprintf(out, "command queue: %u bytes, %.1f commands deep when full (%u to %u)\n", unsigned(Tuna::CommandQueue::size + 6),
+        queue_full ? double(queue_full_depth) / queue_full : 0.0, queue_full ? unsigned(queue_min_depth) : 0u, unsigned(queue_max_depth));
+    }
+  #else
+    void report_queue(FILE *out)
+    {
+      // As Marlin_main: the slots, send_ok and the indices.
+      fprintf(out, "command queue: %u bytes, %u commands deep when full\n", unsigned(BUFSIZE * MAX_CMD_SIZE + BUFSIZE + 3), unsigned(BUFSIZE));
+    }
+  #endif
+
+  // -P: takes every command through the command queue and into the parser, and reads its parameters as a G0-G3 handler
+  // would, with nothing planned, over and over for a second of host time. Fills the queue, then runs it dry, and times
+  // the two apart: queuing is done as the command arrives, running is what process_next_command adds between handlers.
+  void time_command_path(const std::vector<std::string> &commands)
+  {
+    volatile float sink = 0.0f;           // Keeps the values read
+    const auto read_parameters = [&sink]() {
+      if (parser.command_letter != 'G' || parser.codenum > 3) return;
+      LOOP_XYZE(i) {
+        if (parser.seenval(axis_codes[i])) sink += parser.value_axis_units((AxisEnum)i);
+      }
+      if (parser.seenval('F')) sink += parser.value_feedrate();
+    };
+
+    #if DISABLED(PREPARSED_COMMANDS)
+      static char slots[BUFSIZE][MAX_CMD_SIZE];
+    #endif
+    char line[MAX_CMD_SIZE * 2];
+    unsigned long done = 0;
+    double queuing = 0.0, running = 0.0;
+    size_t next = 0;
+    while (queuing + running < 1.0)
+    {
+      // As get_serial_commands: queue until there is no room.
+      double t = host_seconds();
+      uint8_t queued = 0;
+      #if ENABLED(PREPARSED_COMMANDS)
+        while (Tuna::CommandQueue::has_room())
+        {
+          strcpy(line, commands[next].c_str());
+          Tuna::CommandQueue::enqueue(line, false);
+          if (++next == commands.size()) next = 0;
+        }
+        make_room(false);
+        queued = Tuna::CommandQueue::count;
+      #else
+        // As _enqueuecommand, into a slot of MAX_CMD_SIZE.
+        for (; queued < BUFSIZE; ++queued)
+        {
+          strcpy(line, commands[next].c_str());
+          strncpy(slots[queued], line, MAX_CMD_SIZE - 1);
+          slots[queued][MAX_CMD_SIZE - 1] = '\0';
+          if (++next == commands.size()) next = 0;
+        }
+      #endif
+      const double t2 = host_seconds();
+      queuing += t2 - t;
+
+      // As process_next_command, until the queue is empty.
+      #if ENABLED(PREPARSED_COMMANDS)
+        while (Tuna::CommandQueue::count)
+        {
+          Tuna::CommandQueue::load();
+          read_parameters();
+          Tuna::CommandQueue::pop();
+        }
+      #else
+        for (uint8_t i = 0; i < queued; ++i)
+        {
+          parser.parse(slots[i]);
+          read_parameters();
+        }
+      #endif
+      running += host_seconds() - t2;
+      done += queued;
+    }
+
+    fprintf(stderr, "command path: %lu commands in %.6f s of host time: %.1f ns/command queuing, %.1f ns/command running\n",
+      done, queuing + running, queuing * 1e9 / done, running * 1e9 / done);
+    report_queue(stderr);
+  }
+}
+
+// The host reads each line the firmware sent (-T); an "ok" lets it send another command.
+void sim::serial_received(uint8_t c, uint64_t cycle)
+{
+  ++serial_bytes;
+  if (c != '\n')
+  {
+    if (host_line_length < sizeof(host_line) - 1) host_line[host_line_length++] = char(c);
+    return;
+  }
+  host_line[host_line_length] = '\0';
+  host_line_length = 0;
+  if (!strncmp(host_line, "ok", 2) && !oks_sent.empty())
+  {
+    link_left[oks_read++ % BUFSIZE] = cycle;
+    const uint64_t latency = cycle - oks_sent.front();
+    oks_sent.pop_front();
+    ok_latency += latency;
+    ok_latency_max = max(ok_latency_max, latency);
+  }
+  else if (host_line[0] == ' ')
+  {
+    ++status_lines;
+  }
+  else
+  {
+    ++debug_lines;
+  }
+}
+
+#if ENABLED(SERIAL_TX_LANES)
+  // As HardwareSerial0.cpp's handler, which is not built here.
+  ISR(USART0_UDRE_vect)
+  {
+    Tuna::SerialTx::udre();
+  }
+#endif
+
+// As wiring.cpp's, which is not built here.
+unsigned long micros()
+{
+  return (unsigned long)(sim::now() / (sim::cpu_hz / 1'000'000));
+}
+
+unsigned long millis()
+{
+  return (unsigned long)(sim::now() / (sim::cpu_hz / 1'000));
+}
+
+// The firmware's main loop hook. Any time the firmware waits (a full block buffer, a synchronize), simulated time moves
+// forward to the next stepper ISR.
+void idle(
+  #if ENABLED(ADVANCED_PAUSE_FEATURE)
+    bool
+  #endif
+)
+{
+  report_temperatures();
+  if (sim::settings.plan_only)
+  {
+    // Nothing executes blocks, so retire the oldest one as the stepper ISR would.
+    if (planner.blocks_queued())
+    {
+      sim::dump_block(&planner.block_buffer[planner.block_buffer_tail]);
+      planner.discard_current_block();
+    }
+    return;
+  }
+  sim::step_once();
+}
+
+// As the thermal manager's, between segments of arcs and curves. There are no heaters here.
+bool Temperature::manage_heater()
+{
+  return false;
+}
+
+// The software endstops are off. An arc is still checked against them before it is planned natively.
+bool soft_endstops_enabled = false;
+float soft_endstop_min[XYZ] = { 0.0f }, soft_endstop_max[XYZ] = { 0.0f };
+
+// Called by plan_arc and cubic_b_spline with every segment end. Counts the segment, and records a curve's.
+void clamp_to_software_endstops(float target[XYZ])
+{
+  ++segments;
+  #if ENABLED(BEZIER_CURVE_SUPPORT)
+    if (curve_points) ++curve_segments;
+    if (curve_points && curve_points < COUNT(curve_path))
+    {
+      curve_path[curve_points][0] = target[X_AXIS];
+      curve_path[curve_points][1] = target[Y_AXIS];
+      ++curve_points;
+    }
+  #endif
+}
+
+// Only reached when SD printing finishes.
+void enqueue_and_echo_commands(const Tuna::flash_string & __restrict) {}
+
+int main(int argc, char **argv)
+{
+  const char *input_path = nullptr;
+  const char *trace_path = nullptr;
+  const char *blocks_path = nullptr;
+  const char *profile_path = nullptr;
+  bool trace = true;
+  bool command_path = false;
+  #if ENABLED(BINARY_PROTOCOL)
+    bool binary = false;
+  #endif
+
+  for (int i = 1; i < argc; ++i)
+  {
+    const char *arg = argv[i];
+    if (!strcmp(arg, "-o") && i + 1 < argc) trace_path = argv[++i];
+    else if (!strcmp(arg, "-n")) trace = false;
+    else if (!strcmp(arg, "-i") && i + 1 < argc) sim::settings.isr_cycles = strtoul(argv[++i], nullptr, 10);
+    else if (!strcmp(arg, "-e") && i + 1 < argc) sim::settings.event_cycles = strtoul(argv[++i], nullptr, 10);
+    else if (!strcmp(arg, "-p") && i + 1 < argc) sim::settings.plan_cycles = strtoul(argv[++i], nullptr, 10);
+    else if (!strcmp(arg, "-B") && i + 1 < argc) blocks_path = argv[++i];
+    else if (!strcmp(arg, "-v") && i + 1 < argc) profile_path = argv[++i];
+    else if (!strcmp(arg, "-s") && i + 1 < argc)
+    {
+      if (sscanf(argv[++i], "%lu:%lu", &stall_lines, &stall_ms) != 2 || !stall_lines) usage(argv[0]);
+    }
+    else if (!strcmp(arg, "-b")) sim::settings.plan_only = true, trace = false;
+    else if (!strcmp(arg, "-S") && i + 1 < argc)
+    {
+      sim::settings.preempt_seed = strtoul(argv[++i], nullptr, 10);
+      if (!sim::settings.preempt_seed) usage(argv[0]);
+    }
+    else if (!strcmp(arg, "-F") && i + 1 < argc)
+    {
+      float &from = sim::settings.spectrum_from, &to = sim::settings.spectrum_to, &step = sim::settings.spectrum_step;
+      const int fields = sscanf(argv[++i], "%f:%f:%f", &from, &to, &step);
+      if (fields == 1) to = from, step = 1.0f;
+      else if (fields != 3 || step <= 0.0f || to < from) usage(argv[0]);
+      if (from <= 0.0f) usage(argv[0]);
+    }
+    else if (!strcmp(arg, "-L") && i + 1 < argc)
+    {
+      char *end;
+      link_baud = strtoul(argv[++i], &end, 10);
+      if (!link_baud) usage(argv[0]);
+      #if ENABLED(BAUD_SWITCHING)
+        if (*end == ':') link_max = strtoul(end + 1, &end, 10);
+        Tuna::BaudSwitch::baud = link_baud;
+      #endif
+      if (*end) usage(argv[0]);
+    }
+    else if (!strcmp(arg, "-T") && i + 1 < argc)
+    {
+      serial_out = true;
+      unsigned long ms = 0, debug = 0;
+      if (sscanf(argv[++i], "%lu:%lu", &ms, &debug) < 1) usage(argv[0]);
+      report_ms = uint32_t(ms);
+      report_debug_lines = uint32_t(debug);
+    }
+    else if (!strcmp(arg, "-P")) command_path = true;
+  #if ENABLED(BEZIER_CURVE_SUPPORT)
+    else if (!strcmp(arg, "-C")) time_curves = true;
+  #endif
+  #if ENABLED(RX_LINE_ASSEMBLER)
+    else if (!strcmp(arg, "-A")) return check_assembler() ? 3 : 0;
+  #endif
+  #if ENABLED(BINARY_PROTOCOL)
+    else if (!strcmp(arg, "-x")) binary = true;
+  #endif
+  #if ENABLED(STEP_RECORDING)
+    else if (!strcmp(arg, "-r") && i + 1 < argc)
+    {
+      record_log = fopen(argv[++i], "r");
+      if (!record_log)
+      {
+        perror(argv[i]);
+        return 1;
+      }
+    }
+    else if (!strcmp(arg, "-R") && i + 1 < argc)
+    {
+      record_out = fopen(argv[++i], "w");
+      if (!record_out)
+      {
+        perror(argv[i]);
+        return 1;
+      }
+    }
+  #endif
+    else if (arg[0] == '-' || input_path) usage(argv[0]);
+    else input_path = arg;
+  }
+  if (!input_path)
+  {
+    usage(argv[0]);
+  }
+  if (serial_out)
+  {
+    #if ENABLED(BINARY_PROTOCOL)
+      if (binary) usage(argv[0]);
+    #endif
+    if (!link_baud) usage(argv[0]);
+    sim::settings.serial_baud = link_baud;
+  }
+
+  FILE *input = fopen(input_path, "r");
+  if (!input)
+  {
+    perror(input_path);
+    return 1;
+  }
+  if (command_path)
+  {
+    std::vector<std::string> commands;
+    char line[MAX_CMD_SIZE * 2];
+    while (fgets(line, sizeof(line), input))
+    {
+      const char *start = strip_line(line);
+      if (*start) commands.emplace_back(start);
+    }
+    fclose(input);
+    if (commands.empty()) usage(argv[0]);
+    time_command_path(commands);
+    return 0;
+  }
+  if (trace)
+  {
+    sim::settings.trace = trace_path ? fopen(trace_path, "w") : stdout;
+    if (!sim::settings.trace)
+    {
+      perror(trace_path);
+      return 1;
+    }
+    fputs("cycle,motor,event,position\n", sim::settings.trace);
+  }
+  if (blocks_path)
+  {
+    sim::settings.blocks = fopen(blocks_path, "w");
+    if (!sim::settings.blocks)
+    {
+      perror(blocks_path);
+      return 1;
+    }
+    fputs("steps,nominal_rate,initial_rate,final_rate,accelerate_until,decelerate_after,acceleration_rate\n", sim::settings.blocks);
+  }
+  if (profile_path)
+  {
+    sim::settings.profile = fopen(profile_path, "w");
+    if (!sim::settings.profile)
+    {
+      perror(profile_path);
+      return 1;
+    }
+    fputs("ms,X,Y,Z,E\n", sim::settings.profile);
+  }
+
+  sim::bind_pins();
+  reset_settings();
+  planner.init();
+  stepper.init();
+
+  char line[MAX_CMD_SIZE * 2];
+  unsigned long commands = 0;
+  sim::input_pending = true;
+  if (sim::settings.preempt_seed && !sim::settings.plan_only)
+  {
+    sim::start_preemption();
+  }
+  const double host_start = host_seconds();
+#if ENABLED(BINARY_PROTOCOL)
+  if (binary)
+  {
+    // As get_binary_commands, a frame at a time: its records go to the queue once they are all decoded, and share its
+    // bytes. After an M935 S0, the rest of the file is read as ASCII lines.
+    static char slots[Tuna::BinaryProtocol::payload_size][MAX_CMD_SIZE];
+    Tuna::BinaryProtocol::set_active(true);
+    uint32_t frame_bytes = 0;
+    uint8 records = 0;
+    while (Tuna::BinaryProtocol::active && !feof(input))
+    {
+      const auto reply = Tuna::BinaryProtocol::poll(
+        [&]() -> int16 {
+          const int c = fgetc(input);
+          if (c == EOF) return -1;
+          ++frame_bytes;
+          return int16(c);
+        },
+        [&]() { return !records || Tuna::BinaryProtocol::pending(); },
+        [&]() { return slots[records]; },
+        [&](char * const slot, const Tuna::BinaryProtocol::record record) {
+          if (record == Tuna::BinaryProtocol::record::move) ++binary_moves;
+          if (*slot) ++records;
+        });
+      if (reply == Tuna::BinaryProtocol::reply::malformed)
+      {
+        // The printer would stop: encode.rb wrote a frame the firmware cannot decode.
+        fprintf(stderr, "validation: frame %u does not decode\n", unsigned(Tuna::BinaryProtocol::expected));
+        ++sim::validation.failures;
+      }
+      bool switching = false;
+      for (uint8 r = 0; r < records; ++r)
+      {
+        const uint32_t share = frame_bytes / records + (r ? 0 : frame_bytes % records);
+        // The host waits for an M935's "ok" before it sends on.
+        if (!strncmp(slots[r], "M935", 4)) switching = true;
+        #if ENABLED(PREPARSED_COMMANDS)
+          // As process_next_command would have: a move is queued parsed.
+          make_room();
+          if (slots[r][0] == Tuna::BinaryProtocol::move_tag) Tuna::BinaryProtocol::queue_move(slots[r]);
+          else Tuna::CommandQueue::enqueue(slots[r], false);
+          queued(share);
+        #else
+          run_command(slots[r], share);
+        #endif
+      }
+      #if ENABLED(PREPARSED_COMMANDS)
+        while (switching && Tuna::CommandQueue::count) run_command(nullptr, queued_bytes[queued_front++]);
+      #else
+        UNUSED(switching);
+      #endif
+      records = 0;
+      frame_bytes = 0;
+    }
+  }
+#endif
+  while (fgets(line, sizeof(line), input))
+  {
+    char *start = strip_line(line);
+    if (!*start)
+    {
+      continue;
+    }
+
+    ++commands;
+    #if ENABLED(BAUD_SWITCHING)
+      if (link_baud && !link_clean()) lose_line(start, commands);
+    #endif
+    const uint32_t bytes = link_baud ? numbered_length(start, commands) : 0;
+    #if ENABLED(RX_LINE_ASSEMBLER)
+      // The numbered line, as the parser takes it from the serial port.
+      char * const command = assemble_line(start, commands);
+      if (!command)
+      {
+        if (Tuna::LineAssembler::available()) Tuna::LineAssembler::pop();
+        continue;
+      }
+    #else
+      char * const command = start;
+    #endif
+    #if ENABLED(BAUD_SWITCHING)
+      if (link_baud) line_received(start, commands);
+    #endif
+    #if ENABLED(PREPARSED_COMMANDS)
+      #if ENABLED(BAUD_SWITCHING)
+        // The host waits for an M938's "ok" before it sends on.
+        const bool switching = link_baud && !strncmp(start, "M938", 4);
+      #endif
+      queue_command(command, bytes);
+      #if ENABLED(BAUD_SWITCHING)
+        while (switching && Tuna::CommandQueue::count) run_command(nullptr, queued_bytes[queued_front++]);
+      #endif
+    #else
+      run_command(command, bytes);
+    #endif
+    #if ENABLED(RX_LINE_ASSEMBLER)
+      #if ENABLED(BAUD_SWITCHING)
+        // Claimed before it ran, on the printer: a switch it made has cleared the ring since.
+        if (Tuna::LineAssembler::available())
+      #endif
+      Tuna::LineAssembler::pop();
+    #endif
+  }
+  #if ENABLED(PREPARSED_COMMANDS)
+    while (Tuna::CommandQueue::count) run_command(nullptr, queued_bytes[queued_front++]);
+  #endif
+  #if ENABLED(BAUD_SWITCHING)
+    // A switch no line followed goes back once its time is up.
+    while (link_baud && Tuna::BaudSwitch::fallback)
+    {
+      sim::run_until(sim::now() + sim::cpu_hz / 1000);
+      manage_baud_switch();
+    }
+    if (link_baud && Tuna::BaudSwitch::baud != link_baud)
+    {
+      fprintf(stderr, "validation: the firmware ended at %lu baud, the host at %lu\n", (unsigned long)Tuna::BaudSwitch::baud,
+        (unsigned long)link_baud);
+      ++sim::validation.failures;
+    }
+  #endif
+  sim::input_pending = false;
+  synchronize();
+  #if ENABLED(SERIAL_TX_LANES)
+    if (serial_out) Tuna::serialTx.flush();
+  #endif
+  const double host_elapsed = host_seconds() - host_start;
+  sim::stop_preemption();
+
+  fclose(input);
+  if (sim::settings.blocks)
+  {
+    fclose(sim::settings.blocks);
+  }
+  if (sim::settings.profile)
+  {
+    sim::flush_profile();
+    fclose(sim::settings.profile);
+  }
+  if (sim::settings.trace && sim::settings.trace != stdout)
+  {
+    fclose(sim::settings.trace);
+  }
+
+  if (sim::settings.plan_only)
+  {
+    fprintf(stderr, "planned %lu segments in %.6f s of host time (%.0f segments/s)\n",
+      (unsigned long)segments, host_elapsed, host_elapsed > 0.0 ? segments / host_elapsed : 0.0);
+  }
+  else
+  {
+    sim::report(stderr);
+  }
+#if ENABLED(SEGMENT_MERGING)
+  fprintf(stderr, "merging: %lu moves, %lu merged\n", (unsigned long)planner.merge_stats.moves, (unsigned long)planner.merge_stats.merged);
+#endif
+#if ENABLED(STEPPER_RAMP_CACHE)
+  fprintf(stderr, "ramp cache: %lu lookups, %lu hits; %lu ramp updates loaded, %lu calculated\n", (unsigned long)stepper.ramp_stats.lookups,
+    (unsigned long)stepper.ramp_stats.hits, (unsigned long)stepper.ramp_stats.loaded, (unsigned long)stepper.ramp_stats.calculated);
+#endif
+#if ENABLED(ARC_SUPPORT)
+  fprintf(stderr, "arcs: %lu native, %lu segmented\n", (unsigned long)native_arcs, (unsigned long)segmented_arcs);
+#endif
+#if ENABLED(BINARY_PROTOCOL)
+  if (binary)
+  {
+    const auto &s = Tuna::BinaryProtocol::stats;
+    fprintf(stderr, "binary protocol: %lu frames, %lu records (%lu moves), %u duplicates, %u errors\n", (unsigned long)s.frames,
+      (unsigned long)s.records, (unsigned long)binary_moves, unsigned(s.duplicates), unsigned(s.errors));
+  }
+#endif
+#if ENABLED(PREPARSED_COMMANDS)
+  report_queue(stderr);
+#endif
+#if ENABLED(RX_LINE_ASSEMBLER)
+  {
+    const auto &s = Tuna::LineAssembler::stats;
+    fprintf(stderr, "line assembler: %lu lines, %u overflows, %u truncated, %lu mismatched\n", (unsigned long)s.lines,
+      unsigned(s.overflows), unsigned(s.truncated), (unsigned long)assembler_mismatches);
+  }
+#endif
+  if (link_baud)
+  {
+    fprintf(stderr, "link: %lu baud, %llu bytes for %lu commands, waited %.6f s for input\n", (unsigned long)link_baud,
+      (unsigned long long)link_bytes, (unsigned long)link_commands, double(link_waited) / sim::cpu_hz);
+    #if ENABLED(BAUD_SWITCHING)
+      fprintf(stderr, "baud switching: %lu switches, %lu confirmed, %lu fell back, %lu lines sent again, %lu unsupported\n",
+        (unsigned long)baud_switches, (unsigned long)baud_confirmed, (unsigned long)baud_fallbacks,
+        (unsigned long)baud_resent, (unsigned long)baud_unsupported);
+    #endif
+  }
+  if (serial_out)
+  {
+    fprintf(stderr, "serial out: %llu bytes, %lu oks, %lu status and %lu debug lines read; ok took %.3f ms on average, %.3f ms at most\n",
+      (unsigned long long)serial_bytes, (unsigned long)oks_read, (unsigned long)status_lines, (unsigned long)debug_lines,
+      oks_read ? double(ok_latency) / oks_read * 1000.0 / sim::cpu_hz : 0.0, double(ok_latency_max) * 1000.0 / sim::cpu_hz);
+    #if ENABLED(SERIAL_TX_LANES)
+      const auto &s = Tuna::SerialTx::stats;
+      fprintf(stderr, "serial lanes: main loop waited %.6f s for room in %u writes, %u bytes queued at most; %u status lines coalesced, %u dropped\n",
+        double(s.stall_us) / 1e6, unsigned(s.stalls), unsigned(s.peak), unsigned(s.coalesced), unsigned(s.dropped));
+    #else
+      fprintf(stderr, "serial ring: main loop waited %.6f s for room in %lu writes\n", double(ring_stall_cycles) / sim::cpu_hz,
+        (unsigned long)ring_stalls);
+    #endif
+  }
+#if ENABLED(BEZIER_CURVE_SUPPORT)
+  fprintf(stderr, "curves: %lu, %lu segments", (unsigned long)curves, (unsigned long)curve_segments);
+  if (!sim::settings.plan_only) fprintf(stderr, ", max deviation %.4f mm", curve_deviation);
+  fputc('\n', stderr);
+  time_curve_tracers();
+#endif
+#if ENABLED(PLANNER_PROFILING)
+  fprintf(stderr, "planner: %lu segments, %.2f reverse, %.2f forward, %.2f trapezoids per segment, max %u blocks\n",
+    (unsigned long)planner.profile.segments,
+    double(planner.profile.reverse) / max(planner.profile.segments, 1_u32),
+    double(planner.profile.forward) / max(planner.profile.segments, 1_u32),
+    double(planner.profile.trapezoids) / max(planner.profile.segments, 1_u32),
+    unsigned(planner.profile.max_touched));
+#endif
+#if ENABLED(STEP_RECORDING)
+  if (record_log)
+  {
+    fprintf(stderr, "step record: %lu dumps, %lu entries compared (%lu blocks), %lu unmatched; differing: %lu intervals, %lu step_loops, %lu advance, %lu blocks; clamped: %lu logged, %lu simulated\n",
+      (unsigned long)record_dumps, (unsigned long)record_compared, (unsigned long)record_blocks, (unsigned long)record_unmatched,
+      (unsigned long)record_intervals, (unsigned long)record_loops, (unsigned long)record_advances, (unsigned long)record_misaligned,
+      (unsigned long)record_log_clamped, (unsigned long)record_sim_clamped);
+    if (record_first[0]) fprintf(stderr, "step record: first difference in %s\n", record_first);
+    fclose(record_log);
+  }
+  if (record_out) fclose(record_out);
+#endif
+  if (unhandled)
+  {
+    fprintf(stderr, "%lu commands ignored\n", (unsigned long)unhandled);
+  }
+  const auto &v = sim::validation;
+  if (!sim::settings.plan_only)
+  {
+    fprintf(stderr, "validation: %lu blocks, %lu idle checks, %lu cut short by endstops, %lu dropped, %lu failures (%lu assumptions)\n",
+      (unsigned long)v.blocks, (unsigned long)v.idle_checks, (unsigned long)v.aborted, (unsigned long)v.dropped,
+      (unsigned long)v.failures, (unsigned long)v.assumptions);
+  }
+  else if (v.failures)
+  {
+    // Nothing is stepped, so only the planner's assumptions were checked.
+    fprintf(stderr, "validation: %lu failed assumptions\n", (unsigned long)v.failures);
+  }
+  return sim::validation.failures ? 3 : 0;
+}
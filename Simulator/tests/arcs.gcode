@@ -0,0 +1,15 @@
+; G2/G3 through the firmware's plan_arc: full circles, R arcs both ways, a helix, and an arc too short to plan.
+G28
+G90
+M82
+G92 E0
+G1 Z0.3 F600
+G0 X110 Y100 F6000
+G2 X110 Y100 I-10 J0 E2 F1800
+G3 X100 Y110 I-10 J0 E3 F1800
+G0 X40 Y40 F6000
+G2 X50 Y40 R5 E3.5 F2400
+G3 X50 Y50 R-7.5 F2400
+G2 X60 Y60 I5 J5 Z2.3 E4 F1200
+G2 X60.0002 Y60 I0.0001 J0 F1200
+G1 X40 Y40 Z0.3 F6000
@@ -0,0 +1,14 @@
+; M938, run with -L 115200:250000: a switch the link carries, confirmed by the next line; one it does not, which falls
+; back after T, the line sent at it sent again; and a switch back down.
+G28
+G90
+G1 X20 Y20 F6000
+M938 B250000
+G1 X40 Y30 F6000
+G1 X60 Y40 F6000
+M938 B1000000 T300
+G1 X80 Y50 F6000
+G1 X100 Y60 F6000
+M938 B115200
+G1 X20 Y20 F6000
+M400
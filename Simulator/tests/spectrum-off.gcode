@@ -0,0 +1,47 @@
+; The moves of spectrum.gcode, unshaped.
+G90
+M593 F0
+M204 S3000
+M201 X3000 Y3000
+G1 X100 Y100 F6000
+G1 X66.105 Y114.594 F8699
+G1 X138.258 Y91.891 F6257
+G1 X103.080 Y95.078 F7462
+G1 X93.550 Y61.114 F4092
+G1 X129.504 Y83.159 F8195
+G1 X113.946 Y107.062 F6516
+G1 X77.071 Y91.649 F4176
+G1 X81.007 Y112.553 F7032
+G1 X128.104 Y72.184 F3772
+G1 X135.010 Y91.418 F4219
+G1 X120.033 Y106.831 F4728
+G1 X68.038 Y93.785 F5988
+G1 X89.791 Y93.418 F5793
+G1 X127.033 Y113.805 F8271
+G1 X74.366 Y69.990 F5404
+G1 X96.227 Y84.708 F8339
+G1 X82.618 Y124.470 F3787
+G1 X117.546 Y88.909 F4865
+G1 X74.436 Y111.878 F8250
+G1 X100.316 Y103.628 F8751
+G1 X101.832 Y89.042 F3784
+G1 X113.381 Y90.765 F7489
+G1 X101.948 Y108.731 F7732
+G1 X99.154 Y126.779 F7923
+G1 X84.708 Y101.482 F8594
+G1 X137.198 Y126.153 F6287
+G1 X112.739 Y106.320 F6485
+G1 X70.489 Y81.611 F6720
+G1 X67.648 Y115.923 F6733
+G1 X70.950 Y84.048 F7591
+G1 X84.034 Y71.585 F3169
+G1 X80.636 Y96.392 F5238
+G1 X123.711 Y96.567 F4954
+G1 X122.257 Y122.110 F8469
+G1 X124.038 Y125.738 F5895
+G1 X89.807 Y87.013 F8096
+G1 X98.061 Y115.773 F7041
+G1 X127.330 Y115.071 F3233
+G1 X99.681 Y93.114 F7565
+G1 X94.216 Y101.990 F4848
+M400
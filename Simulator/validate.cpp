@@ -0,0 +1,323 @@
+// Position validation: checks that the stepper and the planner agree on where every axis is, as the firmware runs.
+//
+// Stepper::count_position is counted in the stepper ISR as it pulses, and Planner::position is set as blocks are
+// buffered and by set_position_mm. Nothing in the firmware checks one against the other, so a step that is lost (or
+// taken twice) only shows up as a print defect. Here, from the stepper ISR's point of view:
+//
+//   - Each block that runs to its end moves each axis exactly its steps[], in its direction.
+//   - When a block is picked up, the planner's position is count_position plus the steps of every block still
+//     buffered, including that one, for X, Y and Z. (E is left out: its blocks are scaled by M221 and the volumetric
+//     multiplier, and its planner position is not.)
+//   - count_position moves with the step pins, except where set_position rebases it. (E is left out with LIN_ADVANCE:
+//     its pins also carry the advance offset.)
+//   - Once everything is stepped, the planner's position is count_position, for X, Y and Z.
+//
+// A block cut short by an endstop leaves the positions unknown until they are set again. A quick stop (M410) sets them
+// from where the stepper stopped, but then drops what is buffered for 5000 more stepper ISRs, even moves queued after it,
+// which the planner still counts in its position. The steps of every dropped block are added up, and the planner's
+// position is checked against count_position plus those, from the drop on; an axis is back in step once it is set. (A
+// dropped arc's steps[] are not its displacement, so it leaves the positions unknown.)
+// With INPUT_SHAPING, count_position of X and Y follows the shaped motors, so those are only compared when no echoes
+// are pending. Arcs (NATIVE_ARCS) turn within their block, so their steps[] are not their displacement.
+//
+// The planner shares the block buffer with the ISR without critical sections, so also:
+//
+//   - A block is only picked up while it, and the block after it, are not being rewritten (their sequence is even).
+//   - Nothing the ISR traces a block by changes from its pickup to its end.
+//
+// The planner's position is not checked at pickups that preempt the main loop (-S): it is updated just after a block is
+// published.
+//
+// Failed checks, and failed __assume statements anywhere in the firmware, are reported as they happen and counted.
+
+#include <tuna.h>
+
+#include "planner.h"
+#include "stepper.h"
+#include "endstops.h"
+
+#include <sim/simulator.h>
+
+#include <stdarg.h>
+
+namespace sim
+{
+  validation_stats validation;
+
+  namespace
+  {
+    constexpr uint32_t reported_failures = 20;
+
+    const char axis_names[XYZE] = { 'X', 'Y', 'Z', 'E' };
+
+    struct block_check final
+    {
+      bool active = false;
+      bool arc = false;
+      int32_t start[XYZE];         // count_position when the block was picked up
+      int32_t steps[XYZE];         // Signed
+      bool shaped_start = false;   // Input shaping echoes were pending when it was picked up
+      block_t picked_up;           // The block as it was picked up
+    };
+
+    const block_t *tracked_block = nullptr;
+    block_check current, finished;
+    int32_t counted_before[XYZE];     // count_position before the ISR: one that picks up a block also steps it
+    int64_t pins_before[XYZE];
+    uint8_t tail_before;              // A block of one event is picked up and ended by the same ISR
+    bool position_known = true;
+    int32_t dropped_steps[XYZ] = {};  // Of the blocks dropped after a quick stop, which the planner has counted
+    int64_t pin_offset[XYZE] = {}; // count_position less the pin position, between set_positions
+
+    void fail(const char *format, ...) __attribute__((format(printf, 1, 2)));
+    void fail(const char *format, ...)
+    {
+      ++validation.failures;
+      if (validation.failures > reported_failures) return;
+      fprintf(stderr, "validation: %.6f s: ", double(now()) / cpu_hz);
+      va_list args;
+      va_start(args, format);
+      vfprintf(stderr, format, args);
+      va_end(args);
+      fputc('\n', stderr);
+      if (validation.failures == reported_failures) fprintf(stderr, "validation: further failures are only counted\n");
+    }
+
+    int32_t count(const uint8_t axis)
+    {
+      return Stepper::position(AxisEnum(axis));
+    }
+
+    bool shaping_pending()
+    {
+      #if ENABLED(INPUT_SHAPING)
+        return Stepper::shaping_pending();
+      #else
+        return false;
+      #endif
+    }
+
+    bool is_arc(const block_t *block)
+    {
+      #if ENABLED(NATIVE_ARCS)
+        return TEST(block->flag, BLOCK_BIT_ARC);
+      #else
+        UNUSED(block);
+        return false;
+      #endif
+    }
+
+    void signed_steps(const block_t *block, int32_t (&steps)[XYZE])
+    {
+      LOOP_XYZE(i) {
+        steps[i] = TEST(block->direction_bits, i) ? -int32_t(block->steps[i]) : int32_t(block->steps[i]);
+      }
+    }
+
+    // count_position against the step pins.
+    void check_pins(const char *where, const int32_t (&counted)[XYZE], const int64_t (&pins)[XYZE])
+    {
+      LOOP_XYZE(i) {
+        #if ENABLED(LIN_ADVANCE)
+          if (i == E_AXIS) continue;
+        #endif
+        const int64_t offset = int64_t(counted[i]) - pins[i];
+        if (offset != pin_offset[i])
+        {
+          fail("%s: %c count_position %ld, but its pins moved %lld steps from it", where, axis_names[i],
+            (long)counted[i], (long long)(offset - pin_offset[i]));
+          pin_offset[i] = offset;
+        }
+      }
+    }
+
+    // The planner's position against count_position and the steps buffered from tail on.
+    void check_planner(const char *where, const int32_t (&counted)[XYZE], const uint8_t tail)
+    {
+      int32_t buffered[XYZ] = {};
+      for (uint8_t b = tail; b != planner.block_buffer_head; b = BLOCK_MOD(b + 1))
+      {
+        const block_t *block = &planner.block_buffer[b];
+        if (is_arc(block)) return;
+        int32_t steps[XYZE];
+        signed_steps(block, steps);
+        LOOP_XYZ(i) buffered[i] += steps[i];
+      }
+      const bool shaped = shaping_pending();
+      LOOP_XYZ(i) {
+        if (shaped && i != Z_AXIS) continue;
+        const int32_t planned = Planner::position_steps(AxisEnum(i));
+        if (planned != counted[i] + buffered[i] + dropped_steps[i])
+        {
+          fail("%s: %c planner position %ld, but count_position %ld, %ld steps buffered and %ld dropped", where,
+            axis_names[i], (long)planned, (long)counted[i], (long)buffered[i], (long)dropped_steps[i]);
+        }
+      }
+    }
+
+    // The block that ended last against its steps, once its last steps are all taken.
+    void check_finished(const int32_t (&counted)[XYZE])
+    {
+      if (!finished.active) return;
+      finished.active = false;
+      if (finished.arc) return;
+      const bool shaped = finished.shaped_start || shaping_pending();
+      LOOP_XYZE(i) {
+        if (shaped && i <= Y_AXIS) continue;
+        const int32_t moved = counted[i] - finished.start[i];
+        if (moved != finished.steps[i])
+        {
+          fail("block %lu: %c moved %ld steps of %ld", (unsigned long)validation.blocks, axis_names[i], (long)moved, (long)finished.steps[i]);
+        }
+      }
+    }
+
+    // Whether the trapezoid the ISR traces a block by differs from when it was picked up.
+    bool trapezoid_changed(const block_t *block, const block_t &before)
+    {
+      return block->step_event_count != before.step_event_count || block->accelerate_until != before.accelerate_until
+        || block->decelerate_after != before.decelerate_after || block->acceleration_rate != before.acceleration_rate
+        || block->initial_rate != before.initial_rate || block->final_rate != before.final_rate
+        || block->nominal_rate != before.nominal_rate
+        #if ENABLED(LIN_ADVANCE)
+          || block->la_cruise_steps != before.la_cruise_steps || block->la_final_steps != before.la_final_steps
+        #endif
+        ;
+    }
+
+    // The block the ISR was tracing has ended, or was dropped.
+    void block_end(const block_t *block)
+    {
+      if (current.active && trapezoid_changed(block, current.picked_up))
+      {
+        fail("block %lu: the planner rewrote its trapezoid while it ran", (unsigned long)validation.blocks);
+      }
+      // An endstop cut it short: where the axes are is known again once they are set.
+      if (endstops.endstop_hit_bits)
+      {
+        ++validation.aborted;
+        position_known = false;
+      }
+      else if (position_known)
+      {
+        finished = current;
+      }
+      current.active = false;
+    }
+
+    void block_pickup(const block_t *block, const uint8_t index)
+    {
+      ++validation.blocks;
+      const uint8_t next = BLOCK_MOD(index + 1);
+      if ((block->sequence & 1) || (next != planner.block_buffer_head && (planner.block_buffer[next].sequence & 1)))
+      {
+        fail("block %lu: picked up while the planner was rewriting it, or the next block", (unsigned long)validation.blocks);
+      }
+      if (position_known)
+      {
+        check_finished(counted_before);
+        check_pins("block pickup", counted_before, pins_before);
+        // The planner publishes a block before it updates its position: from anywhere in the main loop, the two can
+        // disagree for a moment.
+        if (!isr_preempted_main()) check_planner("block pickup", counted_before, tail_before);
+      }
+
+      current.active = true;
+      current.arc = is_arc(block);
+      current.shaped_start = shaping_pending();
+      COPY(current.start, counted_before);
+      signed_steps(block, current.steps);
+      current.picked_up = *block;
+    }
+  }
+
+  void validate_isr_enter()
+  {
+    LOOP_XYZE(i) {
+      counted_before[i] = count(i);
+      pins_before[i] = motors[i].position;
+    }
+    tail_before = planner.block_buffer_tail;
+  }
+
+  void validate_isr()
+  {
+    const block_t *block = Stepper::current_block;
+    if (block == tracked_block)
+    {
+      if (!block && planner.block_buffer_tail != tail_before)
+      {
+        // Nothing stepped, or was left to the shaper: after a quick stop, the stepper discards what is buffered for a
+        // while, which the planner does not know of.
+        bool stepped = shaping_pending();
+        LOOP_XYZE(i) stepped |= (count(i) != counted_before[i]);
+        if (!stepped)
+        {
+          ++validation.dropped;
+          if (is_arc(&planner.block_buffer[tail_before]))
+          {
+            position_lost();
+            return;
+          }
+          int32_t steps[XYZE];
+          signed_steps(&planner.block_buffer[tail_before], steps);
+          LOOP_XYZ(i) dropped_steps[i] += steps[i];
+          return;
+        }
+        // Picked up and stepped to its end in this ISR: the block is still in the buffer, behind the tail.
+        block_pickup(&planner.block_buffer[tail_before], tail_before);
+        block_end(&planner.block_buffer[tail_before]);
+      }
+      return;
+    }
+
+    if (tracked_block) block_end(tracked_block);
+    tracked_block = block;
+    if (block) block_pickup(block, planner.block_buffer_tail);
+  }
+
+  void validate_idle()
+  {
+    // With -b, nothing steps the blocks.
+    if (settings.plan_only || !position_known) return;
+    Tuna::critical_section _critsec;
+    ++validation.idle_checks;
+    int32_t counted[XYZE];
+    int64_t pins[XYZE];
+    LOOP_XYZE(i) {
+      counted[i] = count(i);
+      pins[i] = motors[i].position;
+    }
+    check_finished(counted);
+    check_pins("idle", counted, pins);
+    check_planner("idle", counted, planner.block_buffer_tail);
+  }
+
+  void position_lost()
+  {
+    Tuna::critical_section _critsec;
+    position_known = false;
+    finished.active = current.active = false;
+    // The quick stop that follows takes the stepper's block away outside the ISR.
+    tracked_block = nullptr;
+  }
+
+  void position_set()
+  {
+    Tuna::critical_section _critsec;
+    position_known = true;
+    finished.active = false;
+    LOOP_XYZE(i) pin_offset[i] = int64_t(count(i)) - motors[i].position;
+    // Nothing is buffered: an axis that was set is where the planner has it.
+    LOOP_XYZ(i) {
+      if (Planner::position_steps(AxisEnum(i)) == count(i)) dropped_steps[i] = 0;
+    }
+  }
+}
+
+// A failed __assume (tunalib/macros.hpp), which the firmware takes for granted.
+void __assume_failed(const char *expression, const char *file, const int line)
+{
+  ++sim::validation.assumptions;
+  sim::fail("%s:%d: __assume(%s) failed", file, line, expression);
+}
@@ -0,0 +1,50 @@
+# Runs a G-code corpus through a built simulator and summarizes the position validation of every file.
+#
+#   ruby validate.rb prints/                       # every .gcode file under prints/, with ./build/simulator
+#   ruby validate.rb -s simulator-fixed a.gcode b.gcode
+#   ruby validate.rb -S 1 prints/                  # with stepper ISRs preempting the planner, from seed 1
+#
+# Each file is run without a trace (-n). A file fails when the simulator exits non-zero: 3 for validation failures,
+# anything else for a crash. The first lines the simulator reported for a failing file are repeated, and the exit
+# status is the number of files that failed.
+
+$ROOT = File.expand_path(File.dirname(__FILE__))
+
+$SIMULATOR = "simulator"
+$OPTIONS = ["-n"]
+$REPORTED_LINES = 8
+
+paths = []
+args = ARGV.dup
+while (arg = args.shift)
+	if (arg == "-s" && args.length != 0)
+		$SIMULATOR = args.shift
+	elsif (arg == "-S" && args.length != 0)
+		$OPTIONS += ["-S", args.shift]
+	elsif (arg.start_with?("-"))
+		raise ArgumentError.new("usage: validate.rb [-s simulator] [-S seed] file.gcode|directory...")
+	else
+		paths << arg
+	end
+end
+
+files = paths.flat_map { |path| File.directory?(path) ? Dir.glob(path + "/**/*.gcode").sort : [path] }
+raise ArgumentError.new("no G-code files given") if (files.empty?)
+
+binary = $ROOT + "/build/" + $SIMULATOR
+raise ArgumentError.new("#{binary} is not built") if (!File.executable?(binary))
+
+failed = 0
+files.each { |file|
+	output = IO.popen([binary, *$OPTIONS, file, :err => [:child, :out]]) { |io| io.read }
+	status = $?.exitstatus
+	summary = output.lines.grep(/^validation: \d+ blocks/).last
+	puts "#{file}: #{summary ? summary.sub(/^validation: /, "").strip : "no summary"}"
+	next if (status == 0)
+	failed += 1
+	puts "  exit status #{status.inspect}"
+	output.lines.grep(/^validation: \d+\.\d+ s:/).first($REPORTED_LINES).each { |line| puts "  " + line }
+}
+
+puts "#{files.length} files, #{failed} failed"
+exit [failed, 255].min
@@ -106,9 +106,11 @@
  * This setting determines the communication speed of the printer.
  *
  * 250000 works in most cases, but you might try a lower speed if
- * you commonly experience drop-outs during host printing.
+ * you commonly experience drop-outs during host printing. A rate the
+ * USART makes more than 2.5% off (230400 at 16 MHz) fails to build.
+ * With BAUD_SWITCHING, M938 moves to a faster one from here.
  *
- * :[2400, 9600, 19200, 38400, 57600, 115200, 250000]
+ * :[2400, 9600, 19200, 38400, 57600, 115200, 250000, 500000, 1000000]
  */
 #define BAUDRATE 115200
 
@@ -475,6 +477,9 @@
 
 // Enable this feature if all enabled endstop pins are interrupt-capable.
 // This will remove the need to poll the interrupt pins, saving many CPU cycles.
+// The stepper ISR then only samples the endstops after a pin change, and long step
+// intervals are no longer split to poll them. The stock Bi3Plus endstop pins are not
+// interrupt-capable; see X_STOP_PIN in pins_BI3_PLUS.h.
 //#define ENDSTOP_INTERRUPTS_FEATURE
 
 //=============================================================================
@@ -557,6 +562,31 @@ template <uint32_t _steps, uint32_t _microsteps, uint32_t _ratio> static constex
 #define DEFAULT_ZJERK                  2
 #define DEFAULT_EJERK                  35.0
 
+/**
+ * Junction Deviation
+ *
+ * Limit the speed through each corner with Grbl's junction deviation model
+ * instead of the per-axis jerk: the fastest speed at which a circle tangent
+ * to both moves, deviating JUNCTION_DEVIATION_MM from the corner, can be
+ * followed at the block's acceleration. Collinear moves keep their full speed
+ * however short they are. The E jerk still limits the junction speed of
+ * extruding moves.
+ *
+ * M205 J sets the deviation (mm). M205 J0 goes back to the jerk limits.
+ */
+//#define JUNCTION_DEVIATION
+#define JUNCTION_DEVIATION_MM 0.02
+
+/**
+ * S-Curve Acceleration
+ *
+ * Replace the linear speed ramps of the trapezoid with a 5th order Bezier curve
+ * in time (6th order in position), so acceleration and jerk are zero at both ends
+ * of every ramp. Each ramp takes the same time and covers the same distance as the
+ * trapezoid's, but its peak acceleration is 1.875 times the configured value.
+ */
+//#define S_CURVE_ACCELERATION
+
 /**
 * Default Preheating Presets
 * Specific to i3Plus+
@@ -577,6 +577,9 @@
  * Assumption: advance = k * (delta velocity)
  * K=0 means advance disabled.
  * See Marlin documentation for calibration instructions.
+ *
+ * The planner works out each block's advance offsets and the interval between advance steps;
+ * E is stepped with the other axes, and the advance ISR only walks the offset, one step at a time.
  */
 #define LIN_ADVANCE
 
@@ -637,16 +640,32 @@
 //
 // G2/G3 Arc Support
 //
-//#define ARC_SUPPORT               // Disable this feature to save ~3226 bytes
+#define ARC_SUPPORT               // Disable this feature to save ~3226 bytes
 #if ENABLED(ARC_SUPPORT)
   #define MM_PER_ARC_SEGMENT  1   // Length of each arc segment
   #define N_ARC_CORRECTION   25   // Number of intertpolated segments between corrections
   #define ARC_P_CIRCLES         // Enable the 'P' parameter to specify complete circles
   #define CNC_WORKSPACE_PLANES  // Allow G2/G3 to operate in XY, ZX, or YZ planes
+
+  /**
+   * Native arcs
+   *
+   * Plan an XY arc as a single block and let the stepper ISR trace the circle itself,
+   * instead of buffering one line segment per MM_PER_ARC_SEGMENT. An arc step event costs
+   * the ISR an estimated 40 cycles more than a line's. Arcs that cannot be traced this way
+   * (different X and Y steps/mm, radius over 16383 steps, too much Z or E for their
+   * length, reaching past the software endstops, leveling) are still segmented.
+   */
+  //#define NATIVE_ARCS
 #endif
 
 // Support for G5 with XYZE destination and IJPQ offsets. Requires ~2666 bytes.
 #define BEZIER_CURVE_SUPPORT
+#if ENABLED(BEZIER_CURVE_SUPPORT)
+  #define BEZIER_TOLERANCE         0.1  // (mm) Largest distance of a segment's midpoint from the curve, as |X| + |Y|
+  #define BEZIER_MIN_SEGMENT_STEPS   4  // Segments this short (in steps of the finer of X and Y) aren't split further
+  #define BEZIER_BATCH_BLOCKS        8  // Plan a curve's segments this many at a time, while this many are queued ahead
+#endif
 
 // G38.2 and G38.3 Probe Target
 // Enable PROBE_DOUBLE_TOUCH if you want G38 to double touch
@@ -658,6 +677,92 @@
 // Moves (or segments) with fewer steps than this will be joined with the next move
 #define MIN_STEPS_PER_SEGMENT 1 // TODO
 
+// Plan junction speeds as squared fixed-point values and compute the trapezoid
+// with integer math instead of float. The look-ahead passes then need no sqrt or
+// divides. Step rates are limited to 65535 steps/s and speeds to ~2896 mm/s.
+//#define PLANNER_FIXED_POINT
+
+// While the planner waits for room in a full buffer, precompute the stepper intervals
+// of the next block's initial and nominal rates, the last RAMP_TABLE_LENGTH ISRs of its
+// acceleration and the first RAMP_TABLE_LENGTH of its deceleration. Those ISRs then
+// load their interval instead of multiplying and dividing, which is where the ISR is
+// shortest on time. Uses 2 * (9 + 10 * RAMP_TABLE_LENGTH) bytes of SRAM.
+//#define STEPPER_RAMP_TABLES
+#if ENABLED(STEPPER_RAMP_TABLES)
+  #define RAMP_TABLE_LENGTH 16 // Power of 2, up to 128
+#endif
+
+// Instead of a table per block, keep a few acceleration and deceleration ramps that all
+// blocks share, keyed by the acceleration rate and the step rate they start from. A print
+// only uses a handful of accelerations (M204), and its moves mostly start from rest or
+// cruise at a feedrate it has used before. While the planner waits for room in a full
+// buffer, the next block's ramps are looked up, and calculated into the least recently
+// used entry if missing. The first RAMP_CACHE_LENGTH ISRs of each ramp then load their
+// interval. M934 reports the hit rates. Uses RAMP_CACHE_SIZE * (12 + 5 * RAMP_CACHE_LENGTH)
+// bytes of SRAM. Not with STEPPER_RAMP_TABLES or S_CURVE_ACCELERATION.
+//#define STEPPER_RAMP_CACHE
+#if ENABLED(STEPPER_RAMP_CACHE)
+  #define RAMP_CACHE_SIZE    4 // Ramps, 4 to 8
+  #define RAMP_CACHE_LENGTH 32 // ISRs per ramp, up to 255
+#endif
+
+// Above 10kHz the stepper ISR takes 2, 4 or 8 step events back to back and then waits for
+// as long, which is rough on the motors. Instead, take one event per interrupt, spread
+// evenly over the interval; the speed ramp is still only updated once per interval. An
+// axis that does not step on every event is also given its own time within the interval
+// from a small queue, rather than stepping together with the leading axis, so each axis
+// keeps its own step rate. Steps less than MULTI_RATE_MIN_TICKS (0.5µs Timer1 ticks)
+// apart are taken in the same interrupt, so it has to cover a stepping-only interrupt plus
+// 16 ticks. This costs more, shorter, interrupts.
+//#define MULTI_RATE_STEPPING
+#if ENABLED(MULTI_RATE_STEPPING)
+  #define MULTI_RATE_MIN_TICKS 44 // At least 16
+#endif
+
+// Start and end the step pulses of all axes with one store per port, to the port's input
+// register (writing ones there toggles those output bits), instead of a read-modify-write
+// per axis. On the i3 Plus, X and E share port F and Y and Z share port K: two stores
+// instead of four, and none of the critical sections port K needs. Every pulse is then as
+// wide as the wait between the two stores. Single extruder, single stepper per axis only.
+//#define BATCHED_STEP_PULSES
+
+// Input shaping: cancel the ringing of the frame at a resonance of X and of Y. Each step of
+// the axis is split into two or three impulses (a share right away, the rest as echoes a
+// fraction of a ringing period later) whose ringing cancels out, so acceleration can be
+// raised without ghosting. Corners are smoothed over the longest delay. Types:
+//   ZV  - two impulses, half a period: the least smoothing, the narrowest notch
+//   ZVD - three impulses, a whole period: a wider notch, for a frequency known less well
+//   MZV - three impulses, 3/4 of a period: about as wide as ZVD, with less smoothing
+// M593 sets the type, frequency and damping of each axis; a frequency of 0 disables it.
+// Steps wait for their echoes in a queue of SHAPING_BUFFER_SIZE * 8 bytes of SRAM; while it
+// is full, the stepper waits. Steps less than SHAPING_MERGE_TICKS (0.5µs Timer1 ticks) apart
+// share an entry, so 128 entries at the default 400 cover at least 25ms of steps at any rate.
+// Shaping is suspended while homing. Requires LIN_ADVANCE (it shares the advance ISR's timer).
+//#define INPUT_SHAPING
+#if ENABLED(INPUT_SHAPING)
+  #define SHAPING_TYPE ZV             // ZV, ZVD or MZV
+  #define SHAPING_FREQ_X 40.0         // (Hz) Ringing frequency of X. 0 disables.
+  #define SHAPING_FREQ_Y 40.0         // (Hz) Ringing frequency of Y. 0 disables.
+  #define SHAPING_ZETA_X 0.15         // Damping ratio of X, 0 to < 1
+  #define SHAPING_ZETA_Y 0.15         // Damping ratio of Y, 0 to < 1
+  #define SHAPING_MIN_FREQ 10.0       // (Hz) Lowest frequency M593 accepts
+  #define SHAPING_BUFFER_SIZE 128     // Power of 2, up to 256
+  #define SHAPING_MERGE_TICKS 400     // 200µs
+#endif
+
+// Merge consecutive G0/G1 moves that continue in nearly the same direction at the
+// same feedrate and extrusion per mm into one planner block, so dense models use
+// fewer blocks and less planner time. A move is only held back to wait for the next
+// one while at least SEGMENT_MERGE_MIN_BLOCKS blocks are queued. Use M932 to change
+// the tolerances at runtime and to report how many moves were merged.
+//#define SEGMENT_MERGING
+#if ENABLED(SEGMENT_MERGING)
+  #define SEGMENT_MERGE_ANGLE 1.0       // (degrees) Largest direction change merged across
+  #define SEGMENT_MERGE_E_RATIO 0.05    // Largest relative change in extrusion per mm merged across
+  #define SEGMENT_MERGE_MAX_LENGTH 2.0  // (mm) Longest move merging may produce
+  #define SEGMENT_MERGE_MIN_BLOCKS 4
+#endif
+
 // The minimum pulse width (in µs) for stepping a stepper.
 // Set this if you find stepping unreliable, or if using a very fast CPU.
 #define MINIMUM_STEPPER_PULSE 0 // (µs) The smallest stepper pulse allowed
@@ -674,11 +779,13 @@
 // @section hidden
 
 // The number of linear motions that can be in the plan at any give time.
-// THE BLOCK_BUFFER_SIZE NEEDS TO BE A POWER OF 2, i.g. 8,16,32 because shifts and ors are used to do the ring-buffering.
+// Up to 64. A power of 2 (8, 16, 32, 64) lets the ring buffer wrap with a mask; other sizes
+// wrap with a compare. Each block takes about 60 bytes of SRAM: before raising this, check
+// the free memory reported at boot (PlannerBufferBytes is the buffer's share) on the board.
 #if ENABLED(SDSUPPORT)
-  #define BLOCK_BUFFER_SIZE 32 // SD,LCD,Buttons take more memory, block buffer needs to be smaller
+  #define BLOCK_BUFFER_SIZE 32 // SD,LCD,Buttons take more memory, leave room for them
 #else
-  #define BLOCK_BUFFER_SIZE 32 // maximize block buffer
+  #define BLOCK_BUFFER_SIZE 32
 #endif
 
 // @section serial
@@ -687,12 +794,26 @@
 #define MAX_CMD_SIZE 64
 #define BUFSIZE 16
 
+/**
+ * Pre-parsed command queue: each command is parsed once, as it is queued, and kept as its
+ * letter, code and parameter values instead of in a slot of MAX_CMD_SIZE characters.
+ * process_next_command loads it into the parser without scanning any text, and the same
+ * SRAM holds about three times as many moves (a G1 X Y E takes 20 bytes). Commands that
+ * take a string, and everything sent for an upload (M28), are still queued as text. The
+ * layout is in command_queue.hpp. Requires FASTER_GCODE_PARSER.
+ */
+//#define PREPARSED_COMMANDS
+#if ENABLED(PREPARSED_COMMANDS)
+  #define COMMAND_QUEUE_BYTES (BUFSIZE * MAX_CMD_SIZE) // SRAM for the queue, instead of its BUFSIZE slots
+#endif
+
 // Transfer Buffer Size
 // To save 386 bytes of __flashmem (and TX_BUFFER_SIZE+3 bytes of RAM) set to 0.
 // To buffer a simple "ok" you need 4 bytes.
 // For ADVANCED_OK (M105) you need 32 bytes.
 // For debug-echo: 128 bytes for the optimal speed.
 // Other output doesn't need to be that speedy.
+// With SERIAL_TX_LANES, the ring all protocol output goes through: 32, 64, 128 or 256.
 // :[0, 2, 4, 8, 16, 32, 64, 128, 256]
 #define TX_BUFFER_SIZE 128
 
@@ -711,6 +832,64 @@
 // Some clients will have this feature soon. This could make the NO_TIMEOUTS unnecessary.
 #define ADVANCED_OK 1
 
+/**
+ * Binary protocol: a compact framing of G-code on MYSERIAL, for hosts that stream faster
+ * than ASCII lines can carry. M935 S1 switches to it once its "ok" is sent; M935 S0, sent
+ * in a frame, or a reset switches back. G0/G1 moves are sent as varint changes of their
+ * parameters, and are queued without ever being parsed as text. Frames carry a sequence
+ * number and a CRC16, and are acknowledged all at once with "ok S<sequence>" as their
+ * commands are queued; a lost one is asked for with "Resend: S<sequence>". The host may
+ * run ahead of its oldest unacknowledged frame by the receive buffer, as M935 reports.
+ * There are no per-command "ok"s, and M28 uploads need ASCII. The frame format is in
+ * binary_protocol.hpp. Simulator/encode.rb encodes G-code files, and compares the
+ * throughput of both.
+ */
+//#define BINARY_PROTOCOL
+#if ENABLED(BINARY_PROTOCOL)
+  #define BINARY_FRAME_SIZE 64 // Largest payload, in bytes: 16 to 250. Takes as much SRAM.
+#endif
+
+/**
+ * Line assembler: the USART0 receive interrupt assembles ASCII lines as they arrive, with
+ * comments stripped and the checksum XORed in, and loop() only claims finished lines. A
+ * handler that blocks no longer overflows the receive buffer in the middle of a line: a
+ * line is only lost, whole, when RX_LINES are waiting, and M936 counts that. Lines take
+ * RX_LINES * (MAX_CMD_SIZE + 2) bytes of SRAM. Requires MYSERIAL on USART0.
+ */
+//#define RX_LINE_ASSEMBLER
+#if ENABLED(RX_LINE_ASSEMBLER)
+  #define RX_LINES 4 // Finished lines waiting for the command queue: 2, 4, 8 or 16
+#endif
+
+/**
+ * Serial output lanes: MYSERIAL writes to a ring of TX_BUFFER_SIZE (above) instead of the
+ * 64 bytes of HardwareSerial, and temperature auto-reports and debug logs go to lanes of
+ * their own, which never make the main loop wait: a status line not sent yet is replaced
+ * by the next one, and a debug line that does not fit is dropped. The interrupt sends
+ * "ok" and other protocol lines ahead of both, a line at a time. M937 reports how long
+ * protocol output waited for room, and the lines replaced or dropped. Takes
+ * TX_BUFFER_SIZE + TX_DEBUG_BUFFER_SIZE + 2 * TX_STATUS_LINE_SIZE bytes of SRAM.
+ * Requires MYSERIAL on USART0.
+ */
+//#define SERIAL_TX_LANES
+#if ENABLED(SERIAL_TX_LANES)
+  #define TX_DEBUG_BUFFER_SIZE 128 // Debug output, in whole lines: 32, 64, 128 or 256
+  #define TX_STATUS_LINE_SIZE 64   // Longest status line, with its newline: up to 250
+#endif
+
+/**
+ * Baud rate switching: M938 B<baud> moves the port to another rate once its "ok" is out,
+ * so a host can start at BAUDRATE and move up to 250000, 500000 or 1000000, which the
+ * USART makes exactly at 16 MHz, for more command bandwidth. Unless the host confirms
+ * the new rate within BAUD_SWITCH_TIMEOUT (or M938's T), with a numbered line, a frame or
+ * an M938, the port goes back to the rate it had. Only rates within 2.5% are accepted;
+ * the table is in tunalib/serial.hpp.
+ */
+//#define BAUD_SWITCHING
+#if ENABLED(BAUD_SWITCHING)
+  #define BAUD_SWITCH_TIMEOUT 2000 // ms to wait for the host to confirm the new rate: 100 to 60000
+#endif
+
 // @section fwretract
 
 // Firmware based and LCD controlled retract
@@ -1161,6 +1340,41 @@
  */
 //#define PINS_DEBUGGING
 
+/**
+ * M930 - Profile the cost of the stepper and temperature ISRs
+ *
+ * Times every stepper (Timer1) and temperature (Timer0) interrupt with the timer
+ * counters and keeps min/mean/max and a histogram per ISR path (step_loops, split(),
+ * LIN_ADVANCE), plus the totals of the last ISR_PROFILING_BLOCKS finished blocks.
+ * Adds about 100 cycles to every stepper ISR, so only enable it for tuning.
+ */
+//#define ISR_PROFILING
+#if ENABLED(ISR_PROFILING)
+  #define ISR_PROFILING_BLOCKS 8 // Power of 2
+#endif
+
+/**
+ * M931 - Report how many blocks the planner visits per new segment
+ *
+ * Counts the blocks visited by the reverse and forward passes and the trapezoids
+ * recalculated each time a block is added to the plan.
+ */
+//#define PLANNER_PROFILING
+
+/**
+ * M933 - Record the step stream of the stepper ISR
+ *
+ * Records a header for each block the stepper ISR picks up, then the interval, step_loops
+ * and LIN_ADVANCE offset of each update of its speed ramp, flagged when the OCR1A clamp
+ * held the steps back. M933 S1 records the first STEP_RECORDING_SIZE entries, S2 keeps
+ * the last ones, and M933 dumps them. The simulator (-r) replays the same G-code against
+ * the dump, to tell planner math from ISR scheduling. Takes 5 bytes of SRAM per entry.
+ */
+//#define STEP_RECORDING
+#if ENABLED(STEP_RECORDING)
+  #define STEP_RECORDING_SIZE 128 // Power of 2, 16 to 256
+#endif
+
 /**
  * Auto-report temperatures with M155 S<seconds>
  */
@@ -158,6 +158,7 @@
 			  S<print> T<travel> minimum speeds
 			  B<minimum segment time>
 			  X<max X jerk>, Y<max Y jerk>, Z<max Z jerk>, E<max E jerk>
+			  J<junction deviation> (Requires JUNCTION_DEVIATION)
    * M206 - Set additional homing offset. (Disabled by NO_WORKSPACE_OFFSETS or DELTA)
    * M207 - Set Retract Length: S<length>, Feedrate: F<units/min>, and Z lift: Z<distance>. (Requires FWRETRACT)
    * M208 - Set Recover (unretract) Additional (!) Length: S<length> and Feedrate: F<units/min>. (Requires FWRETRACT)
@@ -198,6 +199,7 @@
    * M501 - Restore parameters from EEPROM. (Requires EEPROM_SETTINGS)
    * M502 - Revert to the default "factory settings". ** Does not write them to EEPROM! **
    * M503 - Print the current settings (in memory): "M503 S<verbose>". S0 specifies compact output.
+   * M593 - Set or report input shaping: "M593 [X] [Y] T<type> F<hz> D<damping>". (Requires INPUT_SHAPING)
    * M600 - Pause for filament change: "M600 X<pos> Y<pos> Z<raise> E<first_retract> L<later_retract>". (Requires ADVANCED_PAUSE_FEATURE)
    * M665 - Set delta configurations: "M665 L<diagonal rod> R<delta radius> S<segments/s> A<rod A trim mm> B<rod B trim mm> C<rod C trim mm> I<tower A trim angle> J<tower B trim angle> K<tower C trim angle>" (Requires DELTA)
    * M666 - Set delta endstop adjustment. (Requires DELTA)
@@ -232,6 +234,15 @@
    *
    * ************ Custom codes - This can change to suit future G-code regulations
    * M928 - Start SD logging: "M928 filename.gco". Stop with M29. (Requires SDSUPPORT)
+   * M930 - Report the stepper and temperature ISR cost profile. R to reset. (Requires ISR_PROFILING)
+   * M931 - Report the blocks visited by the planner per new segment. R to reset. (Requires PLANNER_PROFILING)
+   * M932 - Set or report segment merging: S<bool> A<degrees> E<ratio> L<mm>. R to reset the counters. (Requires SEGMENT_MERGING)
+   * M933 - Record the stepper ISR's step stream: S1 the first entries, S2 the last ones. Dump it without S. (Requires STEP_RECORDING)
+   * M934 - Report the ramp cache hit rates. R to reset. (Requires STEPPER_RAMP_CACHE)
+   * M935 - Switch the serial port to binary frames: S1, or back to ASCII: S0. Report the frame counters; R to reset. (Requires BINARY_PROTOCOL)
+   * M936 - Report the serial line counters: lines dropped as the line ring was full, and bytes lost. R to reset. (Requires RX_LINE_ASSEMBLER)
+   * M937 - Report the serial output counters: time spent waiting for room, status lines replaced, debug lines dropped. R to reset. (Requires SERIAL_TX_LANES)
+   * M938 - Report the baud rate, or switch to B<baud> after the "ok"; back again unless confirmed within T<ms>. (Requires BAUD_SWITCHING)
    * M999 - Restart after being stopped by error
    *
    * "T" Codes
@@ -257,8 +268,16 @@
 #include "bi3_plus_lcd.h"
 #include "gcode.h"
 
+#include "planner_arc.h"
 #include "planner_bezier.h"
 #include "watchdog.h"
+#include "isr_profile.hpp"
+#include "step_record.hpp"
+#include "binary_protocol.hpp"
+#include "command_queue.hpp"
+#include "line_assembler.hpp"
+#include "serial_tx.hpp"
+#include "baud_switch.hpp"
 
 #include "Tuna_VM.hpp"
 
@@ -313,11 +332,16 @@ static uint24 gcode_N, gcode_LastN, Stopped_gcode_LastN = 0;
  * (immediate, serial, sd card) and they are processed sequentially by
  * the main loop. The process_next_command function parses the next
  * command and hands off execution to individual handler functions.
+ *
+ * With PREPARSED_COMMANDS, the queue is CommandQueue instead, and
+ * commands are parsed as they are queued.
  */
+#if DISABLED(PREPARSED_COMMANDS)
 uint8_t commands_in_queue = 0; // Count of commands in the queue
 static uint8_t cmd_queue_index_r = 0, // Ring buffer read position
 cmd_queue_index_w = 0; // Ring buffer write position
 static char command_queue[BUFSIZE][MAX_CMD_SIZE];
+#endif
 
 /**
  * Next Injected Command pointer. nullptr if no commands are being injected.
@@ -420,7 +444,9 @@ static uint8_t target_extruder;
 
 float cartes[XYZ] = { 0 };
 
+#if DISABLED(PREPARSED_COMMANDS)
 static bool send_ok[BUFSIZE];
+#endif
 
 MarlinBusyState busy_state = NOT_BUSY;
 static millis_t next_busy_signal_ms = 0;
@@ -457,8 +483,6 @@ void __forceinline __flatten get_cartesian_from_steppers();
 void __forceinline __flatten set_current_from_steppers_for_axis(const AxisEnum axis);
 void __forceinline __flatten set_current_from_steppers();
 
-//void plan_arc(float target[XYZE], float* offset, uint8_t clockwise);
-
 void __forceinline __flatten plan_cubic_move(const float offset[4]);
 
 void __forceinline __flatten tool_change(const uint8_t tmp_extruder, const float fr_mm_s = 0.0, bool no_move = false);
@@ -512,20 +536,72 @@ void enqueue_and_echo_commands(const Tuna::flash_string & __restrict pgcode) {
  * Clear the Marlin command queue
  */
 void __forceinline __flatten clear_command_queue() {
+#if ENABLED(PREPARSED_COMMANDS)
+	CommandQueue::clear();
+#else
 	cmd_queue_index_r = cmd_queue_index_w;
 	commands_in_queue = 0;
+#endif
+}
+
+/**
+ * Commands are queued
+ */
+inline uint8_t __forceinline __flatten queued_commands() {
+#if ENABLED(PREPARSED_COMMANDS)
+	return CommandQueue::count;
+#else
+	return commands_in_queue;
+#endif
+}
+
+/**
+ * The queue has room for another command
+ */
+inline bool __forceinline __flatten queue_has_room() {
+#if ENABLED(PREPARSED_COMMANDS)
+	return CommandQueue::has_room();
+#else
+	return commands_in_queue < BUFSIZE;
+#endif
+}
+
+/**
+ * Where the next command is written, before _commit_command
+ */
+inline char * __forceinline __flatten queue_back() {
+#if ENABLED(PREPARSED_COMMANDS)
+	return CommandQueue::text();
+#else
+	return command_queue[cmd_queue_index_w];
+#endif
+}
+
+/**
+ * The text of the command at the front, if it was not parsed as it was queued
+ */
+inline char * __forceinline __flatten queue_front_text() {
+#if ENABLED(PREPARSED_COMMANDS)
+	return CommandQueue::front_text();
+#else
+	return command_queue[cmd_queue_index_r];
+#endif
 }
 
 /**
  * Once a new command is in the ring buffer, call this to commit it
  */
 inline void __forceinline __flatten _commit_command(bool say_ok) {
+#if ENABLED(PREPARSED_COMMANDS)
+	CommandQueue::commit(say_ok);
+#else
 	send_ok[cmd_queue_index_w] = say_ok;
   if (__unlikely(++cmd_queue_index_w >= BUFSIZE))
   {
     cmd_queue_index_w = 0;
   }
 	commands_in_queue++;
+#endif
 }
 
 /**
@@ -534,11 +610,11 @@ inline void __forceinline __flatten _commit_command(bool say_ok) {
  * Return false for a full buffer, or if the 'command' is a comment.
  */
 inline bool __forceinline __flatten _enqueuecommand(const char* cmd, bool say_ok = false) {
-  if (__unlikely(*cmd == ';') || __unlikely(commands_in_queue >= BUFSIZE))
+  if (__unlikely(*cmd == ';') || __unlikely(!queue_has_room()))
   {
     return false;
   }
-	strcpy(command_queue[cmd_queue_index_w], cmd);
+	strcpy(queue_back(), cmd);
 	_commit_command(say_ok);
 	return true;
 }
@@ -578,6 +654,216 @@ void gcode_line_error(const char* err, bool doFlush = true) {
 	serial_count = 0;
 }
 
+#if ENABLED(BAUD_SWITCHING)
+
+/**
+ * Start MYSERIAL at the rate BaudSwitch has, dropping whatever arrived while the two ends disagreed
+ */
+inline void restart_serial() {
+	MYSERIAL.begin(BaudSwitch::baud);
+	while (MYSERIAL.available() > 0) (void)MYSERIAL.read();
+#if ENABLED(RX_LINE_ASSEMBLER)
+	LineAssembler::clear(); // Drop the partial line, and the lines waiting
+#else
+	serial_count = 0; // Drop any partial ASCII line
+#endif
+}
+
+/**
+ * Switch the baud rate M938 asked for, once the "ok" has gone at the old one,
+ * and switch back if the host has not confirmed the new one in time.
+ */
+inline void manage_baud_switch() {
+	if (__unlikely(BaudSwitch::pending)) MYSERIAL.flush();
+	switch (BaudSwitch::update(millis())) {
+	case BaudSwitch::action::switched:
+		restart_serial();
+		break;
+	case BaudSwitch::action::fell_back:
+		restart_serial();
+		SERIAL_ECHO_START();
+		SERIAL_ECHOLNPAIR("No confirmation at the new baud rate; back to ", BaudSwitch::baud);
+		break;
+	default:
+		break;
+	}
+}
+
+#endif // BAUD_SWITCHING
+
+/**
+ * Act on a command received from the serial port before it is queued:
+ * alert on movement while stopped, and handle the emergency commands.
+ */
+inline void __forceinline __flatten serial_command_received(const char * __restrict command) {
+#if ENABLED(BAUD_SWITCHING)
+	BaudSwitch::line_received(command);
+#endif
+
+	// Movement commands alert when stopped
+	if (__unlikely(!is_running())) {
+		const char* gpos = strchr(command, 'G');
+		if (gpos) {
+			const int codenum = strtol(gpos + 1, nullptr, 10);
+			switch (codenum) {
+			case 0:
+			case 1:
+			case 2:
+			case 3:
+				SERIAL_ERRORLNPGM(MSG_ERR_STOPPED);
+				LCD_MESSAGEPGM(MSG_STOPPED);
+				break;
+			}
+		}
+	}
+
+#if DISABLED(EMERGENCY_PARSER)
+	// If command was e-stop process now
+	if (__unlikely(strcmp(command, "M108") == 0)) {
+		wait_for_heatup = false;
+#if ENABLED(ULTIPANEL)
+		wait_for_user = false;
+#endif
+	}
+	if (__unlikely(strcmp(command, "M112") == 0)) kill(PSTR(MSG_KILLED));
+	if (__unlikely(strcmp(command, "M410") == 0)) { quickstop_stepper(); }
+#endif
+}
+
+#if ENABLED(BINARY_PROTOCOL)
+
+/**
+ * Get the frames waiting on the serial port and queue their commands.
+ * Frames are acknowledged together, once all of their commands are queued.
+ */
+inline void get_binary_commands() {
+	const BinaryProtocol::reply reply = BinaryProtocol::poll(
+		[]() -> int16 { return (MYSERIAL.available() > 0) ? int16(MYSERIAL.read()) : -1; },
+		[]() { return queue_has_room(); },
+		[]() { return queue_back(); },
+		[](char * const command, const BinaryProtocol::record record) {
+			switch (record) {
+			case BinaryProtocol::record::text:
+				serial_command_received(command);
+				if (*command) _commit_command(false); // Decoded in place
+				break;
+			case BinaryProtocol::record::move:
+#if ENABLED(PREPARSED_COMMANDS)
+				BinaryProtocol::queue_move(command);
+#else
+				_commit_command(false);
+#endif
+				break;
+			}
+		});
+
+	switch (reply) {
+	case BinaryProtocol::reply::ok:
+		SERIAL_PROTOCOLPGM(MSG_OK " S");
+		SERIAL_PROTOCOLLN(uint8(BinaryProtocol::expected - 1));
+		break;
+	case BinaryProtocol::reply::resend:
+		SERIAL_PROTOCOLPGM(MSG_RESEND "S");
+		SERIAL_PROTOCOLLN(BinaryProtocol::expected);
+		break;
+	case BinaryProtocol::reply::malformed:
+		// Sent as the host encoded it, so sending it again would not help: the stream is lost from here.
+		SERIAL_ERROR_START();
+		SERIAL_ERRORLNPGM(MSG_ERR_BINARY_FRAME);
+		stop();
+		break;
+	default:
+		break;
+	}
+}
+
+#endif // BINARY_PROTOCOL
+
+/**
+ * Check the line number and checksum of a line from the serial port.
+ * 'apos' is its first '*', if any, and 'checksum' gives the XOR of the
+ * characters before it. Asks for a resend if they do not check out.
+ */
+template <typename Checksum>
+inline bool __forceinline __flatten serial_line_checks(char * __restrict command, const char * __restrict apos, Checksum checksum) {
+	char *npos = __unlikely(*command == 'N') ? command : nullptr; // Require the N parameter to start the line
+
+	if (__unlikely(npos != nullptr)) {
+
+		bool M110 = strstr_P(command, PSTR("M110")) != nullptr;
+
+		if (M110) {
+			char* n2pos = strchr(command + 4, 'N');
+			if (n2pos) npos = n2pos;
+		}
+
+		gcode_N = strtol(npos + 1, nullptr, 10);
+
+		if (gcode_N != gcode_LastN + 1 && !M110) {
+			gcode_line_error(PSTR(MSG_ERR_LINE_NO));
+			return false;
+		}
+
+		if (apos) {
+			if (strtol(apos + 1, nullptr, 10) != checksum()) {
+				gcode_line_error(PSTR(MSG_ERR_CHECKSUM_MISMATCH));
+				return false;
+			}
+			// if no errors, continue parsing
+		}
+		else {
+			gcode_line_error(PSTR(MSG_ERR_NO_CHECKSUM));
+			return false;
+		}
+
+		gcode_LastN = gcode_N;
+		// if no errors, continue parsing
+	}
+	else if (__unlikely(apos != nullptr)) { // No '*' without 'N'
+		gcode_line_error(PSTR(MSG_ERR_NO_LINENUMBER_WITH_CHECKSUM), false);
+		return false;
+	}
+
+	return true;
+}
+
+#if ENABLED(RX_LINE_ASSEMBLER)
+
+/**
+ * Queue the lines the receive interrupt finished.
+ * Exit when the buffer is full or when no more lines are waiting.
+ */
+inline void get_serial_commands() {
+#if ENABLED(BINARY_PROTOCOL)
+	if (BinaryProtocol::active) {
+		get_binary_commands();
+		return;
+	}
+#endif
+
+	while (queue_has_room() && LineAssembler::available()) {
+		LineAssembler::line & __restrict line = LineAssembler::front();
+		char * const command = line.text;
+
+		// Checked, stripped and summed as it arrived
+		const bool checked = serial_line_checks(command, line.star ? &command[line.star - 1] : nullptr, [&line]() { return line.checksum; });
+		if (__likely(checked)) {
+			serial_command_received(command);
+
+#if defined(NO_TIMEOUTS) && NO_TIMEOUTS > 0
+			last_command_time = ms;
+#endif
+
+			// Add the command to the queue
+			_enqueuecommand(command, true);
+		}
+		LineAssembler::pop();
+		if (__unlikely(!checked)) return;
+	}
+}
+
+#else
+
 /**
  * Get all commands waiting on the serial port and queue them.
  * Exit when the buffer is full or when no more characters are
@@ -587,10 +873,17 @@ inline void get_serial_commands() {
 	static char serial_line_buffer[MAX_CMD_SIZE];
 	static bool serial_comment_mode = false;
 
+#if ENABLED(BINARY_PROTOCOL)
+	if (BinaryProtocol::active) {
+		get_binary_commands();
+		return;
+	}
+#endif
+
 	/**
 	 * Loop while serial characters are incoming and the queue is not full
 	 */
-	while (commands_in_queue < BUFSIZE && MYSERIAL.available() > 0) {
+	while (queue_has_room() && MYSERIAL.available() > 0) {
 
 		char serial_char = MYSERIAL.read();
 
@@ -609,76 +902,14 @@ inline void get_serial_commands() {
 			char* command = serial_line_buffer;
 
 			while (*command == ' ') command++; // skip any leading spaces
-			char *npos = __unlikely(*command == 'N') ? command : nullptr, // Require the N parameter to start the line
-				*apos = strchr(command, '*');
 
-			if (__unlikely(npos != nullptr)) {
-
-				bool M110 = strstr_P(command, PSTR("M110")) != nullptr;
-
-				if (M110) {
-					char* n2pos = strchr(command + 4, 'N');
-					if (n2pos) npos = n2pos;
-				}
-
-				gcode_N = strtol(npos + 1, nullptr, 10);
-
-				if (gcode_N != gcode_LastN + 1 && !M110) {
-					gcode_line_error(PSTR(MSG_ERR_LINE_NO));
-					return;
-				}
+			if (!serial_line_checks(command, strchr(command, '*'), [command]() {
+				byte checksum = 0, count = 0;
+				while (command[count] != '*') checksum ^= command[count++];
+				return checksum;
+			})) return;
 
-				if (apos) {
-					byte checksum = 0, count = 0;
-					while (command[count] != '*') checksum ^= command[count++];
-
-					if (strtol(apos + 1, nullptr, 10) != checksum) {
-						gcode_line_error(PSTR(MSG_ERR_CHECKSUM_MISMATCH));
-						return;
-					}
-					// if no errors, continue parsing
-				}
-				else {
-					gcode_line_error(PSTR(MSG_ERR_NO_CHECKSUM));
-					return;
-				}
-
-				gcode_LastN = gcode_N;
-				// if no errors, continue parsing
-			}
-			else if (__unlikely(apos != nullptr)) { // No '*' without 'N'
-				gcode_line_error(PSTR(MSG_ERR_NO_LINENUMBER_WITH_CHECKSUM), false);
-				return;
-			}
-
-			// Movement commands alert when stopped
-			if (__unlikely(!is_running())) {
-				char* gpos = strchr(command, 'G');
-				if (gpos) {
-					const int codenum = strtol(gpos + 1, nullptr, 10);
-					switch (codenum) {
-					case 0:
-					case 1:
-					case 2:
-					case 3:
-						SERIAL_ERRORLNPGM(MSG_ERR_STOPPED);
-						LCD_MESSAGEPGM(MSG_STOPPED);
-						break;
-					}
-				}
-			}
-
-#if DISABLED(EMERGENCY_PARSER)
-			// If command was e-stop process now
-			if (__unlikely(strcmp(command, "M108") == 0)) {
-				wait_for_heatup = false;
-#if ENABLED(ULTIPANEL)
-				wait_for_user = false;
-#endif
-			}
-			if (__unlikely(strcmp(command, "M112") == 0)) kill(PSTR(MSG_KILLED));
-			if (__unlikely(strcmp(command, "M410") == 0)) { quickstop_stepper(); }
-#endif
+			serial_command_received(command);
 
 #if defined(NO_TIMEOUTS) && NO_TIMEOUTS > 0
 			last_command_time = ms;
@@ -707,6 +938,8 @@ inline void get_serial_commands() {
 	} // queue has space, serial has data
 }
 
+#endif // RX_LINE_ASSEMBLER
+
 /**
  * Get commands from the SD Card until the command buffer is full
  * or until the end of the file is reached. The special character '#'
@@ -725,11 +958,11 @@ inline void __forceinline __flatten get_sdcard_commands() {
 	 * due to checksums, however, no checksums are used in SD printing.
 	 */
 
-	if (__unlikely(commands_in_queue == 0)) stop_buffering = false;
+	if (__unlikely(queued_commands() == 0)) stop_buffering = false;
 
 	uint16_t sd_count = 0;
 	bool card_eof = card.eof();
-	while (commands_in_queue < BUFSIZE && __likely(!card_eof) && __likely(!stop_buffering)) {
+	while (queue_has_room() && __likely(!card_eof) && __likely(!stop_buffering)) {
 		const int16_t n = card.get();
 		char sd_char = (char)n;
 		card_eof = card.eof();
@@ -762,7 +995,7 @@ inline void __forceinline __flatten get_sdcard_commands() {
 
 			if (!sd_count) continue; // skip empty lines (and comment lines)
 
-			command_queue[cmd_queue_index_w][sd_count] = '\0'; // terminate string
+			queue_back()[sd_count] = '\0'; // terminate string
 			sd_count = 0; // clear sd line buffer
 
 			_commit_command(false);
@@ -775,7 +1008,7 @@ inline void __forceinline __flatten get_sdcard_commands() {
 		}
 		else {
 			if (sd_char == ';') sd_comment_mode = true;
-			if (__likely(!sd_comment_mode)) command_queue[cmd_queue_index_w][sd_count++] = sd_char;
+			if (__likely(!sd_comment_mode)) queue_back()[sd_count++] = sd_char;
 		}
 	}
 }
@@ -913,6 +1146,9 @@ inline void __forceinline __flatten line_to_current_position() {
  * used by G0/G1/G2/G3/G5 and many other functions to set a destination.
  */
 inline void __forceinline __flatten line_to_destination(const float fr_mm_s) {
+#if ENABLED(SEGMENT_MERGING)
+	if (planner.merge_line(current_position, destination, fr_mm_s, active_extruder)) return;
+#endif
 	planner.buffer_line(destination[X_AXIS], destination[Y_AXIS], destination[Z_AXIS], destination[E_AXIS], fr_mm_s, active_extruder);
 }
 inline void __forceinline __flatten line_to_destination() { line_to_destination(feedrate_mm_s); }
@@ -1206,20 +1442,16 @@ void __forceinline __flatten host_keepalive() {
   * G0, G1: Coordinated movement of X Y Z E axes
   */
 
-template <MovementType move_type, MovementMode dimensional_move_mode = MovementMode::Modal, MovementMode extruder_move_mode = MovementMode::Modal>
-inline void __forceinline __flatten linear_move()
+/**
+ * Move to the destination of a G0/G1, or for an E-only move (e_only),
+ * retract or recover instead when M209 Autoretract is enabled.
+ */
+inline void __forceinline __flatten linear_move_to_destination(const bool e_only)
 {
-  if (__unlikely(!is_running()))
-  {
-    return;
-  }
-
-  gcode_get_destination<move_type, dimensional_move_mode, extruder_move_mode>(); // For X Y Z E F
-
 #if ENABLED(FWRETRACT)
   if (MIN_AUTORETRACT <= MAX_AUTORETRACT) {
     // When M209 Autoretract is enabled, convert E-only moves to firmware retract/recover moves
-    if (autoretract_enabled && parser.seen('E') && !(parser.seen('X') || parser.seen('Y') || parser.seen('Z'))) {
+    if (autoretract_enabled && e_only) {
       const float echange = destination[E_AXIS] - current_position[E_AXIS];
       // Is this a retract or recover move?
       if (WITHIN(FABS(echange), MIN_AUTORETRACT, MAX_AUTORETRACT) && retracted[active_extruder] == (echange > 0.0)) {
@@ -1230,11 +1462,51 @@ inline void __forceinline __flatten linear_move()
       }
     }
   }
+#else
+  UNUSED(e_only);
 #endif // FWRETRACT
 
   prepare_move_to_destination();
 }
 
+template <MovementType move_type, MovementMode dimensional_move_mode = MovementMode::Modal, MovementMode extruder_move_mode = MovementMode::Modal>
+inline void __forceinline __flatten linear_move()
+{
+  if (__unlikely(!is_running()))
+  {
+    return;
+  }
+
+  gcode_get_destination<move_type, dimensional_move_mode, extruder_move_mode>(); // For X Y Z E F
+
+  linear_move_to_destination(parser.seen('E') && !(parser.seen('X') || parser.seen('Y') || parser.seen('Z')));
+}
+
+#if ENABLED(BINARY_PROTOCOL) && DISABLED(PREPARSED_COMMANDS)
+
+/**
+ * A G0/G1 received as a binary move: as linear_move, from the parameters
+ * decoded into the command queue. With PREPARSED_COMMANDS, it is queued
+ * parsed instead, and runs as linear_move.
+ */
+inline void __forceinline __flatten binary_move(const char * __restrict command)
+{
+  if (__unlikely(!is_running()))
+  {
+    return;
+  }
+
+  feedrate_mm_s = BinaryProtocol::get_destination(command, current_position, relative_mode, axis_relative_modes, destination,
+    last_param_feedrate_mm_s);
+
+  if (!DEBUGGING(DRYRUN))
+    print_job_timer.incFilamentUsed(destination[E_AXIS] - current_position[E_AXIS]);
+
+  linear_move_to_destination(BinaryProtocol::e_only(command));
+}
+
+#endif // BINARY_PROTOCOL && !PREPARSED_COMMANDS
+
 #if ENABLED(FWRETRACT)
 
 /**
@@ -1259,6 +1531,8 @@ inline void __forceinline __flatten gcode_G11() { retract(false); }
 
 #endif // FWRETRACT
 
+#if ENABLED(ARC_SUPPORT)
+
 /**
  * G2: Clockwise Arc
  * G3: Counterclockwise Arc
@@ -1285,8 +1559,6 @@ inline void __forceinline __flatten gcode_G11() { retract(false); }
  *    G2 I10           ; CW circle centered at X+10
  *    G3 X20 Y12 R14   ; CCW circle with r=14 ending at X20 Y12
  */
-
-/*
 inline void gcode_G2_G3(bool clockwise) {
 	if (__likely(is_running())) {
 		gcode_get_destination();
@@ -1316,7 +1588,12 @@ inline void gcode_G2_G3(bool clockwise) {
 		if (arc_offset[0] || arc_offset[1]) {
 
 			// Send the arc to the planner
-			plan_arc(destination, arc_offset, clockwise);
+			if (plan_arc(current_position, destination, arc_offset, clockwise, MMS_SCALED(feedrate_mm_s), active_extruder)) {
+				// As far as the parser is concerned, the position is now == target. In reality the
+				// motion control system might still be processing the action and the real tool position
+				// in any intermediate location.
+				set_current_to_destination();
+			}
 			refresh_cmd_timeout();
 		}
 		else {
@@ -1326,7 +1603,8 @@ inline void gcode_G2_G3(bool clockwise) {
 		}
 	}
 }
-*/
+
+#endif // ARC_SUPPORT
 
 /**
  * G4: Dwell S<seconds> or P<milliseconds>
@@ -1393,6 +1671,11 @@ inline void gcode_G28(const bool always_home_all) {
 	// Wait for planner moves to finish!
 	stepper.synchronize();
 
+  #if ENABLED(INPUT_SHAPING)
+    // The echoes would carry the axes on past the endstops.
+    stepper.suspend_shaping(true);
+  #endif
+
 	setup_for_endstop_or_probe_move();
 	endstops.enable(true); // Enable endstops for next homing move
 
@@ -1455,6 +1738,10 @@ inline void gcode_G28(const bool always_home_all) {
 
 	clean_up_after_endstop_or_probe_move();
 
+  #if ENABLED(INPUT_SHAPING)
+    stepper.suspend_shaping(false);
+  #endif
+
 	lcd::refresh();
 
 	report_current_position();
@@ -1869,6 +2156,7 @@ inline void gcode_M155() {
 inline void auto_report_temperatures() {
 	if (auto_report_temp_interval && ELAPSED(millis(), next_temp_report_ms)) {
 		next_temp_report_ms = millis() + 1000UL * auto_report_temp_interval;
+		SERIAL_LANE(status);
 		print_heaterstates();
 		SERIAL_EOL();
 	}
@@ -2113,6 +2401,55 @@ inline void gcode_M110() {
 	if (parser.seenval('N')) gcode_LastN = parser.value_long();
 }
 
+#if ENABLED(INPUT_SHAPING)
+
+  /**
+   * M593: Set or report input shaping
+   *
+   *  X, Y      The axes to set (both, if neither is given)
+   *  T<type>   0 = ZV, 1 = ZVD, 2 = MZV
+   *  F<hz>     Ringing frequency. 0 disables shaping of the axis.
+   *  D<ratio>  Damping ratio, 0 to < 1
+   */
+  inline void gcode_M593() {
+    const bool seen_x = parser.seen('X'), seen_y = parser.seen('Y');
+    for (uint8 i = X_AXIS; i <= Y_AXIS; ++i) {
+      if ((seen_x || seen_y) && !(i == X_AXIS ? seen_x : seen_y)) continue;
+
+      Stepper::shaping_setting setting = stepper.get_shaping(AxisEnum(i));
+      bool changed = false;
+      if (parser.seenval('T')) {
+        const uint8 type = parser.value_byte();
+        if (type <= uint8(Tuna::shaper_type::MZV)) {
+          setting.type = Tuna::shaper_type(type);
+          changed = true;
+        }
+      }
+      if (parser.seenval('F')) {
+        const float frequency = parser.value_float();
+        setting.frequency = (frequency > 0.0f) ? max(frequency, float(SHAPING_MIN_FREQ)) : 0.0f;
+        changed = true;
+      }
+      if (parser.seenval('D')) {
+        setting.zeta = clamp(parser.value_float(), 0.0f, 0.99f);
+        changed = true;
+      }
+      if (changed) stepper.set_shaping(AxisEnum(i), setting);
+    }
+
+    for (uint8 i = X_AXIS; i <= Y_AXIS; ++i) {
+      const Stepper::shaping_setting &setting = stepper.get_shaping(AxisEnum(i));
+      SERIAL_ECHO_START();
+      SERIAL_ECHOPGM("Input shaping ");
+      SERIAL_CHAR(axis_codes[i]);
+      SERIAL_ECHOPAIR(" T", int(setting.type));
+      SERIAL_ECHOPAIR(" F", setting.frequency);
+      SERIAL_ECHOLNPAIR(" D", setting.zeta);
+    }
+  }
+
+#endif // INPUT_SHAPING
+
 /**
 * M900: Set and/or Get advance K factor and WH/D ratio
 *
@@ -2144,6 +2481,339 @@ inline void gcode_M900() {
   SERIAL_EOL();
 }
 
+#if ENABLED(ISR_PROFILING)
+
+  static void isr_profile_report_path(const char * __restrict name_P, const IsrProfile::path path) {
+    IsrProfile::stats s;
+    {
+      Tuna::critical_section _critsec;
+      s = IsrProfile::path_stats[uint8(path)];
+    }
+    if (!s.count) return;
+
+    serialprintPGM(name_P);
+    SERIAL_ECHOPAIR(" n=", s.count);
+    SERIAL_ECHOPAIR(" min=", s.min);
+    SERIAL_ECHOPAIR(" mean=", s.sum / s.count);
+    SERIAL_ECHOPAIR(" max=", s.max);
+    SERIAL_ECHOPGM(" hist=");
+    for (uint8 i = 0; i < IsrProfile::histogram_buckets; ++i) {
+      if (i) SERIAL_CHAR(',');
+      SERIAL_ECHO(s.histogram[i]);
+    }
+    SERIAL_EOL();
+  }
+
+  /**
+   * M930: Report or reset the ISR cost profile (cycles)
+   *
+   *  R  Reset all counters after reporting
+   *
+   * Histogram buckets are <128, <256, <512, <1024, <2048, <4096, <8192 and >=8192 cycles.
+   * The block lines are the most recently finished blocks, oldest first.
+   */
+  inline void gcode_M930() {
+    SERIAL_ECHOLNPGM("ISR profile (cycles):");
+    isr_profile_report_path(PSTR("stepper"), IsrProfile::path::stepper);
+    isr_profile_report_path(PSTR(" step x1"), IsrProfile::path::step_1);
+    isr_profile_report_path(PSTR(" step x2"), IsrProfile::path::step_2);
+    isr_profile_report_path(PSTR(" step x4"), IsrProfile::path::step_4);
+    isr_profile_report_path(PSTR(" step x8"), IsrProfile::path::step_8);
+    isr_profile_report_path(PSTR(" split"), IsrProfile::path::split);
+    #if ENABLED(MULTI_RATE_STEPPING)
+      isr_profile_report_path(PSTR(" event"), IsrProfile::path::event);
+    #endif
+    isr_profile_report_path(PSTR(" idle"), IsrProfile::path::idle);
+    isr_profile_report_path(PSTR(" advance"), IsrProfile::path::advance);
+    isr_profile_report_path(PSTR("temperature"), IsrProfile::path::temperature);
+
+    uint32 clamped, overruns;
+    uint8 head, recorded;
+    {
+      Tuna::critical_section _critsec;
+      clamped = IsrProfile::clamped;
+      overruns = IsrProfile::overruns;
+      head = IsrProfile::block_head;
+      recorded = IsrProfile::blocks_recorded;
+    }
+    SERIAL_ECHOPAIR("clamped=", clamped);
+    SERIAL_ECHOLNPAIR(" overruns=", overruns);
+
+    for (uint8 i = 0; i < recorded; ++i) {
+      IsrProfile::block_record b;
+      {
+        Tuna::critical_section _critsec;
+        b = IsrProfile::blocks[(head - recorded + i) & (IsrProfile::block_count - 1)];
+      }
+      SERIAL_ECHOPAIR("block steps=", uint32(b.step_event_count));
+      SERIAL_ECHOPAIR(" rate=", uint32(b.nominal_rate));
+      SERIAL_ECHOPAIR(" loops=", b.step_loops);
+      SERIAL_ECHOPAIR(" isrs=", b.isr_calls);
+      SERIAL_ECHOPAIR(" step=", b.step_cycles);
+      SERIAL_ECHOPAIR(" split=", b.split_cycles);
+      SERIAL_ECHOPAIR(" advance=", b.advance_cycles);
+      SERIAL_ECHOLNPAIR(" clamped=", b.clamped);
+    }
+
+    if (parser.seen('R')) IsrProfile::reset();
+  }
+
+#endif // ISR_PROFILING
+
+#if ENABLED(PLANNER_PROFILING)
+
+  /**
+   * M931: Report or reset the planner pass counters
+   *
+   *  R  Reset all counters after reporting
+   */
+  inline void gcode_M931() {
+    const Planner::planner_profile & __restrict p = planner.profile;
+    SERIAL_ECHOPAIR("Planner segments=", p.segments);
+    SERIAL_ECHOPAIR(" reverse=", p.reverse);
+    SERIAL_ECHOPAIR(" forward=", p.forward);
+    SERIAL_ECHOPAIR(" trapezoids=", p.trapezoids);
+    SERIAL_ECHOLNPAIR(" max=", p.max_touched);
+
+    if (parser.seen('R')) planner.profile = {};
+  }
+
+#endif // PLANNER_PROFILING
+
+#if ENABLED(SEGMENT_MERGING)
+
+  /**
+   * M932: Set or report segment merging
+   *
+   *  S<bool>     Enable or disable merging
+   *  A<degrees>  Largest direction change merged across
+   *  E<ratio>    Largest relative change in extrusion per mm merged across
+   *  L<mm>       Longest move merging may produce
+   *  R           Reset the counters after reporting
+   */
+  inline void gcode_M932() {
+    if (parser.seen('S')) {
+      planner.merge_config.enabled = parser.value_bool();
+      if (!planner.merge_config.enabled) planner.flush_merged();
+    }
+    if (parser.seen('A')) planner.set_merge_angle(parser.value_float());
+    if (parser.seen('E')) planner.merge_config.e_ratio = parser.value_float();
+    if (parser.seen('L')) planner.merge_config.max_length = parser.value_linear_units();
+
+    SERIAL_ECHOPAIR("Segment merging S", int(planner.merge_config.enabled));
+    SERIAL_ECHOPAIR(" A", planner.merge_config.angle);
+    SERIAL_ECHOPAIR(" E", planner.merge_config.e_ratio);
+    SERIAL_ECHOPAIR(" L", planner.merge_config.max_length);
+    SERIAL_ECHOPAIR(" moves=", planner.merge_stats.moves);
+    SERIAL_ECHOLNPAIR(" merged=", planner.merge_stats.merged);
+
+    if (parser.seen('R')) planner.merge_stats = {};
+  }
+
+#endif // SEGMENT_MERGING
+
+#if ENABLED(STEP_RECORDING)
+
+  /**
+   * M933: Record or dump the step stream of the stepper ISR
+   *
+   *  S0  Stop recording
+   *  S1  Clear the record and record until it is full
+   *  S2  Clear the record and keep recording, over the oldest entries
+   *
+   * Without S, stops recording and dumps the record, oldest first:
+   *
+   *  B<steps>                           A block picked up, with its step_event_count
+   *  S<ticks> <step_loops> <advance>    A ramp update: step_loops steps in <ticks> Timer1 ticks. C if clamped.
+   */
+  inline void gcode_M933() {
+    if (parser.seen('S')) {
+      const uint8 mode = parser.value_byte();
+      if (mode > uint8(StepRecord::mode::ring)) return;
+      StepRecord::start(StepRecord::mode(mode));
+      return;
+    }
+
+    uint16 recorded;
+    uint32 dropped;
+    bool full;
+    {
+      Tuna::critical_section _critsec;
+      StepRecord::recording = StepRecord::mode::stopped;
+      recorded = StepRecord::recorded;
+      dropped = StepRecord::dropped;
+      full = StepRecord::full;
+    }
+
+    SERIAL_ECHOPAIR("Step record: ", recorded);
+    SERIAL_ECHOPAIR(" entries, ", dropped);
+    SERIAL_ECHOPGM(" dropped");
+    if (full) SERIAL_ECHOPGM(", full");
+    SERIAL_EOL();
+
+    // Recording is stopped: the stepper ISR no longer touches the ring.
+    for (uint16 i = 0; i < recorded; ++i) {
+      const StepRecord::entry & __restrict e = StepRecord::entries[(StepRecord::head - recorded + i) & (StepRecord::size - 1)];
+      if (e.step_loops == StepRecord::block_marker) {
+        SERIAL_ECHOLNPAIR("B", (uint32(uint16(e.advance)) << 16) | e.interval);
+        continue;
+      }
+      SERIAL_ECHOPAIR("S", e.interval);
+      SERIAL_ECHOPAIR(" ", e.step_loops & ~StepRecord::clamped_flag);
+      SERIAL_ECHOPAIR(" ", e.advance);
+      if (e.step_loops & StepRecord::clamped_flag) SERIAL_ECHOPGM(" C");
+      SERIAL_EOL();
+    }
+  }
+
+#endif // STEP_RECORDING
+
+#if ENABLED(STEPPER_RAMP_CACHE)
+
+  /**
+   * M934: Report or reset the ramp cache counters
+   *
+   *  R  Reset all counters after reporting
+   *
+   * lookups/hits are the ramps looked up for blocks, and how many were cached already;
+   * loaded/calculated are the stepper ISR's ramp updates, from the cache or not.
+   */
+  inline void gcode_M934() {
+    Stepper::ramp_cache_stats s;
+    {
+      Tuna::critical_section _critsec;
+      s = stepper.ramp_stats;
+      if (parser.seen('R')) stepper.ramp_stats = {};
+    }
+    SERIAL_ECHOPAIR("Ramp cache lookups=", s.lookups);
+    SERIAL_ECHOPAIR(" hits=", s.hits);
+    SERIAL_ECHOPAIR(" loaded=", s.loaded);
+    SERIAL_ECHOLNPAIR(" calculated=", s.calculated);
+  }
+
+#endif // STEPPER_RAMP_CACHE
+
+#if ENABLED(BINARY_PROTOCOL)
+
+  /**
+   * M935: Switch the serial port to binary frames, or back to ASCII lines
+   *
+   *  S1  Take binary frames after this command's "ok", from sequence 0, with every parameter at 0
+   *  S0  Take ASCII lines again (sent in a frame)
+   *  R   Reset the counters after reporting
+   *
+   * Reports the largest payload a frame can have, and how far the host may run ahead of
+   * its oldest unacknowledged frame, in bytes.
+   */
+  inline void gcode_M935() {
+    if (parser.seen('S')) {
+      BinaryProtocol::set_active(parser.value_bool());
+      #if DISABLED(RX_LINE_ASSEMBLER)
+        serial_count = 0; // Drop any partial ASCII line
+      #endif
+    }
+
+    SERIAL_ECHOPAIR("Binary protocol ", BinaryProtocol::active ? "on" : "off");
+    SERIAL_ECHOPAIR(" payload=", BinaryProtocol::payload_size);
+    SERIAL_ECHOPAIR(" window=", SERIAL_RX_BUFFER_SIZE - 1);
+    SERIAL_ECHOPAIR(" frames=", BinaryProtocol::stats.frames);
+    SERIAL_ECHOPAIR(" records=", BinaryProtocol::stats.records);
+    SERIAL_ECHOPAIR(" duplicates=", BinaryProtocol::stats.duplicates);
+    SERIAL_ECHOLNPAIR(" errors=", BinaryProtocol::stats.errors);
+
+    if (parser.seen('R')) BinaryProtocol::stats = {};
+  }
+
+#endif // BINARY_PROTOCOL
+
+#if ENABLED(RX_LINE_ASSEMBLER)
+
+  /**
+   * M936: Report or reset the serial line counters
+   *
+   *  R  Reset the counters after reporting
+   *
+   * overflows: lines dropped as all RX_LINES were waiting, which the host was asked to resend.
+   * overruns: bytes lost in the USART, as its interrupt was held off. errors: framing or parity.
+   */
+  inline void gcode_M936() {
+    LineAssembler::counters s;
+    {
+      Tuna::critical_section _critsec;
+      s = LineAssembler::stats;
+      if (parser.seen('R')) LineAssembler::stats = {};
+    }
+    SERIAL_ECHOPAIR("Serial lines=", s.lines);
+    SERIAL_ECHOPAIR(" ring=", int(LineAssembler::lines));
+    SERIAL_ECHOPAIR(" overflows=", s.overflows);
+    SERIAL_ECHOPAIR(" truncated=", s.truncated);
+    SERIAL_ECHOPAIR(" overruns=", s.overruns);
+    SERIAL_ECHOLNPAIR(" errors=", s.errors);
+  }
+
+#endif // RX_LINE_ASSEMBLER
+
+#if ENABLED(SERIAL_TX_LANES)
+
+  /**
+   * M937: Report or reset the serial output counters
+   *
+   *  R  Reset the counters after reporting
+   *
+   * stalls: protocol writes that waited for room in the ring, and for how long in all.
+   * peak: most bytes waiting in the ring. coalesced: status lines replaced by a newer one
+   * before they were sent. dropped: status and debug lines that did not fit.
+   */
+  inline void gcode_M937() {
+    const SerialTx::counters s = SerialTx::stats; // Only loop() counts
+    if (parser.seen('R')) SerialTx::stats = {};
+    SERIAL_ECHOPAIR("Serial output ring=", int(TX_BUFFER_SIZE));
+    SERIAL_ECHOPAIR(" peak=", s.peak);
+    SERIAL_ECHOPAIR(" stalls=", s.stalls);
+    SERIAL_ECHOPAIR(" stalled_us=", s.stall_us);
+    SERIAL_ECHOPAIR(" coalesced=", s.coalesced);
+    SERIAL_ECHOLNPAIR(" dropped=", s.dropped);
+  }
+
+#endif // SERIAL_TX_LANES
+
+#if ENABLED(BAUD_SWITCHING)
+
+  /**
+   * M938: Report the baud rate, or switch to another
+   *
+   *  B<baud>  Switch to this rate once this command's "ok" is out: one of
+   *           2400, 9600, 19200, 38400, 57600, 115200, 250000, 500000, 1000000
+   *  T<ms>    Switch back unless the host confirms the new rate within this long
+   *           (default BAUD_SWITCH_TIMEOUT)
+   *
+   * The host waits for the "ok", switches its own port, and confirms the rate with a line
+   * that has a line number and a checksum, a frame, or an M938.
+   * Reports the divisor and double-speed bit the USART uses, and how far off the rate is.
+   */
+  inline void gcode_M938() {
+    if (parser.seenval('B')) {
+      const uint32 requested = parser.value_ulong();
+      if (!BaudSwitch::request(requested)) {
+        SERIAL_ERROR_START();
+        SERIAL_ERRORPGM("Unsupported baud rate ");
+        SERIAL_ERRORLN(requested);
+        return;
+      }
+      if (parser.seenval('T')) BaudSwitch::timeout = max(parser.value_ushort(), uint16(100));
+    }
+
+    const uint32 baud = BaudSwitch::pending ? BaudSwitch::pending : BaudSwitch::baud;
+    SERIAL_ECHOPAIR("Baud rate=", baud);
+    SERIAL_ECHOPAIR(" ubrr=", baud_rate::ubrr(baud));
+    SERIAL_ECHOPAIR(" u2x=", int(baud_rate::u2x(baud)));
+    SERIAL_ECHOPAIR(" error%=", baud_rate::error(baud) * 0.1f);
+    if (BaudSwitch::pending) SERIAL_ECHOPAIR(" after_ok timeout_ms=", BaudSwitch::timeout);
+    SERIAL_EOL();
+  }
+
+#endif // BAUD_SWITCHING
+
 /**
  * M111: Set the debug level
  */
@@ -2498,6 +3168,7 @@ inline void gcode_M204() {
  *    Y = Max Y Jerk (units/sec^2)
  *    Z = Max Z Jerk (units/sec^2)
  *    E = Max E Jerk (units/sec^2)
+ *    J = Junction Deviation (units). 0 limits junction speeds with the jerk values. (Requires JUNCTION_DEVIATION)
  */
 inline void gcode_M205() {
 	if (parser.seen('S')) planner.min_feedrate_mm_s = parser.value_linear_units();
@@ -2507,6 +3178,9 @@ inline void gcode_M205() {
 	if (parser.seen('Y')) planner.max_jerk[Y_AXIS] = parser.value_linear_units();
 	if (parser.seen('Z')) planner.max_jerk[Z_AXIS] = parser.value_linear_units();
 	if (parser.seen('E')) planner.max_jerk[E_AXIS] = parser.value_linear_units();
+	#if ENABLED(JUNCTION_DEVIATION)
+		if (parser.seen('J')) planner.junction_deviation_mm = max(parser.value_linear_units(), 0.0f);
+	#endif
 }
 
 /**
@@ -2854,8 +3528,31 @@ inline void gcode_T(uint8_t tmp_extruder) {
  * This is called from the main loop()
  */
 void __forceinline __flatten process_next_command() {
+#if ENABLED(PREPARSED_COMMANDS)
+	// Load the next command in the queue: parsed already, or parsed now
+	CommandQueue::load();
+
+	if (__unlikely(DEBUGGING(ECHO))) {
+		SERIAL_ECHO_START();
+		parser.echo_command();
+		SERIAL_EOL();
+	}
+
+	KEEPALIVE_STATE(IN_HANDLER);
+#else
 	char * const current_command = command_queue[cmd_queue_index_r];
 
+#if ENABLED(BINARY_PROTOCOL)
+	// Decoded already: nothing to parse
+	if (current_command[0] == BinaryProtocol::move_tag) {
+		KEEPALIVE_STATE(IN_HANDLER);
+		binary_move(current_command);
+		KEEPALIVE_STATE(NOT_BUSY);
+		ok_to_send();
+		return;
+	}
+#endif
+
 	if (__unlikely(DEBUGGING(ECHO))) {
 		SERIAL_ECHO_START();
 		SERIAL_ECHOLN(current_command);
@@ -2865,6 +3562,13 @@ void __forceinline __flatten process_next_command() {
 
 	// Parse the next command in the queue
 	parser.parse(current_command);
+#endif
+
+#if ENABLED(SEGMENT_MERGING)
+	// Only G0/G1 can extend a held move. Anything else sees the moves before it in the planner.
+	if (!(parser.command_letter == 'G' && parser.codenum <= 1))
+		planner.flush_merged();
+#endif
 
 	// Handle a known G, M, or T
 	switch (parser.command_letter) {
@@ -2889,10 +3593,12 @@ void __forceinline __flatten process_next_command() {
 
 
 		// G2, G3
-	//case 2: // G2  - CW ARC
-	//case 3: // G3  - CCW ARC
-	//	gcode_G2_G3(parser.codenum == 2);
-	//	break;
+#if ENABLED(ARC_SUPPORT)
+	case 2: // G2  - CW ARC
+	case 3: // G3  - CCW ARC
+		gcode_G2_G3(parser.codenum == 2);
+		break;
+#endif
 
 		// G4 Dwell
 	case 4:
@@ -3191,6 +3897,12 @@ void __forceinline __flatten process_next_command() {
 		gcode_M503();
 		break;
 
+  #if ENABLED(INPUT_SHAPING)
+    case 593: // M593: Set or report input shaping
+      gcode_M593();
+      break;
+  #endif
+
   case 900: // M900: Set advance K factor.
     gcode_M900();
     break;
@@ -3199,6 +3911,60 @@ void __forceinline __flatten process_next_command() {
 		gcode_M907();
 		break;
 
+  #if ENABLED(ISR_PROFILING)
+    case 930: // M930: Report or reset the ISR cost profile
+      gcode_M930();
+      break;
+  #endif
+
+  #if ENABLED(PLANNER_PROFILING)
+    case 931: // M931: Report or reset the planner pass counters
+      gcode_M931();
+      break;
+  #endif
+
+  #if ENABLED(SEGMENT_MERGING)
+    case 932: // M932: Set or report segment merging
+      gcode_M932();
+      break;
+  #endif
+
+  #if ENABLED(STEP_RECORDING)
+    case 933: // M933: Record or dump the step stream
+      gcode_M933();
+      break;
+  #endif
+
+  #if ENABLED(STEPPER_RAMP_CACHE)
+    case 934: // M934: Report or reset the ramp cache counters
+      gcode_M934();
+      break;
+  #endif
+
+  #if ENABLED(BINARY_PROTOCOL)
+    case 935: // M935: Switch the serial port to binary frames, or back
+      gcode_M935();
+      break;
+  #endif
+
+  #if ENABLED(RX_LINE_ASSEMBLER)
+    case 936: // M936: Report or reset the serial line counters
+      gcode_M936();
+      break;
+  #endif
+
+  #if ENABLED(SERIAL_TX_LANES)
+    case 937: // M937: Report or reset the serial output counters
+      gcode_M937();
+      break;
+  #endif
+
+  #if ENABLED(BAUD_SWITCHING)
+    case 938: // M938: Report or switch the baud rate
+      gcode_M938();
+      break;
+  #endif
+
 	case 355: // M355 set case light brightness
 		gcode_M355();
 		break;
@@ -3244,10 +4010,24 @@ void FlushSerialRequestResend() {
  */
 void ok_to_send() {
 	refresh_cmd_timeout();
+#if ENABLED(PREPARSED_COMMANDS)
+	if (!CommandQueue::say_ok()) return;
+#else
 	if (!send_ok[cmd_queue_index_r]) return;
+#endif
 	SERIAL_PROTOCOLPGM(MSG_OK);
 #if ENABLED(ADVANCED_OK)
-	char* p = command_queue[cmd_queue_index_r];
+	char* p = queue_front_text();
+#if ENABLED(PREPARSED_COMMANDS)
+	uint24 line;
+	if (!p) {
+		if (CommandQueue::front_line(line)) {
+			SERIAL_PROTOCOLPGM(" N");
+			SERIAL_PROTOCOL(uint32(line));
+		}
+	}
+	else
+#endif
 	if (__unlikely(*p == 'N')) {
 		SERIAL_PROTOCOL(' ');
 		SERIAL_ECHO(*p++);
@@ -3255,7 +4035,12 @@ void ok_to_send() {
 			SERIAL_ECHO(*p++);
 	}
 	SERIAL_PROTOCOLPGM(" P"); SERIAL_PROTOCOL(int(BLOCK_BUFFER_SIZE - planner.movesplanned() - 1));
+#if ENABLED(PREPARSED_COMMANDS)
+	// Commands of any length that still fit
+	SERIAL_PROTOCOLPGM(" B"); SERIAL_PROTOCOL(int(CommandQueue::room()));
+#else
 	SERIAL_PROTOCOLPGM(" B"); SERIAL_PROTOCOL(BUFSIZE - commands_in_queue);
+#endif
 #endif
 	SERIAL_EOL();
 }
@@ -3494,143 +4279,6 @@ void __forceinline __flatten prepare_move_to_destination() {
 	set_current_to_destination();
 }
 
-/**
- * Plan an arc in 2 dimensions
- *
- * The arc is approximated by generating many small linear segments.
- * The length of each segment is configured in MM_PER_ARC_SEGMENT (Default 1mm)
- * Arcs should only be made relatively large (over 5mm), as larger arcs with
- * larger segments will tend to be more efficient. Your slicer should have
- * options for G2/G3 arc generation. In future these options may be GCode tunable.
- */
-#if 0
-void plan_arc(
-	float logical[XYZE], // Destination position
-	float *offset,       // Center of rotation relative to current_position
-	uint8_t clockwise    // Clockwise?
-) {
-	constexpr AxisEnum p_axis = X_AXIS, q_axis = Y_AXIS, l_axis = Z_AXIS;
-
-	// Radius vector from center to current location
-	float r_P = -offset[0], r_Q = -offset[1];
-
-	const float radius = HYPOT(r_P, r_Q),
-		center_P = current_position[p_axis] - r_P,
-		center_Q = current_position[q_axis] - r_Q,
-		rt_X = logical[p_axis] - center_P,
-		rt_Y = logical[q_axis] - center_Q,
-		linear_travel = logical[l_axis] - current_position[l_axis],
-		extruder_travel = logical[E_AXIS] - current_position[E_AXIS];
-
-	// CCW angle of rotation between position and target from the circle center. Only one atan2() trig computation required.
-	float angular_travel = ATAN2(r_P * rt_Y - r_Q * rt_X, r_P * rt_X + r_Q * rt_Y);
-	if (angular_travel < 0) angular_travel += RADIANS(360);
-	if (clockwise) angular_travel -= RADIANS(360);
-
-	// Make a circle if the angular rotation is 0 and the target is current position
-	if (angular_travel == 0 && current_position[p_axis] == logical[p_axis] && current_position[q_axis] == logical[q_axis])
-		angular_travel = RADIANS(360);
-
-	const float mm_of_travel = HYPOT(angular_travel * radius, FABS(linear_travel));
-	if (mm_of_travel < 0.001) return;
-
-	uint16_t segments = FLOOR(mm_of_travel / (MM_PER_ARC_SEGMENT));
-	if (segments == 0) segments = 1;
-
-	/**
-	 * Vector rotation by transformation matrix: r is the original vector, r_T is the rotated vector,
-	 * and phi is the angle of rotation. Based on the solution approach by Jens Geisler.
-	 *     r_T = [cos(phi) -sin(phi);
-	 *            sin(phi)  cos(phi)] * r ;
-	 *
-	 * For arc generation, the center of the circle is the axis of rotation and the radius vector is
-	 * defined from the circle center to the initial position. Each line segment is formed by successive
-	 * vector rotations. This requires only two cos() and sin() computations to form the rotation
-	 * matrix for the duration of the entire arc. Error may accumulate from numerical round-off, since
-	 * all double numbers are single precision on the Arduino. (True double precision will not have
-	 * round off issues for CNC applications.) Single precision error can accumulate to be greater than
-	 * tool precision in some cases. Therefore, arc path correction is implemented.
-	 *
-	 * Small angle approximation may be used to reduce computation overhead further. This approximation
-	 * holds for everything, but very small circles and large MM_PER_ARC_SEGMENT values. In other words,
-	 * theta_per_segment would need to be greater than 0.1 rad and N_ARC_CORRECTION would need to be large
-	 * to cause an appreciable drift error. N_ARC_CORRECTION~=25 is more than small enough to correct for
-	 * numerical drift error. N_ARC_CORRECTION may be on the order a hundred(s) before error becomes an
-	 * issue for CNC machines with the single precision Arduino calculations.
-	 *
-	 * This approximation also allows plan_arc to immediately insert a line segment into the planner
-	 * without the initial overhead of computing cos() or sin(). By the time the arc needs to be applied
-	 * a correction, the planner should have caught up to the lag caused by the initial plan_arc overhead.
-	 * This is important when there are successive arc motions.
-	 */
-	 // Vector rotation matrix values
-	float arc_target[XYZE];
-	const float theta_per_segment = angular_travel / segments,
-		linear_per_segment = linear_travel / segments,
-		extruder_per_segment = extruder_travel / segments,
-		sin_T = theta_per_segment,
-		cos_T = 1 - 0.5 * sq(theta_per_segment); // Small angle approximation
-
-// Initialize the linear axis
-	arc_target[l_axis] = current_position[l_axis];
-
-	// Initialize the extruder axis
-	arc_target[E_AXIS] = current_position[E_AXIS];
-
-	const float fr_mm_s = MMS_SCALED(feedrate_mm_s);
-
-	millis_t next_idle_ms = millis() + 200UL;
-
-	int8_t count = N_ARC_CORRECTION;
-
-	for (uint16_t i = 1; i < segments; i++) { // Iterate (segments-1) times
-
-    Temperature::manage_heater();
-		if (ELAPSED(millis(), next_idle_ms)) {
-			next_idle_ms = millis() + 200UL;
-			idle();
-		}
-
-		if (--count) {
-			// Apply vector rotation matrix to previous r_P / 1
-			const float r_new_Y = r_P * sin_T + r_Q * cos_T;
-			r_P = r_P * cos_T - r_Q * sin_T;
-			r_Q = r_new_Y;
-		}
-		else
-		{
-			count = N_ARC_CORRECTION;
-
-			// Arc correction to radius vector. Computed only every N_ARC_CORRECTION increments.
-			// Compute exact location by applying transformation matrix from initial radius vector(=-offset).
-			// To reduce stuttering, the sin and cos could be computed at different times.
-			// For now, compute both at the same time.
-			const float cos_Ti = cos(i * theta_per_segment), sin_Ti = sin(i * theta_per_segment);
-			r_P = -offset[0] * cos_Ti + offset[1] * sin_Ti;
-			r_Q = -offset[0] * sin_Ti - offset[1] * cos_Ti;
-		}
-
-		// Update arc_target location
-		arc_target[p_axis] = center_P + r_P;
-		arc_target[q_axis] = center_Q + r_Q;
-		arc_target[l_axis] += linear_per_segment;
-		arc_target[E_AXIS] += extruder_per_segment;
-
-		clamp_to_software_endstops(arc_target);
-
-		planner.buffer_line_kinematic(arc_target, fr_mm_s, active_extruder);
-	}
-
-	// Ensure last segment arrives at target location.
-	planner.buffer_line_kinematic(logical, fr_mm_s, active_extruder);
-
-	// As far as the parser is concerned, the position is now == target. In reality the
-	// motion control system might still be processing the action and the real tool position
-	// in any intermediate location.
-	set_current_to_destination();
-}
-#endif
-
 void __forceinline __flatten plan_cubic_move(const float offset[4]) {
 	cubic_b_spline(current_position, destination, offset, MMS_SCALED(feedrate_mm_s), active_extruder);
 
@@ -3690,13 +4338,19 @@ void disable_all_steppers() {
  */
 void manage_inactivity(bool ignore_stepper_queue/*=false*/) {
 
-	if (commands_in_queue < BUFSIZE) get_available_commands();
+	if (queue_has_room()) get_available_commands();
 
 	const millis_t ms = millis();
 
 	if (max_inactive_time && ELAPSED(ms, previous_cmd_ms + max_inactive_time)) {
 		SERIAL_ERROR_START();
+#if ENABLED(PREPARSED_COMMANDS)
+		SERIAL_ECHOPGM(MSG_KILL_INACTIVE_TIME);
+		parser.echo_command();
+		SERIAL_EOL();
+#else
 		SERIAL_ECHOLNPAIR(MSG_KILL_INACTIVE_TIME, parser.command_ptr);
+#endif
 		kill(PSTR(MSG_KILLED));
 	}
 
@@ -3723,6 +4377,10 @@ void idle(
 
 	host_keepalive();
 
+#if ENABLED(BAUD_SWITCHING)
+	manage_baud_switch();
+#endif
+
 	auto_report_temperatures();
 
 	manage_inactivity();
@@ -3797,7 +4455,7 @@ void setup() {
 
 	setup_powerhold();
 
-	MYSERIAL.begin(BAUDRATE);
+	MYSERIAL.begin(baud_rate::checked<BAUDRATE>::value);
 	SERIAL_PROTOCOLLNPGM("start");
 	SERIAL_ECHO_START();
 
@@ -3825,8 +4483,10 @@ void setup() {
 	SERIAL_ECHOPAIR(MSG_FREE_MEMORY, freeMemory());
 	SERIAL_ECHOLNPAIR(MSG_PLANNER_BUFFER_BYTES, (int)sizeof(block_t)*BLOCK_BUFFER_SIZE);
 
+#if DISABLED(PREPARSED_COMMANDS)
 	// Send "ok" after commands by default
 	for (int8_t i = 0; i < BUFSIZE; i++) send_ok[i] = true;
+#endif
 
 	// Load data from EEPROM if available (or use defaults)
 	// This also updates variables in the planner, elsewhere
@@ -3838,6 +4498,10 @@ void setup() {
 	// Vital to init stepper/planner equivalent for current_position
 	SYNC_PLAN_POSITION_KINEMATIC();
 
+	#if ENABLED(ISR_PROFILING)
+		IsrProfile::reset();  // Before any of the profiled ISRs are enabled
+	#endif
+
   Temperature::init();    // Initialize temperature loop
 
 	watchdog_init();
@@ -3861,13 +4525,14 @@ void setup() {
  *  - Call LCD update
  */
 void loop() {
-	if (commands_in_queue < BUFSIZE) get_available_commands();
+	if (queue_has_room()) get_available_commands();
 
 	card.checkautostart(false);
 
-	if (__likely(commands_in_queue)) {
-		if (__unlikely(card.saving)) {
-			char* command = command_queue[cmd_queue_index_r];
+	if (__likely(queued_commands())) {
+		// While saving, commands are queued as text
+		if (__unlikely(card.saving) && queue_front_text()) {
+			char* command = queue_front_text();
 			if (strstr_P(command, PSTR("M29"))) {
 				// M29 closes the file
 				card.closefile();
@@ -3887,11 +4552,18 @@ void loop() {
 			process_next_command();
 
 		// The queue may be reset by a command handler or by code invoked by idle() within a handler
+#if ENABLED(PREPARSED_COMMANDS)
+		CommandQueue::pop();
+#else
 		if (__likely(commands_in_queue)) {
 			--commands_in_queue;
 			if (++cmd_queue_index_r >= BUFSIZE) cmd_queue_index_r = 0;
 		}
+#endif
 }
 	endstops.report_state();
+#if ENABLED(SEGMENT_MERGING)
+	planner.poll_merged();
+#endif
 	idle();
 }
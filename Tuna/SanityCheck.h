@@ -406,6 +406,177 @@
   #endif
 #endif
 
+/**
+ * ISR profiling hooks into the LIN_ADVANCE ISR scheduler
+ */
+#if ENABLED(ISR_PROFILING) && DISABLED(LIN_ADVANCE)
+  #error "ISR_PROFILING requires LIN_ADVANCE."
+#endif
+
+/**
+ * Step recording hooks into the LIN_ADVANCE ISR scheduler, and records the advance offset
+ */
+#if ENABLED(STEP_RECORDING) && DISABLED(LIN_ADVANCE)
+  #error "STEP_RECORDING requires LIN_ADVANCE."
+#endif
+
+#if ENABLED(BINARY_PROTOCOL) && !WITHIN(BINARY_FRAME_SIZE, 16, 250)
+  #error "BINARY_FRAME_SIZE must be 16 to 250."
+#endif
+
+/**
+ * The line assembler takes over the receive interrupt of USART0
+ */
+#if ENABLED(RX_LINE_ASSEMBLER)
+  #if defined(USBCON) || !defined(ARDUINO_SERIAL) || ENABLED(BLUETOOTH)
+    #error "RX_LINE_ASSEMBLER requires MYSERIAL to be Serial, on USART0."
+  #elif RX_LINES != 2 && RX_LINES != 4 && RX_LINES != 8 && RX_LINES != 16
+    #error "RX_LINES must be 2, 4, 8 or 16."
+  #endif
+#endif
+
+#if ENABLED(SERIAL_TX_LANES)
+  #if defined(USBCON) || !defined(ARDUINO_SERIAL) || ENABLED(BLUETOOTH)
+    #error "SERIAL_TX_LANES requires MYSERIAL to be Serial, on USART0."
+  #elif TX_BUFFER_SIZE != 32 && TX_BUFFER_SIZE != 64 && TX_BUFFER_SIZE != 128 && TX_BUFFER_SIZE != 256
+    #error "SERIAL_TX_LANES requires a TX_BUFFER_SIZE of 32, 64, 128 or 256."
+  #elif TX_DEBUG_BUFFER_SIZE != 32 && TX_DEBUG_BUFFER_SIZE != 64 && TX_DEBUG_BUFFER_SIZE != 128 && TX_DEBUG_BUFFER_SIZE != 256
+    #error "TX_DEBUG_BUFFER_SIZE must be 32, 64, 128 or 256."
+  #elif !WITHIN(TX_STATUS_LINE_SIZE, 2, 250)
+    #error "TX_STATUS_LINE_SIZE must be 2 to 250."
+  #endif
+#endif
+
+#if ENABLED(BAUD_SWITCHING) && !WITHIN(BAUD_SWITCH_TIMEOUT, 100, 60000)
+  #error "BAUD_SWITCH_TIMEOUT must be 100 to 60000."
+#endif
+
+/**
+ * The pre-parsed command queue loads parameters as FASTER_GCODE_PARSER finds them
+ */
+#if ENABLED(PREPARSED_COMMANDS)
+  #if DISABLED(FASTER_GCODE_PARSER)
+    #error "PREPARSED_COMMANDS requires FASTER_GCODE_PARSER."
+  #elif !WITHIN(COMMAND_QUEUE_BYTES, 2 * (MAX_CMD_SIZE + 2), 4096)
+    #error "COMMAND_QUEUE_BYTES must be 2 * (MAX_CMD_SIZE + 2) to 4096."
+  #endif
+#endif
+
+/**
+ * Block indices are int8_t, and some are doubled in a uint8_t
+ */
+#if !WITHIN(BLOCK_BUFFER_SIZE, 2, 64)
+  #error "BLOCK_BUFFER_SIZE must be between 2 and 64."
+#elif ENABLED(STEPPER_RAMP_TABLES) && (BLOCK_BUFFER_SIZE & 1)
+  #error "STEPPER_RAMP_TABLES requires an even BLOCK_BUFFER_SIZE."
+#endif
+
+/**
+ * Shared ramps
+ */
+#if ENABLED(STEPPER_RAMP_CACHE)
+  #if ENABLED(STEPPER_RAMP_TABLES)
+    #error "STEPPER_RAMP_CACHE and STEPPER_RAMP_TABLES are alternatives. Enable only one."
+  #elif ENABLED(S_CURVE_ACCELERATION)
+    #error "STEPPER_RAMP_CACHE is not compatible with S_CURVE_ACCELERATION."
+  #elif !WITHIN(RAMP_CACHE_SIZE, 4, 8)
+    #error "RAMP_CACHE_SIZE must be between 4 and 8."
+  #elif !WITHIN(RAMP_CACHE_LENGTH, 1, 255)
+    #error "RAMP_CACHE_LENGTH must be between 1 and 255."
+  #endif
+#endif
+
+/**
+ * Multi-rate stepping queues steps no closer together than the OCR1A clamp allows
+ */
+#if ENABLED(MULTI_RATE_STEPPING) && !WITHIN(MULTI_RATE_MIN_TICKS, 16, 1000)
+  #error "MULTI_RATE_MIN_TICKS must be between 16 and 1000."
+#endif
+
+/**
+ * Batched step pulses drive one stepper per axis, from the pin map
+ */
+#if ENABLED(BATCHED_STEP_PULSES)
+  #if E_STEPPERS > 1
+    #error "BATCHED_STEP_PULSES requires a single E stepper."
+  #elif ENABLED(X_DUAL_STEPPER_DRIVERS) || ENABLED(Y_DUAL_STEPPER_DRIVERS) || ENABLED(Z_DUAL_STEPPER_DRIVERS) || ENABLED(DUAL_X_CARRIAGE)
+    #error "BATCHED_STEP_PULSES does not support dual stepper drivers."
+  #elif ENABLED(BABYSTEPPING)
+    #error "BATCHED_STEP_PULSES is incompatible with BABYSTEPPING."
+  #endif
+#endif
+
+/**
+ * Input shaping runs on the advance ISR's timer, and owns the X and Y direction pins
+ */
+#if ENABLED(INPUT_SHAPING)
+  #if DISABLED(LIN_ADVANCE)
+    #error "INPUT_SHAPING requires LIN_ADVANCE."
+  #elif ENABLED(MULTI_RATE_STEPPING)
+    #error "INPUT_SHAPING is incompatible with MULTI_RATE_STEPPING."
+  #elif ENABLED(NATIVE_ARCS)
+    #error "INPUT_SHAPING is incompatible with NATIVE_ARCS."
+  #elif ENABLED(X_DUAL_STEPPER_DRIVERS) || ENABLED(Y_DUAL_STEPPER_DRIVERS) || ENABLED(DUAL_X_CARRIAGE)
+    #error "INPUT_SHAPING does not support dual X or Y stepper drivers."
+  #elif ENABLED(BABYSTEPPING) && ENABLED(BABYSTEP_XY)
+    #error "INPUT_SHAPING is incompatible with BABYSTEP_XY."
+  #elif (SHAPING_BUFFER_SIZE) < 4 || (SHAPING_BUFFER_SIZE) > 256 || ((SHAPING_BUFFER_SIZE) & ((SHAPING_BUFFER_SIZE) - 1))
+    #error "SHAPING_BUFFER_SIZE must be a power of 2, from 4 to 256."
+  #elif !WITHIN(SHAPING_MERGE_TICKS, 1, 4000)
+    #error "SHAPING_MERGE_TICKS must be between 1 and 4000."
+  #endif
+  static_assert(SHAPING_MIN_FREQ > 0, "SHAPING_MIN_FREQ must be greater than 0.");
+  static_assert(SHAPING_FREQ_X == 0 || SHAPING_FREQ_X >= SHAPING_MIN_FREQ, "SHAPING_FREQ_X must be 0 or at least SHAPING_MIN_FREQ.");
+  static_assert(SHAPING_FREQ_Y == 0 || SHAPING_FREQ_Y >= SHAPING_MIN_FREQ, "SHAPING_FREQ_Y must be 0 or at least SHAPING_MIN_FREQ.");
+  static_assert(SHAPING_ZETA_X >= 0 && SHAPING_ZETA_X < 1, "SHAPING_ZETA_X must be from 0 to less than 1.");
+  static_assert(SHAPING_ZETA_Y >= 0 && SHAPING_ZETA_Y < 1, "SHAPING_ZETA_Y must be from 0 to less than 1.");
+#endif
+
+/**
+ * G5 curves are planned in batches, behind a queue of planned blocks
+ */
+#if ENABLED(BEZIER_CURVE_SUPPORT)
+  static_assert(BEZIER_TOLERANCE > 0, "BEZIER_TOLERANCE must be greater than 0.");
+  #if !WITHIN(BEZIER_MIN_SEGMENT_STEPS, 1, 100)
+    #error "BEZIER_MIN_SEGMENT_STEPS must be between 1 and 100."
+  #elif !WITHIN(BEZIER_BATCH_BLOCKS, 1, (BLOCK_BUFFER_SIZE) / 2)
+    #error "BEZIER_BATCH_BLOCKS must be between 1 and BLOCK_BUFFER_SIZE / 2."
+  #endif
+#endif
+
+/**
+ * Segment merging holds a move back only while blocks are queued ahead of it
+ */
+#if ENABLED(SEGMENT_MERGING)
+  #if !WITHIN(SEGMENT_MERGE_MIN_BLOCKS, 1, BLOCK_BUFFER_SIZE - 1)
+    #error "SEGMENT_MERGE_MIN_BLOCKS must be between 1 and BLOCK_BUFFER_SIZE - 1."
+  #elif IS_KINEMATIC
+    #error "SEGMENT_MERGING requires a Cartesian machine."
+  #endif
+#endif
+
+/**
+ * Junction Deviation
+ */
+#if ENABLED(JUNCTION_DEVIATION)
+  #if IS_CORE || IS_KINEMATIC
+    #error "JUNCTION_DEVIATION requires a Cartesian machine."
+  #endif
+#endif
+
+/**
+ * Native arcs
+ */
+#if ENABLED(NATIVE_ARCS)
+  #if DISABLED(ARC_SUPPORT)
+    #error "NATIVE_ARCS requires ARC_SUPPORT."
+  #elif IS_CORE || IS_KINEMATIC
+    #error "NATIVE_ARCS requires a Cartesian machine."
+  #elif ENABLED(MIXING_EXTRUDER)
+    #error "NATIVE_ARCS is not compatible with MIXING_EXTRUDER."
+  #endif
+#endif
+
 /**
  * Limited number of servos
  */
@@ -1006,6 +1177,32 @@ static_assert(1 >= 0
   #endif
 #endif
 
+/**
+ * Endstop interrupts need every endstop on a pin change interrupt: PB0-PB7, PJ0-PJ1 and PK0-PK7 on the ATmega2560.
+ * None of the stock Bi3Plus endstop pins (54, 24, 23) have one.
+ */
+#if ENABLED(ENDSTOP_INTERRUPTS_FEATURE)
+  #define _ENDSTOP_PCINT(P) (WITHIN(P, 10, 15) || WITHIN(P, 50, 53) || WITHIN(P, 62, 69))
+  #if HAS_X_MIN && !_ENDSTOP_PCINT(X_MIN_PIN)
+    #error "ENDSTOP_INTERRUPTS_FEATURE requires X_MIN_PIN to be a pin change interrupt pin (10-15, 50-53 or 62-69)."
+  #elif HAS_X_MAX && !_ENDSTOP_PCINT(X_MAX_PIN)
+    #error "ENDSTOP_INTERRUPTS_FEATURE requires X_MAX_PIN to be a pin change interrupt pin (10-15, 50-53 or 62-69)."
+  #elif HAS_Y_MIN && !_ENDSTOP_PCINT(Y_MIN_PIN)
+    #error "ENDSTOP_INTERRUPTS_FEATURE requires Y_MIN_PIN to be a pin change interrupt pin (10-15, 50-53 or 62-69)."
+  #elif HAS_Y_MAX && !_ENDSTOP_PCINT(Y_MAX_PIN)
+    #error "ENDSTOP_INTERRUPTS_FEATURE requires Y_MAX_PIN to be a pin change interrupt pin (10-15, 50-53 or 62-69)."
+  #elif HAS_Z_MIN && !_ENDSTOP_PCINT(Z_MIN_PIN)
+    #error "ENDSTOP_INTERRUPTS_FEATURE requires Z_MIN_PIN to be a pin change interrupt pin (10-15, 50-53 or 62-69)."
+  #elif HAS_Z_MAX && !_ENDSTOP_PCINT(Z_MAX_PIN)
+    #error "ENDSTOP_INTERRUPTS_FEATURE requires Z_MAX_PIN to be a pin change interrupt pin (10-15, 50-53 or 62-69)."
+  #elif ENABLED(Z_MIN_PROBE_ENDSTOP) && !_ENDSTOP_PCINT(Z_MIN_PROBE_PIN)
+    #error "ENDSTOP_INTERRUPTS_FEATURE requires Z_MIN_PROBE_PIN to be a pin change interrupt pin (10-15, 50-53 or 62-69)."
+  #elif ENABLED(G38_PROBE_TARGET)
+    #error "ENDSTOP_INTERRUPTS_FEATURE does not support G38_PROBE_TARGET."
+  #endif
+  #undef _ENDSTOP_PCINT
+#endif
+
 /**
  * emergency-command parser
  */
@@ -298,7 +298,9 @@ struct exfat_boot
 	}
 };
 
+#if defined(__AVR__) // Relies upon AVR's byte alignment.
 static_assert(sizeof(exfat_boot) == 512, "wtf");
+#endif
 
 //------------------------------------------------------------------------------
 /**
@@ -0,0 +1,86 @@
+/**
+ * arc_tracer.hpp - integer circle tracer for native G2/G3 arcs
+ *
+ * Walks a circle in the XY plane one step event at a time, with only additions and compares: the position is kept
+ * relative to the center, in steps, along with error = x^2 + y^2 - r^2. Each event takes one step along the axis the
+ * circle is moving fastest on (the major axis) and, if that leaves the position further from the circle than a step
+ * of the other axis would, a step of the minor axis too. The traced path stays within about half a step (0.6 at worst)
+ * of the circle, and a full circle ends exactly where it started.
+ *
+ * The planner walks an arc with it first, to find the number of events and where the arc ends, and the stepper ISR
+ * then walks it again to generate the steps; both have to use this same code so they agree step for step.
+ */
+
+#pragma once
+
+#include "MarlinConfig.h"
+
+#if ENABLED(NATIVE_ARCS)
+
+namespace Tuna
+{
+  struct arc_tracer final
+  {
+    // Event weights: one straight event is 12, one diagonal event (both X and Y step) is 17, ~12 * sqrt(2).
+    static constexpr const uint8 straight_weight = 12;
+    static constexpr const uint8 diagonal_weight = 17;
+
+    // Largest coordinate relative to the center, so that error and its updates fit in an int32.
+    static constexpr const int16 max_radius = 16383;
+
+    struct event final
+    {
+      int8 dx, dy;                        // -1, 0 or 1
+    };
+
+    int16 x, y;                           // Position relative to the center, in steps
+    int32 error;                          // x^2 + y^2 - r^2
+
+    static inline __forceinline __flatten int32 step_error(const int16 v, const int8 dv)
+    {
+      // (v + dv)^2 - v^2
+      return (dv > 0) ? (int32(v) * 2 + 1) : (1 - int32(v) * 2);
+    }
+
+    inline __forceinline __flatten event next(const bool clockwise)
+    {
+      event e = { 0, 0 };
+      const int16 ax = abs(x), ay = abs(y);
+
+      if (ay >= ax)
+      {
+        // Moving mostly along X: counterclockwise is -X above the center.
+        e.dx = ((y > 0) != clockwise) ? -1 : 1;
+        error += step_error(x, e.dx);
+        x += e.dx;
+
+        if (error >= ay) e.dy = (y > 0) ? -1 : 1;       // Outside: step toward the center
+        else if (-error > ay) e.dy = (y > 0) ? 1 : -1;  // Inside: step away from it
+        if (e.dy)
+        {
+          error += step_error(y, e.dy);
+          y += e.dy;
+        }
+      }
+      else
+      {
+        // Moving mostly along Y: counterclockwise is +Y right of the center.
+        e.dy = ((x > 0) == clockwise) ? -1 : 1;
+        error += step_error(y, e.dy);
+        y += e.dy;
+
+        if (error >= ax) e.dx = (x > 0) ? -1 : 1;
+        else if (-error > ax) e.dx = (x > 0) ? 1 : -1;
+        if (e.dx)
+        {
+          error += step_error(x, e.dx);
+          x += e.dx;
+        }
+      }
+
+      return e;
+    }
+  };
+}
+
+#endif // NATIVE_ARCS
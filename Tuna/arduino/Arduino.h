@@ -114,6 +114,7 @@ void analogReference(uint8_t mode);
 void analogWrite(uint8_t, int);
 
 unsigned long millis(void);
+unsigned long micros(void);
 void delay(unsigned long);
 void delay(uint8_t);
 void delay(uint16_t);
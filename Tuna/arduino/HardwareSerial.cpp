@@ -104,7 +104,7 @@ void HardwareSerial::_tx_udr_empty_irq(void) __restrict
 
 void HardwareSerial::begin(__uint24 baud, byte config) __restrict
 {
-  // Try u2x mode first
+  // Try u2x mode first (baud_rate, in tunalib/serial.hpp, checks the rates this makes)
   uint16_t baud_setting = (F_CPU / 4 / baud - 1) / 2;
   *_ucsra = 1 << U2X0;
 
@@ -28,6 +28,13 @@
 #include "HardwareSerial.h"
 #include "HardwareSerial_private.h"
 
+#if ENABLED(RX_LINE_ASSEMBLER)
+  #include "line_assembler.hpp"
+#endif
+#if ENABLED(SERIAL_TX_LANES)
+  #include "serial_tx.hpp"
+#endif
+
 // Each HardwareSerial is defined in its own file, sine the linker pulls
 // in the entire file when any element inside is used. --gc-sections can
 // additionally cause unused symbols to be dropped, but ISRs have the
@@ -48,6 +55,14 @@ __signal(USART_RXC) // ATmega8
 #error "Don't know what the Data Received vector is called for Serial"
 #endif
 {
+#if ENABLED(RX_LINE_ASSEMBLER)
+  if (__likely(!Tuna::LineAssembler::raw())) {
+    // The status is only valid before the data register is read
+    const uint8_t status = UCSR0A;
+    Tuna::LineAssembler::receive(status, UDR0);
+    return;
+  }
+#endif
   Serial._rx_complete_irq();
 }
 
@@ -63,7 +78,11 @@ __signal(USART_UDRE)
   #error "Don't know what the Data Register Empty vector is called for Serial"
 #endif
 {
+#if ENABLED(SERIAL_TX_LANES)
+  Tuna::SerialTx::udre();
+#else
   Serial._tx_udr_empty_irq();
+#endif
 }
 
 #if defined(UBRRH) && defined(UBRRL)
@@ -76,11 +76,13 @@ uint8_t Print::print(uint16_t n, uint8_t base) __restrict
   else return printNumber(n, base);
 }
 
+#if defined(__AVR__)
 uint8_t Print::print(const __uint24 & __restrict n, uint8_t base) __restrict
 {
   if (base == 0) return write(n);
   else return printNumber(n, base);
 }
+#endif
 
 uint8_t Print::print(const uint32_t & __restrict n, uint8_t base) __restrict
 {
@@ -100,11 +102,13 @@ uint8_t Print::print(int16_t n, uint8_t base) __restrict
   else return printNumber(n, base);
 }
 
+#if defined(__AVR__)
 uint8_t Print::print(const __int24 & __restrict n, uint8_t base) __restrict
 {
   if (base == 0) return write(n);
   else return printNumber(n, base);
 }
+#endif
 
 uint8_t Print::print(const int32_t & __restrict n, uint8_t base) __restrict
 {
@@ -158,12 +162,14 @@ uint8_t Print::println(uint16_t num, uint8_t base) __restrict
   return n;
 }
 
+#if defined(__AVR__)
 uint8_t Print::println(const __uint24 & __restrict num, uint8_t base) __restrict
 {
   uint8_t n = print(num, base);
   n += println();
   return n;
 }
+#endif
 
 uint8_t Print::println(const uint32_t & __restrict num, uint8_t base) __restrict
 {
@@ -186,12 +192,14 @@ uint8_t Print::println(int16_t num, uint8_t base) __restrict
   return n;
 }
 
+#if defined(__AVR__)
 uint8_t Print::println(const __int24 & __restrict num, uint8_t base) __restrict
 {
   uint8_t n = print(num, base);
   n += println();
   return n;
 }
+#endif
 
 uint8_t Print::println(const int32_t & __restrict num, uint8_t base) __restrict
 {
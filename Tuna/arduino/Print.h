@@ -88,11 +88,15 @@ class Print
 
     uint8_t print(uint8_t, uint8_t = DEC) __restrict;
     uint8_t print(uint16_t, uint8_t = DEC) __restrict;
+#if defined(__AVR__) // On other targets, __uint24 is one of the standard integer types.
     uint8_t print(const __uint24 & __restrict, uint8_t = DEC) __restrict;
+#endif
     uint8_t print(const uint32_t & __restrict, uint8_t = DEC) __restrict;
     uint8_t print(const uint64_t & __restrict, uint8_t = DEC) __restrict;
     uint8_t print(int16_t __restrict, uint8_t = DEC) __restrict;
+#if defined(__AVR__)
     uint8_t print(const __int24 & __restrict, uint8_t = DEC) __restrict;
+#endif
     uint8_t print(const int32_t & __restrict, uint8_t = DEC) __restrict;
     uint8_t print(const int64_t & __restrict, uint8_t = DEC) __restrict;
 
@@ -128,11 +132,15 @@ class Print
     // integer types
     uint8_t println(uint8_t, uint8_t = DEC) __restrict;
     uint8_t println(uint16_t, uint8_t = DEC) __restrict;
+#if defined(__AVR__) // On other targets, __uint24 is one of the standard integer types.
     uint8_t println(const __uint24 & __restrict, uint8_t = DEC) __restrict;
+#endif
     uint8_t println(const uint32_t & __restrict, uint8_t = DEC) __restrict;
     uint8_t println(const uint64_t & __restrict, uint8_t = DEC) __restrict;
     uint8_t println(int16_t, uint8_t = DEC) __restrict;
+#if defined(__AVR__)
     uint8_t println(const __int24 & __restrict, uint8_t = DEC) __restrict;
+#endif
     uint8_t println(const int32_t & __restrict, uint8_t = DEC) __restrict;
     uint8_t println(const int64_t & __restrict, uint8_t = DEC) __restrict;
 
@@ -0,0 +1,50 @@
+#include <tuna.h>
+
+#if ENABLED(BAUD_SWITCHING)
+
+#include "baud_switch.hpp"
+
+namespace Tuna
+{
+  uint32 BaudSwitch::baud = BAUDRATE;
+  uint32 BaudSwitch::pending = 0;
+  uint32 BaudSwitch::fallback = 0;
+  uint16 BaudSwitch::timeout = BAUD_SWITCH_TIMEOUT;
+  millis_t BaudSwitch::deadline = 0;
+
+  bool BaudSwitch::request(const uint32 rate)
+  {
+    if (!baud_rate::supported(rate)) return false;
+    if (rate != baud) pending = rate;
+    return true;
+  }
+
+  BaudSwitch::action BaudSwitch::update(const millis_t now)
+  {
+    if (__unlikely(pending))
+    {
+      // A switch before the last was confirmed still goes back to the rate that worked.
+      if (!fallback) fallback = baud;
+      baud = pending;
+      pending = 0;
+      deadline = now + timeout;
+      return action::switched;
+    }
+    if (__unlikely(fallback) && ELAPSED(now, deadline))
+    {
+      baud = fallback;
+      fallback = 0;
+      return action::fell_back;
+    }
+    return action::none;
+  }
+
+  void BaudSwitch::line_received(const char * __restrict command)
+  {
+    if (__likely(!fallback)) return;
+    // Checked by now: a line that starts with its number has a good checksum.
+    if (*command == 'N' || !strncmp_P(command, PSTR("M938"), 4)) fallback = 0;
+  }
+}
+
+#endif // BAUD_SWITCHING
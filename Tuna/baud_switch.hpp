@@ -0,0 +1,56 @@
+/**
+ * baud_switch.hpp - switching the baud rate at run time, for BAUD_SWITCHING
+ *
+ * M938 B<baud> asks for a rate. Once its "ok" is out at the old one, the port moves to the new rate, and back again
+ * unless the host confirms it within the timeout. Only what a host sends on purpose confirms it: a line with a line
+ * number and a good checksum, a frame (which carries a sequence number and a CRC), or an M938. Bytes at the wrong rate
+ * can come out as a short unnumbered line, which does not.
+ *
+ * This holds the rates and decides when to move; moving the port is the caller's (restart_serial in Marlin_main), as
+ * the simulator has a port of its own.
+ */
+
+#pragma once
+
+#include "MarlinConfig.h"
+
+#if ENABLED(BAUD_SWITCHING)
+
+namespace Tuna
+{
+  class BaudSwitch final : trait::ce_only
+  {
+  public:
+    enum class action : uint8
+    {
+      none = 0,
+      switched,                           // To the rate asked for
+      fell_back                           // To the rate before, unconfirmed
+    };
+
+    static uint32 baud;                   // The rate MYSERIAL runs at
+    static uint32 pending;                // Asked for, switched to once the "ok" is out; 0 if none
+    static uint32 fallback;               // The rate to go back to, until the new one is confirmed; 0 if none
+    static uint16 timeout;                // ms to wait for the confirmation
+
+    // From M938: false if the USART cannot make the rate. Nothing is pending if it is the rate already.
+    static bool request(const uint32 rate);
+
+    // From idle, once anything written before is out when pending is set.
+    static action update(const millis_t now);
+
+    // A line from the serial port, its line number and checksum checked.
+    static void line_received(const char * __restrict command);
+
+    // A frame with a good CRC, in sequence.
+    static inline __forceinline void frame_received()
+    {
+      fallback = 0;
+    }
+
+  private:
+    static millis_t deadline;
+  };
+}
+
+#endif // BAUD_SWITCHING
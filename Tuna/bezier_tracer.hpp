@@ -0,0 +1,162 @@
+/**
+ * bezier_tracer.hpp - fixed-point adaptive forward differencing for G5 cubic Bezier curves
+ *
+ * Walks a cubic Bezier curve in the XY plane one line segment at a time, with only additions, shifts and compares: the
+ * position is kept relative to the start of the curve in fixed point, along with its first, second and third forward
+ * differences over the current parameter step h = 2^-level. Stepping adds each difference to the one above it; halving
+ * or doubling h rescales them, so the step adapts to the curve as it goes:
+ *
+ *  - A segment strays at most max(|D2|, |D2 - D3|) / 8 from the curve (B'' is linear, and largest at an end). While
+ *    that is over the tolerance (as the sum of X and Y), and the segment is longer than the minimum length, the step
+ *    is halved.
+ *  - Twice the step would stray at most max(|D2 - D3|, |D2 + D3|) / 2. While that is within the tolerance, and the
+ *    parameter is on the coarser grid, the step is doubled.
+ *
+ * The k-th difference is kept scaled by 2^(k * level), so that all three keep their full precision at any step; a
+ * third difference that small would otherwise round to nothing, and the error would grow with the cube of the number
+ * of steps. The fixed point scale is picked per curve from the size of its coefficients, so a curve of any size keeps
+ * about 26 significant bits. The last segment ends at t = 1, where the caller uses the exact target.
+ */
+
+#pragma once
+
+#include "MarlinConfig.h"
+
+#if ENABLED(BEZIER_CURVE_SUPPORT)
+
+namespace Tuna
+{
+  struct bezier_tracer final
+  {
+    static constexpr const uint8 min_level = 3;               // Longest segment: 1/8 of the parameter range
+    static constexpr const uint8 max_level = 10;              // Shortest segment: 1/1024 of it
+    static constexpr const uint16 t_end = 1_u16 << max_level;
+
+    int32 x, y;                           // Position relative to the start, in units of 2^-shift mm
+    int32 dx[3], dy[3];                   // Forward differences over the current step, the k-th scaled by 2^(k * level)
+    int32 tolerance;                      // 8 * the largest deviation of a segment from the curve, in units
+    int32 min_length;                     // Shortest segment that may be split, as |dx| + |dy|, in units
+    float unit;                           // 2^-shift: one unit, in mm
+    uint16 t;                             // Parameter, in 1/t_end
+    uint8 level;                          // Step is 2^-level
+
+    /**
+     * Start a curve. control holds the control points and the end point relative to the start point, in mm.
+     */
+    void init(const float (&control)[3][2], const float tolerance_mm, const float min_length_mm)
+    {
+      float a[2], b[2], c[2];
+      float largest = 0.0f;
+      for (uint8 i = 0; i < 2; ++i)
+      {
+        // B(t) = a t^3 + b t^2 + c t
+        c[i] = 3.0f * control[0][i];
+        b[i] = 3.0f * (control[1][i] - 2.0f * control[0][i]);
+        a[i] = control[2][i] + 3.0f * (control[0][i] - control[1][i]);
+        NOLESS(largest, FABS(a[i]) + FABS(b[i]) + FABS(c[i]));
+      }
+
+      // Positions stay under 2^26 units, and the scaled differences under 2^30.
+      int exponent;
+      frexp(largest, &exponent);
+      const int8 shift = (exponent > 26) ? 0 : (exponent < 2) ? 24 : int8(26 - exponent);
+      const float scale = ldexp(1.0f, shift);
+      unit = ldexp(1.0f, -shift);
+
+      constexpr const float h = 1.0f / (1 << min_level);
+      for (uint8 i = 0; i < 2; ++i)
+      {
+        int32 * __restrict d = i ? dy : dx;
+        d[0] = LROUND((a[i] * h * h + b[i] * h + c[i]) * scale);
+        d[1] = LROUND((6.0f * a[i] * h + 2.0f * b[i]) * scale);
+        d[2] = LROUND(6.0f * a[i] * scale);
+      }
+
+      x = y = 0;
+      t = 0;
+      level = min_level;
+      tolerance = LROUND(8.0f * tolerance_mm * scale);
+      min_length = LROUND(min_length_mm * scale);
+    }
+
+    static inline __forceinline __flatten int32 rounded_shift(const int32 value, const uint8 bits)
+    {
+      return bits ? ((value + (1_i32 << (bits - 1))) >> bits) : value;
+    }
+
+    // The unscaled second and third differences, and how far a segment of this step or twice it may stray.
+    inline __forceinline __flatten int32 second(const int32 (&d)[3]) const { return rounded_shift(d[1], 2 * level); }
+    inline __forceinline __flatten int32 third(const int32 (&d)[3]) const { return rounded_shift(d[2], 3 * level); }
+
+    inline __forceinline __flatten int32 deviation(const int32 (&d)[3]) const
+    {
+      const int32 d2 = second(d), d3 = third(d);
+      return max(labs(d2), labs(d2 - d3));
+    }
+
+    inline __forceinline __flatten int32 doubled_deviation(const int32 (&d)[3]) const
+    {
+      const int32 d2 = second(d), d3 = third(d);
+      return 4 * max(labs(d2 - d3), labs(d2 + d3));
+    }
+
+    inline __forceinline __flatten void halve(int32 (&d)[3]) const
+    {
+      // D1' = D1 / 2 - D2 / 8 + D3 / 16, D2' = D2 / 4 - D3 / 8, D3' = D3 / 8
+      d[0] -= rounded_shift(d[1], level + 2) - rounded_shift(d[2], 2 * level + 3);
+      d[1] -= rounded_shift(d[2], level + 1);
+    }
+
+    inline __forceinline __flatten void double_step(int32 (&d)[3]) const
+    {
+      // D1' = 2 D1 + D2, D2' = 4 D2 + 4 D3, D3' = 8 D3
+      d[0] += rounded_shift(d[1], level + 1);
+      d[1] += rounded_shift(d[2], level);
+    }
+
+    inline __forceinline __flatten void step(int32 & __restrict position, int32 (&d)[3]) const
+    {
+      position += rounded_shift(d[0], level);
+      d[0] += rounded_shift(d[1], level);
+      d[1] += rounded_shift(d[2], level);
+    }
+
+    /**
+     * Take the next segment. Returns false once the curve is done. Otherwise the segment ends at
+     * (x, y) * unit, at parameter t / t_end; at t == t_end the caller should use the exact end point.
+     */
+    inline __forceinline __flatten bool next()
+    {
+      if (t >= t_end) return false;
+
+      // Finer, while the segment may stray too far from the curve and is long enough to split.
+      while (
+        level < max_level &&
+        deviation(dx) + deviation(dy) > tolerance &&
+        rounded_shift(labs(dx[0]) + labs(dy[0]), level) > min_length
+      ) {
+        halve(dx);
+        halve(dy);
+        ++level;
+      }
+
+      // Coarser, while twice the segment would still be close enough and would start on the coarser grid.
+      while (
+        level > min_level &&
+        (t & ((1_u16 << (max_level - level + 1)) - 1)) == 0 &&
+        doubled_deviation(dx) + doubled_deviation(dy) <= tolerance
+      ) {
+        double_step(dx);
+        double_step(dy);
+        --level;
+      }
+
+      step(x, dx);
+      step(y, dy);
+      t += 1_u16 << (max_level - level);
+      return true;
+    }
+  };
+}
+
+#endif // BEZIER_CURVE_SUPPORT
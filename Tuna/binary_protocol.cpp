@@ -0,0 +1,261 @@
+#include <tuna.h>
+
+#if ENABLED(BINARY_PROTOCOL)
+
+#include "binary_protocol.hpp"
+
+#include <util/crc16.h>
+
+#if ENABLED(PREPARSED_COMMANDS)
+  #include "command_queue.hpp"
+#else
+  #include "planner.h"
+  #include "gcode.h"
+#endif
+#if ENABLED(RX_LINE_ASSEMBLER)
+  #include "line_assembler.hpp"
+#endif
+
+namespace Tuna
+{
+  bool BinaryProtocol::active = false;
+  uint8 BinaryProtocol::expected = 0;
+  BinaryProtocol::counters BinaryProtocol::stats = {};
+
+  uint8 BinaryProtocol::state = BinaryProtocol::state_sync;
+  uint8 BinaryProtocol::sequence;
+  uint8 BinaryProtocol::length;
+  uint8 BinaryProtocol::offset;
+  uint8 BinaryProtocol::crc_low;
+  uint16 BinaryProtocol::crc;
+  uint8 BinaryProtocol::payload[BinaryProtocol::payload_size];
+  int32 BinaryProtocol::last[BinaryProtocol::params];
+  bool BinaryProtocol::resend_requested = false;
+
+  void BinaryProtocol::start()
+  {
+    active = true;
+    expected = 0;
+    state = state_sync;
+    resend_requested = false;
+    for (auto &p : last) p = 0;
+  }
+
+  void BinaryProtocol::set_active(const bool on)
+  {
+    if (on)
+      start();
+    else
+      active = false;
+    #if ENABLED(RX_LINE_ASSEMBLER)
+      LineAssembler::discard(); // Drop any partial ASCII line
+    #endif
+  }
+
+  BinaryProtocol::received BinaryProtocol::receive(const uint8 c)
+  {
+    switch (state)
+    {
+    case state_sync:
+      if (c == sync)
+      {
+        crc = 0xFFFF;
+        state = state_sequence;
+      }
+      return received::none;
+    case state_sequence:
+      sequence = c;
+      crc = _crc_ccitt_update(crc, c);
+      state = state_length;
+      return received::none;
+    case state_length:
+      if (__unlikely(c > payload_size))
+      {
+        state = state_sync;
+        ++stats.errors;
+        return received::error;
+      }
+      length = c;
+      offset = 0;
+      crc = _crc_ccitt_update(crc, c);
+      state = c ? state_payload : state_crc_low;
+      return received::none;
+    case state_payload:
+      payload[offset++] = c;
+      crc = _crc_ccitt_update(crc, c);
+      if (offset == length) state = state_crc_low;
+      return received::none;
+    case state_crc_low:
+      crc_low = c;
+      state = state_crc_high;
+      return received::none;
+    default:
+      break;
+    }
+
+    // The CRC's high byte ends the frame.
+    state = state_sync;
+    if (__unlikely(((uint16(c) << 8) | crc_low) != crc))
+    {
+      ++stats.errors;
+      return received::error;
+    }
+    if (__unlikely(sequence != expected))
+    {
+      // Behind: sent again, as the host did not hear it was taken. Ahead: one before it was lost.
+      if (uint8(expected - sequence) <= 128)
+      {
+        ++stats.duplicates;
+        return received::duplicate;
+      }
+      ++stats.errors;
+      return received::error;
+    }
+    if (__unlikely(!check()))
+    {
+      ++stats.errors;
+      return received::malformed;
+    }
+    ++expected;
+    ++stats.frames;
+    offset = 0;
+    if (length) state = state_pending;
+    return received::frame;
+  }
+
+  bool BinaryProtocol::read_varint(uint32 & __restrict value)
+  {
+    value = 0;
+    for (uint8 shift = 0; shift < 35; shift += 7)
+    {
+      if (__unlikely(offset == length)) return false;
+      const uint8 b = payload[offset++];
+      value |= uint32(b & 0x7F) << shift;
+      if (!(b & 0x80)) return true;
+    }
+    return false;
+  }
+
+  bool BinaryProtocol::check()
+  {
+    for (offset = 0; offset != length;)
+    {
+      const uint8 header = payload[offset++];
+      if (header == text_record)
+      {
+        if (offset == length) return false;
+        const uint8 size = payload[offset++];
+        if (size > text_size || size > length - offset) return false;
+        offset += size;
+        continue;
+      }
+      if (header & 0xC0) return false;
+      for (uint8 i = 0; i < params; ++i)
+      {
+        uint32 zigzag;
+        if (TEST(header, i) && !read_varint(zigzag)) return false;
+      }
+    }
+    return true;
+  }
+
+  BinaryProtocol::record BinaryProtocol::decode(char * __restrict slot)
+  {
+    const uint8 header = payload[offset++];
+
+    if (header == text_record)
+    {
+      const uint8 size = payload[offset++];
+      memcpy(slot, &payload[offset], size);
+      slot[size] = '\0';
+      offset += size;
+      if (offset == length) state = state_sync;
+      ++stats.records;
+      return record::text;
+    }
+
+    move m;
+    m.tag = move_tag;
+    m.header = header;
+    for (uint8 i = 0; i < params; ++i)
+    {
+      m.value[i] = 0.0f;
+      if (!TEST(header, i)) continue;
+      uint32 zigzag;
+      read_varint(zigzag);
+      last[i] += int32(zigzag >> 1) ^ -int32(zigzag & 1);
+      // As value_float reads the text: strtod's nearest double, as a float.
+      m.value[i] = float(double(last[i]) / ((i == E_AXIS) ? 100000.0 : 1000.0));
+    }
+    memcpy(slot, &m, sizeof(m));
+    if (offset == length) state = state_sync;
+    ++stats.records;
+    return record::move;
+  }
+
+#if ENABLED(PREPARSED_COMMANDS)
+
+  void BinaryProtocol::queue_move(const char * __restrict slot)
+  {
+    move m;
+    memcpy(&m, slot, sizeof(m));
+
+    // The queue takes them in letter order.
+    constexpr const char letters[params] = { 'E', 'F', 'X', 'Y', 'Z' };
+    constexpr const uint8 bits[params] = { E_AXIS, params - 1, X_AXIS, Y_AXIS, Z_AXIS };
+    uint32 given = 0;
+    float values[params];
+    uint8 n = 0;
+    for (uint8 i = 0; i < params; ++i)
+    {
+      if (TEST(m.header, bits[i]))
+      {
+        given |= uint32(1) << (letters[i] - 'A');
+        values[n++] = m.value[bits[i]];
+      }
+    }
+    CommandQueue::enqueue('G', TEST(m.header, rapid_bit) ? 0 : 1, given, values, false);
+  }
+
+#else
+
+  float BinaryProtocol::get_destination(const char * __restrict slot, const float (&position)[XYZE], const bool relative,
+    const bool (&axis_relative)[XYZE], float (&destination)[XYZE], float & __restrict feedrate)
+  {
+    move m;
+    memcpy(&m, slot, sizeof(m));
+    const bool rapid = TEST(m.header, rapid_bit);
+
+    float max_feedrate = type_trait<float>::max;
+    LOOP_XYZE(i)
+    {
+      if (!TEST(m.header, i))
+      {
+        destination[i] = position[i];
+        continue;
+      }
+      const float axis_move = m.value[i]
+        #if ENABLED(INCH_MODE_SUPPORT)
+          * parser.axis_unit_factor(AxisEnum(i))
+        #endif
+      ;
+      destination[i] = axis_move + ((relative || axis_relative[i]) ? position[i] : 0);
+      if (rapid) max_feedrate = min(max_feedrate, planner.max_feedrate_mm_s[i]);
+    }
+
+    constexpr const uint8 f = params - 1;
+    if (TEST(m.header, f) && m.value[f] > 0.0f)
+    {
+      feedrate = MMM_TO_MMS(m.value[f]
+        #if ENABLED(INCH_MODE_SUPPORT)
+          * parser.linear_unit_factor
+        #endif
+      );
+    }
+    return rapid ? max_feedrate : feedrate;
+  }
+
+#endif // PREPARSED_COMMANDS
+}
+
+#endif // BINARY_PROTOCOL
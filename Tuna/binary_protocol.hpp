@@ -0,0 +1,208 @@
+/**
+ * binary_protocol.hpp - compact binary framing of G-code for BINARY_PROTOCOL
+ *
+ * Once M935 S1 switches it on, MYSERIAL takes frames instead of ASCII lines:
+ *
+ *   [sync] [sequence] [length] [payload: length bytes] [CRC16: low byte, high byte]
+ *
+ * The CRC is avr-libc's _crc_ccitt_update from 0xFFFF, over the sequence, the length and the payload. The payload is a
+ * run of records, each of them one command:
+ *
+ *   - A G0/G1: a header byte (bits 0-4: X Y Z E F given, bit 5: G0, bits 6-7 clear), then each parameter given, as a
+ *     zigzag varint (LEB128) of its change from the same parameter of the move before. X Y Z and F count in 1/1000,
+ *     E in 1/100000. The values are those of the G-code text, so G90/G91, M82/M83 and G92 apply to them as they would.
+ *   - Anything else: text_record, the length of the command, and its text.
+ *
+ * Frames are only taken in sequence, and only decoded as the command queue has room for their records, so the receive
+ * buffer is all the host can run ahead by. Moves decode straight into a queue slot as a move, never as text: nothing
+ * parses them again. Simulator/encode.rb writes the frames for a G-code file.
+ */
+
+#pragma once
+
+#include "MarlinConfig.h"
+
+#if ENABLED(BAUD_SWITCHING)
+  #include "baud_switch.hpp"
+#endif
+
+#if ENABLED(BINARY_PROTOCOL)
+
+namespace Tuna
+{
+  class BinaryProtocol final : trait::ce_only
+  {
+  public:
+    static constexpr const uint8 sync = 0xF5;                 // Starts a frame. Not a character of any ASCII command.
+    static constexpr const uint8 text_record = 0x40;
+    static constexpr const uint8 move_tag = 0x01;             // Leads a queued move, where a command's letter would be.
+    static constexpr const uint8 params = 5;                  // X Y Z E F, in the order of their header bits.
+    static constexpr const uint8 rapid_bit = 5;               // In the header of a move: a G0.
+    static constexpr const uint8 payload_size = BINARY_FRAME_SIZE;
+    static constexpr const uint8 text_size = (payload_size - 2 < MAX_CMD_SIZE - 1) ? payload_size - 2 : MAX_CMD_SIZE - 1;
+
+    // A G0/G1 as it is queued: the parameters given, as the parser would have read them.
+    struct move final
+    {
+      uint8 tag;                          // move_tag
+      uint8 header;                       // As received.
+      float value[params];
+    };
+    static_assert(sizeof(move) <= MAX_CMD_SIZE, "A binary move has to fit a command queue slot");
+
+    enum class received : uint8
+    {
+      none = 0,                           // Nothing completed.
+      frame,                              // A frame was taken: pending() while it has records left.
+      duplicate,                          // A frame that was taken before: its acknowledgement was lost.
+      error,                              // A corrupt frame, or one past a lost one.
+      malformed                           // A frame with a good CRC and records that do not decode: not taken.
+    };
+
+    enum class record : uint8
+    {
+      move = 0,
+      text
+    };
+
+    // What the host is answered with, once poll() returns.
+    enum class reply : uint8
+    {
+      none = 0,
+      ok,                                 // "ok S<expected - 1>": every frame up to it is queued.
+      resend,                             // "Resend: S<expected>": one was lost. Every frame before it is queued.
+      malformed                           // A frame that does not decode: the stream is lost from here.
+    };
+
+    struct counters final
+    {
+      uint32 frames;
+      uint32 records;
+      uint16 duplicates;
+      uint16 errors;
+    };
+
+    static bool active;                   // Frames are taken instead of ASCII lines.
+    static uint8 expected;                // Sequence of the next frame to take.
+    static counters stats;
+
+    // Takes frames from sequence 0 on, with every parameter at 0.
+    static void start();
+
+    // Feeds the next byte received. Not while pending().
+    static received receive(const uint8 c);
+
+    // A frame was taken, and has records left to decode.
+    static inline __forceinline bool pending()
+    {
+      return state == state_pending;
+    }
+
+    // Decodes the next record of the frame into a command queue slot: a move, or a null-terminated command. Every
+    // record of a frame taken decodes.
+    static record decode(char * __restrict slot);
+
+    #if ENABLED(PREPARSED_COMMANDS)
+      // Queues the move decoded into 'slot' as a parsed G0/G1.
+      static void queue_move(const char * __restrict slot);
+    #else
+      // As gcode_get_destination, for the move decoded into 'slot': each axis it has goes to its value, or from
+      // 'position' by it where 'relative' or axis_relative[axis] is set; the others stay at 'position'. Sets 'feedrate'
+      // (mm/s) to its F, if it has one. Returns the rate it runs at: 'feedrate', or for a G0 the least max_feedrate of
+      // its axes.
+      static float get_destination(const char * __restrict slot, const float (&position)[XYZE], const bool relative,
+        const bool (&axis_relative)[XYZE], float (&destination)[XYZE], float & __restrict feedrate);
+
+      // The move decoded into 'slot' moves E alone.
+      static inline __forceinline bool e_only(const char * __restrict slot)
+      {
+        constexpr const uint8 axes = _BV(X_AXIS) | _BV(Y_AXIS) | _BV(Z_AXIS) | _BV(E_AXIS);
+        return (uint8(slot[offsetof(move, header)]) & axes) == _BV(E_AXIS);
+      }
+    #endif
+
+    // M935 S: takes frames from sequence 0 on, as start(), or ASCII lines again. Either way, the ASCII line being
+    // received is dropped, with RX_LINE_ASSEMBLER.
+    static void set_active(const bool on);
+
+    // As get_binary_commands: takes frames while room() says the command queue has a slot, from read(), which returns
+    // the next byte received or a negative value if there is none. Each record decodes into back(), and goes to
+    // commit(slot, record). Frames are acknowledged together, once all of their records are queued, and a lost one is
+    // asked for once, until a frame is taken again.
+    template <typename Read, typename Room, typename Back, typename Commit>
+    static reply poll(Read read, Room room, Back back, Commit commit)
+    {
+      bool acknowledge = false;
+      while (room())
+      {
+        if (!pending())
+        {
+          const int16 c = read();
+          if (c < 0) break;
+
+          switch (receive(uint8(c)))
+          {
+          case received::frame:
+            resend_requested = false;
+            #if ENABLED(BAUD_SWITCHING)
+              BaudSwitch::frame_received();
+            #endif
+            if (!pending()) acknowledge = true; // Empty
+            break;
+          case received::malformed:
+            return reply::malformed;
+          case received::duplicate:
+            acknowledge = true; // The host missed the acknowledgement
+            break;
+          case received::error:
+            // Once: the frames after the lost one are refused until it comes again.
+            if (!resend_requested)
+            {
+              resend_requested = true;
+              return reply::resend;
+            }
+            break;
+          default:
+            break;
+          }
+          continue;
+        }
+
+        char * const slot = back();
+        commit(slot, decode(slot));
+        if (!pending()) acknowledge = true;
+      }
+      return acknowledge ? reply::ok : reply::none;
+    }
+
+  private:
+    enum : uint8
+    {
+      state_sync = 0,
+      state_sequence,
+      state_length,
+      state_payload,
+      state_crc_low,
+      state_crc_high,
+      state_pending
+    };
+
+    static uint8 state;
+    static uint8 sequence;
+    static uint8 length;
+    static uint8 offset;                  // Bytes of the payload received, then decoded.
+    static uint8 crc_low;
+    static uint16 crc;
+    static uint8 payload[payload_size];
+    static int32 last[params];            // Parameters of the last move, in 1/1000 (E: 1/100000).
+    static bool resend_requested;         // Since a frame was last taken
+
+    static bool read_varint(uint32 & __restrict value);
+
+    // Walks the records of the frame received without decoding them. A frame is taken whole or not at all: dropping
+    // the records after a bad one would drop their deltas, and move every later move of the stream.
+    static bool check();
+  };
+}
+
+#endif // BINARY_PROTOCOL
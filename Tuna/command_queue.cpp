@@ -0,0 +1,239 @@
+#include <tuna.h>
+
+#if ENABLED(PREPARSED_COMMANDS)
+
+#include "command_queue.hpp"
+#include "gcode.h"
+
+namespace Tuna
+{
+  uint8 CommandQueue::count = 0;
+
+  uint8 CommandQueue::ring[CommandQueue::size];
+  uint16 CommandQueue::head = 0;
+  uint16 CommandQueue::tail = 0;
+  bool CommandQueue::keep_text = false;
+
+  // As GCodeParser::parse, for the parameters of a command that all have values. Leaves the letter and the code, once
+  // read, for the caller. Cuts the text at its checksum, as parse would.
+  bool CommandQueue::parse(char * __restrict p, uint8 (& __restrict record)[entry_size], char & __restrict letter, uint16 & __restrict code)
+  {
+    uint8 end = record_size;
+    uint8 flags = 0;
+
+    while (*p == ' ') ++p;
+
+    if (*p == 'N' && NUMERIC_SIGNED(p[1]))
+    {
+      const uint24 line = uint24(strtol(p + 1, nullptr, 10));
+      memcpy(&record[end], &line, 3);
+      end += 3;
+      flags |= flag_numbered;
+      p += 2;
+      while (NUMERIC(*p)) ++p;
+      while (*p == ' ') ++p;
+    }
+
+    letter = *p++;
+    switch (letter)
+    {
+    case 'G': flags |= kind_g; break;
+    case 'M': flags |= kind_m; break;
+    case 'T': flags |= kind_t; break;
+    default: return false;
+    }
+
+    char *starpos = strchr(p, '*');
+    if (starpos)
+    {
+      --starpos;
+      while (*starpos == ' ') --starpos;
+      starpos[1] = '\0';
+    }
+
+    while (*p == ' ') ++p;
+    if (!NUMERIC(*p)) return false;
+    uint16 c = 0;
+    do
+    {
+      if (c >= 1000) return false;
+      c = c * 10 + (*p++ - '0');
+    } while (NUMERIC(*p));
+    code = c;
+    if (*p == '.') return false;            // A subcode
+    while (*p == ' ') ++p;
+
+    if (letter == 'M') switch (c)
+    {
+    case 23: case 28: case 30: case 32: case 33: case 117: case 118: case 928: return false;
+    default: break;
+    }
+
+    uint32 params = 0;
+    while (const char param = *p++)
+    {
+      if (WITHIN(param, 'A', 'Z'))
+      {
+        while (*p == ' ') ++p;
+        if (!DECIMAL_SIGNED(*p)) return false;
+
+        // The integer accessors read the float: it has to be the integer the text reads as. Below 2^24 a float holds
+        // every integer, so int32(value) is the integer part of the text (unless the text has more digits than a float
+        // holds: 2.99999999 reads as 3); larger values are kept as text.
+        const float value = GCodeParser::read_float(p);
+        if (!(FABS(value) < 16777216.0f)) return false;
+
+        const uint8 ind = param - 'A';
+        const uint32 bit = uint32(1) << ind;
+        uint8 * const v = &record[end - 4 * __builtin_popcountl(params & ~(bit - 1))];
+        if (!(params & bit))
+        {
+          if (end + 4 > entry_size) return false;
+          memmove(v + 4, v, &record[end] - v);
+          end += 4;
+          params |= bit;
+        }
+        memcpy(v, &value, sizeof(value));   // A parameter given twice takes the last value, as in parse
+      }
+      if (!WITHIN(*p, 'A', 'Z'))
+      {
+        while (NUMERIC(*p)) ++p;
+        while (*p == ' ') ++p;
+      }
+    }
+
+    record[0] = end;
+    record[1] = flags;
+    memcpy(&record[2], &c, sizeof(c));
+    memcpy(&record[4], &params, params_size);
+    return true;
+  }
+
+  void CommandQueue::push(const uint16 at, const uint8 entry_bytes)
+  {
+    if (!count) head = at;
+    else if (at != tail) ring[tail] = 0;    // The entry wrapped
+    tail = at + entry_bytes;
+    if (tail == size) tail = 0;
+    ++count;
+  }
+
+  void CommandQueue::enqueue(char * __restrict command, const bool say_ok)
+  {
+    const uint16 at = back();
+    uint8 record[entry_size];
+    char letter = '\0';
+    uint16 code = 0xFFFF;
+
+    // Saved to the card as received, with the line number and checksum that parse would cut. The M29 that ends it is
+    // found in the text, as loop finds it.
+    const bool text_only = keep_text;
+    if (text_only && strstr_P(command, PSTR("M29"))) keep_text = false;
+
+    uint8 entry_bytes;
+    if (!text_only && parse(command, record, letter, code))
+    {
+      record[1] |= say_ok ? flag_say_ok : 0;
+      entry_bytes = record[0];
+      memcpy(&ring[at], record, entry_bytes);
+    }
+    else
+    {
+      char * const text = (char *)&ring[at + header_size];
+      if (text != command)
+      {
+        strncpy(text, command, MAX_CMD_SIZE - 1);
+        text[MAX_CMD_SIZE - 1] = '\0';
+      }
+      entry_bytes = header_size + strlen(text) + 1;
+      ring[at] = entry_bytes;
+      ring[at + 1] = kind_text | (say_ok ? flag_say_ok : 0);
+    }
+
+    if (letter == 'M' && (code == 28 || code == 928)) keep_text = true;
+
+    push(at, entry_bytes);
+  }
+
+  void CommandQueue::enqueue(const char letter, const uint16 code, const uint32 params, const float * __restrict values, const bool say_ok)
+  {
+    const uint16 at = back();
+    const uint8 entry_bytes = record_size + 4 * __builtin_popcountl(params);
+    uint8 * const entry = &ring[at];
+    entry[0] = entry_bytes;
+    entry[1] = ((letter == 'G') ? kind_g : (letter == 'M') ? kind_m : kind_t) | (say_ok ? flag_say_ok : 0);
+    memcpy(&entry[2], &code, sizeof(code));
+    memcpy(&entry[4], &params, params_size);
+    memcpy(&entry[record_size], values, entry_bytes - record_size);
+    push(at, entry_bytes);
+  }
+
+  void CommandQueue::clear()
+  {
+    head = tail;
+    count = 0;
+  }
+
+  uint8 CommandQueue::room()
+  {
+    uint16 entries;
+    if (!count) entries = size / entry_size;
+    else if (tail > head) entries = (size - tail) / entry_size + head / entry_size;
+    else entries = (head - tail) / entry_size;
+    return min(entries, uint16(255 - count));
+  }
+
+  bool CommandQueue::front_line(uint24 & __restrict line)
+  {
+    if (!count || !(ring[head + 1] & flag_numbered)) return false;
+    line = 0;
+    memcpy(&line, &ring[head + record_size], 3);
+    return true;
+  }
+
+  void CommandQueue::load()
+  {
+    uint8 * const entry = &ring[head];
+    const uint8 flags = entry[1];
+    if ((flags & kind_mask) == kind_text)
+    {
+      parser.parse((char *)&entry[header_size]);
+      return;
+    }
+
+    parser.reset();
+    parser.preparsed = true;
+    parser.command_ptr = (char *)entry;
+    parser.command_letter = "?GMT"[flags & kind_mask];
+    uint16 code;
+    memcpy(&code, &entry[2], sizeof(code));
+    parser.codenum = code;
+
+    uint32 params = 0;
+    memcpy(&params, &entry[4], params_size);
+    uint8 at = record_size + ((flags & flag_numbered) ? 3 : 0);
+    for (uint8 ind = 0; params; ++ind, params >>= 1)
+    {
+      if (params & 1)
+      {
+        SBI(parser.codebits[PARAM_IND(ind)], PARAM_BIT(ind));
+        parser.param[ind] = at;
+        at += 4;
+      }
+    }
+  }
+
+  void CommandQueue::pop()
+  {
+    if (!count) return;
+    if (--count)
+    {
+      head += ring[head];
+      if (head == size || !ring[head]) head = 0;
+    }
+    else
+      head = tail = 0;
+  }
+}
+
+#endif // PREPARSED_COMMANDS
@@ -0,0 +1,125 @@
+/**
+ * command_queue.hpp - command queue of parsed commands for PREPARSED_COMMANDS
+ *
+ * A ring of COMMAND_QUEUE_BYTES, holding each command in as many bytes as it takes. A command is parsed once, as it is
+ * queued, into:
+ *
+ *   [size] [flags] [code: 2 bytes] [A-Z given: 4 bytes, bit 0 for A] [line number: 3 bytes, if numbered]
+ *   [values: a float for each parameter given, in letter order]
+ *
+ * The values are what GCodeParser::value_float reads from the text, so the handlers see the same numbers. A G1 X Y E
+ * takes 20 bytes, against the 64 of a text slot. process_next_command loads the parameters into the parser without
+ * scanning any text. Commands that do not fit this are queued as their text, and parsed as they run, as before:
+ *
+ *   [size] [flags] [text, null-terminated]
+ *
+ * That is anything other than G, M or T and a number with parameters A-Z that all have values, commands that take a
+ * string (M23 M28 M30 M32 M33 M117 M118 M928), values that would read as a different integer than they do as text,
+ * and every command from an M28 or M928 to the next M29, as those are written to the card as they were received.
+ *
+ * An entry never wraps: one that would is written at the start of the ring, and a size of 0 marks where the one before
+ * it ends. The queue takes another command while there is room for the longest entry, so its depth depends on what is
+ * queued.
+ */
+
+#pragma once
+
+#include "MarlinConfig.h"
+
+#if ENABLED(PREPARSED_COMMANDS)
+
+namespace Tuna
+{
+  class CommandQueue final : trait::ce_only
+  {
+  public:
+    static constexpr const uint16 size = COMMAND_QUEUE_BYTES;
+    static constexpr const uint8 header_size = 2;
+    static constexpr const uint8 entry_size = header_size + MAX_CMD_SIZE; // The longest entry: a text of MAX_CMD_SIZE - 1
+
+    static uint8 count;                   // Commands queued
+
+    // Room for another command, of any length.
+    static inline __forceinline bool has_room()
+    {
+      if (!count) return true;
+      if (count == 255) return false;
+      if (tail > head) return (size - tail >= entry_size) || (head >= entry_size);
+      return head - tail >= entry_size;
+    }
+
+    // Where the text of the next command can be written before commit(): MAX_CMD_SIZE characters. Only while has_room().
+    static inline __forceinline char * text()
+    {
+      return (char *)&ring[back() + header_size];
+    }
+
+    // Queues the command written at text().
+    static inline __forceinline void commit(const bool say_ok)
+    {
+      enqueue(text(), say_ok);
+    }
+
+    // Queues a command: parsed if it can be, else its text, cut to MAX_CMD_SIZE - 1 characters. Only while has_room().
+    static void enqueue(char * __restrict command, const bool say_ok);
+
+    // Queues a command parsed already: 'params' as in an entry, with a value for each, in letter order.
+    static void enqueue(const char letter, const uint16 code, const uint32 params, const float * __restrict values, const bool say_ok);
+
+    static void clear();
+
+    // How many more commands of the longest kind fit, as ADVANCED_OK reports.
+    static uint8 room();
+
+    // The "ok" of the command at the front is to be sent. Also when the queue is empty, as for a resend.
+    static inline __forceinline bool say_ok()
+    {
+      return !count || (ring[head + 1] & flag_say_ok);
+    }
+
+    // The text of the command at the front, or nullptr if it was queued parsed (or there is none).
+    static inline __forceinline char * front_text()
+    {
+      return (count && (ring[head + 1] & kind_mask) == kind_text) ? (char *)&ring[head + header_size] : nullptr;
+    }
+
+    // The line number of the command at the front, if it was queued parsed and numbered.
+    static bool front_line(uint24 & __restrict line);
+
+    // Loads the command at the front into the parser: its parameters, or its text, parsed now.
+    static void load();
+
+    // Drops the command at the front, once it has run.
+    static void pop();
+
+  private:
+    enum : uint8
+    {
+      kind_text = 0,                      // The letter of a parsed command: G, M or T
+      kind_g,
+      kind_m,
+      kind_t,
+      kind_mask = 0x03,
+      flag_say_ok = 0x04,
+      flag_numbered = 0x08
+    };
+    static constexpr const uint8 params_size = 4;         // The A-Z bits; not sizeof(uint32), which is 8 on 64-bit hosts
+    static constexpr const uint8 record_size = header_size + 2 + params_size;
+
+    static uint8 ring[size];
+    static uint16 head;                   // Front entry
+    static uint16 tail;                   // End of the back entry
+    static bool keep_text;                // From an M28 or M928 to the next M29
+
+    // Where the next entry goes.
+    static inline __forceinline uint16 back()
+    {
+      return (size - tail >= entry_size) ? tail : 0;
+    }
+
+    static bool parse(char * __restrict p, uint8 (& __restrict record)[entry_size], char & __restrict letter, uint16 & __restrict code);
+    static void push(const uint16 at, const uint8 entry_bytes);
+  };
+}
+
+#endif // PREPARSED_COMMANDS
@@ -36,13 +36,13 @@
  *
  */
 
-#define EEPROM_VERSION "V39"
+#define EEPROM_VERSION "V40"
 
 // Change EEPROM version if these are changed:
 #define EEPROM_OFFSET 100
 
 /**
- * V39 EEPROM Layout:
+ * V40 EEPROM Layout:
  *
  *  100  Version                                    (char x4)
  *  104  EEPROM CRC16                               (uint16_t)
@@ -626,7 +626,12 @@ void MarlinSettings::postprocess() {
     }
 
       const uint32 dummyui32 = 0;
-      for (uint8_t q = 3; q--;) EEPROM_WRITE(dummyui32);
+      #if ENABLED(JUNCTION_DEVIATION)
+        EEPROM_WRITE(planner.junction_deviation_mm);
+      #else
+        EEPROM_WRITE(dummyui32);
+      #endif
+      for (uint8_t q = 2; q--;) EEPROM_WRITE(dummyui32);
 
       // TUNA
       const auto &calib = Tuna::Thermal::Manager::Simple::GetCalibration();
@@ -990,7 +995,12 @@ void MarlinSettings::postprocess() {
       }
 
         uint32 dummyui32;
-        for (uint8_t q = 3; q--;) EEPROM_READ(dummyui32);
+        #if ENABLED(JUNCTION_DEVIATION)
+          EEPROM_READ(planner.junction_deviation_mm);
+        #else
+          EEPROM_READ(dummyui32);
+        #endif
+        for (uint8_t q = 2; q--;) EEPROM_READ(dummyui32);
 
         // TUNA
         Thermal::Manager::Simple::calibration calib;
@@ -1187,6 +1197,9 @@ void MarlinSettings::reset() {
   planner.max_jerk[Y_AXIS] = DEFAULT_YJERK;
   planner.max_jerk[Z_AXIS] = DEFAULT_ZJERK;
   planner.max_jerk[E_AXIS] = DEFAULT_EJERK;
+  #if ENABLED(JUNCTION_DEVIATION)
+    planner.junction_deviation_mm = JUNCTION_DEVIATION_MM;
+  #endif
 
   //
   // i3++
@@ -1512,7 +1525,11 @@ void MarlinSettings::reset() {
 
     if (!forReplay) {
       CONFIG_ECHO_START;
-      SERIAL_ECHOLNPGM("Advanced: S<min_feedrate> T<min_travel_feedrate> B<min_segment_time_ms> X<max_xy_jerk> Z<max_z_jerk> E<max_e_jerk>");
+      SERIAL_ECHOLNPGM("Advanced: S<min_feedrate> T<min_travel_feedrate> B<min_segment_time_ms> X<max_xy_jerk> Z<max_z_jerk> E<max_e_jerk>"
+        #if ENABLED(JUNCTION_DEVIATION)
+          " J<junction_deviation>"
+        #endif
+      );
     }
     CONFIG_ECHO_START;
     SERIAL_ECHOPAIR("  M205 S", LINEAR_UNIT(planner.min_feedrate_mm_s));
@@ -1521,7 +1538,12 @@ void MarlinSettings::reset() {
     SERIAL_ECHOPAIR(" X", LINEAR_UNIT(planner.max_jerk[X_AXIS]));
     SERIAL_ECHOPAIR(" Y", LINEAR_UNIT(planner.max_jerk[Y_AXIS]));
     SERIAL_ECHOPAIR(" Z", LINEAR_UNIT(planner.max_jerk[Z_AXIS]));
-    SERIAL_ECHOLNPAIR(" E", LINEAR_UNIT(planner.max_jerk[E_AXIS]));
+    #if ENABLED(JUNCTION_DEVIATION)
+      SERIAL_ECHOPAIR(" E", LINEAR_UNIT(planner.max_jerk[E_AXIS]));
+      SERIAL_ECHOLNPAIR(" J", LINEAR_UNIT(planner.junction_deviation_mm));
+    #else
+      SERIAL_ECHOLNPAIR(" E", LINEAR_UNIT(planner.max_jerk[E_AXIS]));
+    #endif
 
     #if HAS_M206_COMMAND
       if (!forReplay) {
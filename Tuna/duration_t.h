@@ -76,7 +76,9 @@ public:
    *
    * @param seconds The number of seconds
    */
+#if __arch_avr // On the host, uint24 is uint32.
 	_duration_t(uint24 const &seconds) : value(seconds) {}
+#endif
 
 	_duration_t(uint32 const &seconds) : value(seconds) {}
 
@@ -62,6 +62,48 @@ volatile char Endstops::endstop_hit_bits; // use X_MIN, Y_MIN, Z_MIN and Z_MIN_P
   volatile bool Endstops::z_probe_enabled = false;
 #endif
 
+#if ENABLED(ENDSTOP_INTERRUPTS_FEATURE)
+
+  volatile uint8_t Endstops::e_hit = 0;
+
+  // Enable the pin change interrupt of a pin, given its input register and bit. PCINT0 covers port B, PCINT1 PE0 and
+  // port J from bit 1 on, PCINT2 port K.
+  static void enable_pin_change_interrupt(const volatile uint8_t &pin_register, const uint8_t bit) {
+    if (&pin_register == &PINB) {
+      SBI(PCMSK0, bit);
+      SBI(PCICR, PCIE0);
+    }
+    else if (&pin_register == &PINJ) {
+      SBI(PCMSK1, bit + 1);
+      SBI(PCICR, PCIE1);
+    }
+    else if (&pin_register == &PINK) {
+      SBI(PCMSK2, bit);
+      SBI(PCICR, PCIE2);
+    }
+  }
+
+  #define _ENDSTOP_INTERRUPT(IO) enable_pin_change_interrupt(DIO ## IO ## _RPORT, DIO ## IO ## _PIN)
+  #define ENDSTOP_INTERRUPT(IO) _ENDSTOP_INTERRUPT(IO)
+
+  // Any change on an endstop pin: sample the endstops now, during a move, and have the next stepper ISR sample them
+  // again to confirm it. Otherwise the stepper ISR takes both samples.
+  static inline void __forceinline __flatten endstop_pin_changed() {
+    if (ENDSTOPS_ENABLED && stepper.current_block != nullptr) {
+      Endstops::update();
+      Endstops::e_hit = 1;
+    }
+    else {
+      Endstops::e_hit = 2;
+    }
+  }
+
+  __signal(PCINT0) { endstop_pin_changed(); }
+  __signal(PCINT1) { endstop_pin_changed(); }
+  __signal(PCINT2) { endstop_pin_changed(); }
+
+#endif
+
 /**
  * Class and Instance Methods
  */
@@ -140,6 +182,30 @@ void Endstops::init() {
     #endif
   #endif
 
+  #if ENABLED(ENDSTOP_INTERRUPTS_FEATURE)
+    #if HAS_X_MIN
+      ENDSTOP_INTERRUPT(X_MIN_PIN);
+    #endif
+    #if HAS_X_MAX
+      ENDSTOP_INTERRUPT(X_MAX_PIN);
+    #endif
+    #if HAS_Y_MIN
+      ENDSTOP_INTERRUPT(Y_MIN_PIN);
+    #endif
+    #if HAS_Y_MAX
+      ENDSTOP_INTERRUPT(Y_MAX_PIN);
+    #endif
+    #if HAS_Z_MIN
+      ENDSTOP_INTERRUPT(Z_MIN_PIN);
+    #endif
+    #if HAS_Z_MAX
+      ENDSTOP_INTERRUPT(Z_MAX_PIN);
+    #endif
+    #if ENABLED(Z_MIN_PROBE_ENDSTOP)
+      ENDSTOP_INTERRUPT(Z_MIN_PROBE_PIN);
+    #endif
+  #endif
+
 } // Endstops::init
 
 void Endstops::report_state() {
@@ -39,6 +39,11 @@ class Endstops final {
     static byte
       current_endstop_bits, old_endstop_bits;
 
+    #if ENABLED(ENDSTOP_INTERRUPTS_FEATURE)
+      // Set by a pin change on an endstop pin; the stepper ISR calls update() while it counts down.
+      static volatile uint8_t e_hit;
+    #endif
+
     Endstops() {};
 
     /**
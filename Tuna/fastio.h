@@ -115,6 +115,16 @@ static constexpr const auto _bv = make_uintsz<1_u16 << bits>;
 
 #define OUT_WRITE(IO, v) do{ SET_OUTPUT(IO); WRITE(IO, v); }while(0)
 
+/**
+ * Writing ones to an input register toggles those bits of its port. Pins that share a port
+ * can be toggled together with one store, with no read-modify-write, even above 0x100.
+ */
+#define _TOGGLE_REGISTER(IO) (DIO ## IO ## _RPORT)
+#define _PIN_MASK(IO) _bv<DIO ## IO ## _PIN>
+
+#define TOGGLE_REGISTER(IO) _TOGGLE_REGISTER(IO)
+#define PIN_MASK(IO) _PIN_MASK(IO)
+
 /**
  * Timer and Interrupt Control
  */
@@ -49,6 +49,9 @@ int GCodeParser::codenum;
 #if USE_GCODE_SUBCODES
   int GCodeParser::subcode;
 #endif
+#if ENABLED(PREPARSED_COMMANDS)
+  bool GCodeParser::preparsed;
+#endif
 
 #if ENABLED(FASTER_GCODE_PARSER)
   // Optimized Parameters
@@ -78,6 +81,9 @@ void __forceinline __flatten GCodeParser::reset() {
     ZERO(codebits);                     // No codes yet
     //ZERO(param);                      // No parameters (should be safe to comment out this line)
   #endif
+  #if ENABLED(PREPARSED_COMMANDS)
+    preparsed = false;                  // Text, until loaded from the queue
+  #endif
 }
 
 // Populate all fields by parsing a single line of GCode
@@ -231,11 +237,38 @@ void __forceinline __flatten GCodeParser::parse(char *p) {
 
 void GCodeParser::unknown_command_error() {
   SERIAL_ECHO_START();
-  SERIAL_ECHOPAIR(MSG_UNKNOWN_COMMAND, command_ptr);
+  #if ENABLED(PREPARSED_COMMANDS)
+    SERIAL_ECHOPGM(MSG_UNKNOWN_COMMAND);
+    echo_command();
+  #else
+    SERIAL_ECHOPAIR(MSG_UNKNOWN_COMMAND, command_ptr);
+  #endif
   SERIAL_CHAR('"');
   SERIAL_EOL();
 }
 
+#if ENABLED(PREPARSED_COMMANDS)
+
+  void GCodeParser::echo_command() {
+    if (!preparsed) {
+      SERIAL_ECHO(command_ptr);
+      return;
+    }
+    SERIAL_CHAR(command_letter);
+    SERIAL_ECHO(codenum);
+    for (uint8_t ind = 0; ind < COUNT(param); ++ind) {
+      if (TEST(codebits[PARAM_IND(ind)], PARAM_BIT(ind))) {
+        float f;
+        memcpy(&f, command_ptr + param[ind], sizeof(f));
+        SERIAL_CHAR(' ');
+        SERIAL_CHAR('A' + ind);
+        SERIAL_ECHO(f);
+      }
+    }
+  }
+
+#endif // PREPARSED_COMMANDS
+
 #if ENABLED(DEBUG_GCODE_PARSER)
 
   void GCodeParser::debug() {
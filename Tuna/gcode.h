@@ -48,6 +48,10 @@
   extern bool volumetric_enabled;
 #endif
 
+#if ENABLED(PREPARSED_COMMANDS)
+  namespace Tuna { class CommandQueue; }
+#endif
+
 /**
  * GCode parser
  *
@@ -59,12 +63,29 @@
  *    - Parameter exists
  *    - Parameter has value
  *    - Parameter value in different units and types
+ *  - PREPARSED_COMMANDS:
+ *    - Loads a command the queue parsed already (CommandQueue::load)
+ *    - Its values are floats, pointed to as FASTER_GCODE_PARSER points to text
  */
 class GCodeParser final {
 
+  #if ENABLED(PREPARSED_COMMANDS)
+    friend class Tuna::CommandQueue;
+  #endif
+
 private:
   static char *value_ptr;           // Set by seen, used to fetch the value
 
+  #if ENABLED(PREPARSED_COMMANDS)
+    static bool preparsed;          // Values are floats, not text
+
+    static float __forceinline stored_value() {
+      float f;
+      memcpy(&f, value_ptr, sizeof(f));
+      return f;
+    }
+  #endif
+
   #if ENABLED(FASTER_GCODE_PARSER)
     static byte codebits[4];        // Parameters pre-scanned
     static uint8_t param[26];       // For A-Z, offsets into command args
@@ -178,31 +199,47 @@ public:
   inline static bool __forceinline __flatten seenval(const char c) { return seen(c) && has_value(); }
 
   // Float removes 'E' to prevent scientific notation interpretation
+  static float __forceinline __flatten read_float(char * const p) {
+    char *e = p;
+    for (;;) {
+      const char c = *e;
+      if (c == '\0' || c == ' ') break;
+      if (c == 'E' || c == 'e') {
+        *e = '\0';
+        const float ret = strtod(p, nullptr);
+        *e = c;
+        return ret;
+      }
+      ++e;
+    }
+    return strtod(p, nullptr);
+  }
+
   inline static float __forceinline __flatten value_float() {
     if (value_ptr) {
-      char *e = value_ptr;
-      for (;;) {
-        const char c = *e;
-        if (c == '\0' || c == ' ') break;
-        if (c == 'E' || c == 'e') {
-          *e = '\0';
-          const float ret = strtod(value_ptr, nullptr);
-          *e = c;
-          return ret;
-        }
-        ++e;
-      }
-      return strtod(value_ptr, nullptr);
+      #if ENABLED(PREPARSED_COMMANDS)
+        if (preparsed) return stored_value();
+      #endif
+      return read_float(value_ptr);
     }
     return 0.0;
   }
 
   // Code value as a long or ulong
-  inline static int32 value_long() { return value_ptr ? strtol(value_ptr, nullptr, 10) : 0L; }
-  inline static uint32 value_ulong() { return value_ptr ? strtoul(value_ptr, nullptr, 10) : 0UL; }
+  #if ENABLED(PREPARSED_COMMANDS)
+    // The queue only takes values whose integer part reads as the text would
+    inline static int32 value_long() { return value_ptr ? (preparsed ? int32(stored_value()) : strtol(value_ptr, nullptr, 10)) : 0L; }
+    inline static uint32 value_ulong() { return value_ptr ? (preparsed ? uint32(int32(stored_value())) : strtoul(value_ptr, nullptr, 10)) : 0UL; }
 
-  inline static int24 value_i24() { return value_ptr ? int24(strtol(value_ptr, nullptr, 10)) : 0_i24; }
-  inline static uint24 value_u24() { return value_ptr ? uint24(strtoul(value_ptr, nullptr, 10)) : 0_u24; }
+    inline static int24 value_i24() { return int24(value_long()); }
+    inline static uint24 value_u24() { return uint24(value_ulong()); }
+  #else
+    inline static int32 value_long() { return value_ptr ? strtol(value_ptr, nullptr, 10) : 0L; }
+    inline static uint32 value_ulong() { return value_ptr ? strtoul(value_ptr, nullptr, 10) : 0UL; }
+
+    inline static int24 value_i24() { return value_ptr ? int24(strtol(value_ptr, nullptr, 10)) : 0_i24; }
+    inline static uint24 value_u24() { return value_ptr ? uint24(strtoul(value_ptr, nullptr, 10)) : 0_u24; }
+  #endif
 
   // Code value for use as time
   static millis_t __forceinline value_millis() { return value_ulong(); }
@@ -310,6 +347,11 @@ public:
 
   void unknown_command_error();
 
+  #if ENABLED(PREPARSED_COMMANDS)
+    // The command, as text or as its letter, code and parameters
+    static void echo_command();
+  #endif
+
   // Provide simple value accessors with default option
   static float    __forceinline __flatten floatval(const char c, const float dval=0.0)   { return seenval(c) ? value_float()        : dval; }
   static bool     __forceinline boolval(const char c, const bool dval=false)   { return seen(c)    ? value_bool()         : dval; }
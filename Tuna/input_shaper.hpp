@@ -0,0 +1,110 @@
+/**
+ * input_shaper.hpp - impulse shapers for INPUT_SHAPING
+ *
+ * A shaper replaces each step of an axis with two or three impulses, whose ringing at the shaped frequency cancels
+ * out: a share of the step right away, and the rest as echoes a fraction of a ringing period later. The shares add up
+ * to one step exactly, so the axis still ends up where it was sent, only later and smoothed over the longest delay.
+ *
+ *   ZV   Two impulses, the last half a period on. The shortest delay, but the narrowest notch.
+ *   ZVD  Three impulses, the last a whole period on. A notch as deep and wider, so a frequency that is a bit off
+ *        still does well.
+ *   MZV  Three impulses, the last 3/4 of a period on. About as tolerant as ZVD, with less delay.
+ *
+ * The shares are kept in 1/256 of a step and the delays in Timer1 ticks, so the stepper ISR only adds and compares.
+ */
+
+#pragma once
+
+#include "MarlinConfig.h"
+
+#if ENABLED(INPUT_SHAPING)
+
+namespace Tuna
+{
+  enum class shaper_type : uint8 { ZV, ZVD, MZV };
+
+  struct input_shaper final
+  {
+    static constexpr const uint16 one_step = 256;
+    static constexpr const float ticks_per_second = float(F_CPU / 8);
+
+    uint32 delay[2];                      // Timer1 ticks from a step to each of its echoes
+    uint16 share[3];                      // Of each step, in 1/256: right away, then at each echo
+    uint8 echoes;                         // 0 when the axis is not shaped
+
+    // An axis that is not shaped takes each step whole, right away.
+    void disable()
+    {
+      share[0] = one_step;
+      share[1] = share[2] = 0;
+      delay[0] = delay[1] = 0;
+      echoes = 0;
+    }
+
+    /**
+     * Set up a shaper for a resonance at frequency Hz, with damping ratio zeta (0 to < 1). A frequency of 0 disables
+     * shaping. No delay is made shorter than min_delay ticks.
+     */
+    void set(const shaper_type type, const float frequency, const float zeta, const uint32 min_delay)
+    {
+      if (frequency <= 0.0f)
+      {
+        disable();
+        return;
+      }
+
+      const float df = SQRT(1.0f - sq(zeta));
+      const float period = 1.0f / (frequency * df);   // Damped period, in seconds
+
+      float a[3], t[2];
+      switch (type)
+      {
+      case shaper_type::ZV: {
+        const float k = exp(-zeta * float(M_PI) / df);
+        a[0] = 1.0f; a[1] = k; a[2] = 0.0f;
+        t[0] = t[1] = 0.5f * period;
+        echoes = 1;
+      } break;
+      case shaper_type::ZVD: {
+        const float k = exp(-zeta * float(M_PI) / df);
+        a[0] = 1.0f; a[1] = 2.0f * k; a[2] = sq(k);
+        t[0] = 0.5f * period; t[1] = period;
+        echoes = 2;
+      } break;
+      case shaper_type::MZV: {
+        const float k = exp(-0.75f * zeta * float(M_PI) / df);
+        a[0] = 1.0f - float(M_SQRT1_2); a[1] = (float(M_SQRT2) - 1.0f) * k; a[2] = a[0] * sq(k);
+        t[0] = 0.375f * period; t[1] = 0.75f * period;
+        echoes = 2;
+      } break;
+      }
+
+      // Round the first shares, and give the last whatever is left, so that they add up to exactly one step.
+      const float scale = one_step / (a[0] + a[1] + a[2]);
+      share[0] = uint16(LROUND(a[0] * scale));
+      if (echoes == 1)
+      {
+        share[1] = one_step - share[0];
+        share[2] = 0;
+      }
+      else
+      {
+        share[1] = uint16(LROUND(a[1] * scale));
+        share[2] = one_step - share[0] - share[1];
+      }
+
+      for (uint8 i = 0; i < 2; ++i)
+      {
+        delay[i] = max(uint32(LROUND(t[i] * ticks_per_second)), min_delay);
+      }
+    }
+
+    // The longest delay, after which a step has been taken whole.
+    inline uint32 longest_delay() const
+    {
+      return echoes ? delay[echoes - 1] : 0;
+    }
+  };
+}
+
+#endif // INPUT_SHAPING
@@ -0,0 +1,45 @@
+#include <tuna.h>
+
+#if ENABLED(ISR_PROFILING)
+
+#include "isr_profile.hpp"
+#include "planner.h"
+
+namespace Tuna
+{
+  IsrProfile::stats IsrProfile::path_stats[uint8(IsrProfile::path::count)];
+  IsrProfile::block_record IsrProfile::blocks[IsrProfile::block_count];
+  uint8 IsrProfile::block_head = 0;
+  uint8 IsrProfile::blocks_recorded = 0;
+  uint32 IsrProfile::clamped = 0;
+  uint32 IsrProfile::overruns = 0;
+
+  IsrProfile::path IsrProfile::stepper_path = IsrProfile::path::idle;
+  IsrProfile::block_record IsrProfile::current;
+  bool IsrProfile::block_done = false;
+
+  void IsrProfile::reset()
+  {
+    critical_section _critsec;
+
+    for (stats & __restrict s : path_stats)
+    {
+      s = {};
+      s.min = type_trait<uint16>::max;
+    }
+    block_head = 0;
+    blocks_recorded = 0;
+    clamped = 0;
+    overruns = 0;
+  }
+
+  void __forceinline IsrProfile::block_begin(const block_t * __restrict block)
+  {
+    current = {};
+    current.step_event_count = block->step_event_count;
+    current.nominal_rate = block->nominal_rate;
+    block_done = false;
+  }
+}
+
+#endif // ISR_PROFILING
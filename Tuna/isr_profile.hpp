@@ -0,0 +1,225 @@
+/**
+ * isr_profile.hpp - stepper and temperature ISR cost profiling
+ *
+ * Times the Timer1 COMPA (Stepper::advance_isr_scheduler) and Timer0 COMPB (Temperature::isr) handlers against their
+ * own timer counters and keeps min/max/mean and a histogram for each path through them, plus a small ring of
+ * per-block totals for the most recently finished blocks. Reported and reset by M930.
+ *
+ * Timer1 runs at F_CPU/8, so stepper samples have an 8-cycle resolution. Timer0 runs at F_CPU/64 and is shared with
+ * millis(), so temperature samples have a 64-cycle resolution. The counters are read at entry, between the main and
+ * advance ISRs, and at exit of the handler: the interrupt entry latency and the register save/restore are not
+ * included, and the profiling code itself adds roughly 100 cycles to every stepper ISR.
+ */
+
+#pragma once
+
+#include "MarlinConfig.h"
+
+#if ENABLED(ISR_PROFILING)
+
+struct block_t;
+
+namespace Tuna
+{
+  class IsrProfile final : trait::ce_only
+  {
+  public:
+    enum class path : uint8
+    {
+      stepper = 0,   // The whole Timer1 COMPA handler.
+      step_1,        // Stepper::isr tracing a block at 1, 2, 4 or 8 step_loops.
+      step_2,
+      step_4,
+      step_8,
+      split,         // Stepper::isr only checking endstops between the pieces of a split() interval.
+      event,         // Stepper::isr stepping without updating the speed ramp (MULTI_RATE_STEPPING).
+      idle,          // Stepper::isr without a block to trace.
+      advance,       // Stepper::advance_isr.
+      temperature,   // The whole Timer0 COMPB handler.
+      count
+    };
+
+    static constexpr const uint8 histogram_buckets = 8; // <128, <256, <512 ... <8192, >=8192 cycles.
+    static constexpr const uint8 block_count = ISR_PROFILING_BLOCKS;
+    static_assert(block_count != 0 && (block_count & (block_count - 1)) == 0, "ISR_PROFILING_BLOCKS must be a power of 2");
+
+    static constexpr const uint8 timer1_cycles = 8;
+    static constexpr const uint8 timer0_cycles = 64;
+
+    struct stats final
+    {
+      uint16 min;                         // In cycles.
+      uint16 max;
+      uint32 sum;
+      uint32 count;
+      uint16 histogram[histogram_buckets];
+    };
+
+    struct block_record final
+    {
+      uint24 step_event_count;
+      uint24 nominal_rate;
+      uint32 step_cycles;                 // Stepper::isr time spent tracing the block.
+      uint32 split_cycles;                // Stepper::isr time spent in endstop-only split() interrupts.
+      uint32 advance_cycles;              // Stepper::advance_isr time while the block was current.
+      uint16 isr_calls;                   // Stepper::isr calls while the block was current.
+      uint16 clamped;                     // Exits that hit the OCR1A >= TCNT1 + 16 clamp.
+      uint8 step_loops;                   // Highest step_loops used.
+    };
+
+    static stats path_stats[uint8(path::count)];
+    static block_record blocks[block_count];
+    static uint8 block_head;              // Index of the next record to write.
+    static uint8 blocks_recorded;
+    static uint32 clamped;                // Stepper exits that hit the OCR1A clamp.
+    static uint32 overruns;               // Stepper samples dropped because a compare match reset TCNT1 mid-ISR.
+
+    // Live state; only touched from the stepper ISR.
+    static path stepper_path;
+    static block_record current;
+    static bool block_done;
+
+    static void reset();
+
+    static inline __forceinline __flatten void record(const path p, const uint16 cycles)
+    {
+      stats & __restrict s = path_stats[uint8(p)];
+      if (cycles < s.min) s.min = cycles;
+      if (cycles > s.max) s.max = cycles;
+      s.sum += cycles;
+      ++s.count;
+
+      uint8 bucket = 0;
+      for (uint16 v = cycles >> 7; v != 0 && bucket < histogram_buckets - 1; v >>= 1)
+      {
+        ++bucket;
+      }
+      if (s.histogram[bucket] != type_trait<uint16>::max)
+      {
+        ++s.histogram[bucket];
+      }
+    }
+
+    // Called from Stepper::isr.
+    static inline __forceinline void set_path(const path p)
+    {
+      stepper_path = p;
+    }
+
+    static inline __forceinline void set_step_path(const uint8 step_loops)
+    {
+      stepper_path = path(uint8(path::step_1) + (step_loops >= 8 ? 3 : step_loops >> 1));
+      if (step_loops > current.step_loops)
+      {
+        current.step_loops = step_loops;
+      }
+    }
+
+    static void block_begin(const block_t * __restrict block);
+
+    static inline __forceinline void block_end()
+    {
+      block_done = true;
+    }
+
+    static inline __forceinline void clamp()
+    {
+      ++clamped;
+      ++current.clamped;
+    }
+
+    // Times one Timer1 COMPA handler. Declared at the top of the handler; records the whole handler when it goes out
+    // of scope, after the OCR1A clamp.
+    class stepper_timer final
+    {
+      uint16 start_;
+      uint16 mark_;
+
+      static inline __forceinline bool sample(const uint16 from, const uint16 to, uint16 & __restrict cycles)
+      {
+        // Timer1 runs in CTC mode. If the new OCR1A was reached while the handler was still running, TCNT1 was reset.
+        if (__unlikely(to < from))
+        {
+          ++overruns;
+          return false;
+        }
+        const uint16 ticks = to - from;
+        cycles = (ticks >= (type_trait<uint16>::max / timer1_cycles)) ? type_trait<uint16>::max : ticks * timer1_cycles;
+        return true;
+      }
+
+    public:
+      inline __forceinline stepper_timer() : start_(TCNT1), mark_(start_)
+      {
+        stepper_path = path::idle;
+      }
+
+      // Attributes the time since the previous lap to the main ISR's path.
+      inline __forceinline void main_lap()
+      {
+        const uint16 now = TCNT1;
+        uint16 cycles;
+        if (sample(mark_, now, cycles))
+        {
+          record(stepper_path, cycles);
+          if (stepper_path == path::split)
+          {
+            current.split_cycles += cycles;
+            ++current.isr_calls;
+          }
+          else if (stepper_path != path::idle)
+          {
+            current.step_cycles += cycles;
+            ++current.isr_calls;
+          }
+        }
+        mark_ = now;
+
+        if (block_done)
+        {
+          block_done = false;
+          blocks[block_head] = current;
+          block_head = (block_head + 1) & (block_count - 1);
+          if (blocks_recorded < block_count) ++blocks_recorded;
+        }
+      }
+
+      // Attributes the time since the previous lap to Stepper::advance_isr.
+      inline __forceinline void advance_lap()
+      {
+        const uint16 now = TCNT1;
+        uint16 cycles;
+        if (sample(mark_, now, cycles))
+        {
+          record(path::advance, cycles);
+          current.advance_cycles += cycles;
+        }
+        mark_ = now;
+      }
+
+      inline __forceinline ~stepper_timer()
+      {
+        uint16 cycles;
+        if (sample(start_, TCNT1, cycles))
+        {
+          record(path::stepper, cycles);
+        }
+      }
+    };
+
+    // Times one Timer0 COMPB handler.
+    class temperature_timer final
+    {
+      const uint8 start_ = TCNT0;
+
+    public:
+      inline __forceinline ~temperature_timer()
+      {
+        // Timer0 free-runs and the handler is far shorter than one overflow, so the 8-bit difference is exact.
+        record(path::temperature, uint16(uint8(TCNT0 - start_)) * timer0_cycles);
+      }
+    };
+  };
+}
+
+#endif // ISR_PROFILING
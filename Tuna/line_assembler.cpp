@@ -0,0 +1,106 @@
+#include <tuna.h>
+
+#if ENABLED(RX_LINE_ASSEMBLER)
+
+#include "line_assembler.hpp"
+
+namespace Tuna
+{
+  LineAssembler::counters LineAssembler::stats = {};
+
+  LineAssembler::line LineAssembler::ring[LineAssembler::lines];
+  volatile uint8 LineAssembler::head = 0;
+  volatile uint8 LineAssembler::tail = 0;
+
+  uint8 LineAssembler::count = 0;
+  uint8 LineAssembler::star = 0;
+  uint8 LineAssembler::checksum = 0;
+  uint8 LineAssembler::flags = 0;
+
+  void LineAssembler::end_line()
+  {
+    const uint8 f = flags;
+    flags = 0;
+    if (!count) return;                   // Blank, a comment, or dropped
+
+    line & __restrict l = ring[head & (lines - 1)];
+    l.text[count] = '\0';
+    l.star = star;
+    l.checksum = checksum;
+    count = star = checksum = 0;
+
+    if (f & flag_truncated) ++stats.truncated;
+    ++stats.lines;
+    __memorybarrier;                      // The line is written before head
+    head = head + 1;
+  }
+
+  // As get_serial_commands read the receive buffer.
+  void LineAssembler::receive(const uint8 status, const uint8 c)
+  {
+    if (__unlikely(status & (_BV(FE0) | _BV(UPE0))))
+    {
+      ++stats.errors;
+      return;
+    }
+    if (__unlikely(status & _BV(DOR0))) ++stats.overruns;
+
+    if (__unlikely(c == '\n' || c == '\r'))
+    {
+      end_line();
+      return;
+    }
+    if (flags & flag_dropping) return;
+
+    if (__unlikely(count >= MAX_CMD_SIZE - 1))
+    {
+      flags |= flag_truncated;              // Up to the end of the line
+      return;
+    }
+    if (__unlikely(flags & flag_escape))
+      flags &= ~flag_escape;                // Taken as it is
+    else if (__unlikely(c == '\\'))
+    {
+      flags |= flag_escape;
+      return;
+    }
+    else if (c == ';')
+      flags |= flag_comment;
+    if (flags & flag_comment) return;
+
+    if (!count)
+    {
+      if (c == ' ') return;
+      if (__unlikely(uint8(head - tail) == lines))
+      {
+        flags |= flag_dropping;
+        ++stats.overflows;
+        return;
+      }
+    }
+
+    ring[head & (lines - 1)].text[count++] = c;
+    if (!star)
+    {
+      if (c == '*')
+        star = count;
+      else
+        checksum ^= c;
+    }
+  }
+
+  void LineAssembler::discard()
+  {
+    Tuna::critical_section _critsec;
+    count = star = checksum = flags = 0;
+  }
+
+  void LineAssembler::clear()
+  {
+    Tuna::critical_section _critsec;
+    count = star = checksum = flags = 0;
+    tail = head;
+  }
+}
+
+#endif // RX_LINE_ASSEMBLER
@@ -0,0 +1,116 @@
+/**
+ * line_assembler.hpp - ASCII lines assembled in the USART0 receive interrupt, for RX_LINE_ASSEMBLER
+ *
+ * The receive interrupt takes each byte as get_serial_commands took it from the receive buffer: it drops comments,
+ * blank lines and leading spaces, takes the character after a '\' as it is, and cuts lines at MAX_CMD_SIZE - 1
+ * characters. It XORs the characters before the first '*' as they arrive, so a line is finished with its checksum:
+ *
+ *   [text, null-terminated] [offset of the '*' + 1, or 0] [checksum]
+ *
+ * Finished lines wait in a ring of RX_LINES, which loop() claims as the command queue has room, without scanning them
+ * again. The receive buffer of MYSERIAL holds 63 bytes, which a handler that blocks overflows in the middle of a line;
+ * here, the interrupt keeps finishing lines, and only a line that arrives with all RX_LINES waiting is dropped, whole.
+ * It is counted, and the line number check asks the host to resend it, as it did after an overflow.
+ *
+ * While BinaryProtocol is active, bytes go to the receive buffer, as frames are not lines.
+ */
+
+#pragma once
+
+#include "MarlinConfig.h"
+
+#if ENABLED(RX_LINE_ASSEMBLER)
+
+#if ENABLED(BINARY_PROTOCOL)
+  #include "binary_protocol.hpp"
+#endif
+
+namespace Tuna
+{
+  class LineAssembler final : trait::ce_only
+  {
+  public:
+    static constexpr const uint8 lines = RX_LINES;
+
+    struct line final
+    {
+      char text[MAX_CMD_SIZE];
+      uint8 star;                         // Offset of the first '*' + 1; 0 if there is none.
+      uint8 checksum;                     // XOR of the characters before it.
+    };
+
+    struct counters final
+    {
+      uint32 lines;                       // Finished.
+      uint16 overflows;                   // Dropped, as all RX_LINES were waiting.
+      uint16 truncated;                   // Cut at MAX_CMD_SIZE - 1 characters.
+      uint16 overruns;                    // Bytes lost in the USART, as the interrupt was held off too long.
+      uint16 errors;                      // Bytes with a framing or parity error, dropped.
+    };
+
+    static counters stats;
+
+    // Bytes go to the receive buffer of MYSERIAL instead.
+    static inline __forceinline bool raw()
+    {
+      #if ENABLED(BINARY_PROTOCOL)
+        return BinaryProtocol::active;
+      #else
+        return false;
+      #endif
+    }
+
+    // Takes a byte received, with UCSR0A as it was before UDR0 was read. From the receive interrupt.
+    static void receive(const uint8 status, const uint8 c);
+
+    // A line is finished.
+    static inline __forceinline bool available()
+    {
+      const bool finished = head != tail;
+      __memorybarrier;                    // The line is read after head
+      return finished;
+    }
+
+    // The oldest finished line. Only while available().
+    static inline __forceinline line & front()
+    {
+      return ring[tail & (lines - 1)];
+    }
+
+    // Frees the oldest finished line, once it is claimed.
+    static inline __forceinline void pop()
+    {
+      __memorybarrier;                    // The line is read before the interrupt can reuse it
+      tail = tail + 1;
+    }
+
+    // Drops the line being received.
+    static void discard();
+
+    // Drops the line being received, and the finished lines not claimed yet. From loop().
+    static void clear();
+
+  private:
+    enum : uint8
+    {
+      flag_comment = 0x01,
+      flag_escape = 0x02,
+      flag_dropping = 0x04,               // The line has no room: dropped up to its end.
+      flag_truncated = 0x08
+    };
+
+    static line ring[lines];
+    static volatile uint8 head;           // Lines finished, modulo 256. Only the interrupt writes it.
+    static volatile uint8 tail;           // Lines claimed, modulo 256. Only loop() writes it.
+
+    // The line being received, in ring[head], owned by the interrupt.
+    static uint8 count;
+    static uint8 star;
+    static uint8 checksum;
+    static uint8 flags;
+
+    static void end_line();
+  };
+}
+
+#endif // RX_LINE_ASSEMBLER
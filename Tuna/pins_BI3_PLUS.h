@@ -34,10 +34,18 @@
 
 //
 // Limit Switches
+// May be overridden for a rewired board, such as to use ENDSTOP_INTERRUPTS_FEATURE:
+// none of these have a pin change interrupt.
 //
-#define X_STOP_PIN         54
-#define Y_STOP_PIN         24
-#define Z_STOP_PIN         23//23
+#ifndef X_STOP_PIN
+  #define X_STOP_PIN       54
+#endif
+#ifndef Y_STOP_PIN
+  #define Y_STOP_PIN       24
+#endif
+#ifndef Z_STOP_PIN
+  #define Z_STOP_PIN       23//23
+#endif
 
 //
 // Steppers
@@ -80,7 +80,24 @@ Planner planner;
  */
 block_t Planner::block_buffer[BLOCK_BUFFER_SIZE];
 volatile uint8_t Planner::block_buffer_head = 0,           // Index of the next block to be pushed
-                 Planner::block_buffer_tail = 0;
+                 Planner::block_buffer_tail = 0,
+                 Planner::block_buffer_nonbusy = 0,        // Index of the first block the stepper ISR has not picked up
+                 Planner::block_buffer_planned = 0;        // Index of the first block whose entry speed may still change
+
+#if ENABLED(PLANNER_PROFILING)
+  Planner::planner_profile Planner::profile;
+#endif
+
+#if ENABLED(BEZIER_CURVE_SUPPORT)
+  bool Planner::batching = false;
+  uint8 Planner::batch_pending = 0;
+#endif
+
+#if ENABLED(SEGMENT_MERGING)
+  Planner::merge_settings Planner::merge_config;
+  Planner::merge_statistics Planner::merge_stats;
+  Planner::merged_move Planner::merged;
+#endif
 
 float Planner::max_feedrate_mm_s[XYZE_N], // Max speeds in mm per second
       Planner::axis_steps_per_mm[XYZE_N],
@@ -136,6 +153,11 @@ uint32 Planner::cutoff_long;
 float Planner::previous_speed[NUM_AXIS],
       Planner::previous_nominal_speed;
 
+#if ENABLED(JUNCTION_DEVIATION)
+  float Planner::junction_deviation_mm = JUNCTION_DEVIATION_MM,
+        Planner::previous_unit_vec[XYZ];
+#endif
+
 #if ENABLED(DISABLE_INACTIVE_EXTRUDER)
   uint8_t Planner::g_uc_extruder_last_move[EXTRUDERS] = { 0 };
 #endif
@@ -164,16 +186,70 @@ float Planner::previous_speed[NUM_AXIS],
 Planner::Planner() { init(); }
 
 void Planner::init() {
-  block_buffer_head = block_buffer_tail = 0;
+  block_buffer_head = block_buffer_tail = block_buffer_nonbusy = block_buffer_planned = 0;
+  #if ENABLED(BEZIER_CURVE_SUPPORT)
+    batching = false;
+    batch_pending = 0;
+  #endif
   ZERO(position);
   #if ENABLED(LIN_ADVANCE)
     ZERO(position_float);
   #endif
   ZERO(previous_speed);
   previous_nominal_speed = 0.0;
+  #if ENABLED(JUNCTION_DEVIATION)
+    ZERO(previous_unit_vec);
+  #endif
   #if ABL_PLANAR
     bed_level_matrix.set_to_identity();
   #endif
+  #if ENABLED(SEGMENT_MERGING)
+    merged.held = false;
+    merge_config.enabled = true;
+    set_merge_angle(SEGMENT_MERGE_ANGLE);
+    merge_config.e_ratio = SEGMENT_MERGE_E_RATIO;
+    merge_config.max_length = SEGMENT_MERGE_MAX_LENGTH;
+  #endif
+}
+
+/**
+ * Make a block's sequence odd before its trapezoid, or its entry speed, is rewritten.
+ * From then on the stepper ISR picks up neither the block nor the one before it, but it
+ * may have done so already: that is checked after, and the claim given up. A change of
+ * the entry speed also needs the block before it, which ends at that speed.
+ * release_block() makes the sequence even again once the trapezoids are recalculated.
+ */
+bool __forceinline __flatten Planner::claim_block(const uint8 block_index, const bool entry_speed) {
+  block_t * __restrict const block = &block_buffer[block_index];
+  const bool claimed = block->sequence & 1;
+  if (!claimed) {
+    ++block->sequence;
+    __memorybarrier;
+  }
+  const uint8 nonbusy = block_buffer_nonbusy;
+  if (next_block_index(block_index) == nonbusy || (entry_speed && block_index == nonbusy)) {
+    if (!claimed) ++block->sequence;
+    return false;
+  }
+  return true;
+}
+
+void __forceinline __flatten Planner::release_block(block_t * __restrict const block) {
+  if (block->sequence & 1) {
+    __memorybarrier;
+    ++block->sequence;
+  }
+}
+
+/**
+ * Nor can the entry speeds of the blocks the stepper ISR has picked up. The ISR leaves
+ * block_buffer_planned to the planner, which catches it up here before the head moves,
+ * so that it never falls so far behind that the head comes around to it again.
+ */
+void __forceinline __flatten Planner::update_planned() {
+  const uint8 nonbusy = block_buffer_nonbusy;
+  if (BLOCK_MOD(block_buffer_planned - nonbusy + BLOCK_BUFFER_SIZE) > BLOCK_MOD(block_buffer_head - nonbusy + BLOCK_BUFFER_SIZE))
+    block_buffer_planned = nonbusy;
 }
 
 #define MINIMAL_STEP_RATE 120
@@ -182,6 +258,31 @@ void Planner::init() {
  * Calculate trapezoid parameters, multiplying the entry- and exit-speeds
  * by the provided factors.
  */
+#if ENABLED(PLANNER_FIXED_POINT)
+
+void __forceinline __flatten Planner::calculate_trapezoid_for_block(block_t * __restrict const block, const planner_speed_sqr_t entry_speed_sqr, const planner_speed_sqr_t next_entry_speed_sqr) {
+  uint16 initial_rate = speed_sqr_to_rate(entry_speed_sqr),
+         final_rate = speed_sqr_to_rate(next_entry_speed_sqr); // (steps per second)
+
+  // Limit minimal step rate (Otherwise the timer will overflow.)
+  NOLESS(initial_rate, MINIMAL_STEP_RATE);
+  NOLESS(final_rate, MINIMAL_STEP_RATE);
+
+  const uint32 accel = block->acceleration_steps_per_s2;
+  // The stepper can't go faster than this anyway, and it keeps the squared rates in 32 bits.
+  const uint16 nominal_rate = min(uint32(block->nominal_rate), uint32(type_trait<uint16>::max));
+  int32 accelerate_steps = estimate_acceleration_steps(initial_rate, nominal_rate, accel, true);
+  const int32 decelerate_steps = estimate_acceleration_steps(final_rate, nominal_rate, accel, false);
+  int32 plateau_steps = int32(block->step_event_count) - accelerate_steps - decelerate_steps;
+
+  // No cruising; find where to abort accel and start braking (see below).
+  if (plateau_steps < 0) {
+    accelerate_steps = intersection_steps(initial_rate, final_rate, accel, block->step_event_count);
+    plateau_steps = 0;
+  }
+
+#else
+
 void __forceinline __flatten Planner::calculate_trapezoid_for_block(block_t * __restrict const block, const float & __restrict entry_speed, const float & __restrict next_entry_speed) {
   //float nominal_recip = 1.0f / nominal_speed;
   uint32 initial_rate = CEIL(entry_speed),
@@ -206,31 +307,82 @@ void __forceinline __flatten Planner::calculate_trapezoid_for_block(block_t * __
     plateau_steps = 0;
   }
 
-  // Fill variables used by the stepper in a critical section
-  {
-    Tuna::critical_section _critsec;
-    if (!TEST(block->flag, BLOCK_BIT_BUSY)) { // Don't update variables if block is busy.
-      block_t * __restrict out = as<block_t * __restrict>(block);
-      out->accelerate_until = accelerate_steps;
-      out->decelerate_after = accelerate_steps + plateau_steps;
-      out->initial_rate = initial_rate;
-      out->final_rate = final_rate;
-      out->acceleration_rate = int24(accel * 16777216.0 / ((F_CPU) * 0.125)); // * 8.388608
-
-      /*
-      float initial_component = float(out->accelerate_until) / float(out->step_event_count);
-      float final_component = float(out->step_event_count - out->decelerate_after) / float(out->step_event_count);
-
-      if (initial_component + final_component >= 0.99)
-      {
-        out->plateau_rate = out->nominal_rate;
-      }
-      else
-      {
-        out->plateau_rate = uint24((out->nominal_rate - (float(out->final_rate * final_component)) - (float(out->initial_rate) * initial_component)) + 0.5);
-      }
-      */
+#endif // PLANNER_FIXED_POINT
+
+  #if ENABLED(PLANNER_FIXED_POINT)
+    // accel * 2^24 / (F_CPU / 8): the whole part, plus the rounded fraction in 0.16 applied to each byte-half of accel.
+    // acceleration_rate is an int24, so accel stays below 2^20 and neither product can overflow.
+    constexpr const uint32 rate_whole = (1_u32 << 24) / ((F_CPU) / 8);
+    constexpr const uint32 rate_fraction = uint32((((1_u64 << 40) + ((F_CPU) / 16)) / ((F_CPU) / 8)) & 0xFFFF);
+    const uint24 acceleration_rate = accel * rate_whole + ((((accel >> 8) * rate_fraction) + (((accel & 0xFF) * rate_fraction) >> 8)) >> 8);
+  #else
+    const uint24 acceleration_rate = int24(accel * 16777216.0 / ((F_CPU) * 0.125)); // * 8.388608
+  #endif
+
+  #if ENABLED(S_CURVE_ACCELERATION) || ENABLED(LIN_ADVANCE)
+    // The rate at the end of acceleration. Without a plateau, this is where acceleration stops short of nominal_rate.
+    uint32 cruise_rate = min(uint32(block->nominal_rate), uint32(type_trait<uint16>::max));
+    if (plateau_steps == 0) {
+      #if ENABLED(PLANNER_FIXED_POINT)
+        // Both terms add up to at most the square of a 16-bit rate, so this cannot overflow.
+        NOMORE(cruise_rate, Tuna::isqrt(uint32(initial_rate) * initial_rate + 2 * accel * uint32(accelerate_steps)));
+      #else
+        NOMORE(cruise_rate, uint32(SQRT(sq(float(initial_rate)) + 2.0f * accel * accelerate_steps)));
+      #endif
+    }
+    NOLESS(cruise_rate, uint32(max(initial_rate, final_rate)));
+  #endif
+
+  #if ENABLED(S_CURVE_ACCELERATION)
+    // The divides are done here rather than with interrupts off.
+    const uint32 acceleration_time_inverse = ramp_time_inverse(acceleration_rate, cruise_rate - initial_rate);
+    const uint32 deceleration_time_inverse = ramp_time_inverse(acceleration_rate, cruise_rate - final_rate);
+  #endif
+
+  #if ENABLED(LIN_ADVANCE)
+    // The advance offsets at the top and the end of the trapezoid. The offset is proportional to the rate, so these
+    // are all the stepper needs to follow it through the block.
+    uint16 la_cruise_steps = 0, la_final_steps = 0;
+    if (block->use_advance_lead) {
+      la_cruise_steps = (cruise_rate * block->abs_adv_steps_multiplier8) >> 17;
+      la_final_steps = (uint32(final_rate) * block->abs_adv_steps_multiplier8) >> 17;
+    }
+  #endif
+
+  // Fill variables used by the stepper, unless it has picked up the block already.
+  if (claim_block(uint8(block - block_buffer), false)) {
+    block_t * __restrict out = as<block_t * __restrict>(block);
+    out->accelerate_until = accelerate_steps;
+    out->decelerate_after = accelerate_steps + plateau_steps;
+    out->initial_rate = initial_rate;
+    out->final_rate = final_rate;
+    out->acceleration_rate = acceleration_rate;
+    #if ENABLED(STEPPER_RAMP_TABLES) || ENABLED(STEPPER_RAMP_CACHE)
+      CBI(out->flag, BLOCK_BIT_RAMP_TABLE);
+    #endif
+    #if ENABLED(S_CURVE_ACCELERATION)
+      out->cruise_rate = cruise_rate;
+      out->acceleration_time_inverse = acceleration_time_inverse;
+      out->deceleration_time_inverse = deceleration_time_inverse;
+    #endif
+    #if ENABLED(LIN_ADVANCE)
+      out->la_cruise_steps = la_cruise_steps;
+      out->la_final_steps = la_final_steps;
+    #endif
+
+    /*
+    float initial_component = float(out->accelerate_until) / float(out->step_event_count);
+    float final_component = float(out->step_event_count - out->decelerate_after) / float(out->step_event_count);
+
+    if (initial_component + final_component >= 0.99)
+    {
+      out->plateau_rate = out->nominal_rate;
+    }
+    else
+    {
+      out->plateau_rate = uint24((out->nominal_rate - (float(out->final_rate * final_component)) - (float(out->initial_rate) * initial_component)) + 0.5);
     }
+    */
   }
 }
 
@@ -244,47 +396,70 @@ void __forceinline __flatten Planner::calculate_trapezoid_for_block(block_t * __
 
 
 // The kernel called by recalculate() when scanning the plan from last to first entry.
-void __forceinline __flatten Planner::reverse_pass_kernel(block_t * __restrict const current, const block_t * __restrict next) {
-  if (!current || !next) return;
+// Returns false once the stepper ISR has the block before current, or current itself.
+bool __forceinline __flatten Planner::reverse_pass_kernel(block_t * __restrict const current, const block_t * __restrict next, const uint8 block_index) {
+  if (!current || !next) return true;
   // If entry speed is already at the maximum entry speed, no need to recheck. Block is cruising.
   // If not, block in state of acceleration or deceleration. Reset entry speed to maximum and
   // check for maximum allowable speed reductions to ensure maximum possible planned speed.
-  float max_entry_speed = current->max_entry_speed;
-  if (__unlikely(current->entry_speed != max_entry_speed)) {
-    // If nominal length true, max junction speed is guaranteed to be reached. Only compute
-    // for max allowable speed if block is decelerating and nominal length is false.
-    current->entry_speed = (TEST(current->flag, BLOCK_BIT_NOMINAL_LENGTH) || max_entry_speed <= next->entry_speed)
-      ? max_entry_speed
-      : min(max_entry_speed, max_allowable_speed(-current->acceleration, next->entry_speed, current->millimeters));
-    SBI(current->flag, BLOCK_BIT_RECALCULATE);
-  }
+  #if ENABLED(PLANNER_FIXED_POINT)
+    const planner_speed_sqr_t max_entry_speed_sqr = current->max_entry_speed_sqr;
+    if (__unlikely(current->entry_speed_sqr != max_entry_speed_sqr)) {
+      if (!claim_block(block_index, true)) return false;
+      current->entry_speed_sqr = (TEST(current->flag, BLOCK_BIT_NOMINAL_LENGTH) || max_entry_speed_sqr <= next->entry_speed_sqr)
+        ? max_entry_speed_sqr
+        : min(max_entry_speed_sqr, max_allowable_speed_sqr(current->accel_distance_sqr, next->entry_speed_sqr));
+      SBI(current->flag, BLOCK_BIT_RECALCULATE);
+    }
+  #else
+    float max_entry_speed = current->max_entry_speed;
+    if (__unlikely(current->entry_speed != max_entry_speed)) {
+      if (!claim_block(block_index, true)) return false;
+      // If nominal length true, max junction speed is guaranteed to be reached. Only compute
+      // for max allowable speed if block is decelerating and nominal length is false.
+      current->entry_speed = (TEST(current->flag, BLOCK_BIT_NOMINAL_LENGTH) || max_entry_speed <= next->entry_speed)
+        ? max_entry_speed
+        : min(max_entry_speed, max_allowable_speed(current->accel_distance, next->entry_speed));
+      SBI(current->flag, BLOCK_BIT_RECALCULATE);
+    }
+  #endif
+  return true;
 }
 
 /**
  * recalculate() needs to go over the current plan twice.
  * Once in reverse and once forward. This implements the reverse pass.
+ * Returns the number of blocks visited.
  */
-void __forceinline __flatten Planner::reverse_pass() {
+uint8 __forceinline __flatten Planner::reverse_pass() {
+  uint8 visited = 0;
 
   if (movesplanned() > 3) {
-    const uint8_t endnr = BLOCK_MOD(block_buffer_tail + 2); // tail is running. tail+1 shouldn't be altered because it's connected to the running block.
-                                                            // tail+2 because the index is not yet advanced when checked
+    const uint8_t planned = block_buffer_planned;
     uint8_t blocknr = prev_block_index(block_buffer_head);
+    if (blocknr == planned)
+      return visited;
     block_t* __restrict current = &block_buffer[blocknr];
 
-    do {
+    for (;;) {
       const block_t * __restrict const next = current;
       blocknr = prev_block_index(blocknr);
+      if (blocknr == planned) // The entry speed of this block, and of every block before it, is final.
+        break;
       current = &block_buffer[blocknr];
       if (TEST(current->flag, BLOCK_BIT_START_FROM_FULL_HALT)) // Up to this every block is already optimized.
         break;
-      reverse_pass_kernel(current, next);
-    } while (blocknr != endnr);
+      if (!reverse_pass_kernel(current, next, blocknr)) // The stepper is running into this block.
+        break;
+      ++visited;
+    }
   }
+
+  return visited;
 }
 
 // The kernel called by recalculate() when scanning the plan from first to last entry.
-void __forceinline __flatten Planner::forward_pass_kernel(const block_t * __restrict previous, block_t * __restrict const current) {
+void __forceinline __flatten Planner::forward_pass_kernel(const block_t * __restrict previous, block_t * __restrict const current, const uint8 block_index) {
   if (!previous) return;
 
   // If the previous block is an acceleration block, but it is not long enough to complete the
@@ -292,41 +467,85 @@ void __forceinline __flatten Planner::forward_pass_kernel(const block_t * __rest
   // speeds have already been reset, maximized, and reverse planned by reverse planner.
   // If nominal length is true, max junction speed is guaranteed to be reached. No need to recheck.
   if (!TEST(previous->flag, BLOCK_BIT_NOMINAL_LENGTH)) {
-    if (previous->entry_speed < current->entry_speed) {
-      float entry_speed = min(current->entry_speed,
-                               max_allowable_speed(-previous->acceleration, previous->entry_speed, previous->millimeters));
-      // Check for junction speed change
-      if (current->entry_speed != entry_speed) {
-        current->entry_speed = entry_speed;
-        SBI(current->flag, BLOCK_BIT_RECALCULATE);
+    #if ENABLED(PLANNER_FIXED_POINT)
+      if (previous->entry_speed_sqr < current->entry_speed_sqr) {
+        const planner_speed_sqr_t entry_speed_sqr = min(current->entry_speed_sqr,
+                                                         max_allowable_speed_sqr(previous->accel_distance_sqr, previous->entry_speed_sqr));
+        // Check for junction speed change
+        if (current->entry_speed_sqr != entry_speed_sqr) {
+          // Once the stepper has the previous block, this entry speed is final as it is.
+          if (!claim_block(block_index, true)) {
+            block_buffer_planned = block_index;
+            return;
+          }
+          current->entry_speed_sqr = entry_speed_sqr;
+          SBI(current->flag, BLOCK_BIT_RECALCULATE);
+          // The previous block accelerates over its whole length, so no later block can raise this entry speed.
+          block_buffer_planned = block_index;
+        }
       }
-    }
+    #else
+      if (previous->entry_speed < current->entry_speed) {
+        float entry_speed = min(current->entry_speed,
+                                 max_allowable_speed(previous->accel_distance, previous->entry_speed));
+        // Check for junction speed change
+        if (current->entry_speed != entry_speed) {
+          // Once the stepper has the previous block, this entry speed is final as it is.
+          if (!claim_block(block_index, true)) {
+            block_buffer_planned = block_index;
+            return;
+          }
+          current->entry_speed = entry_speed;
+          SBI(current->flag, BLOCK_BIT_RECALCULATE);
+          // The previous block accelerates over its whole length, so no later block can raise this entry speed.
+          block_buffer_planned = block_index;
+        }
+      }
+    #endif
   }
+
+  // Neither can a block entered at its maximum entry speed. Every block before one of these two is
+  // bracketed by final entry speeds, and cannot be improved by new blocks either.
+  #if ENABLED(PLANNER_FIXED_POINT)
+    if (current->entry_speed_sqr == current->max_entry_speed_sqr)
+  #else
+    if (current->entry_speed == current->max_entry_speed)
+  #endif
+      block_buffer_planned = block_index;
 }
 
 /**
  * recalculate() needs to go over the current plan twice.
- * Once in reverse and once forward. This implements the forward pass.
+ * Once in reverse and once forward. This implements the forward pass,
+ * which starts at the first block whose entry speed may still change.
+ * Returns the number of blocks visited.
  */
-void __forceinline __flatten Planner::forward_pass() {
-  block_t * __restrict block[3] = { nullptr, nullptr, nullptr };
-
-  for (uint8_t b = block_buffer_tail; b != block_buffer_head; b = next_block_index(b)) {
-    block[0] = block[1];
-    block[1] = block[2];
-    block[2] = as<block_t * __restrict>(&block_buffer[b]);
-    forward_pass_kernel(block[0], block[1]);
+uint8 __forceinline __flatten Planner::forward_pass() {
+  uint8 visited = 0;
+  const block_t * __restrict previous = nullptr;
+
+  for (uint8_t b = block_buffer_planned; b != block_buffer_head; b = next_block_index(b)) {
+    block_t * __restrict const current = as<block_t * __restrict>(&block_buffer[b]);
+    if (previous) {
+      forward_pass_kernel(previous, current, b);
+      ++visited;
+    }
+    previous = current;
   }
-  forward_pass_kernel(block[1], block[2]);
+
+  return visited;
 }
 
 /**
  * Recalculate the trapezoid speed profiles for all blocks in the plan
  * according to the entry_factor for each junction. Must be called by
  * recalculate() after updating the blocks.
+ * Only blocks from first_index on can have changed. Returns the number
+ * of trapezoids recalculated.
  */
-void __forceinline __flatten Planner::recalculate_trapezoids() {
-  uint8 block_index = block_buffer_tail;
+uint8 __forceinline __flatten Planner::recalculate_trapezoids(const uint8 first_index) {
+  uint8 recalculated = 0;
+  uint8 block_index = first_index;
   block_t * __restrict next = nullptr;
 
   while (block_index != block_buffer_head) {
@@ -335,6 +554,9 @@ void __forceinline __flatten Planner::recalculate_trapezoids() {
     if (current) {
       // Recalculate if current block entry or exit junction speed has changed.
       if (TEST(current->flag, BLOCK_BIT_RECALCULATE) || TEST(next->flag, BLOCK_BIT_RECALCULATE)) {
+      #if ENABLED(PLANNER_FIXED_POINT)
+        calculate_trapezoid_for_block(current, current->entry_speed_sqr, next->entry_speed_sqr);
+      #else
         const float old_entry_speed = next->entry_speed;
         const uint8 direction_bits_delta = next->direction_bits ^ current->direction_bits;
 
@@ -417,16 +639,27 @@ void __forceinline __flatten Planner::recalculate_trapezoids() {
         }
 
         calculate_trapezoid_for_block(current, current->entry_speed, next->entry_speed);
+      #endif
         CBI(current->flag, BLOCK_BIT_RECALCULATE); // Reset current only to ensure next trapezoid is computed
+        release_block(current); // Both trapezoids that end at its entry speed are done
+        ++recalculated;
       }
     }
     block_index = next_block_index(block_index);
   }
   // Last/newest block in buffer. Exit speed is set with MINIMUM_PLANNER_SPEED. Always recalculated.
   if (next) {
-    calculate_trapezoid_for_block(next, next->entry_speed, 0.0f);
+    #if ENABLED(PLANNER_FIXED_POINT)
+      calculate_trapezoid_for_block(next, next->entry_speed_sqr, planner_speed_sqr_t::from(0));
+    #else
+      calculate_trapezoid_for_block(next, next->entry_speed, 0.0f);
+    #endif
     CBI(next->flag, BLOCK_BIT_RECALCULATE);
+    release_block(next);
+    ++recalculated;
   }
+
+  return recalculated;
 }
 
 /*
@@ -452,11 +685,31 @@ void __forceinline __flatten Planner::recalculate_trapezoids() {
  * jerk is jerkier than the set limit, Jerky. Finally it will:
  *
  *   3. Recalculate "trapezoids" for all blocks.
+ *
+ * Blocks before block_buffer_planned already have their final entry speeds, so
+ * neither pass goes past it, and only trapezoids whose entry or exit speed
+ * changed are recalculated. On long runs of blocks at their maximum entry
+ * speed, each new block only visits the blocks since the last of those.
  */
 void __forceinline __flatten Planner::recalculate() {
-  reverse_pass();
-  forward_pass();
-  recalculate_trapezoids();
+  // No trapezoid before block_buffer_planned can change.
+  update_planned();
+  const uint8 first_index = block_buffer_planned;
+  const uint8 reversed = reverse_pass();
+  const uint8 forwarded = forward_pass();
+  const uint8 recalculated = recalculate_trapezoids(first_index);
+
+  #if ENABLED(PLANNER_PROFILING)
+    ++profile.segments;
+    profile.reverse += reversed;
+    profile.forward += forwarded;
+    profile.trapezoids += recalculated;
+    profile.max_touched = max(profile.max_touched, uint8(reversed + forwarded + recalculated));
+  #else
+    UNUSED(reversed);
+    UNUSED(forwarded);
+    UNUSED(recalculated);
+  #endif
 }
 
 
@@ -755,16 +1008,94 @@ void __forceinline __flatten Planner::check_axes_activity() {
 
 #endif // PLANNER_LEVELING
 
-/**
-* Add an arc movement to the buffer.
-*/
-void __forceinline Planner::_buffer_arc(
-  const float(&target)[4],
-  const float(&start_velocity)[4],
-  const float(&end_velocity)[4]
-)
-{
-}
+#if ENABLED(NATIVE_ARCS)
+
+  /**
+   * Planner::_buffer_arc
+   *
+   * Add an arc in the XY plane to the buffer as a single block.
+   *
+   * The arc is walked here with the same Tuna::arc_tracer the stepper ISR will trace it with,
+   * which gives its exact number of step events and where they end. That end, within a step
+   * of the target, becomes the planner position, so the rounding never accumulates over
+   * consecutive arcs.
+   *
+   * Returns false, having buffered nothing, for arcs the ISR cannot trace.
+   */
+  bool Planner::_buffer_arc(const float target[XYZE], const float center[2], const float & __restrict angular_travel, const float & __restrict fr_mm_s, const uint8_t extruder) {
+    // The tracer steps a circle, so X and Y have to share one step size.
+    const float steps_per_mm = axis_steps_per_mm[X_AXIS];
+    if (steps_per_mm != axis_steps_per_mm[Y_AXIS]) return false;
+
+    const int24 center_x = LROUND(center[X_AXIS] * steps_per_mm),
+                center_y = LROUND(center[Y_AXIS] * steps_per_mm),
+                start_x = int24(position[X_AXIS]) - center_x,
+                start_y = int24(position[Y_AXIS]) - center_y,
+                end_x = LROUND(target[X_AXIS] * steps_per_mm) - center_x,
+                end_y = LROUND(target[Y_AXIS] * steps_per_mm) - center_y;
+
+    constexpr int16 max_radius = Tuna::arc_tracer::max_radius;
+    if (uabs(start_x) > max_radius || uabs(start_y) > max_radius || uabs(end_x) > max_radius || uabs(end_y) > max_radius) return false;
+
+    // The target has to be on the circle, and a circle of a few steps is better left to lines.
+    const int32 start_sq = sq(int32(start_x)) + sq(int32(start_y)),
+                end_sq = sq(int32(end_x)) + sq(int32(end_y));
+    const float radius = SQRT(0.5f * float(start_sq + end_sq));
+    if (radius < 4.0f || FABS(SQRT(float(start_sq)) - SQRT(float(end_sq))) > 2.0f) return false;
+
+    const uint24 path_steps = uint24(FABS(angular_travel) * radius + 0.5f);
+    if (path_steps < 2) return false;
+
+    // Z and E may take at most one step per event.
+    const uint24 z_steps = uabs(int24(LROUND(target[Z_AXIS] * axis_steps_per_mm[Z_AXIS])) - int24(position[Z_AXIS])),
+                 e_steps = uint24(FABS((LROUND(target[E_AXIS] * axis_steps_per_mm[E_AXIS_N]) - int24(position[E_AXIS])) * volumetric_multiplier[extruder] * flow_percentage[extruder] * 0.01) + 0.5);
+
+    arc_plan arc;
+    arc.x = int16(start_x);
+    arc.y = int16(start_y);
+    arc.error = (start_sq - end_sq) / 2; // Against the mean of the start and end radii.
+    arc.clockwise = angular_travel < 0.0f;
+
+    // Walk the arc to its last event, the first one within a step of the target once past
+    // half of the path; each event covers between 1 and 1.41 steps of it.
+    Tuna::arc_tracer tracer = { arc.x, arc.y, arc.error };
+    const uint24 min_events = path_steps >> 1, max_events = path_steps + 4;
+    uint24 events = 0, diagonals = 0;
+    for (;;) {
+      const Tuna::arc_tracer::event event = tracer.next(arc.clockwise);
+      ++events;
+      if (event.dx && event.dy) ++diagonals;
+      if (events >= min_events && uabs(tracer.x - end_x) <= 1 && uabs(tracer.y - end_y) <= 1) break;
+      if (events >= max_events) return false;
+      // A large circle takes tens of thousands of events; keep the heaters and the host serviced.
+      if (!(events & 0x0FFF)) idle();
+    }
+
+    arc.events = events;
+    arc.weight = (events - diagonals) * Tuna::arc_tracer::straight_weight + diagonals * Tuna::arc_tracer::diagonal_weight;
+    if (max(z_steps, e_steps) * Tuna::arc_tracer::diagonal_weight > arc.weight) return false;
+
+    arc.end[X_AXIS] = center_x + tracer.x;
+    arc.end[Y_AXIS] = center_y + tracer.y;
+    // The traced path runs ~5% longer than the circle; rate it by its own length, so the arc takes its planned time.
+    arc.path_steps = (arc.weight + Tuna::arc_tracer::straight_weight / 2) / Tuna::arc_tracer::straight_weight;
+    arc.radius_mm = radius / steps_per_mm;
+    arc.length_mm = path_steps / steps_per_mm;
+
+    // Unit tangents; counterclockwise is (-y, x).
+    const float direction = arc.clockwise ? -1.0f : 1.0f,
+                start_scale = direction / SQRT(float(start_sq)),
+                end_scale = direction / HYPOT(float(tracer.x), float(tracer.y));
+    arc.entry[X_AXIS] = -start_y * start_scale;
+    arc.entry[Y_AXIS] = start_x * start_scale;
+    arc.exit[X_AXIS] = -int24(tracer.y) * end_scale;
+    arc.exit[Y_AXIS] = int24(tracer.x) * end_scale;
+
+    _buffer_line(target[X_AXIS], target[Y_AXIS], target[Z_AXIS], target[E_AXIS], fr_mm_s, extruder, &arc);
+    return true;
+  }
+
+#endif // NATIVE_ARCS
 
 /**
  * Planner::_buffer_line
@@ -777,28 +1108,32 @@ void __forceinline Planner::_buffer_arc(
  *  fr_mm_s     - (target) speed of the move
  *  extruder    - target extruder
  */
-void __forceinline Planner::_buffer_line(const float & __restrict a, const float & __restrict b, const float & __restrict c, const float & __restrict e, float fr_mm_s, const uint8_t extruder) {
+void __forceinline Planner::_buffer_line(const float & __restrict a, const float & __restrict b, const float & __restrict c, const float & __restrict e, float fr_mm_s, const uint8_t extruder
+  #if ENABLED(NATIVE_ARCS)
+    , const arc_plan * __restrict arc
+  #endif
+) {
 
   // The target position of the tool in absolute steps
   // Calculate target position in absolute steps
   //this should be done after the wait, because otherwise a M92 code within the gcode disrupts this calculation somehow
 
-  // TODO FIXME their code always presumes LROUND, which doesn't make sense
-  // if you can have negative positions.
-  // That being said, I'm just going to rework it somewhat as the target in our firmware is always > 0 anyways.
-
-  __assume(a >= 0.0f);
-  __assume(b >= 0.0f);
-  __assume(c >= 0.0f);
-  __assume(e >= 0.0f);
-
-  const uint24 target[XYZE] = {
-    round<uint24>(a * axis_steps_per_mm[X_AXIS]),
-    round<uint24>(b * axis_steps_per_mm[Y_AXIS]),
-    round<uint24>(c * axis_steps_per_mm[Z_AXIS]),
-    round<uint24>(e * axis_steps_per_mm[E_AXIS_N])
+  // Homing moves head for negative targets, so they are rounded signed; the positions wrap around as uint24.
+  uint24 target[XYZE] = {
+    uint24(round<int24>(a * axis_steps_per_mm[X_AXIS])),
+    uint24(round<int24>(b * axis_steps_per_mm[Y_AXIS])),
+    uint24(round<int24>(c * axis_steps_per_mm[Z_AXIS])),
+    uint24(round<int24>(e * axis_steps_per_mm[E_AXIS_N]))
   };
 
+  #if ENABLED(NATIVE_ARCS)
+    // An arc ends where its tracer stops, within a step of the target.
+    if (arc) {
+      target[X_AXIS] = arc->end[X_AXIS];
+      target[Y_AXIS] = arc->end[Y_AXIS];
+    }
+  #endif
+
   // When changing extruders recalculate steps corresponding to the E position
   #if ENABLED(DISTINCT_E_FACTORS)
     if (last_extruder != extruder && axis_steps_per_mm[E_AXIS_N] != axis_steps_per_mm[E_AXIS + last_extruder]) {
@@ -808,7 +1143,11 @@ void __forceinline Planner::_buffer_line(const float & __restrict a, const float
   #endif
 
   #if ENABLED(LIN_ADVANCE)
-    const float mm_D_float = SQRT(sq(a - position_float[X_AXIS]) + sq(b - position_float[Y_AXIS]));
+    const float mm_D_float =
+      #if ENABLED(NATIVE_ARCS)
+        arc ? arc->length_mm :
+      #endif
+      SQRT(sq(a - position_float[X_AXIS]) + sq(b - position_float[Y_AXIS]));
   #endif
 
   const int24 da = target[X_AXIS] - position[X_AXIS],
@@ -914,12 +1253,24 @@ void __forceinline Planner::_buffer_line(const float & __restrict a, const float
 
   // If the buffer is full: good! That means we are well ahead of the robot.
   // Rest here until there is room in the buffer.
-  while (block_buffer_tail == next_buffer_head) idle();
+  while (block_buffer_tail == next_buffer_head) {
+    #if ENABLED(BEZIER_CURVE_SUPPORT)
+      // The stepper can't drain blocks that were never planned: plan them before it runs out of others.
+      if (batch_pending && movesplanned() - batch_pending < BEZIER_BATCH_BLOCKS) {
+        recalculate();
+        batch_pending = 0;
+      }
+    #endif
+    #if ENABLED(STEPPER_RAMP_TABLES) || ENABLED(STEPPER_RAMP_CACHE)
+      stepper.prepare_ramp_table();
+    #endif
+    idle();
+  }
 
   // Prepare to set up new block
   block_t * __restrict block = as<block_t * __restrict>(&block_buffer[block_buffer_head]);
 
-  // Clear all flags, including the "busy" bit
+  // Clear all flags
   block->flag = 0;
 
   // Set direction bits
@@ -947,6 +1298,21 @@ void __forceinline Planner::_buffer_line(const float & __restrict a, const float
   #endif
 
   block->steps[E_AXIS] = esteps;
+
+  #if ENABLED(NATIVE_ARCS)
+    if (arc) {
+      // The ISR traces an arc with its own events. X and Y each run at the full path rate
+      // somewhere along it, so both count the whole path for the limits below.
+      block->steps[X_AXIS] = block->steps[Y_AXIS] = arc->path_steps;
+      block->step_event_count = arc->events;
+      block->flag = arc->clockwise ? BLOCK_FLAG_ARC | BLOCK_FLAG_ARC_CLOCKWISE : BLOCK_FLAG_ARC;
+      block->arc_x = arc->x;
+      block->arc_y = arc->y;
+      block->arc_error = arc->error;
+      block->arc_weight = arc->weight;
+    }
+    else
+  #endif
   block->step_event_count = max(block->steps[X_AXIS], block->steps[Y_AXIS], block->steps[Z_AXIS], esteps);
 
   // Bail if this is a zero-length block
@@ -1143,11 +1509,12 @@ void __forceinline Planner::_buffer_line(const float & __restrict a, const float
   #endif
   delta_mm[E_AXIS] = esteps_float * steps_to_mm[E_AXIS_N];
 
+  float millimeters;
   if (block->steps[X_AXIS] < MIN_STEPS_PER_SEGMENT && block->steps[Y_AXIS] < MIN_STEPS_PER_SEGMENT && block->steps[Z_AXIS] < MIN_STEPS_PER_SEGMENT) {
-    block->millimeters = FABS(delta_mm[E_AXIS]);
+    millimeters = FABS(delta_mm[E_AXIS]);
   }
   else {
-    block->millimeters = SQRT(
+    millimeters = SQRT(
       #if CORE_IS_XY
         sq(delta_mm[X_HEAD]) + sq(delta_mm[Y_HEAD]) + sq(delta_mm[Z_AXIS])
       #elif CORE_IS_XZ
@@ -1159,8 +1526,11 @@ void __forceinline Planner::_buffer_line(const float & __restrict a, const float
       #endif
     );
   }
-  __assume(block->millimeters > 0);
-  float inverse_millimeters = 1.0 / block->millimeters;  // Inverse millimeters to remove multiple divides
+  #if ENABLED(NATIVE_ARCS)
+    if (arc) millimeters = HYPOT(arc->length_mm, delta_mm[Z_AXIS]);
+  #endif
+  __assume(millimeters > 0);
+  float inverse_millimeters = 1.0 / millimeters;  // Inverse millimeters to remove multiple divides
 
   // Calculate moves/second for this move. No divide by zero due to previous checks.
   float inverse_mm_s = fr_mm_s * inverse_millimeters;
@@ -1191,9 +1561,15 @@ void __forceinline Planner::_buffer_line(const float & __restrict a, const float
     CRITICAL_SECTION_END
 #endif
 
-  block->nominal_speed = block->millimeters * inverse_mm_s; // (mm/sec) Always > 0
+  block->nominal_speed = millimeters * inverse_mm_s; // (mm/sec) Always > 0
   __assume(block->nominal_speed > 0.0);
-  block->nominal_rate = CEIL(block->step_event_count * inverse_mm_s); // (step/sec) Always > 0
+  #if ENABLED(NATIVE_ARCS)
+    // Rates count steps of path; a diagonal arc event covers sqrt(2) of them.
+    const uint24 rate_steps = arc ? arc->path_steps : block->step_event_count;
+  #else
+    const uint24 rate_steps = block->step_event_count;
+  #endif
+  block->nominal_rate = CEIL(rate_steps * inverse_mm_s); // (step/sec) Always > 0
   __assume(block->nominal_rate > 0.0);
   //block->plateau_rate = block->nominal_rate;
 
@@ -1241,6 +1617,20 @@ void __forceinline Planner::_buffer_line(const float & __restrict a, const float
     if (cs > max_feedrate_mm_s[i]) NOMORE(speed_factor, max_feedrate_mm_s[i] / cs);
   }
 
+  #if ENABLED(NATIVE_ARCS)
+    if (arc) {
+      // X and Y each reach the full XY speed somewhere along an arc, which starts along its entry tangent.
+      const float xy_speed = arc->length_mm * inverse_mm_s;
+      for (uint8_t i = X_AXIS; i <= Y_AXIS; i++) {
+        if (xy_speed > max_feedrate_mm_s[i]) NOMORE(speed_factor, max_feedrate_mm_s[i] / xy_speed);
+        current_speed[i] = arc->entry[i] * xy_speed;
+      }
+      // Keep the centripetal acceleration within the acceleration the block is planned with.
+      const float max_xy_speed_sqr = (esteps ? acceleration : travel_acceleration) * arc->radius_mm;
+      if (sq(xy_speed) > max_xy_speed_sqr) NOMORE(speed_factor, SQRT(max_xy_speed_sqr) / xy_speed);
+    }
+  #endif
+
   // Max segment time in µs.
   #ifdef XY_FREQUENCY_LIMIT
 
@@ -1288,7 +1678,7 @@ void __forceinline Planner::_buffer_line(const float & __restrict a, const float
   }
 
   // Compute and limit the acceleration rate for the trapezoid generator.
-  const float steps_per_mm = block->step_event_count * inverse_millimeters;
+  const float steps_per_mm = rate_steps * inverse_millimeters;
   uint32 accel;
   if (!block->steps[X_AXIS] && !block->steps[Y_AXIS] && !block->steps[Z_AXIS]) {
     // convert to: acceleration steps/sec^2
@@ -1297,14 +1687,14 @@ void __forceinline Planner::_buffer_line(const float & __restrict a, const float
   else {
     #define LIMIT_ACCEL_LONG(AXIS,INDX) do{ \
       if (block->steps[AXIS] && max_acceleration_steps_per_s2[AXIS+INDX] < accel) { \
-        const uint32 comp = max_acceleration_steps_per_s2[AXIS+INDX] * block->step_event_count; \
+        const uint32 comp = max_acceleration_steps_per_s2[AXIS+INDX] * rate_steps; \
         if (accel * block->steps[AXIS] > comp) accel = comp / block->steps[AXIS]; \
       } \
     }while(0)
 
     #define LIMIT_ACCEL_FLOAT(AXIS,INDX) do{ \
       if (block->steps[AXIS] && max_acceleration_steps_per_s2[AXIS+INDX] < accel) { \
-        const float comp = (float)max_acceleration_steps_per_s2[AXIS+INDX] * (float)block->step_event_count; \
+        const float comp = (float)max_acceleration_steps_per_s2[AXIS+INDX] * (float)rate_steps; \
         if ((float)accel * (float)block->steps[AXIS] > comp) accel = comp / (float)block->steps[AXIS]; \
       } \
     }while(0)
@@ -1319,7 +1709,7 @@ void __forceinline Planner::_buffer_line(const float & __restrict a, const float
     #endif
 
     // Limit acceleration per axis
-    if (__likely(block->step_event_count <= cutoff_long)) {
+    if (__likely(rate_steps <= cutoff_long)) {
       LIMIT_ACCEL_LONG(X_AXIS, 0);
       LIMIT_ACCEL_LONG(Y_AXIS, 0);
       LIMIT_ACCEL_LONG(Z_AXIS, 0);
@@ -1333,7 +1723,7 @@ void __forceinline Planner::_buffer_line(const float & __restrict a, const float
     }
   }
   block->acceleration_steps_per_s2 = accel;
-  block->acceleration = accel / steps_per_mm;
+  const float block_acceleration = accel / steps_per_mm;
 
   // Initial limit on the segment entry velocity
   float vmax_junction;
@@ -1364,6 +1754,55 @@ void __forceinline Planner::_buffer_line(const float & __restrict a, const float
     }
   }
 
+  #if ENABLED(JUNCTION_DEVIATION)
+    // Direction of the XYZ motion. Junctions with a block without it (retracts) use the jerk limits.
+    float unit_vec[XYZ];
+    const bool has_xyz = block->steps[X_AXIS] || block->steps[Y_AXIS] || block->steps[Z_AXIS];
+    if (has_xyz) LOOP_XYZ(i) unit_vec[i] = delta_mm[i] * inverse_millimeters;
+    else ZERO(unit_vec);
+    #if ENABLED(NATIVE_ARCS)
+      if (arc) {
+        const float xy_fraction = arc->length_mm * inverse_millimeters;
+        unit_vec[X_AXIS] = arc->entry[X_AXIS] * xy_fraction;
+        unit_vec[Y_AXIS] = arc->entry[Y_AXIS] * xy_fraction;
+      }
+    #endif
+
+    if (junction_deviation_mm > 0.0f && has_xyz && moves_queued > 1 && previous_nominal_speed > 0.0001
+        && (previous_unit_vec[X_AXIS] != 0.0f || previous_unit_vec[Y_AXIS] != 0.0f || previous_unit_vec[Z_AXIS] != 0.0f)) {
+      /**
+       * Junction deviation, from Grbl (Sonny Jeon)
+       *
+       * theta is the angle between the previous and the current move, 180 degrees when they are collinear. The junction
+       * speed is the speed at which a circle tangent to both moves, with its closest point junction_deviation_mm away from
+       * the corner, can be followed with centripetal acceleration block_acceleration:
+       *   v^2 = a * jd * sin(theta/2) / (1 - sin(theta/2)),  sin(theta/2) = sqrt((1 - cos(theta)) / 2)
+       */
+      const float junction_cos_theta = -previous_unit_vec[X_AXIS] * unit_vec[X_AXIS]
+                                       -previous_unit_vec[Y_AXIS] * unit_vec[Y_AXIS]
+                                       -previous_unit_vec[Z_AXIS] * unit_vec[Z_AXIS];
+
+      vmax_junction = min(block->nominal_speed, previous_nominal_speed);
+
+      if (junction_cos_theta > 0.999999f) {
+        // A full reversal; the move has to come to a stop.
+        vmax_junction = 0.0f;
+      }
+      else if (junction_cos_theta > -0.999999f) {
+        // Collinear moves are only limited by their nominal speeds.
+        const float sin_theta_d2 = SQRT(0.5f * (1.0f - junction_cos_theta));
+        const float vmax_junction_sqr = block_acceleration * junction_deviation_mm * sin_theta_d2 / (1.0f - sin_theta_d2);
+        if (sq(vmax_junction) > vmax_junction_sqr) vmax_junction = SQRT(vmax_junction_sqr);
+      }
+
+      // The extruder has no corner to follow, so its speed change is still limited by its jerk.
+      const float e_exit = previous_speed[E_AXIS] * (vmax_junction / previous_nominal_speed),
+                  e_entry = current_speed[E_AXIS] * (vmax_junction / block->nominal_speed),
+                  e_jerk = FABS(e_exit - e_entry);
+      if (e_jerk > max_jerk[E_AXIS]) vmax_junction *= max_jerk[E_AXIS] / e_jerk;
+    }
+    else
+  #endif
   if (moves_queued > 1 && previous_nominal_speed > 0.0001) {
     // Estimate a maximum velocity allowed at a joint of two successive segments.
     // If this maximum velocity allowed is lower than the minimum of the entry / exit safe velocities,
@@ -1415,14 +1854,30 @@ void __forceinline Planner::_buffer_line(const float & __restrict a, const float
     vmax_junction = safe_speed;
   }
 
-  // Max entry speed of this block equals the max exit speed of the previous block.
-  block->max_entry_speed = vmax_junction;
+  #if ENABLED(PLANNER_FIXED_POINT)
+    // Max entry speed of this block equals the max exit speed of the previous block.
+    block->max_entry_speed_sqr = to_speed_sqr(sq(vmax_junction));
 
-  // Initialize block entry speed. Compute based on deceleration to user-defined MINIMUM_PLANNER_SPEED.
-  const float v_allowable = max_allowable_speed(-block->acceleration, 0.0f, block->millimeters);
-  // If stepper ISR is disabled, this indicates buffer_segment wants to add a split block.
-  // In this case start with the max. allowed speed to avoid an interrupted first move.
-  block->entry_speed = TEST(TIMSK1, OCIE1A) ? 0.0f : min(vmax_junction, v_allowable);
+    // The passes only ever need max_allowable_speed squared, which is this plus the target speed squared.
+    block->accel_distance_sqr = to_speed_sqr(2 * block_acceleration * millimeters);
+
+    // Initialize block entry speed. Compute based on deceleration to user-defined MINIMUM_PLANNER_SPEED.
+    const planner_speed_sqr_t v_allowable_sqr = block->accel_distance_sqr;
+    // If stepper ISR is disabled, this indicates buffer_segment wants to add a split block.
+    // In this case start with the max. allowed speed to avoid an interrupted first move.
+    block->entry_speed_sqr = TEST(TIMSK1, OCIE1A) ? planner_speed_sqr_t::from(0) : min(block->max_entry_speed_sqr, v_allowable_sqr);
+  #else
+    // Max entry speed of this block equals the max exit speed of the previous block.
+    block->max_entry_speed = vmax_junction;
+
+    block->accel_distance = 2 * block_acceleration * millimeters;
+
+    // Initialize block entry speed. Compute based on deceleration to user-defined MINIMUM_PLANNER_SPEED.
+    const float v_allowable = max_allowable_speed(block->accel_distance, 0.0f);
+    // If stepper ISR is disabled, this indicates buffer_segment wants to add a split block.
+    // In this case start with the max. allowed speed to avoid an interrupted first move.
+    block->entry_speed = TEST(TIMSK1, OCIE1A) ? 0.0f : min(vmax_junction, v_allowable);
+  #endif
 
   // Initialize planner efficiency flags
   // Set flag if block will always reach maximum junction speed regardless of entry/exit speeds.
@@ -1432,12 +1887,31 @@ void __forceinline Planner::_buffer_line(const float & __restrict a, const float
   // block nominal speed limits both the current and next maximum junction speeds. Hence, in both
   // the reverse and forward planners, the corresponding block junction speed will always be at the
   // the maximum junction speed and may always be ignored for any speed reduction checks.
-  block->flag |= block->nominal_speed <= v_allowable ? BLOCK_FLAG_RECALCULATE | BLOCK_FLAG_NOMINAL_LENGTH : BLOCK_FLAG_RECALCULATE;
+  #if ENABLED(PLANNER_FIXED_POINT)
+    block->flag |= to_speed_sqr(sq(block->nominal_speed)) <= v_allowable_sqr ? BLOCK_FLAG_RECALCULATE | BLOCK_FLAG_NOMINAL_LENGTH : BLOCK_FLAG_RECALCULATE;
+  #else
+    block->flag |= block->nominal_speed <= v_allowable ? BLOCK_FLAG_RECALCULATE | BLOCK_FLAG_NOMINAL_LENGTH : BLOCK_FLAG_RECALCULATE;
+  #endif
 
   // Update previous path unit_vector and nominal speed
   COPY(previous_speed, current_speed);
   previous_nominal_speed = block->nominal_speed;
   previous_safe_speed = safe_speed;
+  #if ENABLED(JUNCTION_DEVIATION)
+    COPY(previous_unit_vec, unit_vec);
+  #endif
+  #if ENABLED(NATIVE_ARCS)
+    if (arc) {
+      // The next move joins an arc at its exit tangent.
+      const float xy_fraction = arc->length_mm * inverse_millimeters;
+      for (uint8_t i = X_AXIS; i <= Y_AXIS; i++) {
+        previous_speed[i] = arc->exit[i] * block->nominal_speed * xy_fraction;
+        #if ENABLED(JUNCTION_DEVIATION)
+          previous_unit_vec[i] = arc->exit[i] * xy_fraction;
+        #endif
+      }
+    }
+  #endif
 
   #if ENABLED(LIN_ADVANCE)
 
@@ -1461,16 +1935,26 @@ void __forceinline Planner::_buffer_line(const float & __restrict a, const float
                             && extruder_advance_k
                             && (uint32)esteps != block->step_event_count
                             && de_float > 0.0;
-    if (block->use_advance_lead)
+    if (block->use_advance_lead) {
       block->abs_adv_steps_multiplier8 = LROUND(
         extruder_advance_k
         * (UNEAR_ZERO(advance_ed_ratio) ? de_float / mm_D_float : advance_ed_ratio) // Use the fixed ratio, if set
         * (block->nominal_speed / (float)block->nominal_rate)
         * axis_steps_per_mm[E_AXIS_N] * 256.0
       );
+
+      // While the rate ramps at acceleration_steps_per_s2, the offset moves by one E step every
+      // 2^17 / (acceleration_steps_per_s2 * multiplier) seconds. Steps that fall behind (at the
+      // 100 tick floor, the stepper ISR's capped rate) are made up while cruising, never dropped.
+      const float la_interval = float((F_CPU) / 8) * 131072.0f / (float(block->acceleration_steps_per_s2) * float(block->abs_adv_steps_multiplier8));
+      block->la_interval = (la_interval >= 65535.0f) ? 65535 : (la_interval <= 100.0f) ? 100 : uint16(la_interval);
+    }
   #endif // LIN_ADVANCE
 
-  // Move buffer head
+  // Move buffer head. The stepper leaves the block, and the one before it, until recalculate() releases it.
+  block->sequence |= 1;
+  update_planned();
+  __memorybarrier;
   block_buffer_head = next_buffer_head;
 
   // Update the position (only when a move was queued)
@@ -1482,12 +1966,36 @@ void __forceinline Planner::_buffer_line(const float & __restrict a, const float
     position_float[E_AXIS] = e;
   #endif
 
+  #if ENABLED(BEZIER_CURVE_SUPPORT)
+    // Leave this block for the next recalculate() while the batch is short, and the stepper
+    // has at least BEZIER_BATCH_BLOCKS planned blocks to work through meanwhile.
+    if (batching && ++batch_pending < BEZIER_BATCH_BLOCKS && movesplanned() - batch_pending >= BEZIER_BATCH_BLOCKS)
+      return;
+    batch_pending = 0;
+  #endif
+
   recalculate();
 
   stepper.wake_up();
 
 } // buffer_line()
 
+#if ENABLED(BEZIER_CURVE_SUPPORT)
+
+  /**
+   * End a batch started by begin_batch(), planning any blocks still pending.
+   */
+  void Planner::end_batch() {
+    batching = false;
+    if (batch_pending) {
+      batch_pending = 0;
+      recalculate();
+      stepper.wake_up();
+    }
+  }
+
+#endif
+
 /**
  * Directly set the planner XYZ position (and stepper positions)
  * converting mm (or angles for SCARA) into steps.
@@ -1496,6 +2004,9 @@ void __forceinline Planner::_buffer_line(const float & __restrict a, const float
  */
 
 void __forceinline Planner::_set_position_mm(const float & __restrict a, const float & __restrict b, const float & __restrict c, const float & __restrict e) {
+  #if ENABLED(SEGMENT_MERGING)
+    flush_merged();
+  #endif
   #if ENABLED(DISTINCT_E_FACTORS)
     #define _EINDEX (E_AXIS + active_extruder)
     last_extruder = active_extruder;
@@ -1536,6 +2047,9 @@ void __forceinline __flatten Planner::set_position_mm_kinematic(const float posi
  * Sync from the stepper positions. (e.g., after an interrupted move)
  */
 void __forceinline __flatten Planner::sync_from_steppers() {
+  #if ENABLED(SEGMENT_MERGING)
+    discard_merged();
+  #endif
   LOOP_XYZE(i) {
     position[i] = stepper.position((AxisEnum)i);
     #if ENABLED(LIN_ADVANCE)
@@ -1552,6 +2066,9 @@ void __forceinline __flatten Planner::sync_from_steppers() {
  * Setters for planner position (also setting stepper position).
  */
 void __forceinline __flatten Planner::set_position_mm(const AxisEnum axis, const float & __restrict v) {
+  #if ENABLED(SEGMENT_MERGING)
+    flush_merged();
+  #endif
   #if ENABLED(DISTINCT_E_FACTORS)
     const uint8_t axis_index = axis + (axis == E_AXIS ? active_extruder : 0);
     last_extruder = active_extruder;
@@ -1562,7 +2079,7 @@ void __forceinline __flatten Planner::set_position_mm(const AxisEnum axis, const
   #if ENABLED(LIN_ADVANCE)
     position_float[axis] = v;
   #endif
-  stepper.set_position(axis, v);
+  stepper.set_position(axis, position[axis]);
   previous_speed[axis] = 0.0;
 }
 
@@ -1588,6 +2105,86 @@ void __forceinline Planner::refresh_positioning() {
   reset_acceleration_rates();
 }
 
+#if ENABLED(SEGMENT_MERGING)
+
+  void Planner::set_merge_angle(const float & __restrict angle) {
+    merge_config.angle = angle;
+    merge_config.sin_sq_angle = sq(sin(RADIANS(angle)));
+  }
+
+  bool Planner::merge_line(const float (&start)[XYZE], const float (&target)[XYZE], const float & __restrict fr_mm_s, const uint8_t extruder) {
+    ++merge_stats.moves;
+
+    const float delta[XYZ] = { target[X_AXIS] - start[X_AXIS], target[Y_AXIS] - start[Y_AXIS], target[Z_AXIS] - start[Z_AXIS] };
+    const float length_sq = sq(delta[X_AXIS]) + sq(delta[Y_AXIS]) + sq(delta[Z_AXIS]);
+
+    if (merged.held) {
+      // The move has to start where the held one ends, at the same feedrate, with the same extruder.
+      bool mergeable = length_sq != 0.0f && fr_mm_s == merged.fr_mm_s && extruder == merged.extruder;
+      LOOP_XYZE(i) mergeable = mergeable && start[i] == merged.target[i];
+
+      float merged_length = 0.0f;
+      if (mergeable) {
+        const float total[XYZ] = {
+          target[X_AXIS] - merged.start[X_AXIS],
+          target[Y_AXIS] - merged.start[Y_AXIS],
+          target[Z_AXIS] - merged.start[Z_AXIS]
+        };
+        const float total_sq = sq(total[X_AXIS]) + sq(total[Y_AXIS]) + sq(total[Z_AXIS]);
+        mergeable = total_sq <= sq(merge_config.max_length);
+        merged_length = SQRT(total_sq);
+      }
+
+      if (mergeable) {
+        // Direction change against the held move: |a x b|^2 = |a|^2 |b|^2 - (a . b)^2
+        const float held[XYZ] = {
+          merged.target[X_AXIS] - merged.start[X_AXIS],
+          merged.target[Y_AXIS] - merged.start[Y_AXIS],
+          merged.target[Z_AXIS] - merged.start[Z_AXIS]
+        };
+        const float dot = held[X_AXIS] * delta[X_AXIS] + held[Y_AXIS] * delta[Y_AXIS] + held[Z_AXIS] * delta[Z_AXIS];
+        const float lengths_sq = sq(merged.length) * length_sq;
+        mergeable = dot > 0.0f && lengths_sq - sq(dot) <= merge_config.sin_sq_angle * lengths_sq;
+      }
+
+      if (mergeable) {
+        // Extrusion per mm: |e / length - held_e / held_length| <= ratio * |held_e / held_length|
+        const float length = SQRT(length_sq),
+                    e = target[E_AXIS] - start[E_AXIS],
+                    held_e = merged.target[E_AXIS] - merged.start[E_AXIS];
+        mergeable = FABS(e * merged.length - held_e * length) <= merge_config.e_ratio * FABS(held_e) * length;
+      }
+
+      if (mergeable) {
+        COPY(merged.target, target);
+        merged.length = merged_length;
+        ++merge_stats.merged;
+        return true;
+      }
+
+      buffer_merged();
+    }
+
+    // Only hold the move back while there is enough queued ahead of it to wait for the next one.
+    if (!merge_config.enabled || length_sq == 0.0f || movesplanned() < SEGMENT_MERGE_MIN_BLOCKS)
+      return false;
+
+    COPY(merged.start, start);
+    COPY(merged.target, target);
+    merged.fr_mm_s = fr_mm_s;
+    merged.length = SQRT(length_sq);
+    merged.extruder = extruder;
+    merged.held = true;
+    return true;
+  }
+
+  void Planner::buffer_merged() {
+    merged.held = false;
+    buffer_line(merged.target[X_AXIS], merged.target[Y_AXIS], merged.target[Z_AXIS], merged.target[E_AXIS], merged.fr_mm_s, merged.extruder);
+  }
+
+#endif // SEGMENT_MERGING
+
 #if ENABLED(AUTOTEMP)
 
   void Planner::autotemp_M104_M109() {
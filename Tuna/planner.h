@@ -51,21 +51,34 @@ enum BlockFlagBit : uint8_t {
   // Start from a halt at the start of this block, respecting the maximum allowed jerk.
   BLOCK_BIT_START_FROM_FULL_HALT,
 
-  // The block is busy
-  BLOCK_BIT_BUSY,
-
   // The Block is an arc block
   BLOCK_BIT_ARC,
+
+  // The stepper has precomputed ramps (a table, or cached ones) for the block's current trapezoid
+  BLOCK_BIT_RAMP_TABLE,
+
+  // The arc block turns clockwise
+  BLOCK_BIT_ARC_CLOCKWISE,
 };
 
 enum BlockFlag : uint8_t {
   BLOCK_FLAG_RECALCULATE          = _BV(BLOCK_BIT_RECALCULATE),
   BLOCK_FLAG_NOMINAL_LENGTH       = _BV(BLOCK_BIT_NOMINAL_LENGTH),
   BLOCK_FLAG_START_FROM_FULL_HALT = _BV(BLOCK_BIT_START_FROM_FULL_HALT),
-  BLOCK_FLAG_BUSY                 = _BV(BLOCK_BIT_BUSY),
-  BLOCK_FLAG_ARC                  = _BV(BLOCK_BIT_ARC)
+  BLOCK_FLAG_ARC                  = _BV(BLOCK_BIT_ARC),
+  BLOCK_FLAG_RAMP_TABLE           = _BV(BLOCK_BIT_RAMP_TABLE),
+  BLOCK_FLAG_ARC_CLOCKWISE        = _BV(BLOCK_BIT_ARC_CLOCKWISE)
 };
 
+#if ENABLED(PLANNER_FIXED_POINT)
+  /**
+   * Junction speeds are planned as squares, in (mm/sec)^2 with 8 fractional bits, so that
+   * the reverse and forward passes reduce to additions and compares. The largest value is
+   * kept below half the range so the sum of any two never overflows (about 2896 mm/sec).
+   */
+  using planner_speed_sqr_t = Tuna::fixed<uint32, 8>;
+#endif
+
 /**
  * struct block_t
  *
@@ -74,11 +87,18 @@ enum BlockFlag : uint8_t {
  *
  * The "nominal" values are as-specified by gcode, and
  * may never actually be reached due to acceleration limits.
+ *
+ * The fields read by the stepper ISR come first, so the ISR reaches all of them with a
+ * displacement from the block pointer (ldd/std reach 63 bytes) and the planner-only fields
+ * are kept out of its way at the end.
  */
 struct block_t final
 {
 
+  // ---- Read by the stepper ISR ----
+
   uint8 flag;                             // Block flags (See BlockFlag enum above)
+  volatile uint8 sequence;                // Odd while the planner rewrites the trapezoid (See Planner::claim_block)
 
   uint8 active_extruder;            // The extruder to move (if E move)
 
@@ -86,34 +106,66 @@ struct block_t final
   uint24 steps[NUM_AXIS];                 // Step count along each axis
   uint24 step_event_count;                // The number of step events required to complete this block
 
-  #if ENABLED(MIXING_EXTRUDER)
-    uint32 mix_event_count[MIXING_STEPPERS]; // Scaled step_event_count for the mixing steppers
-  #endif
-
   uint24 accelerate_until,                 // The index of the step event on which to stop acceleration
           decelerate_after,                 // The index of the step event on which to start decelerating
           acceleration_rate;                // The acceleration rate used for acceleration calculation
 
   uint8 direction_bits;                   // The direction bit set for this block (refers to *_DIRECTION_BIT in config.h)
 
-  // Advance extrusion
+  #if ENABLED(STEPPER_RAMP_CACHE)
+    uint8 ramp_slots;                     // Cached acceleration ramp in the low nibble, deceleration ramp in the high one; 0xF for none
+  #endif
+
+  #if ENABLED(NATIVE_ARCS)
+    // An arc block is traced by Tuna::arc_tracer instead of Bresenham; steps[X] and steps[Y] are then only its path length
+    int16 arc_x, arc_y;                   // Start of the arc relative to its center, in steps
+    int32 arc_error;                      // arc_x^2 + arc_y^2 - radius^2
+    uint24 arc_weight;                    // Weighted step events (12 straight, 17 diagonal); Z and E are spread over it
+  #endif
+
+  // Advance extrusion, planned as an offset of the E position: the advance ISR steps it toward the target of the
+  // current phase, one step every la_interval, and does no arithmetic of its own
   #if ENABLED(LIN_ADVANCE)
     bool use_advance_lead;
-    uint32 abs_adv_steps_multiplier8; // Factorised by 2^8 to avoid float
+    uint16 la_interval;                     // Timer1 ticks between advance steps; the offset changes at a constant rate while the rate ramps
+    uint16 la_cruise_steps,                 // Advance offset in E steps at the end of acceleration
+           la_final_steps;                  // Advance offset in E steps at final_rate
   #endif
 
-  // Fields used by the motion planner to manage acceleration
-  float nominal_speed,                      // The nominal speed for this block in mm/sec
-        entry_speed,                        // Entry speed at previous-current junction in mm/sec
-        max_entry_speed,                    // Maximum allowable junction entry speed in mm/sec
-        millimeters,                        // The total travel of this block in mm
-        acceleration;                       // acceleration mm/sec^2
-
   // Settings for the trapezoid generator
   uint24 nominal_rate,                    // The nominal step rate for this block in step_events/sec
            initial_rate,                    // The jerk-adjusted step rate at start of block
-           final_rate,                      // The minimal rate at exit
-           acceleration_steps_per_s2;       // acceleration steps/sec^2
+           final_rate;                      // The minimal rate at exit
+
+  #if ENABLED(S_CURVE_ACCELERATION)
+    uint16 cruise_rate;                     // The step rate at the end of acceleration; below nominal_rate if there is no plateau
+    uint32 acceleration_time_inverse,       // 2^32 / the length of the acceleration ramp in Timer1 ticks
+           deceleration_time_inverse;       // 2^32 / the length of the deceleration ramp in Timer1 ticks
+  #endif
+
+  #if ENABLED(MIXING_EXTRUDER)
+    uint32 mix_event_count[MIXING_STEPPERS]; // Scaled step_event_count for the mixing steppers
+  #endif
+
+  // ---- Planner only ----
+
+  uint24 acceleration_steps_per_s2;       // acceleration steps/sec^2
+
+  #if ENABLED(LIN_ADVANCE)
+    uint32 abs_adv_steps_multiplier8;       // Advance offset at a rate: rate * multiplier >> 17 E steps. Factorised by 2^8 to avoid float
+  #endif
+
+  // Fields used by the motion planner to manage acceleration
+  float nominal_speed;                      // The nominal speed for this block in mm/sec
+  #if ENABLED(PLANNER_FIXED_POINT)
+    planner_speed_sqr_t entry_speed_sqr,    // Entry speed at previous-current junction in (mm/sec)^2
+                        max_entry_speed_sqr, // Maximum allowable junction entry speed in (mm/sec)^2
+                        accel_distance_sqr; // 2 * acceleration * millimeters: the largest change of speed^2 over the block
+  #else
+    float entry_speed,                      // Entry speed at previous-current junction in mm/sec
+          max_entry_speed,                  // Maximum allowable junction entry speed in mm/sec
+          accel_distance;                   // 2 * acceleration * millimeters: the largest change of speed^2 over the block
+  #endif
 
   //uint24 plateau_rate;
 
@@ -125,11 +177,21 @@ struct block_t final
     uint32 valve_pressure, e_to_p_pressure;
   #endif
 
-  uint32 segment_time;
+  #if ENABLED(ULTRA_LCD)
+    uint32 segment_time;
+  #endif
 
 };
 
-#define BLOCK_MOD(n) ((n)&(BLOCK_BUFFER_SIZE-1))
+#if (BLOCK_BUFFER_SIZE & (BLOCK_BUFFER_SIZE - 1)) == 0
+  #define BLOCK_MOD(n) ((n)&(BLOCK_BUFFER_SIZE-1))
+#else
+  // Block indices only ever step one block past either end of the buffer.
+  constexpr inline __forceinline __flatten uint8 block_mod(const int16 n) {
+    return (n < 0) ? uint8(n + BLOCK_BUFFER_SIZE) : (n >= BLOCK_BUFFER_SIZE) ? uint8(n - BLOCK_BUFFER_SIZE) : uint8(n);
+  }
+  #define BLOCK_MOD(n) block_mod(n)
+#endif
 
 class Planner final {
 
@@ -137,10 +199,29 @@ class Planner final {
 
     /**
      * A ring buffer of moves described in steps
+     *
+     * The planner and the stepper ISR share it without critical sections. Only the planner
+     * moves block_buffer_head and writes blocks; only the ISR moves block_buffer_tail and
+     * block_buffer_nonbusy. A block is filled in before the head passes it, and its trapezoid
+     * is only rewritten while its sequence is odd, which keeps the ISR from picking it up, or
+     * the block before it (whose exit speed is its entry speed).
      */
     static block_t block_buffer[BLOCK_BUFFER_SIZE];
-    static volatile uint8_t block_buffer_head,  // Index of the next block to be pushed
-                            block_buffer_tail;
+    static volatile uint8_t block_buffer_head,    // Index of the next block to be pushed
+                            block_buffer_tail,
+                            block_buffer_nonbusy, // Index of the first block the stepper ISR has not picked up
+                            block_buffer_planned; // Index of the first block whose entry speed may still change
+
+    #if ENABLED(PLANNER_PROFILING)
+      // Blocks visited by recalculate(), reported and reset by M931.
+      struct planner_profile final {
+        uint32 segments;      // Calls to recalculate(), one per new block (one per batch in a batch).
+        uint32 reverse;       // Blocks visited by the reverse pass.
+        uint32 forward;       // Blocks visited by the forward pass.
+        uint32 trapezoids;    // Trapezoids recalculated.
+        uint8 max_touched;    // Most blocks visited by one recalculate(), over all three.
+      } static profile;
+    #endif
 
     #if ENABLED(DISTINCT_E_FACTORS)
       static uint8_t last_extruder;             // Respond to extruder change
@@ -170,6 +251,10 @@ class Planner final {
                  max_jerk[XYZE],       // The largest speed change requiring no acceleration
                  min_travel_feedrate_mm_s;
 
+    #if ENABLED(JUNCTION_DEVIATION)
+      static float junction_deviation_mm;  // Corner deviation (mm) for junction speeds. 0 uses max_jerk instead. M205 J
+    #endif
+
     #if HAS_ABL
       static bool abl_enabled;              // Flag that bed leveling is enabled
       #if ABL_PLANAR
@@ -187,6 +272,19 @@ class Planner final {
 
   private:
 
+    #if ENABLED(SEGMENT_MERGING)
+      struct merged_move final {
+        float start[XYZE],
+              target[XYZE],
+              fr_mm_s,
+              length;       // (mm) XYZ length of the held move
+        uint8_t extruder;
+        bool held;
+      } static merged;
+
+      static void buffer_merged();
+    #endif
+
     /**
      * The current position of the tool in absolute steps
      * Recalculated if any axis_steps_per_mm are changed by gcode
@@ -203,6 +301,13 @@ class Planner final {
      */
     static float previous_nominal_speed;
 
+    #if ENABLED(JUNCTION_DEVIATION)
+      /**
+       * XYZ unit vector of previous path line segment, all zero if it had no XYZ motion
+       */
+      static float previous_unit_vec[XYZ];
+    #endif
+
     /**
      * Limit where 64bit math is necessary for acceleration calculation
      */
@@ -259,6 +364,20 @@ class Planner final {
 
     static __forceinline __flatten bool is_full() { return (block_buffer_tail == BLOCK_MOD(block_buffer_head + 1)); }
 
+    #if ENABLED(BEZIER_CURVE_SUPPORT)
+      /**
+       * Between begin_batch() and end_batch(), blocks are planned BEZIER_BATCH_BLOCKS at a time:
+       * while enough planned blocks are queued ahead of them, new blocks wait for the next
+       * recalculate(), which plans them all at once. The stepper doesn't start a block until
+       * it and its successor are planned, so pending blocks are never executed.
+       */
+      static bool batching;
+      static uint8 batch_pending;               // Blocks buffered since the last recalculate()
+
+      static __forceinline __flatten void begin_batch() { batching = true; }
+      static void end_batch();
+    #endif
+
     #if PLANNER_LEVELING
 
       #define ARG_X float lx
@@ -281,6 +400,23 @@ class Planner final {
 
     #endif
 
+    #if ENABLED(NATIVE_ARCS)
+      // An arc as walked by _buffer_arc, for _buffer_line to turn into a block.
+      struct arc_plan final {
+        int16 x, y;             // Start relative to the center, in steps
+        int32 error;            // x^2 + y^2 - radius^2 at the start
+        int24 end[2];           // Where the tracer stops, in absolute X and Y steps
+        uint24 events,          // Step events to trace it
+               weight,          // Weighted step events (12 straight, 17 diagonal)
+               path_steps;      // Length of the traced path in steps (weight / 12)
+        float length_mm,        // XY path length
+              radius_mm,
+              entry[2],         // XY unit tangent at the start
+              exit[2];          // ...and at the end
+        bool clockwise;
+      };
+    #endif
+
     /**
      * Planner::_buffer_line
      *
@@ -293,14 +429,16 @@ class Planner final {
      *  extruder  - target extruder
      */
     // TODO validate I actually want this to be forceinline. This makes the binary waaaaay bigger.
-    static void __forceinline _buffer_line(const float & __restrict a, const float & __restrict b, const float & __restrict c, const float & __restrict e, float fr_mm_s, const uint8_t extruder);
-
-    static void __forceinline _buffer_arc(
-      const float(&target)[4],
-      const float(&start_velocity)[4],
-      const float(&end_velocity)[4]
+    static void __forceinline _buffer_line(const float & __restrict a, const float & __restrict b, const float & __restrict c, const float & __restrict e, float fr_mm_s, const uint8_t extruder
+      #if ENABLED(NATIVE_ARCS)
+        , const arc_plan * __restrict arc = nullptr
+      #endif
     );
 
+    #if ENABLED(NATIVE_ARCS)
+      static bool _buffer_arc(const float target[XYZE], const float center[2], const float & __restrict angular_travel, const float & __restrict fr_mm_s, const uint8_t extruder);
+    #endif
+
     static void __forceinline _set_position_mm(const float & __restrict a, const float & __restrict b, const float & __restrict c, const float & __restrict e);
 
     /**
@@ -316,20 +454,41 @@ class Planner final {
      *  extruder     - target extruder
      */
     static void __forceinline __flatten buffer_line(ARG_X, ARG_Y, ARG_Z, const float & __restrict e, const float & __restrict fr_mm_s, const uint8_t extruder) {
+      #if ENABLED(SEGMENT_MERGING)
+        flush_merged();
+      #endif
       #if PLANNER_LEVELING && IS_CARTESIAN
         apply_leveling(lx, ly, lz);
       #endif
       _buffer_line(lx, ly, lz, e, fr_mm_s, extruder);
     }
 
-    static void __forceinline buffer_arc(
-      const float(&target)[4],
-      const float(&start_velocity)[4],
-      const float(&end_velocity)[4]
-    )
-    {
-      _buffer_arc(target, start_velocity, end_velocity);
-    }
+    #if ENABLED(NATIVE_ARCS)
+
+      /**
+       * Add an arc in the XY plane to the buffer as a single block, traced by the stepper ISR.
+       * Returns false, having buffered nothing, if the arc cannot be traced natively; the caller
+       * then has to buffer it as line segments.
+       *
+       *  target         - x,y,z,e target position in mm
+       *  center         - x,y center of the arc in mm
+       *  angular_travel - angle to turn, in radians; negative is clockwise
+       *  fr_mm_s        - (target) speed of the move (mm/s)
+       *  extruder       - target extruder
+       */
+      static bool __forceinline __flatten buffer_arc(const float target[XYZE], const float center[2], const float & __restrict angular_travel, const float & __restrict fr_mm_s, const uint8_t extruder) {
+        #if PLANNER_LEVELING
+          // Leveling corrects Z along the path, so leveled arcs are segmented.
+          return false;
+        #else
+          #if ENABLED(SEGMENT_MERGING)
+            flush_merged();
+          #endif
+          return _buffer_arc(target, center, angular_travel, fr_mm_s, extruder);
+        #endif
+      }
+
+    #endif
 
     /**
      * Add a new linear movement to the buffer.
@@ -341,6 +500,9 @@ class Planner final {
      *  extruder - target extruder
      */
     static void __forceinline __flatten buffer_line_kinematic(const float ltarget[XYZE], const float & __restrict fr_mm_s, const uint8_t extruder) {
+      #if ENABLED(SEGMENT_MERGING)
+        flush_merged();
+      #endif
       #if PLANNER_LEVELING
         float lpos[XYZ] = { ltarget[X_AXIS], ltarget[Y_AXIS], ltarget[Z_AXIS] };
         apply_leveling(lpos);
@@ -355,6 +517,49 @@ class Planner final {
       #endif
     }
 
+    #if ENABLED(SEGMENT_MERGING)
+
+      /**
+       * Segment merging, ahead of buffer_line.
+       *
+       * A G0/G1 move is held back, and each following move that continues it within the
+       * tolerances extends it instead of taking a block of its own. Any other way into the
+       * planner buffers the held move first.
+       */
+      struct merge_settings final {
+        bool enabled;
+        float angle,        // (degrees) Largest direction change merged across
+              sin_sq_angle, // sq(sin(angle))
+              e_ratio,      // Largest relative change in extrusion per mm merged across
+              max_length;   // (mm) Longest move merging may produce
+      } static merge_config;
+
+      struct merge_statistics final {
+        uint32 moves,       // Moves passed to merge_line
+               merged;      // Moves that extended the held move
+      } static merge_stats;
+
+      static void set_merge_angle(const float & __restrict angle);
+
+      /**
+       * Merge the move from start to target into the held move, or hold it back.
+       * Returns false if the caller has to buffer the move itself.
+       */
+      static bool merge_line(const float (&start)[XYZE], const float (&target)[XYZE], const float & __restrict fr_mm_s, const uint8_t extruder);
+
+      // Buffer the held move, if any.
+      static void __forceinline __flatten flush_merged() { if (merged.held) buffer_merged(); }
+
+      // Buffer the held move if the queue ahead of it is running low. Called from the main loop.
+      static void __forceinline __flatten poll_merged() {
+        if (merged.held && movesplanned() < SEGMENT_MERGE_MIN_BLOCKS) buffer_merged();
+      }
+
+      // Drop the held move. Used when the planned moves are aborted.
+      static void __forceinline __flatten discard_merged() { merged.held = false; }
+
+    #endif
+
     /**
      * Set the planner.position and individual stepper positions.
      * Used by G92, G28, G29, and other procedures.
@@ -385,36 +590,43 @@ class Planner final {
      */
     static inline bool __forceinline __flatten blocks_queued() { return (block_buffer_head != block_buffer_tail); }
 
+    /**
+     * The position of an axis in steps, after the last buffered block
+     */
+    static inline int24 __forceinline __flatten position_steps(const AxisEnum axis) { return int24(position[axis]); }
+
     /**
      * "Discards" the block and "releases" the memory.
      * Called when the current block is no longer needed.
      */
     static __forceinline __flatten void discard_current_block() {
-      if (blocks_queued())
-        block_buffer_tail = BLOCK_MOD(block_buffer_tail + 1);
+      if (blocks_queued()) {
+        const uint8_t next = BLOCK_MOD(block_buffer_tail + 1);
+        // A block discarded without being picked up (quick stop) is not picked up later either.
+        block_buffer_nonbusy = next;
+        block_buffer_tail = next;
+      }
     }
 
     /**
-     * The current block. nullptr if the buffer is empty.
-     * This also marks the block as busy.
+     * The current block. nullptr if the buffer is empty, or if the planner is
+     * still rewriting its trapezoid (then it is picked up by a later ISR).
+     * From here on the planner leaves the block alone.
      */
     static __forceinline __flatten block_t * __restrict get_current_block() {
       if (blocks_queued()) {
-        block_t * __restrict block = &block_buffer[block_buffer_tail];
+        const uint8_t tail = block_buffer_tail;
+        block_t * __restrict block = &block_buffer[tail];
 
-        // If the trapezoid of this block has to be recalculated, it's not save to execute it.
-        if (movesplanned() > 1) {
-          block_t * next = &block_buffer[next_block_index(block_buffer_tail)];
-          if (TEST(block->flag, BLOCK_BIT_RECALCULATE) || TEST(next->flag, BLOCK_BIT_RECALCULATE))
-            return nullptr;
-        }
-        else if (TEST(block->flag, BLOCK_BIT_RECALCULATE))
-          return nullptr;
+        // The planner has this block, or the next one, whose entry speed this one ends at.
+        if (block->sequence & 1) return nullptr;
+        const uint8_t next = next_block_index(tail);
+        if (next != block_buffer_head && (block_buffer[next].sequence & 1)) return nullptr;
 
         #if ENABLED(ULTRA_LCD)
           block_buffer_runtime_us -= block->segment_time; //We can't be sure how long an active block will take, so don't count it.
         #endif
-        SBI(block->flag, BLOCK_BIT_BUSY);
+        block_buffer_nonbusy = next;
         return block;
       }
       else {
@@ -465,21 +677,115 @@ class Planner final {
     /**
      * Calculate the maximum allowable speed at this point, in order
      * to reach 'target_velocity' using 'acceleration' within a given
-     * 'distance'.
+     * 'distance'. 'accel_distance' is 2 * acceleration * distance.
      */
-    static __forceinline __flatten float max_allowable_speed(const float & __restrict accel, const float & __restrict target_velocity, const float & __restrict distance) {
-      return SQRT(sq(target_velocity) - 2 * accel * distance);
+    static __forceinline __flatten float max_allowable_speed(const float & __restrict accel_distance, const float & __restrict target_velocity) {
+      return SQRT(sq(target_velocity) + accel_distance);
     }
 
-    static void __forceinline __flatten calculate_trapezoid_for_block(block_t * __restrict const block, const float & __restrict entry_speed, const float & __restrict next_entry_speed);
+    #if ENABLED(S_CURVE_ACCELERATION)
+
+      /**
+       * 2^32 / the length in Timer1 ticks of a ramp between two rates. The trapezoid's linear
+       * ramp reaches rate = ticks * acceleration_rate / 2^24, so the ramp lasts
+       * (delta << 24) / acceleration_rate ticks, and the S-curve takes exactly as long.
+       */
+      static __forceinline __flatten uint32 ramp_time_inverse(const uint24 acceleration_rate, const uint16 delta_rate) {
+        if (delta_rate == 0) return type_trait<uint32>::max;
+        return (uint32(acceleration_rate) << 8) / delta_rate;
+      }
+
+    #endif
+
+    #if ENABLED(PLANNER_FIXED_POINT)
+
+      /**
+       * Integer versions of the above for the fixed-point planner. Rates are in steps/sec and
+       * at most 65535, so their squares fit in 32 bits; the differences are taken unsigned with
+       * the sign tracked separately, and every quotient rounds the same way the float version does.
+       */
+
+      // estimate_acceleration_distance, rounded up or down. Limited to +/-2^29 steps.
+      static __forceinline __flatten int32 estimate_acceleration_steps(const uint16 initial_rate, const uint16 target_rate, const uint32 accel, const bool round_up) {
+        constexpr const uint32 limit = 1_u32 << 29;
+        if (accel == 0) return 0;
+        const uint32 accel2 = accel * 2;
+        if (target_rate >= initial_rate) {
+          const uint32 delta = uint32(target_rate) * target_rate - uint32(initial_rate) * initial_rate;
+          uint32 steps = delta / accel2;
+          if (round_up && steps * accel2 != delta) ++steps;
+          return int32(min(steps, limit));
+        }
+        else {
+          const uint32 delta = uint32(initial_rate) * initial_rate - uint32(target_rate) * target_rate;
+          uint32 steps = delta / accel2;
+          if (!round_up && steps * accel2 != delta) ++steps;
+          return -int32(min(steps, limit));
+        }
+      }
+
+      // CEIL(intersection_distance), limited to 0..distance.
+      // Computed as distance / 2 + (final_rate^2 - initial_rate^2) / (4 * accel) so nothing overflows.
+      static __forceinline __flatten uint24 intersection_steps(const uint16 initial_rate, const uint16 final_rate, const uint32 accel, const uint24 distance) {
+        if (accel == 0) return 0;
+        const uint32 accel4 = accel * 4;
+        const uint24 half = distance >> 1;
+        const uint32 odd = (distance & 1) ? accel * 2 : 0; // The half step, in units of 1 / (4 * accel)
+        if (final_rate >= initial_rate) {
+          const uint32 delta = uint32(final_rate) * final_rate - uint32(initial_rate) * initial_rate;
+          const uint32 steps = delta / accel4;
+          if (steps >= distance) return distance;
+          const uint32 remainder = (delta - steps * accel4) + odd; // < 6 * accel
+          return min(uint32(half + steps + (remainder != 0) + (remainder > accel4)), uint32(distance));
+        }
+        else {
+          const uint32 delta = uint32(initial_rate) * initial_rate - uint32(final_rate) * final_rate;
+          if (delta <= odd) return half + (delta != odd);
+          const uint32 steps = (delta - odd) / accel4;
+          return (steps >= half) ? 0 : half - steps;
+        }
+      }
+
+      // max_allowable_speed, squared. Both terms are below half the range, so this cannot overflow.
+      static __forceinline __flatten planner_speed_sqr_t max_allowable_speed_sqr(const planner_speed_sqr_t accel_distance_sqr, const planner_speed_sqr_t target_velocity_sqr) {
+        return accel_distance_sqr + target_velocity_sqr;
+      }
+
+      // Convert a float (mm/sec)^2 value, limiting it to half the range.
+      static __forceinline __flatten planner_speed_sqr_t to_speed_sqr(const float value) {
+        constexpr const float limit = float(type_trait<uint32>::max >> (planner_speed_sqr_t::fractional_bits + 1));
+        return planner_speed_sqr_t(min(value, limit));
+      }
+
+      // CEIL(sqrt(speed_sqr)), as calculate_trapezoid_for_block takes CEIL of the float speed.
+      static __forceinline __flatten uint16 speed_sqr_to_rate(const planner_speed_sqr_t speed_sqr) {
+        static_assert((planner_speed_sqr_t::fractional_bits & 1) == 0, "planner_speed_sqr_t needs an even number of fractional bits");
+        constexpr const uint8 root_fraction = planner_speed_sqr_t::fractional_bits / 2;
+        const uint32 raw = speed_sqr.raw();
+        uint32 root = Tuna::isqrt(raw);
+        if (root * root != raw) ++root;
+        return uint16((root + ((1_u32 << root_fraction) - 1)) >> root_fraction);
+      }
+
+      static void __forceinline __flatten calculate_trapezoid_for_block(block_t * __restrict const block, const planner_speed_sqr_t entry_speed_sqr, const planner_speed_sqr_t next_entry_speed_sqr);
+
+    #else
+
+      static void __forceinline __flatten calculate_trapezoid_for_block(block_t * __restrict const block, const float & __restrict entry_speed, const float & __restrict next_entry_speed);
+
+    #endif
+
+    static bool __forceinline __flatten claim_block(const uint8 block_index, const bool entry_speed);
+    static void __forceinline __flatten release_block(block_t * __restrict const block);
+    static void __forceinline __flatten update_planned();
 
-    static void __forceinline __flatten reverse_pass_kernel(block_t * __restrict const current, const block_t * __restrict next);
-    static void __forceinline __flatten forward_pass_kernel(const block_t * __restrict previous, block_t * __restrict const current);
+    static bool __forceinline __flatten reverse_pass_kernel(block_t * __restrict const current, const block_t * __restrict next, const uint8 block_index);
+    static void __forceinline __flatten forward_pass_kernel(const block_t * __restrict previous, block_t * __restrict const current, const uint8 block_index);
 
-    static void __forceinline __flatten reverse_pass();
-    static void __forceinline __flatten forward_pass();
+    static uint8 __forceinline __flatten reverse_pass();
+    static uint8 __forceinline __flatten forward_pass();
 
-    static void __forceinline __flatten recalculate_trapezoids();
+    static uint8 __forceinline __flatten recalculate_trapezoids(const uint8 first_index);
 
     static void __forceinline __flatten recalculate();
 
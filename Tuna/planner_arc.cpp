@@ -0,0 +1,177 @@
+/**
+ * Marlin 3D Printer Firmware
+ * Copyright (C) 2016 MarlinFirmware [https://github.com/MarlinFirmware/Marlin]
+ *
+ * Based on Sprinter and grbl.
+ * Copyright (C) 2011 Camiel Gubbels / Erik van der Zalm
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+/**
+ * planner_arc.cpp
+ *
+ * Compute and buffer movement commands for G2/G3 arcs
+ *
+ */
+
+#include <tuna.h>
+
+#if ENABLED(ARC_SUPPORT)
+
+#include "planner.h"
+#include "planner_arc.h"
+#include "thermal/thermal.hpp"
+
+/**
+ * Plan an arc in 2 dimensions
+ *
+ * The arc is approximated by generating many small linear segments.
+ * The length of each segment is configured in MM_PER_ARC_SEGMENT (Default 1mm)
+ * Arcs should only be made relatively large (over 5mm), as larger arcs with
+ * larger segments will tend to be more efficient. Your slicer should have
+ * options for G2/G3 arc generation. In future these options may be GCode tunable.
+ *
+ * With NATIVE_ARCS the planner takes the whole arc as a single block instead, if it can.
+ */
+bool plan_arc(const float position[NUM_AXIS], const float target[NUM_AXIS], const float offset[2], const bool clockwise, float fr_mm_s, uint8_t extruder) {
+  constexpr AxisEnum p_axis = X_AXIS, q_axis = Y_AXIS, l_axis = Z_AXIS;
+
+  // Radius vector from center to current location
+  float r_P = -offset[0], r_Q = -offset[1];
+
+  const float radius = HYPOT(r_P, r_Q),
+              center_P = position[p_axis] - r_P,
+              center_Q = position[q_axis] - r_Q,
+              rt_X = target[p_axis] - center_P,
+              rt_Y = target[q_axis] - center_Q,
+              linear_travel = target[l_axis] - position[l_axis],
+              extruder_travel = target[E_AXIS] - position[E_AXIS];
+
+  // CCW angle of rotation between position and target from the circle center. Only one atan2() trig computation required.
+  float angular_travel = ATAN2(r_P * rt_Y - r_Q * rt_X, r_P * rt_X + r_Q * rt_Y);
+  if (angular_travel < 0) angular_travel += RADIANS(360);
+  if (clockwise) angular_travel -= RADIANS(360);
+
+  // Make a circle if the angular rotation is 0 and the target is current position
+  if (angular_travel == 0 && position[p_axis] == target[p_axis] && position[q_axis] == target[q_axis])
+    angular_travel = RADIANS(360);
+
+  const float mm_of_travel = HYPOT(angular_travel * radius, FABS(linear_travel));
+  if (mm_of_travel < 0.001) return false;
+
+  #if ENABLED(NATIVE_ARCS)
+    // Segments are clamped to the software endstops one by one, so an arc that may reach past them is still segmented.
+    if (!soft_endstops_enabled || (
+         center_P - radius >= soft_endstop_min[p_axis] && center_P + radius <= soft_endstop_max[p_axis]
+      && center_Q - radius >= soft_endstop_min[q_axis] && center_Q + radius <= soft_endstop_max[q_axis]
+      && WITHIN(target[l_axis], soft_endstop_min[l_axis], soft_endstop_max[l_axis])
+    )) {
+      const float center[2] = { center_P, center_Q };
+      if (planner.buffer_arc(target, center, angular_travel, fr_mm_s, extruder)) return true;
+    }
+  #endif
+
+  uint16_t segments = FLOOR(mm_of_travel / (MM_PER_ARC_SEGMENT));
+  if (segments == 0) segments = 1;
+
+  /**
+   * Vector rotation by transformation matrix: r is the original vector, r_T is the rotated vector,
+   * and phi is the angle of rotation. Based on the solution approach by Jens Geisler.
+   *     r_T = [cos(phi) -sin(phi);
+   *            sin(phi)  cos(phi)] * r ;
+   *
+   * For arc generation, the center of the circle is the axis of rotation and the radius vector is
+   * defined from the circle center to the initial position. Each line segment is formed by successive
+   * vector rotations. This requires only two cos() and sin() computations to form the rotation
+   * matrix for the duration of the entire arc. Error may accumulate from numerical round-off, since
+   * all double numbers are single precision on the Arduino. (True double precision will not have
+   * round off issues for CNC applications.) Single precision error can accumulate to be greater than
+   * tool precision in some cases. Therefore, arc path correction is implemented.
+   *
+   * Small angle approximation may be used to reduce computation overhead further. This approximation
+   * holds for everything, but very small circles and large MM_PER_ARC_SEGMENT values. In other words,
+   * theta_per_segment would need to be greater than 0.1 rad and N_ARC_CORRECTION would need to be large
+   * to cause an appreciable drift error. N_ARC_CORRECTION~=25 is more than small enough to correct for
+   * numerical drift error. N_ARC_CORRECTION may be on the order a hundred(s) before error becomes an
+   * issue for CNC machines with the single precision Arduino calculations.
+   *
+   * This approximation also allows plan_arc to immediately insert a line segment into the planner
+   * without the initial overhead of computing cos() or sin(). By the time the arc needs to be applied
+   * a correction, the planner should have caught up to the lag caused by the initial plan_arc overhead.
+   * This is important when there are successive arc motions.
+   */
+  // Vector rotation matrix values
+  float arc_target[XYZE];
+  const float theta_per_segment = angular_travel / segments,
+              linear_per_segment = linear_travel / segments,
+              extruder_per_segment = extruder_travel / segments,
+              sin_T = theta_per_segment,
+              cos_T = 1 - 0.5 * sq(theta_per_segment); // Small angle approximation
+
+  // Initialize the linear axis
+  arc_target[l_axis] = position[l_axis];
+
+  // Initialize the extruder axis
+  arc_target[E_AXIS] = position[E_AXIS];
+
+  millis_t next_idle_ms = millis() + 200UL;
+
+  int8_t count = N_ARC_CORRECTION;
+
+  for (uint16_t i = 1; i < segments; i++) { // Iterate (segments-1) times
+
+    Temperature::manage_heater();
+    if (ELAPSED(millis(), next_idle_ms)) {
+      next_idle_ms = millis() + 200UL;
+      idle();
+    }
+
+    if (--count) {
+      // Apply vector rotation matrix to previous r_P / 1
+      const float r_new_Y = r_P * sin_T + r_Q * cos_T;
+      r_P = r_P * cos_T - r_Q * sin_T;
+      r_Q = r_new_Y;
+    }
+    else {
+      count = N_ARC_CORRECTION;
+
+      // Arc correction to radius vector. Computed only every N_ARC_CORRECTION increments.
+      // Compute exact location by applying transformation matrix from initial radius vector(=-offset).
+      // To reduce stuttering, the sin and cos could be computed at different times.
+      // For now, compute both at the same time.
+      const float cos_Ti = cos(i * theta_per_segment), sin_Ti = sin(i * theta_per_segment);
+      r_P = -offset[0] * cos_Ti + offset[1] * sin_Ti;
+      r_Q = -offset[0] * sin_Ti - offset[1] * cos_Ti;
+    }
+
+    // Update arc_target location
+    arc_target[p_axis] = center_P + r_P;
+    arc_target[q_axis] = center_Q + r_Q;
+    arc_target[l_axis] += linear_per_segment;
+    arc_target[E_AXIS] += extruder_per_segment;
+
+    clamp_to_software_endstops(arc_target);
+
+    planner.buffer_line_kinematic(arc_target, fr_mm_s, extruder);
+  }
+
+  // Ensure last segment arrives at target location.
+  planner.buffer_line_kinematic(target, fr_mm_s, extruder);
+
+  return true;
+}
+
+#endif // ARC_SUPPORT
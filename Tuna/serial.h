@@ -29,6 +29,9 @@
   #include "HardwareSerial.h"
   #if ENABLED(BLUETOOTH)
     #define MYSERIAL bluetoothSerial
+  #elif ENABLED(SERIAL_TX_LANES)
+    #include "serial_tx.hpp"
+    #define MYSERIAL Tuna::serialTx
   #else
     #define MYSERIAL Serial
   #endif // BLUETOOTH
@@ -40,6 +43,13 @@
 extern const char echomagic[] __flashmem;
 extern const char errormagic[] __flashmem;
 
+// Output in the rest of the scope goes to a lane of SERIAL_TX_LANES: status or debug.
+#if ENABLED(SERIAL_TX_LANES)
+  #define SERIAL_LANE(L) Tuna::SerialTx::scope _serial_lane(Tuna::SerialTx::lane::L)
+#else
+  #define SERIAL_LANE(L) NOOP
+#endif
+
 #define SERIAL_CHAR(x) ((void)MYSERIAL.write(x))
 #define SERIAL_EOL() SERIAL_CHAR('\n')
 
@@ -0,0 +1,199 @@
+#include <tuna.h>
+
+#if ENABLED(SERIAL_TX_LANES)
+
+#include "serial_tx.hpp"
+
+namespace Tuna
+{
+  SerialTx serialTx;
+
+  SerialTx::counters SerialTx::stats = {};
+
+  SerialTx::lane SerialTx::writing = SerialTx::lane::protocol;
+
+  SerialTx::ring<TX_BUFFER_SIZE> SerialTx::protocol;
+  SerialTx::ring<TX_DEBUG_BUFFER_SIZE> SerialTx::debug;
+  bool SerialTx::debug_dropping = false;
+
+  char SerialTx::status_line[2][TX_STATUS_LINE_SIZE];
+  uint8 SerialTx::status_written = SerialTx::none;
+  uint8 SerialTx::status_writing = 0;
+  volatile uint8 SerialTx::status_pending = SerialTx::none;
+  volatile uint8 SerialTx::status_sending = SerialTx::none;
+  uint8 SerialTx::status_sent;
+
+  uint8 SerialTx::sending = SerialTx::none;
+  bool SerialTx::written = false;
+
+  void SerialTx::udre()
+  {
+    if (sending == none)
+    {
+      if (protocol.tail != protocol.committed)
+      {
+        sending = uint8(lane::protocol);
+      }
+      else if (status_pending != none)
+      {
+        status_sending = status_pending;
+        status_pending = none;
+        status_sent = 0;
+        sending = uint8(lane::status);
+      }
+      else if (debug.tail != debug.committed)
+      {
+        sending = uint8(lane::debug);
+      }
+      else
+      {
+        UCSR0B &= ~_BV(UDRIE0);
+        return;
+      }
+    }
+
+    uint8 c;
+    switch (lane(sending))
+    {
+    case lane::protocol:
+      if (protocol.tail == protocol.committed)
+      {
+        // The rest of the line is still to be written: the next write starts the interrupt again.
+        UCSR0B &= ~_BV(UDRIE0);
+        return;
+      }
+      c = protocol.data[protocol.tail & protocol.mask];
+      protocol.tail = protocol.tail + 1;
+      break;
+    case lane::status:
+      c = status_line[status_sending][status_sent++];
+      if (c == '\n') status_sending = none;
+      break;
+    default:
+      c = debug.data[debug.tail & debug.mask];
+      debug.tail = debug.tail + 1;
+      break;
+    }
+    if (c == '\n') sending = none;
+
+    UDR0 = c;
+    // Clears TXC0 (by writing a one to it), so flush waits for this byte to be out.
+    UCSR0A |= _BV(TXC0);
+  }
+
+  void SerialTx::wait()
+  {
+    ++stats.stalls;
+    const uint32 start = micros();
+    do
+    {
+      // With interrupts disabled, nothing else empties the ring: send from here, as HardwareSerial::write does.
+      if (TEST(UCSR0A, UDRE0) && !TEST(SREG, SREG_I)) udre();
+    } while (!protocol.room());
+    stats.stall_us += micros() - start;
+  }
+
+  void SerialTx::put_status(const uint8 c)
+  {
+    if (status_written == none)
+    {
+      // A line not sent yet is replaced. Otherwise, the line that is not being sent is free.
+      critical_section _critsec;
+      if (status_pending != none)
+      {
+        status_writing = status_pending;
+        status_pending = none;
+        ++stats.coalesced;
+      }
+      else
+      {
+        status_writing = (status_sending == 0) ? 1 : 0;
+      }
+      status_written = 0;
+    }
+    else if (status_written == dropping)
+    {
+      if (c == '\n') status_written = none;
+      return;
+    }
+
+    if (__unlikely(status_written == TX_STATUS_LINE_SIZE))
+    {
+      ++stats.dropped;
+      status_written = (c == '\n') ? none : dropping;
+      return;
+    }
+
+    status_line[status_writing][status_written++] = c;
+    if (c == '\n')
+    {
+      status_written = none;
+      __memorybarrier;                    // The line is written before the interrupt can take it
+      status_pending = status_writing;
+      start();
+    }
+  }
+
+  void SerialTx::put_debug(const uint8 c)
+  {
+    if (debug_dropping)
+    {
+      if (c == '\n') debug_dropping = false;
+      return;
+    }
+
+    if (__unlikely(!debug.room()))
+    {
+      // The whole line goes.
+      debug.head = debug.committed;
+      debug_dropping = c != '\n';
+      ++stats.dropped;
+      return;
+    }
+
+    debug.data[debug.head & debug.mask] = c;
+    debug.head = debug.head + 1;
+    if (c == '\n')
+    {
+      __memorybarrier;                    // The line is written before the interrupt can send it
+      debug.committed = debug.head;
+      start();
+    }
+  }
+
+  uint8_t SerialTx::write(const uint8_t c) __restrict
+  {
+    switch (writing)
+    {
+    case lane::protocol:
+      if (__unlikely(!protocol.room())) wait();
+      protocol.data[protocol.head & protocol.mask] = c;
+      protocol.head = protocol.head + 1;
+      __memorybarrier;                    // The byte is written before the interrupt can send it
+      protocol.committed = protocol.head;
+      stats.peak = max(stats.peak, protocol.used());
+      start();
+      break;
+    case lane::status:
+      put_status(c);
+      break;
+    default:
+      put_debug(c);
+      break;
+    }
+    return 1;
+  }
+
+  void SerialTx::flush() __restrict
+  {
+    if (!written) return;
+
+    // As HardwareSerial::flush.
+    while (!TEST(UCSR0A, TXC0) || TEST(UCSR0B, UDRIE0))
+    {
+      if (!TEST(SREG, SREG_I) && TEST(UCSR0B, UDRIE0) && TEST(UCSR0A, UDRE0)) udre();
+    }
+  }
+}
+
+#endif // SERIAL_TX_LANES
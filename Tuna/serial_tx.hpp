@@ -0,0 +1,143 @@
+/**
+ * serial_tx.hpp - lanes of output on USART0, for SERIAL_TX_LANES
+ *
+ * HardwareSerial::write spins while its 64 bytes are full, so a temperature report or a debug log in the middle of a
+ * print holds up the main loop, and every "ok" queued behind it. Here, MYSERIAL writes to one of three lanes, picked
+ * with SERIAL_LANE for the rest of a scope:
+ *
+ *   protocol  Everything not sent elsewhere: "ok", command output, errors. A ring of TX_BUFFER_SIZE; a write waits for
+ *             room, as before, and the wait is counted.
+ *   status    Lines sent on a timer (auto_report_temperatures). Two lines of TX_STATUS_LINE_SIZE: one being sent, one
+ *             written. A line that has not started sending is replaced by the next, and a write never waits.
+ *   debug     Diagnostics (Log::d). A ring of TX_DEBUG_BUFFER_SIZE that takes whole lines: a line that does not fit is
+ *             dropped, and a write never waits. A report a command asked for, as a calibration's, is protocol output.
+ *
+ * The data register empty interrupt sends a line at a time: from the protocol ring first, then the status line, then
+ * the debug ring. An "ok" waits at most for the end of the line on the wire. Protocol lines stay in the order written,
+ * as hosts pair a command's output with its "ok". A protocol line is sent as it is written; the other lanes are only
+ * sent once their line is finished.
+ *
+ * Input goes through Serial, as before. Nothing else may write to Serial, as its interrupt now serves the lanes.
+ */
+
+#pragma once
+
+#include "MarlinConfig.h"
+
+#if ENABLED(SERIAL_TX_LANES)
+
+#include "HardwareSerial.h"
+
+namespace Tuna
+{
+  class SerialTx final : public Print
+  {
+  public:
+    enum class lane : uint8
+    {
+      protocol = 0,
+      status,
+      debug
+    };
+
+    struct counters final
+    {
+      uint16 stalls;                      // Protocol writes that waited for room.
+      uint32 stall_us;                    // How long they waited, in all.
+      uint16 coalesced;                   // Status lines replaced before they were sent.
+      uint16 dropped;                     // Status and debug lines that did not fit.
+      uint8 peak;                         // Most bytes waiting in the protocol ring.
+    };
+
+    static counters stats;
+
+    // Sends what is written in the rest of the scope to a lane.
+    class scope final
+    {
+      const lane previous;
+    public:
+      scope(const scope &) = delete;
+      scope & operator = (const scope &) = delete;
+
+      inline __forceinline scope(const lane to) : previous(writing)
+      {
+        writing = to;
+      }
+      inline __forceinline ~scope()
+      {
+        writing = previous;
+      }
+    };
+
+    virtual uint8_t write(uint8_t c) __restrict override final;
+    using Print::write;
+
+    // Waits until the interrupt has nothing left to send, and the last byte is out of the USART.
+    void flush() __restrict;
+
+    // Input, and the USART's settings, are Serial's.
+    inline __forceinline void begin(const __uint24 baud) __restrict { Serial.begin(baud); }
+    inline __forceinline int available() __restrict { return Serial.available(); }
+    inline __forceinline int read() __restrict { return Serial.read(); }
+
+    // Sends the next byte. From the data register empty interrupt.
+    static void udre();
+
+  private:
+    template <uint16 N>
+    struct ring final
+    {
+      static constexpr const uint8 mask = N - 1;
+
+      uint8 data[N];
+      uint8 head;                         // Written. Only loop() writes it.
+      volatile uint8 committed;           // What the interrupt may send, up to here.
+      volatile uint8 tail;                // Sent. Only the interrupt writes it.
+
+      inline __forceinline uint8 used() const
+      {
+        return uint8(head - tail);
+      }
+      inline __forceinline uint8 room() const
+      {
+        return uint8(N - 1) - used();
+      }
+    };
+
+    enum : uint8
+    {
+      none = 0xFF,                        // No status line; the interrupt is between lines.
+      dropping = 0xFE                     // The status line being written did not fit: dropped up to its end.
+    };
+
+    static lane writing;
+
+    static ring<TX_BUFFER_SIZE> protocol;
+    static ring<TX_DEBUG_BUFFER_SIZE> debug;
+    static bool debug_dropping;
+
+    static char status_line[2][TX_STATUS_LINE_SIZE];
+    static uint8 status_written;          // Bytes of the line being written, none, or dropping.
+    static uint8 status_writing;          // The line being written.
+    static volatile uint8 status_pending; // The line finished and not sent yet, or none.
+    static volatile uint8 status_sending; // The line being sent, or none. Only the interrupt writes it.
+    static uint8 status_sent;             // Bytes of it sent.
+
+    static uint8 sending;                 // The lane of the line being sent, or none. Only the interrupt uses it.
+    static bool written;                  // Anything was sent since reset, so TXC0 will be set.
+
+    static inline __forceinline void start()
+    {
+      written = true;
+      UCSR0B |= _BV(UDRIE0);
+    }
+
+    static void wait();
+    static void put_status(const uint8 c);
+    static void put_debug(const uint8 c);
+  };
+
+  extern SerialTx serialTx;
+}
+
+#endif // SERIAL_TX_LANES
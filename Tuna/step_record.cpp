@@ -0,0 +1,36 @@
+#include <tuna.h>
+
+#if ENABLED(STEP_RECORDING)
+
+#include "step_record.hpp"
+#include "planner.h"
+
+namespace Tuna
+{
+  StepRecord::entry StepRecord::entries[StepRecord::size];
+  uint8 StepRecord::head = 0;
+  uint16 StepRecord::recorded = 0;
+  uint32 StepRecord::dropped = 0;
+  bool StepRecord::full = false;
+  StepRecord::mode StepRecord::recording = StepRecord::mode::stopped;
+
+  void StepRecord::start(const mode m)
+  {
+    critical_section _critsec;
+
+    head = 0;
+    recorded = 0;
+    dropped = 0;
+    full = false;
+    recording = m;
+  }
+
+  void __forceinline StepRecord::block_begin(const block_t * __restrict block)
+  {
+    if (__likely(recording == mode::stopped)) return;
+    const uint32 steps = block->step_event_count;
+    push({ uint16(steps), block_marker, int16(steps >> 16) });
+  }
+}
+
+#endif // STEP_RECORDING
@@ -0,0 +1,99 @@
+/**
+ * step_record.hpp - step stream recording for STEP_RECORDING
+ *
+ * Records what Stepper::isr actually traced into a small ring, for M933 to dump: a header for each block it picks up,
+ * then, for each update of the speed ramp, the interval it set (in Timer1 ticks, for step_loops step events), the
+ * step_loops it took them at, and the LIN_ADVANCE offset stepped so far. An update is flagged when an interrupt before
+ * the next one was pushed back by the OCR1A clamp, as then the steps came later than the interval says.
+ *
+ * The intervals are the stepper's own planner math, and the flags are where the ISR scheduling failed it. A run of the
+ * same G-code in the simulator (simulator -r) records the same stream from the host-built planner and stepper, and
+ * diffs the two. Recording costs a few stores per ramp update, and nothing while it is stopped.
+ */
+
+#pragma once
+
+#include "MarlinConfig.h"
+
+#if ENABLED(STEP_RECORDING)
+
+struct block_t;
+
+namespace Tuna
+{
+  class StepRecord final : trait::ce_only
+  {
+  public:
+    enum class mode : uint8
+    {
+      stopped = 0,
+      once,                               // Until the ring is full: the first entries after arming.
+      ring                                // Overwriting the oldest entries: the last ones before the dump.
+    };
+
+    static constexpr const uint8 block_marker = 0;          // step_loops of a block header.
+    static constexpr const uint8 clamped_flag = 0x80;       // In step_loops: the steps were held back by the clamp.
+
+    static constexpr const uint16 size = STEP_RECORDING_SIZE;
+    static_assert(size >= 16 && size <= 256 && (size & (size - 1)) == 0, "STEP_RECORDING_SIZE must be a power of 2, 16 to 256");
+
+    // A ramp update, or a block header: then step_loops is block_marker, and interval and advance hold the block's
+    // step_event_count, low 16 bits and high 8 bits.
+    struct entry final
+    {
+      uint16 interval;
+      uint8 step_loops;
+      int16 advance;
+    };
+
+    static entry entries[size];
+    static uint8 head;                    // Index of the next entry to write.
+    static uint16 recorded;               // Entries in the ring, up to size.
+    static uint32 dropped;                // Entries overwritten (ring).
+    static bool full;                     // Stopped by a full ring (once).
+    static mode recording;
+
+    // Clears the ring and starts (or stops) recording. Called outside of the stepper ISR.
+    static void start(const mode m);
+
+    static inline __forceinline __flatten void push(const entry & __restrict e)
+    {
+      if (__unlikely(recorded == size))
+      {
+        if (recording == mode::once)
+        {
+          recording = mode::stopped;
+          full = true;
+          return;
+        }
+        ++dropped;
+      }
+      else
+      {
+        ++recorded;
+      }
+      entries[head] = e;
+      head = (head + 1) & (size - 1);
+    }
+
+    // Called from Stepper::isr when it picks up a block.
+    static void block_begin(const block_t * __restrict block);
+
+    // Called from Stepper::isr with each update of the speed ramp.
+    static inline __forceinline __flatten void ramp(const uint16 interval, const uint8 step_loops, const int16 advance)
+    {
+      if (__likely(recording == mode::stopped)) return;
+      push({ interval, step_loops, advance });
+    }
+
+    // Called from the Timer1 handler when the OCR1A clamp pushes the next interrupt back.
+    static inline __forceinline void clamp_hit()
+    {
+      if (__likely(recording == mode::stopped)) return;
+      entry & __restrict last = entries[(head - 1) & (size - 1)];
+      if (last.step_loops != block_marker) last.step_loops |= clamped_flag;
+    }
+  };
+}
+
+#endif // STEP_RECORDING
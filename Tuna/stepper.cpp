@@ -54,6 +54,8 @@
 #include "language.h"
 #include "cardreader.h"
 #include "speed_lookuptable.h"
+#include "isr_profile.hpp"
+#include "step_record.hpp"
 
 #if HAS_DIGIPOTSS
   #include <SPI.h>
@@ -76,31 +78,12 @@ uint24 Stepper::step_events_completed = 0; // The number of step events executed
 
 #if ENABLED(LIN_ADVANCE)
 
-  constexpr uint16_t ADV_NEVER = 65535;
-
   uint16_t Stepper::nextMainISR = 0,
-           Stepper::nextAdvanceISR = ADV_NEVER,
-           Stepper::eISR_Rate = ADV_NEVER;
-
-    volatile int Stepper::e_steps[E_STEPPERS];
-    int Stepper::final_estep_rate,
-        Stepper::current_estep_rate[E_STEPPERS],
-        Stepper::current_adv_steps[E_STEPPERS];
+           Stepper::nextAdvanceISR = ADV_NEVER;
 
-  /**
-   * See https://github.com/MarlinFirmware/Marlin/issues/5699#issuecomment-309264382
-   *
-   * This fix isn't perfect and may lose steps - but better than locking up completely
-   * in future the planner should slow down if advance stepping rate would be too high
-   */
-  uint16_t __forceinline adv_rate(const int steps, const uint16_t timer, const uint8_t loops) {
-    if (__likely(steps != 0)) {
-      const uint16_t rate = (timer * loops) / uabs(steps);
-      //return constrain(rate, 1, ADV_NEVER - 1)
-      return rate ? rate : 1;
-    }
-    return ADV_NEVER;
-  }
+  int16 Stepper::current_adv_steps = 0,
+        Stepper::la_target = 0;
+  uint16 Stepper::la_interval = ADV_NEVER;
 
 #endif // LIN_ADVANCE
 
@@ -113,6 +96,95 @@ unsigned short Stepper::acc_step_rate; // needed for deceleration start point
 uint8_t Stepper::step_loops, Stepper::step_loops_nominal;
 unsigned short Stepper::OCR1A_nominal;
 
+#if ENABLED(STEPPER_RAMP_TABLES) || ENABLED(STEPPER_RAMP_CACHE)
+  uint8 Stepper::accel_step_index, Stepper::decel_step_index;
+#endif
+
+#if ENABLED(STEPPER_RAMP_TABLES)
+  Stepper::ramp_table Stepper::ramp_tables[2];
+  const Stepper::ramp_table * __restrict Stepper::current_ramp = nullptr;
+#endif
+
+#if ENABLED(STEPPER_RAMP_CACHE)
+  Stepper::cached_ramp Stepper::ramp_cache[RAMP_CACHE_SIZE];
+  uint16 Stepper::ramp_clock = 0;
+  const Stepper::cached_ramp * __restrict Stepper::current_accel_ramp = nullptr;
+  const Stepper::cached_ramp * __restrict Stepper::current_decel_ramp = nullptr;
+  Stepper::ramp_cache_stats Stepper::ramp_stats;
+#endif
+
+#if ENABLED(NATIVE_ARCS)
+  Tuna::arc_tracer Stepper::arc;
+  int24 Stepper::arc_increment[2][2];
+  uint8 Stepper::arc_diagonals = 0;
+#endif
+
+#if ENABLED(MULTI_RATE_STEPPING)
+  Stepper::axis_steps Stepper::pending[XYZE - 1];
+  uint8 Stepper::pending_count = 0, Stepper::pending_next = 0;
+  uint16 Stepper::event_interval, Stepper::group_interval, Stepper::group_last_interval;
+  uint8 Stepper::group_events = 0;
+  uint8 Stepper::step_shift[XYZE];
+  uint16 Stepper::step_recip[XYZE];
+#endif
+
+#if ENABLED(MULTI_RATE_STEPPING) || ENABLED(INPUT_SHAPING)
+  // 65535 / d, for the 8-bit step counts d a block's steps are shifted down to, and for the steps of an axis in a
+  // shaping entry. 65535 is a long on the AVR, so each divide this replaces would be a 32-bit one, some 600 cycles; a
+  // lookup is a few.
+  static const uint16_t step_reciprocals[256] __flashmem = {
+        0, 65535, 32767, 21845, 16383, 13107, 10922,  9362,
+     8191,  7281,  6553,  5957,  5461,  5041,  4681,  4369,
+     4095,  3855,  3640,  3449,  3276,  3120,  2978,  2849,
+     2730,  2621,  2520,  2427,  2340,  2259,  2184,  2114,
+     2047,  1985,  1927,  1872,  1820,  1771,  1724,  1680,
+     1638,  1598,  1560,  1524,  1489,  1456,  1424,  1394,
+     1365,  1337,  1310,  1285,  1260,  1236,  1213,  1191,
+     1170,  1149,  1129,  1110,  1092,  1074,  1057,  1040,
+     1023,  1008,   992,   978,   963,   949,   936,   923,
+      910,   897,   885,   873,   862,   851,   840,   829,
+      819,   809,   799,   789,   780,   771,   762,   753,
+      744,   736,   728,   720,   712,   704,   697,   689,
+      682,   675,   668,   661,   655,   648,   642,   636,
+      630,   624,   618,   612,   606,   601,   595,   590,
+      585,   579,   574,   569,   564,   560,   555,   550,
+      546,   541,   537,   532,   528,   524,   520,   516,
+      511,   508,   504,   500,   496,   492,   489,   485,
+      481,   478,   474,   471,   468,   464,   461,   458,
+      455,   451,   448,   445,   442,   439,   436,   434,
+      431,   428,   425,   422,   420,   417,   414,   412,
+      409,   407,   404,   402,   399,   397,   394,   392,
+      390,   387,   385,   383,   381,   378,   376,   374,
+      372,   370,   368,   366,   364,   362,   360,   358,
+      356,   354,   352,   350,   348,   346,   344,   343,
+      341,   339,   337,   336,   334,   332,   330,   329,
+      327,   326,   324,   322,   321,   319,   318,   316,
+      315,   313,   312,   310,   309,   307,   306,   304,
+      303,   302,   300,   299,   297,   296,   295,   293,
+      292,   291,   289,   288,   287,   286,   284,   283,
+      282,   281,   280,   278,   277,   276,   275,   274,
+      273,   271,   270,   269,   268,   267,   266,   265,
+      264,   263,   262,   261,   260,   259,   258,   257
+  };
+#endif
+
+#if ENABLED(INPUT_SHAPING)
+  Tuna::input_shaper Stepper::shaper[2];
+  Stepper::shaping_entry Stepper::shaping_queue[SHAPING_BUFFER_SIZE];
+  uint8 Stepper::shaping_head = 0;
+  volatile uint8 Stepper::shaping_tail[2][2] = { { 0, 0 }, { 0, 0 } };
+  uint8 Stepper::shaping_echoed[2][2] = { { 0, 0 }, { 0, 0 } };
+  int16 Stepper::shaping_error[2] = { 0, 0 };
+  int8 Stepper::shaping_steps[2] = { 0, 0 };
+  uint8 Stepper::shaping_direction = 0;
+  uint32 Stepper::shaping_clock = 0;
+  bool Stepper::shaping_suspended = false;
+  Stepper::shaping_setting Stepper::shaping_settings[2] = {
+    { Tuna::shaper_type::SHAPING_TYPE, SHAPING_FREQ_X, SHAPING_ZETA_X },
+    { Tuna::shaper_type::SHAPING_TYPE, SHAPING_FREQ_Y, SHAPING_ZETA_Y }
+  };
+#endif
+
 volatile int24 Stepper::endstops_trigsteps[XYZ];
 
 #define X_APPLY_DIR(v,Q) X_DIR_WRITE(v)
@@ -126,6 +198,55 @@ volatile int24 Stepper::endstops_trigsteps[XYZ];
 
 #define E_APPLY_STEP(v,Q) E_STEP_WRITE(v)
 
+#if ENABLED(BATCHED_STEP_PULSES)
+
+  #define _STEP_REGISTER_X TOGGLE_REGISTER(X_STEP_PIN)
+  #define _STEP_REGISTER_Y TOGGLE_REGISTER(Y_STEP_PIN)
+  #define _STEP_REGISTER_Z TOGGLE_REGISTER(Z_STEP_PIN)
+  #define _STEP_REGISTER_E TOGGLE_REGISTER(E0_STEP_PIN)
+  #define _STEP_MASK_X PIN_MASK(X_STEP_PIN)
+  #define _STEP_MASK_Y PIN_MASK(Y_STEP_PIN)
+  #define _STEP_MASK_Z PIN_MASK(Z_STEP_PIN)
+  #define _STEP_MASK_E PIN_MASK(E0_STEP_PIN)
+
+  #define _STEP_REGISTER(AXIS) _STEP_REGISTER_ ## AXIS
+  #define _STEP_MASK(AXIS) _STEP_MASK_ ## AXIS
+  #define _SAME_STEP_PORT(A, B) (&_STEP_REGISTER(A) == &_STEP_REGISTER(B))
+
+  // The first of X, Y, Z and E on each port holds the mask of the whole port; the others hold none.
+  #define _FIRST_ON_STEP_PORT_X true
+  #define _FIRST_ON_STEP_PORT_Y (!_SAME_STEP_PORT(Y, X))
+  #define _FIRST_ON_STEP_PORT_Z (!_SAME_STEP_PORT(Z, X) && !_SAME_STEP_PORT(Z, Y))
+  #define _FIRST_ON_STEP_PORT_E (!_SAME_STEP_PORT(E, X) && !_SAME_STEP_PORT(E, Y) && !_SAME_STEP_PORT(E, Z))
+  #define _FIRST_ON_STEP_PORT(AXIS) _FIRST_ON_STEP_PORT_ ## AXIS
+
+  /**
+   * The step pins of a set of axes (bits of AxisEnum), grouped by port. The ports come from
+   * the pin map, so the grouping is done by the compiler; what's left is a mask per port, and
+   * one store to its input register to toggle the port's pins. The step pins idle at their
+   * inactive level, so toggling them twice makes a pulse. Both toggles take the same stores
+   * in the same order, so every pulse is as wide as the wait between them, give or take the
+   * stores to the other ports.
+   */
+  struct step_pulse final {
+    uint8 x, y, z, e;
+
+    #define _STEP_PORT_BITS(AXIS, FIRST) ((_SAME_STEP_PORT(AXIS, FIRST) && TEST(axes, _AXIS(AXIS))) ? _STEP_MASK(AXIS) : 0)
+    #define _STEP_PORT_MASK(FIRST) (_FIRST_ON_STEP_PORT(FIRST) ? uint8(_STEP_PORT_BITS(X, FIRST) | _STEP_PORT_BITS(Y, FIRST) | _STEP_PORT_BITS(Z, FIRST) | _STEP_PORT_BITS(E, FIRST)) : 0)
+
+    __forceinline __flatten step_pulse(const uint8 axes) :
+      x(_STEP_PORT_MASK(X)), y(_STEP_PORT_MASK(Y)), z(_STEP_PORT_MASK(Z)), e(_STEP_PORT_MASK(E)) {}
+
+    inline __forceinline __flatten void toggle() const {
+      _STEP_REGISTER(X) = x;
+      if (_FIRST_ON_STEP_PORT(Y)) _STEP_REGISTER(Y) = y;
+      if (_FIRST_ON_STEP_PORT(Z)) _STEP_REGISTER(Z) = z;
+      if (_FIRST_ON_STEP_PORT(E)) _STEP_REGISTER(E) = e;
+    }
+  };
+
+#endif
+
 // intRes = longIn1 * longIn2 >> 24
 // uses:
 // r26 to store 0
@@ -148,6 +269,68 @@ inline uint16 __forceinline __flatten MultiU24X24toH16(arg_type<uint24> a, arg_t
   return result;
 }
 
+#if ENABLED(S_CURVE_ACCELERATION)
+
+  // The S-curve ramp: 10s^3 - 15s^4 + 6s^5 in 0.16, where s = time / ramp length = time * time_inverse / 2^32.
+  // This is the 5th order Bezier with control points 0, 0, 0, 1, 1, 1: acceleration and jerk are zero at both ends,
+  // and its mean is 1/2, so the ramp covers the same steps in the same time as the trapezoid's linear one.
+  inline uint32 __forceinline __flatten bezier_ramp(arg_type<uint24> time, arg_type<uint32> time_inverse)
+  {
+    const uint64 s64 = (uint64(time) * time_inverse) >> 16;
+    if (s64 >= type_trait<uint16>::max)
+    {
+      return 1_u32 << 16;
+    }
+    const uint32 s = uint32(s64);
+    const uint32 s2 = (s * s) >> 16;
+    const uint32 s3 = (s2 * s) >> 16;
+    // 10 - 15s + 6s^2 is between 1 and 10 for 0 <= s <= 1; it is taken down to 0.12 so the product fits in 32 bits.
+    const uint32 inner = ((10_u32 << 16) - (15 * s) + (6 * s2)) >> 4;
+    return (s3 * inner) >> 12;
+  }
+
+#endif
+
+// The step rate at a point on the acceleration ramp.
+inline uint16 __forceinline __flatten acceleration_step_rate(const block_t * __restrict block, arg_type<uint24> acceleration_time)
+{
+  #if ENABLED(S_CURVE_ACCELERATION)
+    uint16 step_rate = block->initial_rate + uint16((uint32(block->cruise_rate - block->initial_rate) * bezier_ramp(acceleration_time, block->acceleration_time_inverse)) >> 16);
+  #else
+    uint16 step_rate = MultiU24X24toH16(acceleration_time, block->acceleration_rate);
+    step_rate += block->initial_rate;
+  #endif
+
+  // upper limit
+  if (__unlikely(step_rate > block->nominal_rate))
+  {
+    step_rate = block->nominal_rate;
+  }
+  return step_rate;
+}
+
+// The step rate at a point on the deceleration ramp, which started at start_rate.
+inline uint16 __forceinline __flatten deceleration_step_rate(const block_t * __restrict block, arg_type<uint24> deceleration_time, const uint16 start_rate)
+{
+  #if ENABLED(S_CURVE_ACCELERATION)
+    // The ramp never passes its end, so this stays at or above final_rate.
+    UNUSED(start_rate);
+    return block->cruise_rate - uint16((uint32(block->cruise_rate - block->final_rate) * bezier_ramp(deceleration_time, block->deceleration_time_inverse)) >> 16);
+  #else
+    uint16 step_rate = MultiU24X24toH16(deceleration_time, block->acceleration_rate);
+
+    if (step_rate < start_rate) { // Still decelerating?
+      step_rate = start_rate - step_rate;
+      NOLESS(step_rate, block->final_rate);
+    }
+    else
+    {
+      step_rate = block->final_rate;
+    }
+    return step_rate;
+  #endif
+}
+
 // Some useful constants
 
 #define ENABLE_STEPPER_DRIVER_INTERRUPT()  SBI(TIMSK1, OCIE1A)
@@ -194,14 +377,27 @@ void __forceinline __flatten Stepper::set_directions() {
       count_direction[AXIS ##_AXIS] = 1; \
     }
 
-  SET_STEP_DIR(X); // A
-  SET_STEP_DIR(Y); // B
+  #if ENABLED(INPUT_SHAPING)
+    // The shaper turns X and Y for each of their own steps; this is only the way the block goes.
+    #define SET_XY_DIR(AXIS) count_direction[AXIS ##_AXIS] = motor_direction(AXIS ##_AXIS) ? -1 : 1
+  #else
+    #define SET_XY_DIR(AXIS) SET_STEP_DIR(AXIS)
+  #endif
+
+  SET_XY_DIR(X); // A
+  SET_XY_DIR(Y); // B
   SET_STEP_DIR(Z); // C
-}
 
-#if ENABLED(ENDSTOP_INTERRUPTS_FEATURE)
-  extern volatile uint8_t e_hit;
-#endif
+  // The advance ISR turns E around for its own steps, and puts it back.
+  if (motor_direction(E_AXIS)) {
+    REV_E_DIR();
+    count_direction[E_AXIS] = -1;
+  }
+  else {
+    NORM_E_DIR();
+    count_direction[E_AXIS] = 1;
+  }
+}
 
 /**
  * Stepper Driver Interrupt
@@ -229,6 +425,96 @@ __signal(TIMER1_COMPA)
   }
 }
 
+#define _COUNTER(AXIS) counter[_AXIS(AXIS)]
+#define _APPLY_STEP(AXIS) AXIS ##_APPLY_STEP
+#define _INVERT_STEP_PIN(AXIS) INVERT_## AXIS ##_STEP_PIN
+
+#if ENABLED(BATCHED_STEP_PULSES)
+
+  // Advance the Bresenham counter; mark the axis if it needs a step
+  #define PULSE_START(AXIS) \
+    _COUNTER(AXIS) += current_block->steps[_AXIS(AXIS)]; \
+    if (_COUNTER(AXIS) > 0) SBI(axes, _AXIS(AXIS));
+
+  // After the pulse: reset the Bresenham counter, update the position
+  #define PULSE_STOP(AXIS) \
+    if (TEST(axes, _AXIS(AXIS))) { \
+      _COUNTER(AXIS) -= current_block->step_event_count; \
+      __assume(count_direction[_AXIS(AXIS)] == -1 || count_direction[_AXIS(AXIS)] == 1); \
+      count_position[_AXIS(AXIS)] += count_direction[_AXIS(AXIS)]; \
+    }
+
+#else
+
+  // Advance the Bresenham counter; start a pulse if the axis needs a step
+  #define PULSE_START(AXIS) \
+    _COUNTER(AXIS) += current_block->steps[_AXIS(AXIS)]; \
+    if (_COUNTER(AXIS) > 0) { _APPLY_STEP(AXIS)(!_INVERT_STEP_PIN(AXIS),0); }
+
+  // Stop an active pulse, reset the Bresenham counter, update the position
+  #define PULSE_STOP(AXIS) \
+    if (_COUNTER(AXIS) > 0) { \
+      _COUNTER(AXIS) -= current_block->step_event_count; \
+      __assume(count_direction[_AXIS(AXIS)] == -1 || count_direction[_AXIS(AXIS)] == 1); \
+      count_position[_AXIS(AXIS)] += count_direction[_AXIS(AXIS)]; \
+      _APPLY_STEP(AXIS)(_INVERT_STEP_PIN(AXIS),0); \
+    }
+
+#endif
+
+#if ENABLED(INPUT_SHAPING)
+
+  // X and Y: the Bresenham counter commands the step, and the shaper decides whether the motor takes one now
+  #define XY_PULSE_START(AXIS) \
+    _COUNTER(AXIS) += current_block->steps[_AXIS(AXIS)]; \
+    if (_COUNTER(AXIS) > 0) { \
+      _COUNTER(AXIS) -= current_block->step_event_count; \
+      if (shaping_command(_AXIS(AXIS))) { _XY_STEP_START(AXIS); } \
+    }
+
+  #if ENABLED(BATCHED_STEP_PULSES)
+    #define _XY_STEP_START(AXIS) SBI(axes, _AXIS(AXIS))
+    #define XY_PULSE_STOP(AXIS) NOOP
+  #else
+    #define _XY_STEP_START(AXIS) do { _APPLY_STEP(AXIS)(!_INVERT_STEP_PIN(AXIS),0); SBI(axes, _AXIS(AXIS)); } while (0)
+    #define XY_PULSE_STOP(AXIS) if (TEST(axes, _AXIS(AXIS))) { _APPLY_STEP(AXIS)(_INVERT_STEP_PIN(AXIS),0); }
+  #endif
+
+#else
+
+  #define XY_PULSE_START(AXIS) PULSE_START(AXIS)
+  #define XY_PULSE_STOP(AXIS) PULSE_STOP(AXIS)
+
+#endif
+
+/**
+ * Estimate the number of cycles that the stepper logic already takes
+ * up between the start and stop of the X stepper pulse.
+ *
+ * Currently this uses very modest estimates of around 5 cycles.
+ * True values may be derived by careful testing.
+ *
+ * Once any delay is added, the cost of the delay code itself
+ * may be subtracted from this value to get a more accurate delay.
+ * Delays under 20 cycles (1.25µs) will be very accurate, using NOPs.
+ * Longer delays use a loop. The resolution is 8 cycles.
+ */
+#define _CYCLE_APPROX_1 5
+#define _CYCLE_APPROX_2 _CYCLE_APPROX_1
+#define _CYCLE_APPROX_3 _CYCLE_APPROX_2 + 5
+#define _CYCLE_APPROX_4 _CYCLE_APPROX_3
+#define _CYCLE_APPROX_5 _CYCLE_APPROX_4 + 5
+#define _CYCLE_APPROX_6 _CYCLE_APPROX_5
+#define _CYCLE_APPROX_7 _CYCLE_APPROX_6
+
+#if ENABLED(BATCHED_STEP_PULSES)
+  // Only the stores to the other ports fall between the two toggles of a pin: three at most, 2 cycles each.
+  #define CYCLES_EATEN_XYZE 6
+#else
+  #define CYCLES_EATEN_XYZE _CYCLE_APPROX_7
+#endif
+#define EXTRA_CYCLES_XYZE (STEP_PULSE_CYCLES - (CYCLES_EATEN_XYZE))
+
 template <bool endstops_enabled> void __forceinline __flatten Stepper::isr() {
 
 #define ENDSTOP_NOMINAL_OCR_VAL 4096    // check endstops every 1.5ms to guarantee two stepper ISRs within 5ms for BLTouch
@@ -236,6 +522,13 @@ template <bool endstops_enabled> void __forceinline __flatten Stepper::isr() {
 
   uint16 ocr_val;
 
+  // With endstop interrupts, a pin change is latched, so there is nothing to poll between steps.
+  #if ENABLED(ENDSTOP_INTERRUPTS_FEATURE)
+    constexpr const bool poll_endstops = false;
+  #else
+    constexpr const bool poll_endstops = endstops_enabled;
+  #endif
+
   // sample endstops in between step pulses
   static uint16_t step_remaining = 0;
 
@@ -243,7 +536,7 @@ template <bool endstops_enabled> void __forceinline __flatten Stepper::isr() {
   {
     const uint16 value16 = uint16(value);
     ocr_val = value16;
-    if constexpr(endstops_enabled)
+    if constexpr(poll_endstops)
     {
       if (value > ENDSTOP_NOMINAL_OCR_VAL)
       {
@@ -254,11 +547,15 @@ template <bool endstops_enabled> void __forceinline __flatten Stepper::isr() {
     }
   };
 
-  if constexpr(endstops_enabled)
+  if constexpr(poll_endstops)
   {
     if (__likely(step_remaining != 0))
     {   // Just check endstops - not yet time for a step
-      endstops.update();
+      #if ENABLED(ISR_PROFILING)
+        IsrProfile::set_path(IsrProfile::path::split);
+      #endif
+      // The block may have ended with the step before; there is nothing to stop then.
+      if (current_block != nullptr) endstops.update();
       if (step_remaining > ENDSTOP_NOMINAL_OCR_VAL) {
         step_remaining -= ENDSTOP_NOMINAL_OCR_VAL;
         ocr_val = ENDSTOP_NOMINAL_OCR_VAL;
@@ -283,10 +580,28 @@ template <bool endstops_enabled> void __forceinline __flatten Stepper::isr() {
     #ifdef SD_FINISHED_RELEASECOMMAND
       if (!cleaning_buffer_counter && (SD_FINISHED_STEPPERRELEASE)) enqueue_and_echo_commands(SD_FINISHED_RELEASECOMMAND);
     #endif
+    #if ENABLED(MULTI_RATE_STEPPING)
+      pending_count = pending_next = 0;
+    #endif
     _NEXT_ISR(200); // Run at max speed - 10 KHz
     return;
   }
 
+  #if ENABLED(MULTI_RATE_STEPPING)
+    // Steps queued within the interval of the last event come first, before the next block too.
+    if (pending_next < pending_count) {
+      #if ENABLED(ISR_PROFILING)
+        IsrProfile::set_path(IsrProfile::path::event);
+      #endif
+      const axis_steps & __restrict steps = pending[pending_next++];
+      pulse_axes(steps.axes);
+      // Timer1 takes OCR1A + 1 ticks to match; only the event's own interrupt gets the extra tick.
+      split(((pending_next < pending_count) ? pending[pending_next].offset : event_interval) - steps.offset - 1);
+      _NEXT_ISR(ocr_val);
+      return;
+    }
+  #endif
+
   // If there is no current block, attempt to pop one from the buffer
   if (__unlikely(current_block == nullptr)) {
     // Anything in the buffer?
@@ -294,21 +609,55 @@ template <bool endstops_enabled> void __forceinline __flatten Stepper::isr() {
     if (__likely(current_block != nullptr)) {
       trapezoid_generator_reset();
 
+      #if ENABLED(ISR_PROFILING)
+        IsrProfile::block_begin(current_block);
+      #endif
+      #if ENABLED(STEP_RECORDING)
+        StepRecord::block_begin(current_block);
+      #endif
+
       __assume(current_block->step_event_count > 0);
 
-      // Initialize Bresenham counters to 1/2 the ceiling
-      counter[3] = counter[2] = counter[1] = counter[0] = -(current_block->step_event_count >> 1);
+      #if ENABLED(MULTI_RATE_STEPPING)
+        // Start each axis half its own step period in, less half an event: the leading axis steps right at each
+        // event, and the steps of the others are centered on the block, as with the counters at 1/2 the ceiling.
+        LOOP_XYZE(i) {
+          const uint24 steps = current_block->steps[i];
+          counter[i] = -int24((current_block->step_event_count - steps) >> 1);
+          uint8 shift = 0;
+          for (uint24 s = steps; s > 255; s >>= 1) ++shift;
+          step_shift[i] = shift;
+          step_recip[i] = pgm_read_word(&step_reciprocals[uint8(steps >> shift)]);
+        }
+        group_events = 0;
+      #else
+        // Initialize Bresenham counters to 1/2 the ceiling
+        counter[3] = counter[2] = counter[1] = counter[0] = -(current_block->step_event_count >> 1);
+      #endif
 
       #if ENABLED(MIXING_EXTRUDER)
         MIXING_STEPPERS_LOOP(i)
           counter_m[i] = -(current_block->mix_event_count[i] >> 1);
       #endif
 
+      #if ENABLED(NATIVE_ARCS)
+        if (TEST(current_block->flag, BLOCK_BIT_ARC)) {
+          arc = { current_block->arc_x, current_block->arc_y, current_block->arc_error };
+          // Z and E are spread over the weighted events, which follow the path length.
+          arc_increment[0][0] = current_block->steps[Z_AXIS] * Tuna::arc_tracer::straight_weight;
+          arc_increment[0][1] = current_block->steps[Z_AXIS] * Tuna::arc_tracer::diagonal_weight;
+          arc_increment[1][0] = current_block->steps[E_AXIS] * Tuna::arc_tracer::straight_weight;
+          arc_increment[1][1] = current_block->steps[E_AXIS] * Tuna::arc_tracer::diagonal_weight;
+          counter[Z_AXIS] = counter[E_AXIS] = -(current_block->arc_weight >> 1);
+          arc_diagonals = 0;
+        }
+      #endif
+
       step_events_completed = 0;
 
       #if ENABLED(ENDSTOP_INTERRUPTS_FEATURE)
-        e_hit = 2; // Needed for the case an endstop is already triggered before the new move begins.
-                   // No 'change' can be detected.
+        endstops.e_hit = 2; // Needed for the case an endstop is already triggered before the new move begins.
+                            // No 'change' can be detected.
       #endif
 
       #if ENABLED(Z_LATE_ENABLE)
@@ -330,302 +679,1086 @@ template <bool endstops_enabled> void __forceinline __flatten Stepper::isr() {
   __assume(current_block->decelerate_after >= current_block->accelerate_until);
   __assume(current_block->decelerate_after <= current_block->step_event_count);
   __assume(current_block->accelerate_until <= current_block->step_event_count);
-  __assume((current_block->accelerate_until + current_block->decelerate_after) <= current_block->step_event_count);
   __assume(current_block->active_extruder == 0);
 
   // Update endstops state, if enabled
   if constexpr(endstops_enabled)
   {
-    endstops.update();
+    #if ENABLED(ENDSTOP_INTERRUPTS_FEATURE)
+      if (__unlikely(endstops.e_hit != 0)) {
+        --endstops.e_hit;
+        endstops.update();
+      }
+    #else
+      endstops.update();
+    #endif
   }
 
-  // Take multiple steps per interrupt (For high speed moves)
-  bool all_steps_done = false;
-  for (uint8_t i = step_loops; __likely(i--);) {
-    #if ENABLED(LIN_ADVANCE)
-      counter[E_AXIS] += current_block->steps[E_AXIS];
-      if (counter[E_AXIS] > 0) {
-        counter[E_AXIS] -= current_block->step_event_count;
-        // Don't step E here for mixing extruder
-        __assume(count_direction[E_AXIS] == -1 || count_direction[E_AXIS] == 1);
-        count_position[E_AXIS] += count_direction[E_AXIS];
-        __unlikely(motor_direction(E_AXIS)) ? --e_steps[TOOL_E_INDEX] : ++e_steps[TOOL_E_INDEX];
+  #if ENABLED(NATIVE_ARCS)
+    const uint8 event_loops = step_loops;
+  #endif
+
+  // Advance the speed ramp. Returns the interval to the next update, which comes step_loops events later.
+  const auto ramp_interval = [&]() -> uint16 {
+    if (step_events_completed <= current_block->accelerate_until) {
+
+      uint16_t timer;
+      #if ENABLED(STEPPER_RAMP_TABLES)
+        const ramp_entry * __restrict entry = nullptr;
+        if (current_ramp) {
+          if (uint8(accel_step_index - current_ramp->accel_first) < current_ramp->accel_count) {
+            entry = &current_ramp->accel[accel_step_index & (RAMP_TABLE_LENGTH - 1)];
+          }
+          if (accel_step_index != type_trait<uint8>::max) ++accel_step_index;
+        }
+        if (entry) {
+          acc_step_rate = entry->step_rate;
+          timer = entry->timer;
+          step_loops = entry->step_loops;
+        }
+        else
+      #elif ENABLED(STEPPER_RAMP_CACHE)
+        const ramp_entry * __restrict entry = nullptr;
+        if (current_accel_ramp) {
+          // Once the nominal rate limits the ramp, the block is off it for good.
+          if (accel_step_index < current_accel_ramp->length && current_accel_ramp->entries[accel_step_index].step_rate <= current_block->nominal_rate)
+            entry = &current_accel_ramp->entries[accel_step_index++];
+          else
+            current_accel_ramp = nullptr;
+        }
+        if (entry) {
+          ++ramp_stats.loaded;
+          acc_step_rate = entry->step_rate;
+          timer = entry->timer;
+          step_loops = entry->step_loops;
+        }
+        else
+          ++ramp_stats.calculated;
+        if (!entry)
+      #endif
+      {
+        acc_step_rate = acceleration_step_rate(current_block, acceleration_time);
+
+        // step_rate to timer interval
+        timer = calc_timer(acc_step_rate);
       }
-    #endif // LIN_ADVANCE
 
-    #define _COUNTER(AXIS) counter[_AXIS(AXIS)]
-    #define _APPLY_STEP(AXIS) AXIS ##_APPLY_STEP
-    #define _INVERT_STEP_PIN(AXIS) INVERT_## AXIS ##_STEP_PIN
+      #if ENABLED(NATIVE_ARCS)
+        timer = arc_interval(timer, event_loops);
+      #endif
 
-    // Advance the Bresenham counter; start a pulse if the axis needs a step
-    #define PULSE_START(AXIS) \
-      _COUNTER(AXIS) += current_block->steps[_AXIS(AXIS)]; \
-      if (_COUNTER(AXIS) > 0) { _APPLY_STEP(AXIS)(!_INVERT_STEP_PIN(AXIS),0); }
+      acceleration_time += timer;
+      return timer;
+    }
+    else if (step_events_completed > current_block->decelerate_after) {
+      uint16_t step_rate, timer;
+      #if ENABLED(STEPPER_RAMP_TABLES)
+        if (current_ramp && decel_step_index < current_ramp->decel_count) {
+          const ramp_entry & __restrict entry = current_ramp->decel[decel_step_index++];
+          step_rate = entry.step_rate;
+          timer = entry.timer;
+          step_loops = entry.step_loops;
+        }
+        else
+      #elif ENABLED(STEPPER_RAMP_CACHE)
+        const ramp_entry * __restrict entry = nullptr;
+        if (current_decel_ramp) {
+          // The ramp starts from the nominal rate, which the block may not have reached. Once the final rate limits
+          // it, the block is off it for good.
+          if (decel_step_index < current_decel_ramp->length && (decel_step_index != 0 || acc_step_rate == current_decel_ramp->start_rate)
+            && current_decel_ramp->entries[decel_step_index].step_rate >= current_block->final_rate)
+            entry = &current_decel_ramp->entries[decel_step_index++];
+          else
+            current_decel_ramp = nullptr;
+        }
+        if (entry) {
+          ++ramp_stats.loaded;
+          step_rate = entry->step_rate;
+          timer = entry->timer;
+          step_loops = entry->step_loops;
+        }
+        else
+          ++ramp_stats.calculated;
+        if (!entry)
+      #endif
+      {
+        step_rate = deceleration_step_rate(current_block, deceleration_time, acc_step_rate);
 
-    // Stop an active pulse, reset the Bresenham counter, update the position
-    #define PULSE_STOP(AXIS) \
-      if (_COUNTER(AXIS) > 0) { \
-        _COUNTER(AXIS) -= current_block->step_event_count; \
-        __assume(count_direction[_AXIS(AXIS)] == -1 || count_direction[_AXIS(AXIS)] == 1); \
-        count_position[_AXIS(AXIS)] += count_direction[_AXIS(AXIS)]; \
-        _APPLY_STEP(AXIS)(_INVERT_STEP_PIN(AXIS),0); \
+        // step_rate to timer interval
+        timer = calc_timer(step_rate);
       }
 
-    /**
-     * Estimate the number of cycles that the stepper logic already takes
-     * up between the start and stop of the X stepper pulse.
-     *
-     * Currently this uses very modest estimates of around 5 cycles.
-     * True values may be derived by careful testing.
-     *
-     * Once any delay is added, the cost of the delay code itself
-     * may be subtracted from this value to get a more accurate delay.
-     * Delays under 20 cycles (1.25µs) will be very accurate, using NOPs.
-     * Longer delays use a loop. The resolution is 8 cycles.
-     */
-    #define _CYCLE_APPROX_1 5
-    #define _CYCLE_APPROX_2 _CYCLE_APPROX_1
-    #define _CYCLE_APPROX_3 _CYCLE_APPROX_2 + 5
-    #define _CYCLE_APPROX_4 _CYCLE_APPROX_3
-    #define _CYCLE_APPROX_5 _CYCLE_APPROX_4 + 5
-    #define _CYCLE_APPROX_6 _CYCLE_APPROX_5
-    #define _CYCLE_APPROX_7 _CYCLE_APPROX_6
-
-    #define CYCLES_EATEN_XYZE _CYCLE_APPROX_7
-    #define EXTRA_CYCLES_XYZE (STEP_PULSE_CYCLES - (CYCLES_EATEN_XYZE))
-
-    /**
-     * If a minimum pulse time was specified get the timer 0 value.
-     *
-     * TCNT0 has an 8x prescaler, so it increments every 8 cycles.
-     * That's every 0.5µs on 16MHz and every 0.4µs on 20MHz.
-     * 20 counts of TCNT0 -by itself- is a good pulse delay.
-     * 10µs = 160 or 200 cycles.
-     */
-    #if EXTRA_CYCLES_XYZE > 20
-      uint32 pulse_start = TCNT0;
-    #endif
+      #if ENABLED(NATIVE_ARCS)
+        timer = arc_interval(timer, event_loops);
+      #endif
 
-    PULSE_START(X);
-    PULSE_START(Y);
-    PULSE_START(Z);
+      #if ENABLED(LIN_ADVANCE)
+        // The first deceleration ISR: head for the offset at the end of the block.
+        if (current_block->use_advance_lead && deceleration_time == 0) {
+          set_advance_target(current_block->la_final_steps);
+        }
+      #endif
 
-    // For minimum pulse time wait before stopping pulses
-    #if EXTRA_CYCLES_XYZE > 20
-      while (EXTRA_CYCLES_XYZE > (uint32)(TCNT0 - pulse_start) * (INT0_PRESCALER)) { /* nada */ }
-      pulse_start = TCNT0;
-    #elif EXTRA_CYCLES_XYZE > 0
-      DELAY_NOPS(EXTRA_CYCLES_XYZE);
-    #endif
+      deceleration_time += timer;
+      return timer;
+    }
+    else {
+      acc_step_rate = current_block->nominal_rate;
 
-    PULSE_STOP(X);
-    PULSE_STOP(Y);
-    PULSE_STOP(Z);
+      // ensure we're running at the correct step rate, even if we just came off an acceleration
+      step_loops = step_loops_nominal;
 
-    if (__unlikely(++step_events_completed >= current_block->step_event_count))
-    {
-      all_steps_done = true;
-      break;
+      #if ENABLED(NATIVE_ARCS)
+        return arc_interval(OCR1A_nominal, event_loops);
+      #else
+        return OCR1A_nominal;
+      #endif
     }
+  };
 
-      // For minimum pulse time wait after stopping pulses also
-#if EXTRA_CYCLES_XYZE > 20
-      if (i) while (EXTRA_CYCLES_XYZE > (uint32)(TCNT0 - pulse_start) * (INT0_PRESCALER)) { /* nada */ }
-#elif EXTRA_CYCLES_XYZE > 0
-      if (i) DELAY_NOPS(EXTRA_CYCLES_XYZE);
-#endif
-
-  } // steps_loop
+  #if ENABLED(MULTI_RATE_STEPPING)
 
-  #if ENABLED(LIN_ADVANCE)
-    if (current_block->use_advance_lead) {
-      const int delta_adv_steps = current_estep_rate[TOOL_E_INDEX] - current_adv_steps[TOOL_E_INDEX];
-      current_adv_steps[TOOL_E_INDEX] += delta_adv_steps;
-      // For most extruders, advance the single E stepper
-      e_steps[TOOL_E_INDEX] += delta_adv_steps;
-   }
-  #endif
+    // One step event per interrupt. The events of a ramp update are spread evenly over its interval instead of
+    // being taken back to back, and the ramp is still only updated once for all of them. The event is stepped
+    // first, so the ramp update does not hold its pulses back.
+    const bool all_steps_done = (++step_events_completed >= current_block->step_event_count);
 
-  // If we have esteps to execute, fire the next advance_isr "now"
-    if (e_steps[TOOL_E_INDEX])
+    uint8 later = 0;
+    #if ENABLED(NATIVE_ARCS)
+      if (__unlikely(TEST(current_block->flag, BLOCK_BIT_ARC))) {
+        arc_event(false);
+      }
+      else
+    #endif
     {
-      nextAdvanceISR = 0;
+      later = line_event();
     }
 
-  // Calculate new timer value
-  if (step_events_completed <= current_block->accelerate_until) {
-
-    acc_step_rate = MultiU24X24toH16(acceleration_time, current_block->acceleration_rate);
-    acc_step_rate += current_block->initial_rate;
-
-    // upper limit
-    if (__unlikely(acc_step_rate > current_block->nominal_rate))
-    {
-      acc_step_rate = current_block->nominal_rate;
+    if (group_events == 0) {
+      const uint16 timer = ramp_interval();
+      uint16 interval = timer;
+      for (uint8 l = step_loops; l > 1; l >>= 1) interval >>= 1;
+      // Timer1 takes OCR1A + 1 ticks to match, so the group is one tick short of its interval per extra
+      // interrupt; that and the rounding are made up on the last one, so the group takes as long as before.
+      group_interval = interval - 1;
+      group_last_interval = timer - interval * (step_loops - 1);
+      group_events = step_loops;
+      #if ENABLED(ISR_PROFILING)
+        IsrProfile::set_step_path(step_loops);
+      #endif
+      #if ENABLED(STEP_RECORDING)
+        StepRecord::ramp(timer, step_loops, current_adv_steps);
+      #endif
     }
+    #if ENABLED(ISR_PROFILING)
+      else {
+        IsrProfile::set_path(IsrProfile::path::event);
+      }
+    #endif
+    event_interval = (--group_events == 0) ? group_last_interval : group_interval;
 
-    // step_rate to timer interval
-    const uint16_t timer = calc_timer(acc_step_rate);
+    queue_steps(later);
 
-    split(timer);  // split step into multiple ISRs if larger than  ENDSTOP_NOMINAL_OCR_VAL
+    split((pending_count != 0) ? pending[0].offset : event_interval);  // split step into multiple ISRs if larger than  ENDSTOP_NOMINAL_OCR_VAL
     _NEXT_ISR(ocr_val);
 
-    acceleration_time += timer;
+  #else
 
-    #if ENABLED(LIN_ADVANCE)
+    #if ENABLED(ISR_PROFILING)
+      IsrProfile::set_step_path(step_loops);
+    #endif
 
-      if (current_block->use_advance_lead) {
-        current_estep_rate[TOOL_E_INDEX] = ((uint32)acc_step_rate * current_block->abs_adv_steps_multiplier8) >> 17;
-      }
-    #endif // LIN_ADVANCE
+    // Take multiple steps per interrupt (For high speed moves)
+    bool all_steps_done = false;
+    for (uint8_t i = step_loops; __likely(i--);) {
+      #if ENABLED(NATIVE_ARCS)
+        if (__unlikely(TEST(current_block->flag, BLOCK_BIT_ARC))) {
+          arc_event(i != 0);
+          if (__unlikely(++step_events_completed >= current_block->step_event_count)) {
+            all_steps_done = true;
+            break;
+          }
+          continue;
+        }
+      #endif
 
-    eISR_Rate = adv_rate(e_steps[TOOL_E_INDEX], timer, step_loops);
-  }
-  else if (step_events_completed > current_block->decelerate_after) {
-    uint16_t step_rate = MultiU24X24toH16(deceleration_time, current_block->acceleration_rate);
+      /**
+       * If a minimum pulse time was specified get the timer 0 value.
+       *
+       * TCNT0 has an 8x prescaler, so it increments every 8 cycles.
+       * That's every 0.5µs on 16MHz and every 0.4µs on 20MHz.
+       * 20 counts of TCNT0 -by itself- is a good pulse delay.
+       * 10µs = 160 or 200 cycles.
+       */
+      #if ENABLED(BATCHED_STEP_PULSES)
+
+        uint8 axes = 0;
+        XY_PULSE_START(X);
+        XY_PULSE_START(Y);
+        PULSE_START(Z);
+        PULSE_START(E);
+        const step_pulse pulse(axes);
+
+        #if EXTRA_CYCLES_XYZE > 20
+          uint32 pulse_start = TCNT0;
+        #endif
+        pulse.toggle();
 
-    if (step_rate < acc_step_rate) { // Still decelerating?
-      step_rate = acc_step_rate - step_rate;
-      NOLESS(step_rate, current_block->final_rate);
-    }
-    else
-    {
-      step_rate = current_block->final_rate;
-    }
+      #else
 
-    // step_rate to timer interval
-    const uint16_t timer = calc_timer(step_rate);
+        #if EXTRA_CYCLES_XYZE > 20
+          uint32 pulse_start = TCNT0;
+        #endif
 
-    split(timer);  // split step into multiple ISRs if larger than  ENDSTOP_NOMINAL_OCR_VAL
-    _NEXT_ISR(ocr_val);
+        #if ENABLED(INPUT_SHAPING)
+          uint8 axes = 0;
+        #endif
+        XY_PULSE_START(X);
+        XY_PULSE_START(Y);
+        PULSE_START(Z);
+        PULSE_START(E);
 
-    deceleration_time += timer;
+      #endif
 
-    #if ENABLED(LIN_ADVANCE)
+      // For minimum pulse time wait before stopping pulses
+      #if EXTRA_CYCLES_XYZE > 20
+        while (EXTRA_CYCLES_XYZE > (uint32)(TCNT0 - pulse_start) * (INT0_PRESCALER)) { /* nada */ }
+        pulse_start = TCNT0;
+      #elif EXTRA_CYCLES_XYZE > 0
+        DELAY_NOPS(EXTRA_CYCLES_XYZE);
+      #endif
 
-      if (current_block->use_advance_lead) {
-        current_estep_rate[TOOL_E_INDEX] = ((uint32)step_rate * current_block->abs_adv_steps_multiplier8) >> 17;
-      }
-    #endif // LIN_ADVANCE
+      #if ENABLED(BATCHED_STEP_PULSES)
+        pulse.toggle();
+      #endif
 
-    #if ENABLED(LIN_ADVANCE)
-      eISR_Rate = adv_rate(e_steps[TOOL_E_INDEX], timer, step_loops);
-    #endif
-  }
-  else {
-    acc_step_rate = current_block->nominal_rate;
+      XY_PULSE_STOP(X);
+      XY_PULSE_STOP(Y);
+      PULSE_STOP(Z);
+      PULSE_STOP(E);
 
-    #if ENABLED(LIN_ADVANCE)
+      if (__unlikely(++step_events_completed >= current_block->step_event_count))
+      {
+        all_steps_done = true;
+        break;
+      }
 
-      if (current_block->use_advance_lead)
-        current_estep_rate[TOOL_E_INDEX] = final_estep_rate;
+        // For minimum pulse time wait after stopping pulses also
+  #if EXTRA_CYCLES_XYZE > 20
+        if (i) while (EXTRA_CYCLES_XYZE > (uint32)(TCNT0 - pulse_start) * (INT0_PRESCALER)) { /* nada */ }
+  #elif EXTRA_CYCLES_XYZE > 0
+        if (i) DELAY_NOPS(EXTRA_CYCLES_XYZE);
+  #endif
 
-      eISR_Rate = adv_rate(e_steps[TOOL_E_INDEX], OCR1A_nominal, step_loops_nominal);
+    } // steps_loop
 
+    #if ENABLED(INPUT_SHAPING)
+      if (shaping_steps[X_AXIS] | shaping_steps[Y_AXIS]) queue_echoes();
     #endif
 
-    split(OCR1A_nominal);  // split step into multiple ISRs if larger than  ENDSTOP_NOMINAL_OCR_VAL
+    const uint16 timer = ramp_interval();
+    #if ENABLED(STEP_RECORDING)
+      StepRecord::ramp(timer, step_loops, current_adv_steps);
+    #endif
+    split(timer);  // split step into multiple ISRs if larger than  ENDSTOP_NOMINAL_OCR_VAL
     _NEXT_ISR(ocr_val);
 
-    // ensure we're running at the correct step rate, even if we just came off an acceleration
-    step_loops = step_loops_nominal;
-  }
+  #endif
 
   // If current block is finished, reset pointer
   if (__unlikely(all_steps_done)) {
     current_block = nullptr;
     planner.discard_current_block();
+    #if ENABLED(ISR_PROFILING)
+      IsrProfile::block_end();
+    #endif
   }
 }
 
-#if ENABLED(LIN_ADVANCE)
+#if ENABLED(NATIVE_ARCS)
 
-  #define CYCLES_EATEN_E (E_STEPPERS * 5)
-  #define EXTRA_CYCLES_E (STEP_PULSE_CYCLES - (CYCLES_EATEN_E))
+  /**
+   * One step event of an arc block.
+   *
+   * X and Y follow Tuna::arc_tracer, turning their direction pins around wherever the
+   * arc crosses an axis. Z and E follow Bresenham over the weighted events instead of
+   * the event count, so they keep pace with the path length.
+   */
+  void __forceinline __flatten Stepper::arc_event(const bool more) {
+    const Tuna::arc_tracer::event event = arc.next(TEST(current_block->flag, BLOCK_BIT_ARC_CLOCKWISE));
+    const uint8 diagonal = (event.dx && event.dy) ? 1 : 0;
+    arc_diagonals += diagonal;
+
+    #define ARC_SET_DIR(AXIS, D) \
+      if (D && D != count_direction[_AXIS(AXIS)]) { \
+        count_direction[_AXIS(AXIS)] = D; \
+        if (D < 0) { SBI(last_direction_bits, _AXIS(AXIS)); AXIS ##_APPLY_DIR(INVERT_## AXIS ##_DIR, false); } \
+        else { CBI(last_direction_bits, _AXIS(AXIS)); AXIS ##_APPLY_DIR(!INVERT_## AXIS ##_DIR, false); } \
+      }
 
-  // Timer interrupt for E. e_steps is set in the main routine;
+    ARC_SET_DIR(X, event.dx);
+    ARC_SET_DIR(Y, event.dy);
 
-  template <bool endstops_enabled> void __forceinline __flatten Stepper::advance_isr() 
-  {
+    counter[Z_AXIS] += arc_increment[0][diagonal];
+    const bool step_z = counter[Z_AXIS] > 0;
+    counter[E_AXIS] += arc_increment[1][diagonal];
+    const bool step_e = counter[E_AXIS] > 0;
+
+    #if ENABLED(BATCHED_STEP_PULSES)
+
+      const step_pulse pulse(
+        (event.dx ? _BV(X_AXIS) : 0) | (event.dy ? _BV(Y_AXIS) : 0) | (step_z ? _BV(Z_AXIS) : 0) | (step_e ? _BV(E_AXIS) : 0)
+      );
+      #if EXTRA_CYCLES_XYZE > 20
+        uint32 pulse_start = TCNT0;
+      #endif
+      pulse.toggle();
 
-    nextAdvanceISR = eISR_Rate;
+      #define ARC_PULSE_STOP(AXIS) NOOP
 
-    #define SET_E_STEP_DIR(INDEX) \
-      if (e_steps[INDEX]) E## INDEX ##_DIR_WRITE(e_steps[INDEX] < 0 ? INVERT_E## INDEX ##_DIR : !INVERT_E## INDEX ##_DIR)
+    #else
 
-    #define START_E_PULSE(INDEX) \
-      if (e_steps[INDEX]) E## INDEX ##_STEP_WRITE(!INVERT_E_STEP_PIN)
+      #if EXTRA_CYCLES_XYZE > 20
+        uint32 pulse_start = TCNT0;
+      #endif
 
-    #define STOP_E_PULSE(INDEX) \
-      if (e_steps[INDEX]) { \
-        e_steps[INDEX] < 0 ? ++e_steps[INDEX] : --e_steps[INDEX]; \
-        E## INDEX ##_STEP_WRITE(INVERT_E_STEP_PIN); \
+      if (event.dx) X_APPLY_STEP(!INVERT_X_STEP_PIN, 0);
+      if (event.dy) Y_APPLY_STEP(!INVERT_Y_STEP_PIN, 0);
+      if (step_z) Z_APPLY_STEP(!INVERT_Z_STEP_PIN, 0);
+      if (step_e) E_APPLY_STEP(!INVERT_E_STEP_PIN, 0);
+
+      #define ARC_PULSE_STOP(AXIS) _APPLY_STEP(AXIS)(_INVERT_STEP_PIN(AXIS), 0)
+
+    #endif
+
+    #if EXTRA_CYCLES_XYZE > 20
+      while (EXTRA_CYCLES_XYZE > (uint32)(TCNT0 - pulse_start) * (INT0_PRESCALER)) { /* nada */ }
+      pulse_start = TCNT0;
+    #elif EXTRA_CYCLES_XYZE > 0
+      DELAY_NOPS(EXTRA_CYCLES_XYZE);
+    #endif
+
+    #if ENABLED(BATCHED_STEP_PULSES)
+      pulse.toggle();
+    #endif
+
+    if (event.dx) {
+      count_position[X_AXIS] += event.dx;
+      ARC_PULSE_STOP(X);
+    }
+    if (event.dy) {
+      count_position[Y_AXIS] += event.dy;
+      ARC_PULSE_STOP(Y);
+    }
+    if (step_z) {
+      counter[Z_AXIS] -= current_block->arc_weight;
+      count_position[Z_AXIS] += count_direction[Z_AXIS];
+      ARC_PULSE_STOP(Z);
+    }
+    if (step_e) {
+      counter[E_AXIS] -= current_block->arc_weight;
+      count_position[E_AXIS] += count_direction[E_AXIS];
+      ARC_PULSE_STOP(E);
+    }
+
+    #if EXTRA_CYCLES_XYZE > 20
+      if (more) while (EXTRA_CYCLES_XYZE > (uint32)(TCNT0 - pulse_start) * (INT0_PRESCALER)) { /* nada */ }
+    #elif EXTRA_CYCLES_XYZE > 0
+      if (more) DELAY_NOPS(EXTRA_CYCLES_XYZE);
+    #else
+      UNUSED(more);
+    #endif
+  }
+
+#endif // NATIVE_ARCS
+
+#if ENABLED(MULTI_RATE_STEPPING)
+
+  /**
+   * One step event of a line block: Bresenham decides which axes step in it, as before. The
+   * axes that step right at the event are pulsed now. The others crossed their step partway
+   * through it, and are left for queue_steps. Returns their bits.
+   */
+  uint8 __forceinline __flatten Stepper::line_event() {
+    uint8 axes = 0, later = 0;
+
+    #define LINE_STEP(AXIS) \
+      _COUNTER(AXIS) += current_block->steps[_AXIS(AXIS)]; \
+      if (_COUNTER(AXIS) > 0) { \
+        if (uint24(_COUNTER(AXIS)) >= current_block->steps[_AXIS(AXIS)]) SBI(axes, _AXIS(AXIS)); else SBI(later, _AXIS(AXIS)); \
+        _COUNTER(AXIS) -= current_block->step_event_count; \
       }
 
-    SET_E_STEP_DIR(0);
+    LINE_STEP(X);
+    LINE_STEP(Y);
+    LINE_STEP(Z);
+    LINE_STEP(E);
 
-    // Step all E steppers that have steps
-    for (uint8_t i = step_loops; i--;) {
+    pulse_axes(axes);
+    return later;
+  }
+
+  /**
+   * Queue the steps line_event left, once event_interval is known. An axis crossed its step
+   * (steps - count) / steps of the way through the event, so its step is queued at that
+   * offset into the interval, and each axis keeps to its own step rate. A step is only
+   * queued if its interrupt can come after this one is over, MULTI_RATE_MIN_TICKS before the
+   * next event and as far from the other queued steps; otherwise it is pulsed now, or with
+   * the queued step next to it.
+   */
+  void __forceinline __flatten Stepper::queue_steps(const uint8 later) {
+    pending_count = pending_next = 0;
+    if (!later) return;
+
+    uint8 axes = 0;
+
+    // The rest of this interrupt and the OCR1A clamp come first.
+    const uint16 earliest = TCNT1 + 32;
+    const bool spread = event_interval >= earliest + (MULTI_RATE_MIN_TICKS);
+
+    LOOP_XYZE(axis) {
+      if (!TEST(later, axis)) continue;
+      if (!spread) {
+        SBI(axes, axis);
+        continue;
+      }
+
+      // (steps - count) / steps, as a fraction of 256, without dividing.
+      const uint24 steps = current_block->steps[axis];
+      uint24 left = steps - uint24(counter[axis] + current_block->step_event_count);
+      for (uint8 s = step_shift[axis]; s; --s) left >>= 1;
+      const uint8 fraction = (uint16(left) * step_recip[axis]) >> 8;
+      uint16 offset = (uint24(event_interval) * fraction) >> 8;
+      if (offset < earliest) {
+        SBI(axes, axis);
+        continue;
+      }
+      NOMORE(offset, event_interval - (MULTI_RATE_MIN_TICKS));
+
+      bool merged = false;
+      for (uint8 j = 0; j < pending_count && !merged; ++j) {
+        if (uint16(offset - pending[j].offset + (MULTI_RATE_MIN_TICKS - 1)) < uint16(2 * (MULTI_RATE_MIN_TICKS) - 1)) {
+          SBI(pending[j].axes, axis);
+          merged = true;
+        }
+      }
+      if (merged) continue;
+
+      uint8 i = pending_count;
+      for (; i && pending[i - 1].offset > offset; --i) pending[i] = pending[i - 1];
+      pending[i] = { offset, uint8(_BV(axis)) };
+      ++pending_count;
+    }
+
+    if (axes) pulse_axes(axes);
+  }
 
-      #if EXTRA_CYCLES_E > 20
+  /**
+   * Pulse the given axes (bits of AxisEnum) together and count their steps. The steps of an
+   * axis are always in different interrupts, so there is no wait after the pulse.
+   */
+  void __forceinline __flatten Stepper::pulse_axes(const uint8 axes) {
+    #if ENABLED(BATCHED_STEP_PULSES)
+
+      const step_pulse pulse(axes);
+      #if EXTRA_CYCLES_XYZE > 20
         uint32 pulse_start = TCNT0;
       #endif
+      pulse.toggle();
+
+      #define AXIS_PULSE_STOP(AXIS) \
+        if (TEST(axes, _AXIS(AXIS))) { \
+          __assume(count_direction[_AXIS(AXIS)] == -1 || count_direction[_AXIS(AXIS)] == 1); \
+          count_position[_AXIS(AXIS)] += count_direction[_AXIS(AXIS)]; \
+        }
 
-      START_E_PULSE(0);
+    #else
 
-      // For minimum pulse time wait before stopping pulses
-      #if EXTRA_CYCLES_E > 20
-        while (EXTRA_CYCLES_E > (uint32)(TCNT0 - pulse_start) * (INT0_PRESCALER)) { /* nada */ }
-        pulse_start = TCNT0;
-      #elif EXTRA_CYCLES_E > 0
-        DELAY_NOPS(EXTRA_CYCLES_E);
+      #if EXTRA_CYCLES_XYZE > 20
+        uint32 pulse_start = TCNT0;
       #endif
 
-      STOP_E_PULSE(0);
+      #define AXIS_PULSE_START(AXIS) \
+        if (TEST(axes, _AXIS(AXIS))) { _APPLY_STEP(AXIS)(!_INVERT_STEP_PIN(AXIS),0); }
+
+      #define AXIS_PULSE_STOP(AXIS) \
+        if (TEST(axes, _AXIS(AXIS))) { \
+          __assume(count_direction[_AXIS(AXIS)] == -1 || count_direction[_AXIS(AXIS)] == 1); \
+          count_position[_AXIS(AXIS)] += count_direction[_AXIS(AXIS)]; \
+          _APPLY_STEP(AXIS)(_INVERT_STEP_PIN(AXIS),0); \
+        }
+
+      AXIS_PULSE_START(X);
+      AXIS_PULSE_START(Y);
+      AXIS_PULSE_START(Z);
+      AXIS_PULSE_START(E);
+
+    #endif
+
+    // For minimum pulse time wait before stopping pulses
+    #if EXTRA_CYCLES_XYZE > 20
+      while (EXTRA_CYCLES_XYZE > (uint32)(TCNT0 - pulse_start) * (INT0_PRESCALER)) { /* nada */ }
+    #elif EXTRA_CYCLES_XYZE > 0
+      DELAY_NOPS(EXTRA_CYCLES_XYZE);
+    #endif
+
+    #if ENABLED(BATCHED_STEP_PULSES)
+      pulse.toggle();
+    #endif
+
+    AXIS_PULSE_STOP(X);
+    AXIS_PULSE_STOP(Y);
+    AXIS_PULSE_STOP(Z);
+    AXIS_PULSE_STOP(E);
+  }
+
+#endif // MULTI_RATE_STEPPING
+
+#if ENABLED(INPUT_SHAPING)
+
+  /**
+   * Input shaping of X and Y.
+   *
+   * The Bresenham counters of X and Y only command steps. Each commanded step adds the shaper's
+   * first share (of 256) to the shaped position of the axis right away, and its echoes add the
+   * others later, from the queue. The motor follows the shaped position: it steps on once that
+   * is half a step ahead, but turns back only once it is a step and a half behind, as around a
+   * reversal the shares of new steps and the echoes of old ones push it back and forth. Once the
+   * last echo of an axis is in, it settles to within half a step again, so a move still ends on
+   * the step it was planned to. The echoes of a block still land after it, and a reversal can
+   * have the motor step against the block's direction, so the shaper owns the direction pins of
+   * X and Y, and count_position counts the motor's own steps.
+   */
+  uint8 __forceinline __flatten Stepper::shaping_count() {
+    uint8 count = 0;
+    for (uint8 axis = 0; axis < 2; ++axis)
+      for (uint8 echo = 0; echo < shaper[axis].echoes; ++echo)
+        NOLESS(count, uint8((shaping_head - shaping_tail[axis][echo]) & SHAPING_MASK));
+    return count;
+  }
+
+  bool Stepper::shaping_pending() {
+    CRITICAL_SECTION_START;
+    const bool pending = shaping_count() != 0;
+    CRITICAL_SECTION_END;
+    return pending;
+  }
+
+  void __forceinline __flatten Stepper::shaping_step(const uint8 axis, const bool negative) {
+    if (negative != TEST(shaping_direction, axis)) {
+      shaping_direction ^= _BV(axis);
+      if (axis == X_AXIS)
+        X_APPLY_DIR(negative ? INVERT_X_DIR : !INVERT_X_DIR, false);
+      else
+        Y_APPLY_DIR(negative ? INVERT_Y_DIR : !INVERT_Y_DIR, false);
+    }
+    count_position[axis] += negative ? -1 : 1;
+  }
+
+  bool __forceinline __flatten Stepper::shaping_next_step(const uint8 axis, const bool settle) {
+    int16 & __restrict error = shaping_error[axis];
+    const int16 back = (settle || !shaper[axis].echoes) ? 128 : 384;
+    const bool negative = TEST(shaping_direction, axis);
+    if (negative ? (error < -128 || error >= back) : (error >= 128 || error < -back)) {
+      const bool step_negative = error < 0;
+      error += step_negative ? 256 : -256;
+      shaping_step(axis, step_negative);
+      return true;
+    }
+    return false;
+  }
 
-      // For minimum pulse time wait before looping
-      #if EXTRA_CYCLES_E > 20
-        if (i) while (EXTRA_CYCLES_E > (uint32)(TCNT0 - pulse_start) * (INT0_PRESCALER)) { /* nada */ }
-      #elif EXTRA_CYCLES_E > 0
-        if (i) DELAY_NOPS(EXTRA_CYCLES_E);
+  void __forceinline __flatten Stepper::shaping_pulse(const uint8 axis) {
+    #if EXTRA_CYCLES_XYZE > 20
+      uint32 pulse_start = TCNT0;
+    #endif
+    #if ENABLED(BATCHED_STEP_PULSES)
+      const step_pulse pulse(_BV(axis));
+      pulse.toggle();
+      #define SHAPING_PULSE_STOP() pulse.toggle()
+    #else
+      if (axis == X_AXIS) X_APPLY_STEP(!INVERT_X_STEP_PIN, 0); else Y_APPLY_STEP(!INVERT_Y_STEP_PIN, 0);
+      #define SHAPING_PULSE_STOP() if (axis == X_AXIS) X_APPLY_STEP(INVERT_X_STEP_PIN, 0); else Y_APPLY_STEP(INVERT_Y_STEP_PIN, 0)
+    #endif
+
+    // Minimum pulse time, and the same again before any next pulse
+    #if EXTRA_CYCLES_XYZE > 20
+      while (EXTRA_CYCLES_XYZE > (uint32)(TCNT0 - pulse_start) * (INT0_PRESCALER)) { /* nada */ }
+      pulse_start = TCNT0;
+      SHAPING_PULSE_STOP();
+      while (EXTRA_CYCLES_XYZE > (uint32)(TCNT0 - pulse_start) * (INT0_PRESCALER)) { /* nada */ }
+    #else
+      #if EXTRA_CYCLES_XYZE > 0
+        DELAY_NOPS(EXTRA_CYCLES_XYZE);
       #endif
+      SHAPING_PULSE_STOP();
+      #if EXTRA_CYCLES_XYZE > 0
+        DELAY_NOPS(EXTRA_CYCLES_XYZE);
+      #endif
+    #endif
+  }
 
-    } // steps_loop
+  bool __forceinline __flatten Stepper::shaping_command(const uint8 axis) {
+    const int8 direction = count_direction[axis];
+    shaping_steps[axis] += direction;
+    const int16 share = shaper[axis].share[0];
+    shaping_error[axis] += (direction < 0) ? -share : share;
+    // The share is at most a step: one step catches up, or two to turn back.
+    if (!shaping_next_step(axis, false)) return false;
+    if (shaping_next_step(axis, false)) shaping_pulse(axis);
+    return true;
+  }
+
+  void __forceinline __flatten Stepper::queue_echoes() {
+    const int8 x = shaping_steps[X_AXIS], y = shaping_steps[Y_AXIS];
+    shaping_steps[X_AXIS] = shaping_steps[Y_AXIS] = 0;
+    if (!(shaper[X_AXIS].echoes | shaper[Y_AXIS].echoes)) return;
+
+    // Steps shortly after the last queued ones join them. No echo of those can have been taken
+    // yet: every delay is longer than SHAPING_MERGE_TICKS plus ADV_MERGE_TICKS.
+    if (shaping_count() != 0) {
+      shaping_entry & __restrict last = shaping_queue[(shaping_head - 1) & SHAPING_MASK];
+      const int8 merged_x = last.steps[X_AXIS] + x, merged_y = last.steps[Y_AXIS] + y;
+      if (
+        shaping_clock - last.time < SHAPING_MERGE_TICKS &&
+        WITHIN(merged_x, -SHAPING_ENTRY_STEPS, SHAPING_ENTRY_STEPS) &&
+        WITHIN(merged_y, -SHAPING_ENTRY_STEPS, SHAPING_ENTRY_STEPS)
+      ) {
+        last.span = uint16(shaping_clock - last.time);
+        last.steps[X_AXIS] = merged_x;
+        last.steps[Y_AXIS] = merged_y;
+        return;
+      }
+    }
+
+    // The scheduler only runs the main ISR while there is room.
+    shaping_queue[shaping_head] = { shaping_clock, 0, { x, y } };
+    shaping_head = (shaping_head + 1) & SHAPING_MASK;
+  }
+
+  uint16 __forceinline __flatten Stepper::echo_isr() {
+    uint32 next = ADV_NEVER;
+    for (uint8 axis = 0; axis < 2; ++axis) {
+      const Tuna::input_shaper & __restrict axis_shaper = shaper[axis];
+      bool idle = true;
+      for (uint8 echo = 0; echo < axis_shaper.echoes; ++echo) {
+        uint8 tail = shaping_tail[axis][echo];
+        uint8 & __restrict echoed = shaping_echoed[axis][echo];
+        const uint32 delay = axis_shaper.delay[echo];
+        const int16 share = axis_shaper.share[echo + 1];
+        while (tail != shaping_head) {
+          const shaping_entry & __restrict entry = shaping_queue[tail];
+          const int8 steps = entry.steps[axis];
+          const uint8 count = (steps < 0) ? -steps : steps;
+          // The steps of an entry echo one at a time over its span, as they were commanded, and not
+          // as a burst: the k-th of n is due span * k / (n - 1) after the first.
+          uint16 offset = 0;
+          if (echoed) offset = uint16((uint32(entry.span) * pgm_read_word(&step_reciprocals[count - 1])) >> 16) * echoed;
+          const int32 due = int32(entry.time + delay + offset - shaping_clock);
+          // An echo due this close is taken now, as the advance ISR does.
+          if (due > ADV_MERGE_TICKS) {
+            NOMORE(next, uint32(due));
+            break;
+          }
+          if (count) {
+            shaping_error[axis] += (steps < 0) ? -share : share;
+            while (shaping_next_step(axis, false)) shaping_pulse(axis);
+            if (++echoed < count) continue;
+            echoed = 0;
+          }
+          tail = (tail + 1) & SHAPING_MASK;
+        }
+        shaping_tail[axis][echo] = tail;
+        if (tail != shaping_head) idle = false;
+      }
+
+      // The last echo is in: back to within half a step.
+      if (idle) while (shaping_next_step(axis, true)) shaping_pulse(axis);
+    }
+    return uint16(next);
+  }
+
+  void Stepper::apply_shaping() {
+    for (uint8 axis = 0; axis < 2; ++axis) {
+      if (shaping_suspended)
+        shaper[axis].disable();
+      else
+        shaper[axis].set(shaping_settings[axis].type, shaping_settings[axis].frequency, shaping_settings[axis].zeta, SHAPING_MERGE_TICKS + ADV_MERGE_TICKS + 1);
+      shaping_tail[axis][0] = shaping_tail[axis][1] = shaping_head;
+      shaping_error[axis] = 0;
+      shaping_echoed[axis][0] = shaping_echoed[axis][1] = 0;
+    }
+  }
+
+  void Stepper::set_shaping(const AxisEnum axis, const shaping_setting &setting) {
+    synchronize();
+    CRITICAL_SECTION_START;
+    shaping_settings[axis] = setting;
+    apply_shaping();
+    CRITICAL_SECTION_END;
+  }
+
+  void Stepper::suspend_shaping(const bool suspend) {
+    synchronize();
+    CRITICAL_SECTION_START;
+    shaping_suspended = suspend;
+    apply_shaping();
+    CRITICAL_SECTION_END;
+  }
+
+#endif // INPUT_SHAPING
+
+#if ENABLED(LIN_ADVANCE)
+
+  #if ENABLED(BATCHED_STEP_PULSES)
+    #define CYCLES_EATEN_E 0
+  #else
+    #define CYCLES_EATEN_E (E_STEPPERS * 5)
+  #endif
+  #define EXTRA_CYCLES_E (STEP_PULSE_CYCLES - (CYCLES_EATEN_E))
+
+  /**
+   * Timer interrupt for the advance offset of E.
+   *
+   * The main ISR steps E along with the other axes; this one only moves the advance offset toward
+   * la_target, one step every la_interval, both of which the planner precomputed. It may run without
+   * a block (the offset of the last one is still being stepped), so it drives E0 directly.
+   */
+  template <bool endstops_enabled> void __forceinline __flatten Stepper::advance_isr()
+  {
+    if (__unlikely(current_adv_steps == la_target)) {
+      nextAdvanceISR = ADV_NEVER;
+      return;
+    }
+
+    const bool forward = la_target > current_adv_steps;
+
+    // E is pointed the way of the block's own E steps; turn it around for this step if need be.
+    const bool turn = (forward == motor_direction(E_AXIS));
+    if (turn) E0_DIR_WRITE(forward ? !INVERT_E0_DIR : INVERT_E0_DIR);
+
+    #if EXTRA_CYCLES_E > 20
+      uint32 pulse_start = TCNT0;
+    #endif
+
+    #if ENABLED(BATCHED_STEP_PULSES)
+      #define ADVANCE_PULSE(INVERT) _STEP_REGISTER(E) = _STEP_MASK(E)
+    #else
+      #define ADVANCE_PULSE(INVERT) E0_STEP_WRITE(INVERT)
+    #endif
+
+    ADVANCE_PULSE(!INVERT_E_STEP_PIN);
+
+    // For minimum pulse time wait before stopping the pulse
+    #if EXTRA_CYCLES_E > 20
+      while (EXTRA_CYCLES_E > (uint32)(TCNT0 - pulse_start) * (INT0_PRESCALER)) { /* nada */ }
+    #elif EXTRA_CYCLES_E > 0
+      DELAY_NOPS(EXTRA_CYCLES_E);
+    #endif
+
+    ADVANCE_PULSE(INVERT_E_STEP_PIN);
+
+    if (turn) E0_DIR_WRITE(forward ? INVERT_E0_DIR : !INVERT_E0_DIR);
+
+    current_adv_steps += forward ? 1 : -1;
+    nextAdvanceISR = (current_adv_steps == la_target) ? ADV_NEVER : la_interval;
   }
 
   template <bool endstops_enabled> void __forceinline __flatten Stepper::advance_isr_scheduler()
   {
+    #if ENABLED(ISR_PROFILING)
+      IsrProfile::stepper_timer _profile;
+    #endif
+
+    // Step the echoes that are due first: they may free the queue room the main ISR needs.
+    #if ENABLED(INPUT_SHAPING)
+      uint16 nextShapingISR = echo_isr();
+    #endif
+
     // Run main stepping ISR if flagged
-    if (!nextMainISR) isr<endstops_enabled>();
-
-    // Run Advance stepping ISR if flagged
-    if (!nextAdvanceISR) advance_isr<endstops_enabled>();
-
-    // Is the next advance ISR scheduled before the next main ISR?
-    if (nextAdvanceISR <= nextMainISR) {
-      // Set up the next interrupt
-      OCR1A = nextAdvanceISR;
-      // New interval for the next main ISR
-      if (nextMainISR) nextMainISR -= nextAdvanceISR;
-      // Will call Stepper::advance_isr on the next interrupt
-      nextAdvanceISR = 0;
+    if (!nextMainISR)
+    {
+      #if ENABLED(INPUT_SHAPING)
+        // No room to queue its steps: try again with the next echo.
+        if (__unlikely(shaping_count() >= SHAPING_BUFFER_SIZE - 1)) {
+          nextMainISR = nextShapingISR;
+        }
+        else
+      #endif
+      {
+        isr<endstops_enabled>();
+        #if ENABLED(INPUT_SHAPING)
+          // Its steps may have an echo due before any other.
+          nextShapingISR = echo_isr();
+        #endif
+      }
+      #if ENABLED(ISR_PROFILING)
+        _profile.main_lap();
+      #endif
     }
-    else {
-      // The next main ISR comes first
-      OCR1A = nextMainISR;
-      // New interval for the next advance ISR, if any
-      if (nextAdvanceISR && nextAdvanceISR != ADV_NEVER)
-        nextAdvanceISR -= nextMainISR;
-      // Will call Stepper::isr on the next interrupt
-      nextMainISR = 0;
+
+    // Run Advance stepping ISR if flagged, or if it is due too soon to get an interrupt of its own
+    if (nextAdvanceISR <= ADV_MERGE_TICKS)
+    {
+      advance_isr<endstops_enabled>();
+      #if ENABLED(ISR_PROFILING)
+        _profile.advance_lap();
+      #endif
     }
 
+    // Is the next advance ISR (or echo) scheduled before the next main ISR? If it would come only just
+    // before it, it runs right after it instead, in the same interrupt: an interrupt that close to the
+    // next one would be pushed back by the clamp below, and the main ISR with it.
+    uint16 interval = nextMainISR;
+    if (nextAdvanceISR < interval && interval - nextAdvanceISR > ADV_MERGE_TICKS) interval = nextAdvanceISR;
+    #if ENABLED(INPUT_SHAPING)
+      // Echoes are found by their time, on shaping_clock, so they need no countdown of their own.
+      if (nextShapingISR < interval && interval - nextShapingISR > ADV_MERGE_TICKS) interval = nextShapingISR;
+    #endif
+
+    // Set up the next interrupt
+    OCR1A = interval;
+    // New intervals for the next main ISR, and the next advance ISR, if any; at 0, they run on the next interrupt
+    nextMainISR = (nextMainISR > interval) ? nextMainISR - interval : 0;
+    if (nextAdvanceISR != ADV_NEVER)
+      nextAdvanceISR = (nextAdvanceISR > interval) ? nextAdvanceISR - interval : 0;
+
     // Don't run the ISR faster than possible
-    NOLESS(OCR1A, TCNT1 + 16);
+    #if ENABLED(ISR_PROFILING) || ENABLED(STEP_RECORDING)
+      const uint16 min_ocr = TCNT1 + 16;
+      if (OCR1A < min_ocr)
+      {
+        OCR1A = min_ocr;
+        #if ENABLED(ISR_PROFILING)
+          IsrProfile::clamp();
+        #endif
+        #if ENABLED(STEP_RECORDING)
+          StepRecord::clamp_hit();
+        #endif
+      }
+    #else
+      NOLESS(OCR1A, TCNT1 + 16);
+    #endif
+
+    #if ENABLED(INPUT_SHAPING)
+      // Timer1 matches OCR1A + 1 ticks after this interrupt's match.
+      shaping_clock += uint32(OCR1A) + 1;
+    #endif
   }
 
 #endif // LIN_ADVANCE
 
+#if ENABLED(STEPPER_RAMP_TABLES)
+
+  /**
+   * Precompute the ramp table of the next block to be traced: the block after the busy one,
+   * or the first block if none is busy yet.
+   *
+   * The entries are made by the same calculation as Stepper::isr, in the same order, so a
+   * block is traced identically with or without its table. The acceleration ramp is followed
+   * ISR by ISR (up to 255 of them), keeping its last RAMP_TABLE_LENGTH entries, where the
+   * step rate is highest. That also gives the rate deceleration starts from, and the first
+   * RAMP_TABLE_LENGTH entries of the deceleration ramp follow from it.
+   *
+   * This costs the main loop what it saves the ISR, so the planner only calls it while it
+   * waits for room in a full buffer.
+   *
+   * Only the planner changes a trapezoid, and it clears BLOCK_BIT_RAMP_TABLE when it does.
+   * The table is for the next block the ISR picks up, and the bit is only set while the ISR
+   * has not yet, so the ISR never sees a table change under it.
+   */
+  void Stepper::prepare_ramp_table() {
+    static_assert(RAMP_TABLE_LENGTH > 0 && RAMP_TABLE_LENGTH <= 128 && (RAMP_TABLE_LENGTH & (RAMP_TABLE_LENGTH - 1)) == 0, "RAMP_TABLE_LENGTH must be a power of 2, up to 128");
+
+    const uint8 index = planner.block_buffer_nonbusy;
+    if (index == planner.block_buffer_head) return;
+    const block_t * __restrict block = &planner.block_buffer[index];
+    // A block still to be recalculated could not be picked up yet anyway. An arc stretches
+    // its intervals as it goes, so its ramps are left to the ISR.
+    if ((block->sequence & 1) || (block->flag & (BLOCK_FLAG_RAMP_TABLE | BLOCK_FLAG_RECALCULATE | BLOCK_FLAG_ARC))) return;
+
+    // The table of the block the ISR has is the other one.
+    ramp_table & __restrict table = ramp_tables[index & 1];
+
+    uint8 loops;
+    table.nominal_timer = step_timer(block->nominal_rate, loops);
+    table.nominal_step_loops = loops;
+    table.initial_timer = step_timer(block->initial_rate, loops);
+    table.initial_step_loops = loops;
+
+    // Follow the ISR through the acceleration ramp.
+    const uint24 step_event_count = block->step_event_count;
+    uint24 step_events = 0;
+    decltype(acceleration_time) accel_time = table.initial_timer;
+    uint16 start_rate = block->initial_rate; // acc_step_rate
+    uint8 accel_isrs = 0;
+    bool decel_known = false;
+    for (;;) {
+      step_events = min(step_events + loops, step_event_count);
+      if (step_events > block->accelerate_until) {
+        if (step_events <= block->decelerate_after) {
+          // Cruising sets acc_step_rate to nominal.
+          start_rate = block->nominal_rate;
+        }
+        decel_known = true;
+        break;
+      }
+      if (accel_isrs == type_trait<uint8>::max) {
+        // The rest of the ramp is left to the ISR. At most 8 steps are taken per ISR, so a
+        // longer plateau is always cruised before deceleration.
+        if (block->decelerate_after >= block->accelerate_until + 8) {
+          start_rate = block->nominal_rate;
+          decel_known = true;
+        }
+        break;
+      }
+      start_rate = acceleration_step_rate(block, accel_time);
+      const uint16 timer = step_timer(start_rate, loops);
+      table.accel[accel_isrs++ & (RAMP_TABLE_LENGTH - 1)] = { start_rate, timer, loops };
+      accel_time += timer;
+      if (step_events == step_event_count) break;
+    }
+    const uint8 accel_count = min(accel_isrs, uint8(RAMP_TABLE_LENGTH));
+
+    // There can be no more deceleration ISRs than steps in the deceleration.
+    uint8 decel_count = 0;
+    if (decel_known) {
+      const uint24 decel_steps = step_event_count - min(block->decelerate_after, step_event_count);
+      const uint8 decel_limit = uint8(min(decel_steps, uint24(RAMP_TABLE_LENGTH)));
+      decltype(deceleration_time) decel_time = 0;
+      while (decel_count < decel_limit) {
+        const uint16 step_rate = deceleration_step_rate(block, decel_time, start_rate);
+        const uint16 timer = step_timer(step_rate, loops);
+        table.decel[decel_count++] = { step_rate, timer, loops };
+        decel_time += timer;
+      }
+    }
+
+    table.accel_first = accel_isrs - accel_count;
+    table.accel_count = accel_count;
+    table.decel_count = decel_count;
+    // The ISR only looks at the bit as it picks the block up: if it just has, the table goes unused.
+    __memorybarrier;
+    if (planner.block_buffer_nonbusy == index)
+      SBI(as<block_t * __restrict>(block)->flag, BLOCK_BIT_RAMP_TABLE);
+  }
+
+#endif // STEPPER_RAMP_TABLES
+
+#if ENABLED(STEPPER_RAMP_CACHE)
+
+  /**
+   * The cache slot of the ramp from start_rate at acceleration_rate, calculating it into the
+   * least recently used slot not in keep (a bit per slot) if it is missing. The entries are
+   * made by the same calculation as Stepper::isr, without the limit of a block's nominal
+   * (or final) rate: the ISR leaves the ramp where that would apply.
+   */
+  uint8 Stepper::find_ramp(const uint24 acceleration_rate, const uint16 start_rate, const bool decelerate, const uint8 keep) {
+    ++ramp_stats.lookups;
+    const uint16 now = ++ramp_clock;
+
+    uint8 victim = RAMP_SLOT_NONE;
+    uint16 victim_age = 0;
+    for (uint8 s = 0; s < RAMP_CACHE_SIZE; ++s) {
+      cached_ramp & __restrict ramp = ramp_cache[s];
+      if (ramp.acceleration_rate == acceleration_rate && ramp.start_rate == start_rate && ramp.decelerate == decelerate) {
+        ++ramp_stats.hits;
+        ramp.used = now;
+        return s;
+      }
+      if (TEST(keep, s)) continue;
+      const uint16 age = ramp.acceleration_rate ? uint16(now - ramp.used) : type_trait<uint16>::max;
+      if (victim == RAMP_SLOT_NONE || age > victim_age) {
+        victim = s;
+        victim_age = age;
+      }
+    }
+
+    cached_ramp & __restrict ramp = ramp_cache[victim];
+    ramp.acceleration_rate = acceleration_rate;
+    ramp.start_rate = start_rate;
+    ramp.decelerate = decelerate;
+    ramp.used = now;
+    uint8 loops;
+    ramp.start_timer = step_timer(start_rate, loops);
+    ramp.start_step_loops = loops;
+
+    uint8 length = 0;
+    if (decelerate) {
+      decltype(deceleration_time) decel_time = 0;
+      while (length < RAMP_CACHE_LENGTH) {
+        const uint16 drop = MultiU24X24toH16(decel_time, acceleration_rate);
+        if (drop >= start_rate) break; // At the final rate from here on, whatever it is
+        const uint16 step_rate = start_rate - drop;
+        const uint16 timer = step_timer(step_rate, loops);
+        ramp.entries[length++] = { step_rate, timer, loops };
+        decel_time += timer;
+      }
+    }
+    else {
+      decltype(acceleration_time) accel_time = ramp.start_timer;
+      while (length < RAMP_CACHE_LENGTH) {
+        uint16 step_rate = MultiU24X24toH16(accel_time, acceleration_rate);
+        step_rate += start_rate;
+        const uint16 timer = step_timer(step_rate, loops);
+        ramp.entries[length++] = { step_rate, timer, loops };
+        accel_time += timer;
+      }
+    }
+    ramp.length = length;
+    return victim;
+  }
+
+  /**
+   * Look up (or calculate) the cached ramps of the next block to be traced: the block after
+   * the busy one, or the first block if none is busy yet.
+   *
+   * Its acceleration ramp is keyed by its initial rate. A deceleration ramp is only looked
+   * up for a block that cruises for at least 8 steps first (the most an ISR takes at once),
+   * as it then starts from the nominal rate.
+   *
+   * Like the ramp tables, this costs the main loop what it saves the ISR, so the planner
+   * only calls it while it waits for room in a full buffer.
+   *
+   * The ISR may be tracing the ramps of the block it picked up last, so those are never
+   * replaced. The bit is only set while the ISR has not picked the block up, so its ramps
+   * stay cached until the block after it is.
+   */
+  void Stepper::prepare_ramp_table() {
+    const uint8 index = planner.block_buffer_nonbusy;
+    if (index == planner.block_buffer_head) return;
+    const block_t * __restrict block = &planner.block_buffer[index];
+    // An arc stretches its intervals as it goes, so its ramps are left to the ISR.
+    if ((block->sequence & 1) || (block->flag & (BLOCK_FLAG_RAMP_TABLE | BLOCK_FLAG_RECALCULATE | BLOCK_FLAG_ARC))) return;
+
+    const block_t * __restrict previous = &planner.block_buffer[BLOCK_MOD(index + BLOCK_BUFFER_SIZE - 1)];
+    uint8 keep = 0;
+    if (TEST(previous->flag, BLOCK_BIT_RAMP_TABLE)) {
+      const uint8 slots = previous->ramp_slots;
+      if ((slots & 0xF) != RAMP_SLOT_NONE) SBI(keep, slots & 0xF);
+      if ((slots >> 4) != RAMP_SLOT_NONE) SBI(keep, slots >> 4);
+    }
+
+    uint8 accel_slot = RAMP_SLOT_NONE, decel_slot = RAMP_SLOT_NONE;
+    if (block->acceleration_rate != 0 && block->initial_rate < block->nominal_rate && block->nominal_rate <= type_trait<uint16>::max) {
+      accel_slot = find_ramp(block->acceleration_rate, uint16(block->initial_rate), false, keep);
+      SBI(keep, accel_slot);
+    }
+    if (block->acceleration_rate != 0 && block->final_rate < block->nominal_rate && block->nominal_rate <= type_trait<uint16>::max
+      && block->decelerate_after >= block->accelerate_until + 8 && block->decelerate_after < block->step_event_count) {
+      decel_slot = find_ramp(block->acceleration_rate, uint16(block->nominal_rate), true, keep);
+    }
+    if (accel_slot == RAMP_SLOT_NONE && decel_slot == RAMP_SLOT_NONE) return;
+
+    as<block_t * __restrict>(block)->ramp_slots = accel_slot | (decel_slot << 4);
+    // The ISR only looks at the bit as it picks the block up: if it just has, the ramps go unused.
+    __memorybarrier;
+    if (planner.block_buffer_nonbusy == index)
+      SBI(as<block_t * __restrict>(block)->flag, BLOCK_BIT_RAMP_TABLE);
+  }
+
+#endif // STEPPER_RAMP_CACHE
+
 void Stepper::init() {
 
   // Init Digipot Motor Current
@@ -808,21 +1941,39 @@ void Stepper::init() {
   ENABLE_STEPPER_DRIVER_INTERRUPT();
 
   #if ENABLED(LIN_ADVANCE)
-    for (uint8_t i = 0; i < COUNT(e_steps); i++) e_steps[i] = 0;
-      ZERO(current_adv_steps);
+    current_adv_steps = la_target = 0;
   #endif // LIN_ADVANCE
 
+  #if ENABLED(INPUT_SHAPING)
+    apply_shaping();
+  #endif
+
   endstops.enable(true); // Start with endstops active. After homing they can be disabled
   Tuna::intrinsic::sei();
 
   set_directions(); // Init directions to last_direction_bits = 0
+
+  #if ENABLED(INPUT_SHAPING)
+    // As shaping_direction = 0
+    X_APPLY_DIR(!INVERT_X_DIR, false);
+    Y_APPLY_DIR(!INVERT_Y_DIR, false);
+  #endif
 }
 
 
 /**
  * Block until all buffered steps are executed
  */
-void __forceinline Stepper::synchronize() { while (planner.blocks_queued()) idle(); }
+void __forceinline Stepper::synchronize() {
+  #if ENABLED(SEGMENT_MERGING)
+    planner.flush_merged();
+  #endif
+  while (planner.blocks_queued()) idle();
+  #if ENABLED(INPUT_SHAPING)
+    // X and Y are not there until their last echoes are.
+    while (shaping_pending()) idle();
+  #endif
+}
 
 /**
  * Set the stepper positions directly in steps
@@ -921,9 +2072,15 @@ void Stepper::finish_and_disable() {
 
 void Stepper::quick_stop() {
   cleaning_buffer_counter = 5000;
+  #if ENABLED(SEGMENT_MERGING)
+    planner.discard_merged();
+  #endif
   DISABLE_STEPPER_DRIVER_INTERRUPT();
   while (planner.blocks_queued()) planner.discard_current_block();
   current_block = nullptr;
+  #if ENABLED(INPUT_SHAPING)
+    apply_shaping(); // Drop the echoes
+  #endif
   ENABLE_STEPPER_DRIVER_INTERRUPT();
   #if ENABLED(ULTRA_LCD)
     planner.clear_block_buffer_runtime();
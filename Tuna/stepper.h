@@ -48,6 +48,8 @@
 #include "stepper_indirection.h"
 #include "language.h"
 #include "types.h"
+#include "arc_tracer.hpp"
+#include "input_shaper.hpp"
 
 class Stepper;
 extern Stepper stepper;
@@ -68,14 +70,15 @@ class Stepper final {
     static uint24 step_events_completed; // The number of step events executed in the current block
 
     #if ENABLED(LIN_ADVANCE)
-      static uint16_t nextMainISR, nextAdvanceISR, eISR_Rate;
+      static constexpr const uint16 ADV_NEVER = 65535;
+      static constexpr const uint16 ADV_MERGE_TICKS = 64; // An advance step due this close to a main ISR is taken with it
+      static uint16_t nextMainISR, nextAdvanceISR;
       #define _NEXT_ISR(T) nextMainISR = T
-      static volatile int e_steps[E_STEPPERS];
-      static int final_estep_rate;
-      static int current_estep_rate[E_STEPPERS]; // Actual extruder speed [steps/s]
-      static int current_adv_steps[E_STEPPERS];  // The amount of current added esteps due to advance.
-                                                  // i.e., the current amount of pressure applied
-                                                  // to the spring (=filament).
+      static int16 current_adv_steps;    // The advance offset stepped so far, in E steps,
+                                         // i.e., the current amount of pressure applied
+                                         // to the spring (=filament).
+      static int16 la_target;            // The offset the advance ISR is stepping toward
+      static uint16 la_interval;         // Timer1 ticks between its steps
     #else
       #define _NEXT_ISR(T) OCR1A = T
     #endif // ADVANCE or LIN_ADVANCE
@@ -86,6 +89,99 @@ class Stepper final {
     static uint8_t step_loops, step_loops_nominal;
     static unsigned short OCR1A_nominal;
 
+    #if ENABLED(STEPPER_RAMP_TABLES) || ENABLED(STEPPER_RAMP_CACHE)
+      // One precomputed stepper ISR of an acceleration or deceleration ramp.
+      struct ramp_entry final {
+        uint16 step_rate;
+        uint16 timer;
+        uint8 step_loops;
+      };
+
+      static uint8 accel_step_index, decel_step_index; // Counted up to 255
+    #endif
+
+    #if ENABLED(STEPPER_RAMP_TABLES)
+      // The fastest part of the ramps of one block, precomputed by prepare_ramp_table while the block waits in the
+      // queue: acceleration ISRs accel_first to accel_first + accel_count - 1, kept modulo RAMP_TABLE_LENGTH, and the
+      // first decel_count deceleration ISRs. For the others, the ISR calculates the rate itself.
+      struct ramp_table final {
+        uint16 initial_timer, nominal_timer;
+        uint8 initial_step_loops, nominal_step_loops;
+        uint8 accel_first, accel_count, decel_count;
+        ramp_entry accel[RAMP_TABLE_LENGTH], decel[RAMP_TABLE_LENGTH];
+      };
+
+      // One for the block being traced and one for the block after it, indexed by the block's buffer index.
+      static ramp_table ramp_tables[2];
+      static const ramp_table * __restrict current_ramp; // nullptr if the current block has no table
+    #endif
+
+    #if ENABLED(STEPPER_RAMP_CACHE)
+      static constexpr const uint8 RAMP_SLOT_NONE = 0xF;
+
+      // The first ISRs of a ramp from start_rate at acceleration_rate, as long as no block's nominal rate (or final
+      // rate, decelerating) limits it; a block only follows it until it does. Free while acceleration_rate is 0.
+      struct cached_ramp final {
+        uint24 acceleration_rate;
+        uint16 start_rate;
+        uint16 start_timer;               // The interval at start_rate, and its step loops
+        uint16 used;                      // ramp_clock when last looked up
+        uint8 start_step_loops;
+        uint8 length;
+        bool decelerate;
+        ramp_entry entries[RAMP_CACHE_LENGTH];
+      };
+
+      static cached_ramp ramp_cache[RAMP_CACHE_SIZE];
+      static uint16 ramp_clock;
+      static const cached_ramp * __restrict current_accel_ramp, * __restrict current_decel_ramp; // nullptr once left
+
+      static uint8 find_ramp(const uint24 acceleration_rate, const uint16 start_rate, const bool decelerate, const uint8 keep);
+    #endif
+
+    #if ENABLED(NATIVE_ARCS)
+      static Tuna::arc_tracer arc;        // The arc being traced, if the current block is one
+      static int24 arc_increment[2][2];   // Bresenham increments of Z and E, for a straight and a diagonal event
+      static uint8 arc_diagonals;         // Diagonal events traced since the last interval was set
+    #endif
+
+    #if ENABLED(MULTI_RATE_STEPPING)
+      // Steps of the axes that do not step on every event, scheduled within the current event interval.
+      struct axis_steps final {
+        uint16 offset;                    // Timer1 ticks after the event
+        uint8 axes;                       // Bits of the axes that step
+      };
+      static axis_steps pending[XYZE - 1];  // In order of offset
+      static uint8 pending_count, pending_next;
+      static uint16 event_interval;       // Timer1 ticks from the current event to the next one
+      static uint16 group_interval, group_last_interval; // Intervals of the events of the current ramp group
+      static uint8 group_events;          // Events left in the current ramp group
+      static uint8 step_shift[XYZE];      // steps[axis] >> step_shift fits in 8 bits...
+      static uint16 step_recip[XYZE];     // ... and this is 65535 divided by it
+    #endif
+
+    #if ENABLED(INPUT_SHAPING)
+      // The X and Y steps of one interrupt, or of a few close together, waiting for their echoes.
+      struct shaping_entry final {
+        uint32 time;                      // On shaping_clock
+        uint16 span;                      // Ticks from its first commanded steps to its last
+        int8 steps[2];                    // Commanded steps of X and Y, signed
+      };
+      static constexpr const uint8 SHAPING_MASK = SHAPING_BUFFER_SIZE - 1;
+      static constexpr const int8 SHAPING_ENTRY_STEPS = 100; // Most steps of an axis merged into one entry
+
+      static Tuna::input_shaper shaper[2];          // In use by the ISR, for X and Y
+      static shaping_entry shaping_queue[SHAPING_BUFFER_SIZE];
+      static uint8 shaping_head;                    // Next free entry
+      static volatile uint8 shaping_tail[2][2];     // Next entry each echo of X and Y is due for
+      static uint8 shaping_echoed[2][2];            // Steps of that entry echoed so far
+      static int16 shaping_error[2];                // Shaped position less the motor position, in 1/256 steps
+      static int8 shaping_steps[2];                 // Commanded in the current interrupt, not queued yet
+      static uint8 shaping_direction;               // Motor directions of X and Y, as last_direction_bits
+      static uint32 shaping_clock;                  // Timer1 ticks; the time of the current interrupt
+      static bool shaping_suspended;
+    #endif
+
     static volatile int24 endstops_trigsteps[XYZ];
     static volatile int24 endstops_stepsTotal, endstops_stepsDone;
 
@@ -127,11 +223,51 @@ class Stepper final {
 
     template <bool endstops_enabled> static void __forceinline __flatten isr();
 
+    #if ENABLED(STEPPER_RAMP_TABLES) || ENABLED(STEPPER_RAMP_CACHE)
+      //
+      // Precompute the ramps of the next block to be traced. Called by the planner.
+      //
+      static void prepare_ramp_table();
+    #endif
+
+    #if ENABLED(STEPPER_RAMP_CACHE)
+      // Ramp lookups by prepare_ramp_table and how many found their ramp cached, and the ramp updates of the ISR
+      // loaded from the cache or calculated. (M934)
+      struct ramp_cache_stats final {
+        uint32 lookups, hits, loaded, calculated;
+      };
+      static ramp_cache_stats ramp_stats;
+    #endif
+
     #if ENABLED(LIN_ADVANCE)
     template <bool endstops_enabled> static void __forceinline __flatten advance_isr();
     template <bool endstops_enabled> static void __forceinline __flatten advance_isr_scheduler();
     #endif
 
+    #if ENABLED(INPUT_SHAPING)
+      struct shaping_setting final {
+        Tuna::shaper_type type;
+        float frequency;                  // Hz; 0 if the axis is not shaped
+        float zeta;                       // Damping ratio
+      };
+
+      //
+      // Set the shaper of X or Y, once the moves queued before have finished
+      //
+      static void set_shaping(const AxisEnum axis, const shaping_setting &setting);
+      static inline const shaping_setting & __forceinline get_shaping(const AxisEnum axis) { return shaping_settings[axis]; }
+
+      //
+      // Suspend shaping (while homing) or resume it, once the moves queued before have finished
+      //
+      static void suspend_shaping(const bool suspend);
+
+      //
+      // Are any echoes of X or Y still to come?
+      //
+      static bool shaping_pending();
+    #endif
+
     //
     // Block until all buffered steps are executed
     //
@@ -209,6 +345,11 @@ class Stepper final {
 
     static inline void __forceinline __flatten kill_current_block() {
       step_events_completed = current_block->step_event_count;
+      #if ENABLED(STEPPER_RAMP_TABLES)
+        current_ramp = nullptr; // The block no longer follows its planned ramps.
+      #elif ENABLED(STEPPER_RAMP_CACHE)
+        current_accel_ramp = current_decel_ramp = nullptr;
+      #endif
     }
 
     //
@@ -225,8 +366,68 @@ class Stepper final {
 
   private:
 
-    static inline unsigned __forceinline __flatten short calc_timer(uint16/*24*/ step_rate) {
-      unsigned short timer;
+    #if ENABLED(INPUT_SHAPING)
+      static shaping_setting shaping_settings[2];
+
+      // Load the shapers from the settings, and drop any echoes: the motors stay where they are,
+      // rather than settle later to a shaped position that is no longer coming. The ISR must be idle.
+      static void apply_shaping();
+
+      // Entries of the queue still waiting for an echo.
+      static inline uint8 __forceinline __flatten shaping_count();
+
+      // Command a step of X or Y in its count_direction, and take its first share. True if the motor steps now.
+      static inline bool __forceinline __flatten shaping_command(const uint8 axis);
+
+      // Turn X or Y around if need be for a step that way, and count it.
+      static inline void __forceinline __flatten shaping_step(const uint8 axis, const bool negative);
+
+      // If X or Y is far enough from its shaped position, turn it if need be and count a step toward it; the caller
+      // pulses it. With settle, it turns back within half a step, as when it steps on.
+      static inline bool __forceinline __flatten shaping_next_step(const uint8 axis, const bool settle);
+
+      // Pulse X or Y on its own, waiting out the pulse and the gap after it.
+      static inline void __forceinline __flatten shaping_pulse(const uint8 axis);
+
+      // Queue the steps commanded by this interrupt for their echoes.
+      static inline void __forceinline __flatten queue_echoes();
+
+      // Step the echoes that are due, and return the Timer1 ticks to the next one (ADV_NEVER if none).
+      static inline uint16 __forceinline __flatten echo_isr();
+    #endif
+
+    #if ENABLED(NATIVE_ARCS)
+      // Trace one step event of an arc block, waiting out the step pulse after it if more events follow.
+      static void __forceinline __flatten arc_event(const bool more);
+
+      // A diagonal arc event covers sqrt(2) steps of path, so the interval after it is stretched to match.
+      static inline uint16 __forceinline __flatten arc_interval(const uint16 timer, const uint8 loops) {
+        if (__likely(arc_diagonals == 0)) return timer;
+        // timer * 0.414 for each diagonal event, averaged over the events of the interval.
+        uint32 extra = uint32((timer >> 2) + (timer >> 3) + (timer >> 5) + (timer >> 7)) * arc_diagonals;
+        for (uint8 l = loops; l > 1; l >>= 1) extra >>= 1;
+        arc_diagonals = 0;
+        return uint16(min(timer + extra, uint32(type_trait<uint16>::max)));
+      }
+    #endif
+
+    #if ENABLED(MULTI_RATE_STEPPING)
+      // Trace one step event of a line block: pulse the axes that step right at it, and return the others...
+      static uint8 __forceinline __flatten line_event();
+
+      // ... to be queued within event_interval.
+      static void __forceinline __flatten queue_steps(const uint8 later);
+
+      // Pulse some axes (bits of AxisEnum) together.
+      static void __forceinline __flatten pulse_axes(const uint8 axes);
+    #endif
+
+    static inline unsigned __forceinline __flatten short calc_timer(const uint16/*24*/ step_rate) {
+      return step_timer(step_rate, step_loops);
+    }
+
+    // The timer interval and step loops for a step rate, without touching the ISR's state.
+    static inline unsigned __forceinline __flatten short step_timer(uint16/*24*/ step_rate, uint8_t & __restrict loops) {
 
       NOMORE(step_rate, MAX_STEP_FREQUENCY);
 
@@ -234,18 +435,18 @@ class Stepper final {
 
       if (step_rate > 40000) { // If steprate > 40kHz >> step 8 times
         step_rate >>= 3;
-        step_loops = 8;
+        loops = 8;
       }
       else if (step_rate > 20000) { // If steprate > 20kHz >> step 4 times
         step_rate >>= 2;
-        step_loops = 4;
+        loops = 4;
       }
       else if (step_rate > 10000) { // If steprate > 10kHz >> step 2 times
         step_rate >>= 1;
-        step_loops = 2;
+        loops = 2;
       }
       else {
-        step_loops = 1;
+        loops = 1;
       }
 
       //while (step_rate > 20'000)
@@ -289,18 +490,62 @@ class Stepper final {
       }
 
       deceleration_time = 0;
-      // step_rate to timer interval
-      OCR1A_nominal = calc_timer(current_block->nominal_rate);
-      // make a note of the number of step loops required at nominal speed
-      step_loops_nominal = step_loops;
       acc_step_rate = current_block->initial_rate;
-      acceleration_time = calc_timer(acc_step_rate);
+      #if ENABLED(STEPPER_RAMP_TABLES)
+        // The planner only sets the flag while the block is not busy, so it cannot change from here on.
+        current_ramp = TEST(current_block->flag, BLOCK_BIT_RAMP_TABLE) ? &ramp_tables[planner.block_buffer_tail & 1] : nullptr;
+        accel_step_index = decel_step_index = 0;
+        if (current_ramp) {
+          OCR1A_nominal = current_ramp->nominal_timer;
+          step_loops_nominal = current_ramp->nominal_step_loops;
+          acceleration_time = current_ramp->initial_timer;
+          step_loops = current_ramp->initial_step_loops;
+        }
+        else
+      #endif
+      #if ENABLED(STEPPER_RAMP_CACHE)
+        // The planner only sets the flag while the block is not busy, and then keeps its ramps cached until the
+        // block after it is picked up.
+        current_accel_ramp = current_decel_ramp = nullptr;
+        accel_step_index = decel_step_index = 0;
+        if (TEST(current_block->flag, BLOCK_BIT_RAMP_TABLE)) {
+          const uint8 slots = current_block->ramp_slots;
+          if ((slots & 0xF) != RAMP_SLOT_NONE) current_accel_ramp = &ramp_cache[slots & 0xF];
+          // A deceleration ramp is only cached from the nominal rate.
+          if ((slots >> 4) != RAMP_SLOT_NONE) current_decel_ramp = &ramp_cache[slots >> 4];
+        }
+        if (current_decel_ramp) {
+          OCR1A_nominal = current_decel_ramp->start_timer;
+          step_loops_nominal = current_decel_ramp->start_step_loops;
+        }
+        else {
+          OCR1A_nominal = calc_timer(current_block->nominal_rate);
+          step_loops_nominal = step_loops;
+        }
+        if (current_accel_ramp) {
+          acceleration_time = current_accel_ramp->start_timer;
+          step_loops = current_accel_ramp->start_step_loops;
+        }
+        else {
+          acceleration_time = calc_timer(acc_step_rate);
+        }
+      #else
+      {
+        // step_rate to timer interval
+        OCR1A_nominal = calc_timer(current_block->nominal_rate);
+        // make a note of the number of step loops required at nominal speed
+        step_loops_nominal = step_loops;
+        acceleration_time = calc_timer(acc_step_rate);
+      }
+      #endif
       _NEXT_ISR(acceleration_time);
 
       #if ENABLED(LIN_ADVANCE)
+        // Accelerating (or already cruising): head for the offset at the top of the trapezoid. Whatever offset the
+        // previous blocks left is taken from there, rather than made up in a burst.
         if (current_block->use_advance_lead) {
-          current_estep_rate[current_block->active_extruder] = ((unsigned long)acc_step_rate * current_block->abs_adv_steps_multiplier8) >> 17;
-          final_estep_rate = (current_block->nominal_rate * current_block->abs_adv_steps_multiplier8) >> 17;
+          la_interval = current_block->la_interval;
+          set_advance_target(current_block->la_cruise_steps);
         }
       #endif
 
@@ -315,6 +560,14 @@ class Stepper final {
       // SERIAL_ECHOLN(current_block->final_advance/256.0);
     }
 
+    #if ENABLED(LIN_ADVANCE)
+      // Point the advance ISR at a new offset, and wake it up if it was idle.
+      static inline __forceinline __flatten void set_advance_target(const int16 target) {
+        la_target = target;
+        if (nextAdvanceISR == ADV_NEVER && target != current_adv_steps) nextAdvanceISR = la_interval;
+      }
+    #endif
+
     #if HAS_DIGIPOTSS
       static void digipot_init();
     #endif
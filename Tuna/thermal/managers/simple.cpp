@@ -16,19 +16,30 @@ using namespace Tuna::Thermal::Manager;
 // TODO Establish a global logging system like this.
 namespace Tuna::Log
 {
+#if ENABLED(SERIAL_TX_LANES)
+  // Set while a command's own output goes through the log, as calibrate's report does.
+  bool reporting = false;
+#endif
+
   template <uint8 tabs = 0, typename ...Args>
   inline void d(arg_type<flash_string> tag, arg_type<flash_string> format, Args... args)
   {
+#if ENABLED(SERIAL_TX_LANES)
+    // Dropped, a line at a time, if the debug lane is full; never waits for the port. A command's report is longer
+    // than the debug lane holds, and goes out on the protocol lane, in order with the rest of its output.
+    SerialTx::scope _serial_lane(reporting ? SerialTx::lane::protocol : SerialTx::lane::debug);
+#else
     critical_section log_critsec;
-    Serial.print(tag.fsh());
-    Serial.print(": "_p.fsh());
+#endif
+    MYSERIAL.print(tag.fsh());
+    MYSERIAL.print(": "_p.fsh());
     for (uint8 i = 0; i < tabs; ++i)
     {
-      Serial.print("  "_p.fsh());
+      MYSERIAL.print("  "_p.fsh());
     }
     char buffer[128];
     sprintf_P(buffer, format.c_str(), args...);
-    Serial.println(buffer);
+    MYSERIAL.println(buffer);
   }
 }
 
@@ -376,6 +387,9 @@ namespace
 
 bool Simple::calibrate(arg_type<temp_t> target)
 {
+#if ENABLED(SERIAL_TX_LANES)
+  Log::reporting = true;
+#endif
   Log::d(Tag, "Starting Calibration"_p);
 
   constexpr const exponent_t test_exponents[] =
@@ -462,6 +476,9 @@ bool Simple::calibrate(arg_type<temp_t> target)
 
   settings.save();
 
+#if ENABLED(SERIAL_TX_LANES)
+  Log::reporting = false;
+#endif
   return true;
 }
 
@@ -30,6 +30,7 @@
 #include "planner.h"
 #include "configuration_store.h"
 #include "watchdog.h"
+#include "isr_profile.hpp"
 
 #define ENABLE_ERROR_1A 0
 #define ENABLE_ERROR_1B 0
@@ -671,9 +672,14 @@ inline void __forceinline __flatten set_pin(bool state)
 *  - Check new temperature values for MIN/MAX errors (kill on error)
 *  - Step the babysteps value for each axis towards 0
 *  - For PINS_DEBUGGING, monitor and report endstop pins
-*  - For ENDSTOP_INTERRUPTS_FEATURE check endstops if flagged
 */
-__signal(TIMER0_COMPB) { Temperature::isr(); }
+__signal(TIMER0_COMPB)
+{
+  #if ENABLED(ISR_PROFILING)
+    IsrProfile::temperature_timer _profile;
+  #endif
+  Temperature::isr();
+}
 
 template <typename T, uint8 count>
 class running_average final
@@ -106,7 +106,10 @@ namespace Tuna::Thermistor
     {
       return current_best;
     }
-    return table_search<functor, i + 1, end>(predicate, current_best);
+    else
+    {
+      return table_search<functor, i + 1, end>(predicate, current_best);
+    }
   }
 
   constexpr const auto max_adc_uncast = table_search([](auto &pair, auto best) {
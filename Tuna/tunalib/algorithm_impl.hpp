@@ -3,7 +3,7 @@
 namespace Tuna
 {
   // Simple static-cast like routine. Also makes extracting sub-types easier from encapsulations like 'flash'.
-  template <typename T = void, typename U>
+  template <typename T, typename U>
   constexpr inline __forceinline __flatten auto as(arg_type<U> value)
   {
     if constexpr (is_same<T, void>)
@@ -0,0 +1,58 @@
+#pragma once
+
+// Host builds (the motion simulator). The simulator can preempt the main loop with an interrupt, but only while the I
+// bit of its SREG is set, so sei and cli set and clear it. As avr-libc's do, they are also compiler barriers: nothing
+// a critical section covers is moved out of it. The AVR-specific arithmetic builtins are expressed in plain C++.
+
+// Get rid of any macros that someone already may have defined.
+#undef cli
+#undef sei
+
+extern volatile unsigned char SREG;
+
+namespace Tuna::intrinsic
+{
+  inline __forceinline __flatten void sei() { __memorybarrier; SREG |= 0x80; }
+
+  inline __forceinline __flatten void cli() { SREG &= ~0x80; __memorybarrier; }
+
+  constexpr inline __forceinline __flatten void nop() {}
+
+  constexpr inline __forceinline __flatten void sleep() {}
+
+  constexpr inline __forceinline __flatten void wdr() {}
+
+  constexpr inline __forceinline __flatten uint8 nibble_swap(uint8 val)
+  {
+    return uint8((val << 4) | (val >> 4));
+  }
+
+  constexpr inline __forceinline __flatten uint16 fmul(uint8 val0, uint8 val1)
+  {
+    return uint16((uint16(val0) * val1) << 1);
+  }
+
+  constexpr inline __forceinline __flatten int16 fmuls(int8 val0, int8 val1)
+  {
+    return int16((int16(val0) * val1) << 1);
+  }
+
+  constexpr inline __forceinline __flatten int16 fmulsu(int8 val0, uint8 val1)
+  {
+    return int16((int16(val0) * val1) << 1);
+  }
+
+  constexpr inline __forceinline __flatten void delay_cycles(arg_type<uint32>) {}
+
+  constexpr inline __forceinline __flatten uint8 insert_bits(arg_type<uint32> map, uint8 bits, uint8 val)
+  {
+    uint8 result = 0;
+    for (uint8 i = 0; i < 8; ++i)
+    {
+      const uint8 sel = uint8((map >> (i * 4)) & 0xF);
+      const bool bit = (sel == 0xF) ? bool(val & (1 << i)) : bool(bits & (1 << sel));
+      result |= uint8(bit) << i;
+    }
+    return result;
+  }
+}
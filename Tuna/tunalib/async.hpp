@@ -26,6 +26,8 @@ namespace Tuna
     }
     inline __forceinline __flatten ~critical_section()
     {
+      // Restoring SREG is no barrier in itself: keep what the section covers inside it.
+      __memorybarrier;
       SREG = m_sReg;
     }
   };
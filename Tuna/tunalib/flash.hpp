@@ -5,27 +5,37 @@ class __FlashStringHelper;
 
 namespace Tuna
 {
+#if __harvard
+  using pgm_ptr_t = uint16; // TODO handle > 16-bit ptrs
+#else
+  using pgm_ptr_t = __UINTPTR_TYPE__;
+#endif
+
   template <typename T>
   struct flash_ptr final
   {
-    using ptr_t = uint16; // TODO handle > 16-bit ptrs
+    using ptr_t = pgm_ptr_t;
   private:
-    const uint16  m_Ptr;
+    const ptr_t  m_Ptr;
   public:
-    constexpr __forceinline __flatten flash_ptr(arg_type<T> value) : m_Ptr(uint16(&value)) {}
+    constexpr __forceinline __flatten flash_ptr(arg_type<T> value) : m_Ptr(ptr_t(&value)) {}
 
-    constexpr inline __forceinline __flatten operator uint16 () const __restrict
+    constexpr inline __forceinline __flatten operator ptr_t () const __restrict
     {
       return m_Ptr;
     }
   };
 
   template <typename U>
-  static inline __forceinline __flatten U read_pgm_ptr(uint16 ptr)
+  static inline __forceinline __flatten U read_pgm_ptr(pgm_ptr_t ptr)
   {
     U retValue;// = pgm_read_word(ptr);
                //return retValue;
 
+#if !__harvard
+    // Program memory is ordinary memory.
+    __builtin_memcpy(&retValue, (const void *)ptr, sizeof(U));
+#else
     if constexpr (sizeof(U) == 1)
     {
       __asm__
@@ -192,19 +202,20 @@ namespace Tuna
         );
       }
     }
+#endif
     return retValue;
   }
 
   template <typename U, typename T>
   static inline __forceinline __flatten U read_pgm(arg_type<flash_ptr<T>> value)
   {
-    return read_pgm_ptr<U>(uint16(value));
+    return read_pgm_ptr<U>(pgm_ptr_t(value));
   }
 
   template <typename U, typename T>
   static inline __forceinline __flatten U read_pgm(arg_type<T> value)
   {
-    return read_pgm_ptr<U>(uint16(&value));
+    return read_pgm_ptr<U>(pgm_ptr_t(&value));
   }
 
 
@@ -442,12 +453,12 @@ namespace Tuna
     }
 
     // This implicit conversion exists for Arduino SDK support.
-    constexpr __forceinline __flatten operator const __FlashStringHelper * __restrict () const __restrict
+    inline __forceinline __flatten operator const __FlashStringHelper * __restrict () const __restrict
     {
       return (const __FlashStringHelper * __restrict)m_Str;
     }
 
-    constexpr __forceinline __flatten auto fsh() const __restrict
+    inline __forceinline __flatten auto fsh() const __restrict
     {
       return (const __FlashStringHelper * __restrict)m_Str;
     }
@@ -501,12 +512,12 @@ namespace Tuna
     }
 
     // This implicit conversion exists for Arduino SDK support.
-    constexpr __forceinline __flatten operator const __FlashStringHelper * __restrict () const __restrict
+    inline __forceinline __flatten operator const __FlashStringHelper * __restrict () const __restrict
     {
       return (const __FlashStringHelper * __restrict)m_Str;
     }
 
-    constexpr __forceinline __flatten auto fsh() const __restrict
+    inline __forceinline __flatten auto fsh() const __restrict
     {
       return (const __FlashStringHelper * __restrict)m_Str;
     }
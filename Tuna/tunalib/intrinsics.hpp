@@ -1,7 +1,11 @@
 #pragma once
 
 // TODO add other platforms.
-#include "arch/avr.hpp"
+#if __arch_avr
+# include "arch/avr.hpp"
+#else
+# include "arch/host.hpp"
+#endif
 
 namespace Tuna::intrinsic
 {
@@ -6,8 +6,18 @@
 // These are macros for this file. They will be used to populate constexpr values for regular code, and will be #undef'd
 // outside of those contexts.
 
+// Which architecture are we building for? AVR is the firmware target; anything else is treated as a host build
+// (the motion simulator in /Simulator), where registers are emulated and program memory is ordinary memory.
+#if defined(__AVR__) || __INTELLISENSE__
+# define __arch_avr 1
+# define __arch_host 0
+#else
+# define __arch_avr 0
+# define __arch_host 1
+#endif
+
 // Is the architecture a Harvard architecture?
-#define __harvard 1
+#define __harvard __arch_avr
 
 // Is the architecture a von Neumann architecture?
 #define __von_neumann (!__harvard)
@@ -27,7 +37,12 @@
 // Marks that this location in code is unreachable.
 #define __unreachable __builtin_unreachable()
 // Marks that the compiler can assume that it is guaranteed that the provided condition is true.
-#define __assume(c) { if (!(c)) { __unreachable; } }
+// A host build (the simulator) can define __checked_assume to have the condition checked instead.
+#if defined(__checked_assume)
+# define __assume(c) { if (!(c)) { __assume_failed(#c, __FILE__, __LINE__); } }
+#else
+# define __assume(c) { if (!(c)) { __unreachable; } }
+#endif
 // Marks that the given branch is likely.
 #define __likely(c) (__builtin_expect(c, true))
 // Marks that the given branch is unlikely.
@@ -122,9 +137,15 @@
 # define __memorybarrier 0
 #endif //!__compiling
 
+#if __arch_avr
 // Marks the function as a signal handler. Equivalent to __interrupt except on AVR, where 'sei' is not emitted.
-#define __signal(name) extern "C" void __attribute__((signal, used, externally_visible)) __forceinline __flatten name ## _vect(void)
+# define __signal(name) extern "C" void __attribute__((signal, used, externally_visible)) __forceinline __flatten name ## _vect(void)
 // Marks the function as an interrupt handler.
-#define __interrupt(name) extern "C" void __attribute__((interrupt, used, externally_visible)) __forceinline __flatten name ## _vect(void)
+# define __interrupt(name) extern "C" void __attribute__((interrupt, used, externally_visible)) __forceinline __flatten name ## _vect(void)
+#else
+// On host builds, vectors are ordinary functions which the simulator calls directly.
+# define __signal(name) extern "C" void __attribute__((used)) __flatten name ## _vect(void)
+# define __interrupt(name) extern "C" void __attribute__((used)) __flatten name ## _vect(void)
+#endif
 
 // TODO leaf, maybe
@@ -25,6 +25,31 @@ namespace Tuna
 #endif
 	}
 
+  // Integer square root, rounded down. Shift-and-subtract, so there are no multiplies or divides.
+  constexpr inline __forceinline __flatten uint32 isqrt(uint32 value)
+  {
+    uint32 result = 0;
+    uint32 bit = 1_u32 << 30;
+    while (bit > value)
+    {
+      bit >>= 2;
+    }
+    while (bit != 0)
+    {
+      if (value >= result + bit)
+      {
+        value -= result + bit;
+        result = (result >> 1) + bit;
+      }
+      else
+      {
+        result >>= 1;
+      }
+      bit >>= 2;
+    }
+    return result;
+  }
+
   template <typename T>
   constexpr inline __forceinline __flatten T round(arg_type<float> value)
   {
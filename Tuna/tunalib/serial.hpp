@@ -11,6 +11,70 @@
 
 namespace Tuna
 {
+  // The USART0 settings HardwareSerial::begin picks for a baud rate at F_CPU, and how far the rate they make is off.
+  struct baud_rate final : trait::ce_only
+  {
+    // The most a rate may be off, in tenths of a percent. An 8N1 frame tolerates about 4% between the two ends, and
+    // the datasheet recommends 2% at the receiver; 115200 is 2.1% fast at 16 MHz, and has always worked.
+    constexpr static const int32 max_error = 25;
+
+    // Double speed, unless the divisor would not fit, or for 57600 at 16 MHz, which the bootloader sets without it.
+    constexpr static inline bool u2x(const uint32 baud)
+    {
+      return !(F_CPU == 16000000UL && baud == 57600) && (F_CPU / 4 / baud - 1) / 2 <= 4095;
+    }
+
+    constexpr static inline uint32 ubrr(const uint32 baud)
+    {
+      return u2x(baud) ? (F_CPU / 4 / baud - 1) / 2 : (F_CPU / 8 / baud - 1) / 2;
+    }
+
+    // The rate the USART makes.
+    constexpr static inline uint32 actual(const uint32 baud)
+    {
+      return F_CPU / ((u2x(baud) ? 8 : 16) * (ubrr(baud) + 1));
+    }
+
+    // How far that is off, in tenths of a percent.
+    constexpr static inline int32 error(const uint32 baud)
+    {
+      return (int32(actual(baud)) - int32(baud)) * 1000 / int32(baud);
+    }
+
+    constexpr static inline bool usable(const uint32 baud)
+    {
+      return baud && ubrr(baud) <= 4095 && error(baud) <= max_error && error(baud) >= -max_error;
+    }
+
+    // A rate the firmware is built for, checked as it is instantiated.
+    template <uint32 baud>
+    struct checked final : trait::ce_only
+    {
+      static_assert(usable(baud), "The USART is more than 2.5% off this baud rate at this F_CPU; see baud_rate::max_error.");
+      constexpr static const uint32 value = baud;
+    };
+
+    // The rates BAUDRATE may be, and M938 can switch to.
+    constexpr static inline bool supported(const uint32 baud)
+    {
+      switch (baud)
+      {
+      case checked<2400>::value:
+      case checked<9600>::value:
+      case checked<19200>::value:
+      case checked<38400>::value:
+      case checked<57600>::value:
+      case checked<115200>::value:
+      case checked<250000>::value:
+      case checked<500000>::value:
+      case checked<1000000>::value:
+        return true;
+      default:
+        return false;
+      }
+    }
+  };
+
   template <uint8 SerialNumber = 0>
   struct serial final : trait::ce_only
   {
@@ -42,7 +106,7 @@ namespace Tuna
     template <uint32 baud>
     static inline __forceinline __flatten void begin()
     {
-      get_serial_device().begin(baud);
+      get_serial_device().begin(baud_rate::checked<baud>::value);
     }
 
     template <typename T>
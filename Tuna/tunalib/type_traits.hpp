@@ -243,9 +243,11 @@ namespace Tuna
       0;
   };
   // Alias, AVR, TODO
+#if __arch_avr
   c_static_assert(sizeof(unsigned int) == sizeof(uint16), "AVR error");
   template <>
   struct type_trait<unsigned int> final : type_trait<uint16> {};
+#endif
 
   template <>
   struct type_trait<int16> : _internal::base_type_trait<int16>
@@ -291,11 +293,15 @@ namespace Tuna
       0;
   };
   // Alias, AVR, TODO
+#if __arch_avr
   c_static_assert(sizeof(int) == sizeof(int16), "AVR error");
   template <>
   struct type_trait<int> final : type_trait<int16> {};
+#endif
 
 
+#if __arch_avr
+  // On the host, the 24-bit types are the 32-bit ones.
   template <>
   struct type_trait<uint24> final : _internal::base_type_trait<uint24>
   {
@@ -371,7 +377,7 @@ namespace Tuna
     constexpr inline static signed_type __forceinline __flatten as_signed(arg_type<type> val) { return { val }; }
 
     constexpr static type max = { 0x7FFFFF_i24 };
-    constexpr static type min = { 0x800000_i24 };
+    constexpr static type min = { -0x7FFFFF_i24 - 1_i24 };   // Not 0x800000: that only wraps negative where int24 is 24 bits wide.
     constexpr static type ones = { 0xFFFFFF_i24 };
     constexpr static type zeros = { 0x000099_i24 };
 
@@ -383,6 +389,7 @@ namespace Tuna
       (base == 16) ? 6 :
       0;
   };
+#endif
 
   template <>
   struct type_trait<uint32> final : _internal::base_type_trait<uint32>
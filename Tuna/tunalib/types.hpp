@@ -1,5 +1,7 @@
 #pragma once
 
+#include <stdint.h>
+
 namespace Tuna
 {
   // A few definitions just to help Intellisense along.
@@ -10,6 +12,7 @@ namespace Tuna
   // ~Intellisense
 
   // TODO everything that's not AVR8
+#if __arch_avr
   using uint8 = unsigned char;
   using uint16 = unsigned short;
   using uint24 = __uint24;
@@ -21,6 +24,22 @@ namespace Tuna
   using int24 = __int24;
   using int32 = signed long;
   using int64 = signed long long;
+#else
+  // Host (LP64) builds. The 32-bit types are 32 bits wide, so they wrap where they do on AVR. There is no native 24-bit
+  // type: the 24-bit types are the 32-bit ones, and have no trait specializations or overloads of their own. Values
+  // behave identically as long as they do not rely upon wraparound at 24 bits.
+  using uint8 = unsigned char;
+  using uint16 = unsigned short;
+  using uint32 = uint32_t;
+  using uint24 = uint32;
+  using uint64 = unsigned long long;
+
+  using int8 = signed char;
+  using int16 = signed short;
+  using int32 = int32_t;
+  using int24 = int32;
+  using int64 = signed long long;
+#endif
 
   using uint = uint16;
 
@@ -32,6 +51,7 @@ namespace Tuna
   using user_real = long double;
 
   // sanity checks
+#if __arch_avr
   c_static_assert(sizeof(uint8) == 1);
   c_static_assert(sizeof(int8) == 1);
   c_static_assert(sizeof(uint16) == 2);
@@ -55,6 +75,10 @@ namespace Tuna
   c_static_assert(alignof(int64) == 1);
 
   c_static_assert(sizeof(int) == 2, "atmega int is 2 bytes. Utils need to be rewritten for other sizes.");
+#else
+  c_static_assert(sizeof(uint32) == 4);
+  c_static_assert(sizeof(int32) == 4);
+#endif
 
   namespace _internal
   {